@@ -1242,8 +1242,10 @@ m4_include([m4/libcnotify.m4])
 m4_include([m4/libcpath.m4])
 m4_include([m4/libcrypto.m4])
 m4_include([m4/libcsplit.m4])
+m4_include([m4/libcthreads.m4])
 m4_include([m4/libcstring.m4])
 m4_include([m4/libcsystem.m4])
+m4_include([m4/libdeflate.m4])
 m4_include([m4/libfcache.m4])
 m4_include([m4/libfuse.m4])
 m4_include([m4/libfvalue.m4])
@@ -382,6 +382,9 @@
 /* Define to 1 if the local version of libcsystem is used. */
 #define HAVE_LOCAL_LIBCSYSTEM 1
 
+/* Define to 1 if the local version of libcthreads is used. */
+#define HAVE_LOCAL_LIBCTHREADS 1
+
 /* Define to 1 if the local version of libfcache is used. */
 #define HAVE_LOCAL_LIBFCACHE 1
 
@@ -443,6 +446,9 @@
 /* Define to 1 if you have the `mktime' function. */
 #define HAVE_MKTIME 1
 
+/* Define to 1 if multi thread support should be used. */
+#define HAVE_MULTI_THREAD_SUPPORT 1
+
 /* Define to 1 if you have the `nl_langinfo' function. */
 #define HAVE_NL_LANGINFO 1
 
@@ -476,6 +482,12 @@
 /* Define to 1 whether printf supports the conversion specifier "%zd". */
 #define HAVE_PRINTF_ZD 1
 
+/* Define to 1 if you have the `pthread' library (-lpthread). */
+#define HAVE_PTHREAD 1
+
+/* Define to 1 if you have the <pthread.h> header file. */
+#define HAVE_PTHREAD_H 1
+
 /* Define to 1 if you have Python */
 /* #undef HAVE_PYTHON */
 
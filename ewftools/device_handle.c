@@ -567,6 +567,25 @@ int device_handle_open_smdev_input(
 
 		goto on_error;
 	}
+#if defined( HAVE_LOCAL_LIBSMDEV )
+	if( device_handle->drop_cached_data != 0 )
+	{
+		if( libsmdev_handle_set_drop_cached_data(
+		     device_handle->smdev_input_handle,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set drop cached data in device input handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
 #if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
 	if( libsmdev_handle_open_wide(
 	     device_handle->smdev_input_handle,
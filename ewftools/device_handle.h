@@ -112,6 +112,11 @@ struct device_handle
 	 */
 	uint8_t zero_buffer_on_error;
 
+	/* Value to indicate the data read from the device should be dropped
+	 * from the system page cache
+	 */
+	uint8_t drop_cached_data;
+
 	/* The nofication output stream
 	 */
 	FILE *notify_stream;
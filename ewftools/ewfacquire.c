@@ -41,6 +41,7 @@
 #include "imaging_handle.h"
 #include "log_handle.h"
 #include "process_status.h"
+#include "process_threads.h"
 #include "storage_media_buffer.h"
 
 #if defined( __BORLANDC__ ) && ( __BORLANDC__ < 0x0560 )
@@ -112,12 +113,12 @@ void ewfacquire_usage_fprint(
 	                 "                  [ -B number_of_bytes ] [ -c compression_values ]\n"
 	                 "                  [ -C case_number ] [ -d digest_type ] [ -D description ]\n"
 	                 "                  [ -e examiner_name ] [ -E evidence_number ] [ -f format ]\n"
-	                 "                  [ -g number_of_sectors ] [ -l log_filename ]\n"
+	                 "                  [ -g number_of_sectors ] [ -j jobs ] [ -l log_filename ]\n"
 	                 "                  [ -m media_type ] [ -M media_flags ] [ -N notes ]\n"
 	                 "                  [ -o offset ] [ -p process_buffer_size ]\n"
 	                 "                  [ -P bytes_per_sector ] [ -r read_error_retries ]\n"
 	                 "                  [ -S segment_file_size ] [ -t target ] [ -T toc_file ]\n"
-	                 "                  [ -2 secondary_target ] [ -hqRsuvVw ] source\n\n" );
+	                 "                  [ -2 secondary_target ] [ -hqRsuvVwW ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file(s) or device\n\n" );
 
@@ -146,6 +147,10 @@ void ewfacquire_usage_fprint(
 	                 "\t        encase7, encase7-v2, linen5, linen6, linen7, ewfx\n" );
 	fprintf( stream, "\t-g      specify the number of sectors to be used as error granularity\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     specify the number of concurrent processing jobs (threads) used\n"
+	                 "\t        to compress the chunks, options: 0 (default) to %d\n"
+	                 "\t        (0 represents that the chunks are compressed by the main thread)\n",
+	 IMAGING_HANDLE_MAXIMUM_NUMBER_OF_THREADS );
 	fprintf( stream, "\t-l:     logs acquiry errors and the digest (hash) to the log_filename\n" );
 	fprintf( stream, "\t-m:     specify the media type, options: fixed (default), removable,\n"
 	                 "\t        optical, memory\n" );
@@ -190,6 +195,9 @@ void ewfacquire_usage_fprint(
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 	fprintf( stream, "\t-w:     zero sectors on read error (mimic EnCase like behavior)\n" );
+	fprintf( stream, "\t-W:     drop the data read from the device and the written segment\n"
+	                 "\t        file data from the system page cache (use this to prevent\n"
+	                 "\t        the acquiry from filling the cache)\n" );
 	fprintf( stream, "\t-2:     specify the secondary target file (without extension) to write\n"
 	                 "\t        to\n" );
 }
@@ -573,6 +581,7 @@ int ewfacquire_read_input(
 	ssize_t process_count                        = 0;
 	ssize_t write_count                          = 0;
 	uint32_t chunk_size                          = 0;
+	uint8_t storage_media_buffer_mode            = 0;
 	int number_of_read_errors                    = 0;
 	int read_error_iterator                      = 0;
 	int status                                   = PROCESS_STATUS_COMPLETED;
@@ -734,19 +743,33 @@ int ewfacquire_read_input(
 		goto on_error;
 	}
 #if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-	process_buffer_size = (size_t) chunk_size;
+	storage_media_buffer_mode = STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA;
+	process_buffer_size       = (size_t) chunk_size;
 #else
-	if( imaging_handle->process_buffer_size == 0 )
+	/* The process threads operate on chunks
+	 */
+	if( imaging_handle->number_of_threads > 0 )
 	{
-		process_buffer_size = (size_t) chunk_size;
+		storage_media_buffer_mode = STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA;
+		process_buffer_size       = (size_t) chunk_size;
 	}
 	else
 	{
-		process_buffer_size = imaging_handle->process_buffer_size;
+		storage_media_buffer_mode = STORAGE_MEDIA_BUFFER_MODE_BUFFERED;
+
+		if( imaging_handle->process_buffer_size == 0 )
+		{
+			process_buffer_size = (size_t) chunk_size;
+		}
+		else
+		{
+			process_buffer_size = imaging_handle->process_buffer_size;
+		}
 	}
 #endif
 	if( storage_media_buffer_initialize(
 	     &storage_media_buffer,
+	     storage_media_buffer_mode,
 	     process_buffer_size,
 	     error ) != 1 )
 	{
@@ -805,6 +828,71 @@ int ewfacquire_read_input(
 	}
 	while( acquiry_count < (size64_t) imaging_handle->acquiry_size )
 	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		/* The first chunk is written by the main thread so that the write values
+		 * of the output handle are initialized before the process threads start
+		 * A resumed acquiry is not processed by threads since preparing a chunk
+		 * for writing then depends on the current offset of the output handle
+		 */
+		if( ( imaging_handle->number_of_threads > 0 )
+		 && ( imaging_handle->process_threads == NULL )
+		 && ( resume_acquiry_offset == 0 )
+		 && ( acquiry_count > 0 ) )
+		{
+			if( storage_media_buffer_free(
+			     &storage_media_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free storage media buffer.",
+				 function );
+
+				goto on_error;
+			}
+			if( imaging_handle_threads_start(
+			     imaging_handle,
+			     process_buffer_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to start threads.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( imaging_handle->process_threads != NULL )
+		{
+			/* An error in one of the threads is returned when the threads are stopped
+			 */
+			if( ( imaging_handle->abort != 0 )
+			 || ( process_threads_has_error(
+			       imaging_handle->process_threads ) != 0 ) )
+			{
+				break;
+			}
+			if( process_threads_get_storage_media_buffer(
+			     imaging_handle->process_threads,
+			     &storage_media_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve storage media buffer.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
 		read_size = process_buffer_size;
 
 		if( ( (size64_t) imaging_handle->acquiry_size - acquiry_count ) < (size64_t) read_size )
@@ -841,9 +929,7 @@ int ewfacquire_read_input(
 
 				goto on_error;
 			}
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
 			storage_media_buffer->data_in_compression_buffer = 0;
-#endif
 			storage_media_buffer->raw_buffer_data_size = (size_t) read_count;
 
 			/* Swap byte pairs
@@ -934,14 +1020,12 @@ int ewfacquire_read_input(
 			}
 			read_count = process_count;
 
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
 			/* Set the chunk data size in the compression buffer
 			 */
 			if( storage_media_buffer->data_in_compression_buffer == 1 )
 			{
 				storage_media_buffer->compression_buffer_data_size = (size_t) process_count;
 			}
-#endif
 		}
 		/* Digest hashes are calcultated after swap
 		 */
@@ -977,38 +1061,63 @@ int ewfacquire_read_input(
 		}
 		if( (off64_t) acquiry_count >= resume_acquiry_offset )
 		{
-			process_count = imaging_handle_prepare_write_buffer(
-					 imaging_handle,
-					 storage_media_buffer,
-					 error );
-
-			if( process_count < 0 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			if( imaging_handle->process_threads != NULL )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				"%s: unable to prepare buffer before write.",
-				 function );
+				storage_media_buffer->storage_media_offset = (off64_t) acquiry_count;
 
-				goto on_error;
-			}
-			write_count = imaging_handle_write_buffer(
-				       imaging_handle,
-				       storage_media_buffer,
-				       process_count,
-				       error );
+				if( process_threads_push_storage_media_buffer(
+				     imaging_handle->process_threads,
+				     storage_media_buffer,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to process storage media buffer.",
+					 function );
 
-			if( write_count < 0 )
+					goto on_error;
+				}
+				storage_media_buffer = NULL;
+			}
+			else
+#endif
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write data to file.",
-				 function );
+				process_count = imaging_handle_prepare_write_buffer(
+						 imaging_handle,
+						 storage_media_buffer,
+						 error );
 
-				goto on_error;
+				if( process_count < 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					"%s: unable to prepare buffer before write.",
+					 function );
+
+					goto on_error;
+				}
+				write_count = imaging_handle_write_buffer(
+					       imaging_handle,
+					       storage_media_buffer,
+					       process_count,
+					       error );
+
+				if( write_count < 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write data to file.",
+					 function );
+
+					goto on_error;
+				}
 			}
 		}
 		acquiry_count += read_count;
@@ -1033,6 +1142,24 @@ int ewfacquire_read_input(
 			break;
 		}
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( imaging_handle->process_threads != NULL )
+	{
+		if( imaging_handle_threads_stop(
+		     imaging_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to stop threads.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
 	if( storage_media_buffer_free(
 	     &storage_media_buffer,
 	     error ) != 1 )
@@ -1192,6 +1319,20 @@ int ewfacquire_read_input(
 
 			goto on_error;
 		}
+		if( imaging_handle_print_zero_run_statistics(
+		     imaging_handle,
+		     imaging_handle->notify_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print zero run statistics.",
+			 function );
+
+			goto on_error;
+		}
 		if( log_handle != NULL )
 		{
 			if( device_handle_read_errors_fprint(
@@ -1222,6 +1363,20 @@ int ewfacquire_read_input(
 
 				goto on_error;
 			}
+			if( imaging_handle_print_zero_run_statistics(
+			     imaging_handle,
+			     log_handle->log_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print zero run statistics in log handle.",
+				 function );
+
+				goto on_error;
+			}
 		}
 	}
 	return( 1 );
@@ -1244,6 +1399,14 @@ on_error:
 		 &storage_media_buffer,
 		 NULL );
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( imaging_handle->process_threads != NULL )
+	{
+		imaging_handle_threads_stop(
+		 imaging_handle,
+		 NULL );
+	}
+#endif
 	return( -1 );
 }
 
@@ -1275,6 +1438,7 @@ int main( int argc, char * const argv[] )
 	libcstring_system_character_t *option_media_flags               = NULL;
 	libcstring_system_character_t *option_media_type                = NULL;
 	libcstring_system_character_t *option_notes                     = NULL;
+	libcstring_system_character_t *option_number_of_jobs            = NULL;
 	libcstring_system_character_t *option_number_of_error_retries   = NULL;
 	libcstring_system_character_t *option_offset                    = NULL;
 	libcstring_system_character_t *option_process_buffer_size       = NULL;
@@ -1293,6 +1457,7 @@ int main( int argc, char * const argv[] )
 	off64_t resume_acquiry_offset                                   = 0;
 	size_t string_length                                            = 0;
 	uint8_t calculate_md5                                           = 1;
+	uint8_t drop_cached_data                                        = 0;
 	uint8_t print_status_information                                = 1;
 	uint8_t resume_acquiry                                          = 0;
 	uint8_t swap_byte_pairs                                         = 0;
@@ -1335,7 +1500,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = libcsystem_getopt(
 	                   argc,
 	                   argv,
-	                   _LIBCSTRING_SYSTEM_STRING( "A:b:B:c:C:d:D:e:E:f:g:hl:m:M:N:o:p:P:qr:RsS:t:T:uvVw2:" ) ) ) != (libcstring_system_integer_t) -1 )
+	                   _LIBCSTRING_SYSTEM_STRING( "A:b:B:c:C:d:D:e:E:f:g:hj:l:m:M:N:o:p:P:qr:RsS:t:T:uvVwW2:" ) ) ) != (libcstring_system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -1420,6 +1585,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (libcstring_system_integer_t) 'j':
+				option_number_of_jobs = optarg;
+
+				break;
+
 			case (libcstring_system_integer_t) 'l':
 				log_filename = optarg;
 
@@ -1515,6 +1685,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (libcstring_system_integer_t) 'W':
+				drop_cached_data = 1;
+
+				break;
+
 			case (libcstring_system_integer_t) '2':
 				option_secondary_target_filename = optarg;
 
@@ -1639,6 +1814,10 @@ int main( int argc, char * const argv[] )
 	{
 		ewfacquire_device_handle->zero_buffer_on_error = 1;
 	}
+	if( drop_cached_data != 0 )
+	{
+		ewfacquire_device_handle->drop_cached_data = 1;
+	}
 	/* Open the input file or device size
 	 */
 	if( device_handle_open_input(
@@ -2123,6 +2302,42 @@ int main( int argc, char * const argv[] )
 			 "Unsupported process buffer size defaulting to: chunk size.\n" );
 		}
 	}
+	if( option_number_of_jobs != NULL )
+	{
+		result = imaging_handle_set_number_of_threads(
+			  ewfacquire_imaging_handle,
+			  option_number_of_jobs,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of jobs (threads).\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of jobs (threads) defaulting to: 0.\n" );
+		}
+	}
+	if( drop_cached_data != 0 )
+	{
+		if( imaging_handle_set_drop_cached_data(
+		     ewfacquire_imaging_handle,
+		     drop_cached_data,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set drop cached data.\n" );
+
+			goto on_error;
+		}
+	}
 	if( option_additional_digest_types != NULL )
 	{
 		result = imaging_handle_set_additional_digest_types(
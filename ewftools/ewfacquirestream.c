@@ -480,6 +480,7 @@ int ewfacquirestream_read_input(
 	ssize_t read_count                           = 0;
 	ssize_t process_count                        = 0;
 	ssize_t write_count                          = 0;
+	uint8_t storage_media_buffer_mode            = 0;
 	int status                                   = PROCESS_STATUS_COMPLETED;
 
 	if( imaging_handle == NULL )
@@ -543,8 +544,11 @@ int ewfacquirestream_read_input(
 		return( -1 );
 	}
 #if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-	process_buffer_size = (size_t) chunk_size;
+	storage_media_buffer_mode = STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA;
+	process_buffer_size       = (size_t) chunk_size;
 #else
+	storage_media_buffer_mode = STORAGE_MEDIA_BUFFER_MODE_BUFFERED;
+
 	if( imaging_handle->process_buffer_size == 0 )
 	{
 		process_buffer_size = (size_t) chunk_size;
@@ -556,6 +560,7 @@ int ewfacquirestream_read_input(
 #endif
 	if( storage_media_buffer_initialize(
 	     &storage_media_buffer,
+	     storage_media_buffer_mode,
 	     process_buffer_size,
 	     error ) != 1 )
 	{
@@ -866,6 +871,20 @@ int ewfacquirestream_read_input(
 
 			goto on_error;
 		}
+		if( imaging_handle_print_zero_run_statistics(
+		     imaging_handle,
+		     imaging_handle->notify_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print zero run statistics.",
+			 function );
+
+			goto on_error;
+		}
 		if( log_handle != NULL )
 		{
 			if( imaging_handle_print_hashes(
@@ -882,6 +901,20 @@ int ewfacquirestream_read_input(
 
 				goto on_error;
 			}
+			if( imaging_handle_print_zero_run_statistics(
+			     imaging_handle,
+			     log_handle->log_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print zero run statistics in log handle.",
+				 function );
+
+				goto on_error;
+			}
 		}
 	}
 	return( 1 );
@@ -106,9 +106,10 @@ void usage_fprint(
 
 	fprintf( stream, "Usage: ewfexport [ -A codepage ] [ -b number_of_sectors ]\n"
 	                 "                 [ -B number_of_bytes ] [ -c compression_values ]\n"
-	                 "                 [ -d digest_type ] [ -f format ] [ -l log_filename ]\n"
-	                 "                 [ -o offset ] [ -p process_buffer_size ]\n"
-	                 "                 [ -S segment_file_size ] [ -t target ] [ -hqsuvVw ] ewf_files\n\n" );
+	                 "                 [ -d digest_type ] [ -f format ] [ -j jobs ]\n"
+	                 "                 [ -l log_filename ] [ -o offset ]\n"
+	                 "                 [ -p process_buffer_size ] [ -r read_ahead ]\n"
+	                 "                 [ -S segment_file_size ] [ -t target ] [ -hmqsuvVw ] ewf_files\n\n" );
 
 	fprintf( stream, "\tewf_files: the first or the entire set of EWF segment files\n\n" );
 
@@ -134,10 +135,22 @@ void usage_fprint(
 	                 "\t           smart, encase1, encase2, encase3, encase4, encase5, encase6,\n"
 	                 "\t           encase7, encase7-v2, linen5, linen6, linen7, ewfx\n" );
 	fprintf( stream, "\t-h:        shows this help\n" );
+	fprintf( stream, "\t-j:        specify the number of concurrent processing jobs (threads)\n"
+	                 "\t           used to decompress and compress the chunks, options: 0\n"
+	                 "\t           (default) to %d (0 represents that the chunks are processed\n"
+	                 "\t           by the main thread) (not used for files format)\n",
+	 EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS );
 	fprintf( stream, "\t-l:        logs export errors and the digest (hash) to the log_filename\n" );
+	fprintf( stream, "\t-m:        memory map the input segment files, uncompressed chunks are\n"
+	                 "\t           read directly from the mapping (an IO error while reading\n"
+	                 "\t           the mapped data terminates the program)\n" );
 	fprintf( stream, "\t-o:        specify the offset to start the export (default is 0)\n" );
 	fprintf( stream, "\t-p:        specify the process buffer size (default is the chunk size)\n" );
 	fprintf( stream, "\t-q:        quiet shows minimal status information\n" );
+	fprintf( stream, "\t-r:        specify the number of chunks to read ahead in the background,\n"
+	                 "\t           options: 0 (default) to %d (0 represents that read-ahead\n"
+	                 "\t           is disabled)\n",
+	 EXPORT_HANDLE_MAXIMUM_NUMBER_OF_READ_AHEAD_CHUNKS );
 	fprintf( stream, "\t-s:        swap byte pairs of the media data (from AB to BA)\n"
 	                 "\t           (use this for big to little endian conversion and vice\n"
 	                 "\t           versa)\n" );
@@ -241,8 +254,10 @@ int main( int argc, char * const argv[] )
 	libcstring_system_character_t *option_format                  = NULL;
 	libcstring_system_character_t *option_header_codepage         = NULL;
 	libcstring_system_character_t *option_maximum_segment_size    = NULL;
+	libcstring_system_character_t *option_number_of_jobs          = NULL;
 	libcstring_system_character_t *option_offset                  = NULL;
 	libcstring_system_character_t *option_process_buffer_size     = NULL;
+	libcstring_system_character_t *option_read_ahead              = NULL;
 	libcstring_system_character_t *option_sectors_per_chunk       = NULL;
 	libcstring_system_character_t *option_size                    = NULL;
 	libcstring_system_character_t *option_target_path             = NULL;
@@ -255,6 +270,7 @@ int main( int argc, char * const argv[] )
 	uint8_t calculate_md5                                         = 1;
 	uint8_t print_status_information                              = 1;
 	uint8_t swap_byte_pairs                                       = 0;
+	uint8_t use_memory_map                                        = 0;
 	uint8_t verbose                                               = 0;
 	uint8_t zero_chunk_on_error                                   = 0;
 	int interactive_mode                                          = 1;
@@ -318,7 +334,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = libcsystem_getopt(
 	                   argc,
 	                   argv,
-	                   _LIBCSTRING_SYSTEM_STRING( "A:b:B:c:d:f:hl:o:p:qsS:t:uvVw" ) ) ) != (libcstring_system_integer_t) -1 )
+	                   _LIBCSTRING_SYSTEM_STRING( "A:b:B:c:d:f:hj:l:mo:p:qr:sS:t:uvVw" ) ) ) != (libcstring_system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -378,11 +394,21 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (libcstring_system_integer_t) 'j':
+				option_number_of_jobs = optarg;
+
+				break;
+
 			case (libcstring_system_integer_t) 'l':
 				log_filename = optarg;
 
 				break;
 
+			case (libcstring_system_integer_t) 'm':
+				use_memory_map = 1;
+
+				break;
+
 			case (libcstring_system_integer_t) 'o':
 				option_offset = optarg;
 
@@ -398,6 +424,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (libcstring_system_integer_t) 'r':
+				option_read_ahead = optarg;
+
+				break;
+
 			case (libcstring_system_integer_t) 's':
 				swap_byte_pairs = 1;
 
@@ -539,6 +570,39 @@ int main( int argc, char * const argv[] )
 		goto on_error;
 	}
 #endif
+	if( option_read_ahead != NULL )
+	{
+		result = export_handle_set_number_of_read_ahead_chunks(
+			  ewfexport_export_handle,
+			  option_read_ahead,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of read-ahead chunks.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of read-ahead chunks defaulting to: 0.\n" );
+		}
+	}
+	if( export_handle_set_use_memory_map(
+	     ewfexport_export_handle,
+	     use_memory_map,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set use memory map.\n" );
+
+		goto on_error;
+	}
 	if( libcsystem_signal_attach(
 	     ewfexport_signal_handler,
 	     &error ) != 1 )
@@ -800,6 +864,28 @@ int main( int argc, char * const argv[] )
 			 "Unsupported process buffer size defaulting to: chunk size.\n" );
 		}
 	}
+	if( option_number_of_jobs != NULL )
+	{
+		result = export_handle_set_number_of_threads(
+			  ewfexport_export_handle,
+			  option_number_of_jobs,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of jobs (threads).\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of jobs (threads) defaulting to: 0.\n" );
+		}
+	}
 	if( option_additional_digest_types != NULL )
 	{
 		result = export_handle_set_additional_digest_types(
@@ -72,8 +72,14 @@
 #include "ewftools_libcstring.h"
 #include "ewftools_libcsystem.h"
 #include "ewftools_libewf.h"
+#include "mount_file_entry.h"
 #include "mount_handle.h"
 
+/* The read-ahead size, which corresponds to the maximum size
+ * of the read requests issued by the sub system
+ */
+#define EWFMOUNT_READ_AHEAD_SIZE	( 128 * 1024 )
+
 mount_handle_t *ewfmount_mount_handle = NULL;
 int ewfmount_abort                    = 0;
 
@@ -89,15 +95,20 @@ void usage_fprint(
 	fprintf( stream, "Use ewfmount to mount the EWF format (Expert Witness\n"
                          "Compression Format)\n\n" );
 
-	fprintf( stream, "Usage: ewfmount [ -f format ] [ -X extended_options ] [ -hvV ]\n"
-	                 "                ewf_files mount_point\n\n" );
+	fprintf( stream, "Usage: ewfmount [ -c cache_size ] [ -f format ] [ -j jobs ]\n"
+	                 "                [ -X extended_options ] [ -hvV ] ewf_files mount_point\n\n" );
 
 	fprintf( stream, "\tewf_files:   the first or the entire set of EWF segment files\n\n" );
 	fprintf( stream, "\tmount_point: the directory to serve as mount point\n\n" );
 
+	fprintf( stream, "\t-c:          specify the maximum size of the chunk cache in MiB\n"
+	                 "\t             the size is divided over the jobs\n" );
 	fprintf( stream, "\t-f:          specify the input format, options: raw (default),\n"
 	                 "\t             files (restricted to logical volume files)\n" );
 	fprintf( stream, "\t-h:          shows this help\n" );
+	fprintf( stream, "\t-j:          specify the number of concurrent jobs (or threads) used\n"
+	                 "\t             to handle requests, default is %d\n",
+	                 MOUNT_HANDLE_DEFAULT_NUMBER_OF_THREADS );
 	fprintf( stream, "\t-v:          verbose output to stderr\n"
 	                 "\t             ewfmount will remain running in the foreground\n" );
 	fprintf( stream, "\t-V:          print version\n" );
@@ -159,11 +170,11 @@ int ewfmount_fuse_open(
      const char *path,
      struct fuse_file_info *file_info )
 {
-	libcerror_error_t *error        = NULL;
-	libewf_file_entry_t *file_entry = NULL;
-	static char *function           = "ewfmount_fuse_open";
-	size_t path_length              = 0;
-	int result                      = 0;
+	libcerror_error_t *error             = NULL;
+	mount_file_entry_t *mount_file_entry = NULL;
+	static char *function                = "ewfmount_fuse_open";
+	size_t path_length                   = 0;
+	int result                           = 0;
 
 	if( path == NULL )
 	{
@@ -196,11 +207,11 @@ int ewfmount_fuse_open(
 
 	if( ewfmount_mount_handle->input_format == MOUNT_HANDLE_INPUT_FORMAT_FILES )
 	{
-		if( mount_handle_get_file_entry_by_path(
+		if( mount_handle_get_mount_file_entry_by_path(
 		     ewfmount_mount_handle,
 		     path,
 		     path_length,
-		     &file_entry,
+		     &mount_file_entry,
 		     &error ) != 1 )
 		{
 			libcerror_error_set(
@@ -213,21 +224,6 @@ int ewfmount_fuse_open(
 
 			result = -ENOENT;
 
-			goto on_error;
-		}
-		if( libewf_file_entry_free(
-		     &file_entry,
-		     &error ) != 1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file entry.",
-			 function );
-
-			result = -EIO;
-
 			goto on_error;
 		}
 	}
@@ -276,6 +272,11 @@ int ewfmount_fuse_open(
 
 		goto on_error;
 	}
+	/* The file entry is resolved once and kept open for the reads of the open file
+	 * it is closed when the file is released
+	 */
+	file_info->fh = (uint64_t) (intptr_t) mount_file_entry;
+
 	return( 0 );
 
 on_error:
@@ -286,9 +287,72 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( mount_file_entry != NULL )
+	{
+		mount_file_entry_close(
+		 mount_file_entry,
+		 NULL );
+	}
 	return( result );
 }
 
+/* Releases a file
+ * Returns 0 if successful or a negative errno value otherwise
+ */
+int ewfmount_fuse_release(
+     const char *path LIBCSYSTEM_ATTRIBUTE_UNUSED,
+     struct fuse_file_info *file_info )
+{
+	libcerror_error_t *error             = NULL;
+	mount_file_entry_t *mount_file_entry = NULL;
+	static char *function                = "ewfmount_fuse_release";
+
+	LIBCSYSTEM_UNREFERENCED_PARAMETER( path )
+
+	if( file_info == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file info.",
+		 function );
+
+		goto on_error;
+	}
+	mount_file_entry = (mount_file_entry_t *) (intptr_t) file_info->fh;
+
+	if( mount_file_entry != NULL )
+	{
+		file_info->fh = 0;
+
+		if( mount_file_entry_close(
+		     mount_file_entry,
+		     &error ) != 0 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 0 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( -EIO );
+}
+
 /* Reads a buffer of data at the specified offset
  * Returns number of bytes read if successful or a negative errno value otherwise
  */
@@ -297,16 +361,15 @@ int ewfmount_fuse_read(
      char *buffer,
      size_t size,
      off_t offset,
-     struct fuse_file_info *file_info LIBCSYSTEM_ATTRIBUTE_UNUSED )
+     struct fuse_file_info *file_info )
 {
-	libcerror_error_t *error        = NULL;
-	libewf_file_entry_t *file_entry = NULL;
-	static char *function           = "ewfmount_fuse_read";
-	size_t path_length              = 0;
-	ssize_t read_count              = 0;
-	int result                      = 0;
-
-	LIBCSYSTEM_UNREFERENCED_PARAMETER( file_info )
+	libcerror_error_t *error             = NULL;
+	mount_file_entry_t *mount_file_entry = NULL;
+	static char *function                = "ewfmount_fuse_read";
+	size_t path_length                   = 0;
+	ssize_t read_count                   = 0;
+	uint8_t close_file_entry             = 0;
+	int result                           = 0;
 
 	if( path == NULL )
 	{
@@ -339,46 +402,38 @@ int ewfmount_fuse_read(
 
 	if( ewfmount_mount_handle->input_format == MOUNT_HANDLE_INPUT_FORMAT_FILES )
 	{
-		if( mount_handle_get_file_entry_by_path(
-		     ewfmount_mount_handle,
-		     path,
-		     path_length,
-		     &file_entry,
-		     &error ) != 1 )
+		if( file_info != NULL )
 		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve file entry for: %s.",
-			 function,
-			 path );
-
-			result = -ENOENT;
-
-			goto on_error;
+			mount_file_entry = (mount_file_entry_t *) (intptr_t) file_info->fh;
 		}
-		if( libewf_file_entry_seek_offset(
-		     file_entry,
-		     (off64_t) offset,
-		     SEEK_SET,
-		     &error ) == -1 )
+		if( mount_file_entry == NULL )
 		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_SEEK_FAILED,
-			 "%s: unable to seek offset in file entry.",
-			 function );
+			if( mount_handle_get_mount_file_entry_by_path(
+			     ewfmount_mount_handle,
+			     path,
+			     path_length,
+			     &mount_file_entry,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve file entry for: %s.",
+				 function,
+				 path );
 
-			result = -EIO;
+				result = -ENOENT;
 
-			goto on_error;
+				goto on_error;
+			}
+			close_file_entry = 1;
 		}
-		read_count = libewf_file_entry_read_buffer(
-			      file_entry,
+		read_count = mount_file_entry_read_buffer_at_offset(
+			      mount_file_entry,
 			      (uint8_t *) buffer,
 			      size,
+			      (off64_t) offset,
 			      &error );
 
 		if( read_count == -1 )
@@ -394,20 +449,25 @@ int ewfmount_fuse_read(
 
 			goto on_error;
 		}
-		if( libewf_file_entry_free(
-		     &file_entry,
-		     &error ) != 1 )
+		if( close_file_entry != 0 )
 		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file entry.",
-			 function );
+			close_file_entry = 0;
 
-			result = -EIO;
+			if( mount_file_entry_close(
+			     mount_file_entry,
+			     &error ) != 0 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file entry.",
+				 function );
 
-			goto on_error;
+				result = -EIO;
+
+				goto on_error;
+			}
 		}
 	}
 	else if( ewfmount_mount_handle->input_format == MOUNT_HANDLE_INPUT_FORMAT_RAW )
@@ -441,27 +501,11 @@ int ewfmount_fuse_read(
 
 			goto on_error;
 		}
-		if( mount_handle_seek_offset(
-		     ewfmount_mount_handle,
-		     (off64_t) offset,
-		     SEEK_SET,
-		     &error ) == -1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_SEEK_FAILED,
-			 "%s: unable to seek offset in mount handle.",
-			 function );
-
-			result = -EIO;
-
-			goto on_error;
-		}
-		read_count = mount_handle_read_buffer(
+		read_count = mount_handle_read_buffer_at_offset(
 			      ewfmount_mount_handle,
 			      (uint8_t *) buffer,
 			      size,
+			      (off64_t) offset,
 			      &error );
 
 		if( read_count == -1 )
@@ -488,9 +532,78 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( close_file_entry != 0 )
+	{
+		mount_file_entry_close(
+		 mount_file_entry,
+		 NULL );
+	}
 	return( result );
 }
 
+/* Sets the values of the file stat info from a mount file entry
+ * Returns 1 if successful or -1 on error
+ */
+int ewfmount_fuse_set_stat_info(
+     struct stat *stat_info,
+     mount_file_entry_t *mount_file_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "ewfmount_fuse_set_stat_info";
+
+	if( stat_info == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stat info.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount file entry.",
+		 function );
+
+		return( -1 );
+	}
+#if SIZEOF_OFF_T == 4
+	if( mount_file_entry->size > (size64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid to file entry size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( mount_file_entry->number_of_sub_file_entries == 0 )
+	{
+		stat_info->st_mode = S_IFREG | 0444;
+	}
+	else
+	{
+		stat_info->st_mode = S_IFDIR | 0555;
+	}
+	stat_info->st_ino   = (ino_t) mount_file_entry->inode_number;
+	stat_info->st_nlink = 1;
+	stat_info->st_size  = (off_t) mount_file_entry->size;
+	stat_info->st_mtime = mount_file_entry->modification_time;
+	stat_info->st_atime = mount_file_entry->access_time;
+	stat_info->st_ctime = mount_file_entry->entry_modification_time;
+
+	return( 1 );
+}
+
 /* Reads a directory
  * Returns 0 if successful or a negative errno value otherwise
  */
@@ -501,17 +614,17 @@ int ewfmount_fuse_readdir(
      off_t offset LIBCSYSTEM_ATTRIBUTE_UNUSED,
      struct fuse_file_info *file_info LIBCSYSTEM_ATTRIBUTE_UNUSED )
 {
-	libcerror_error_t *error            = NULL;
-	libewf_file_entry_t *file_entry     = NULL;
-	libewf_file_entry_t *sub_file_entry = NULL;
-	char *name                          = NULL;
-	static char *function               = "ewfmount_fuse_readdir";
-	size_t name_index                   = 0;
-	size_t name_size                    = 0;
-	size_t path_length                  = 0;
-	int number_of_sub_file_entries      = 0;
-	int result                          = 0;
-	int sub_file_entry_index            = 0;
+	struct stat stat_info;
+
+	libcerror_error_t *error                    = NULL;
+	mount_file_entry_t **sub_mount_file_entries = NULL;
+	mount_file_entry_t *mount_file_entry        = NULL;
+	mount_file_entry_t *sub_mount_file_entry    = NULL;
+	static char *function                       = "ewfmount_fuse_readdir";
+	size_t path_length                          = 0;
+	int number_of_sub_file_entries              = 0;
+	int sub_file_entry_index                    = 0;
+	int result                                  = 0;
 
 	LIBCSYSTEM_UNREFERENCED_PARAMETER( offset )
 	LIBCSYSTEM_UNREFERENCED_PARAMETER( file_info )
@@ -534,11 +647,11 @@ int ewfmount_fuse_readdir(
 
 	if( ewfmount_mount_handle->input_format == MOUNT_HANDLE_INPUT_FORMAT_FILES )
 	{
-		if( mount_handle_get_file_entry_by_path(
+		if( mount_handle_get_mount_file_entry_by_path(
 		     ewfmount_mount_handle,
 		     path,
 		     path_length,
-		     &file_entry,
+		     &mount_file_entry,
 		     &error ) != 1 )
 		{
 			libcerror_error_set(
@@ -605,179 +718,119 @@ int ewfmount_fuse_readdir(
 
 		goto on_error;
 	}
-	if( ewfmount_mount_handle->input_format == MOUNT_HANDLE_INPUT_FORMAT_FILES )
-	{
-		if( libewf_file_entry_get_number_of_sub_file_entries(
-		     file_entry,
-		     &number_of_sub_file_entries,
-		     &error ) != 1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of sub file entries.",
-			 function );
-
-			result = -EIO;
-
-			goto on_error;
-		}
-		for( sub_file_entry_index = 0;
-		     sub_file_entry_index < number_of_sub_file_entries;
-		     sub_file_entry_index++ )
-		{
-			if( libewf_file_entry_get_sub_file_entry(
-			     file_entry,
-			     sub_file_entry_index,
-			     &sub_file_entry,
-			     &error ) != 1 )
-			{
-				libcerror_error_set(
-				 &error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to free retrieve sub file entry: %d.",
-				 function,
-				 sub_file_entry_index );
-
-				result = -EIO;
-
-				goto on_error;
-			}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libewf_file_entry_get_utf16_name_size(
-				  sub_file_entry,
-				  &name_size,
-				  &error );
-#else
-			result = libewf_file_entry_get_utf8_name_size(
-				  sub_file_entry,
-				  &name_size,
-				  &error );
-#endif
-			if( result != 1 )
-			{
-				libcerror_error_set(
-				 &error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve the sub file entry name size.",
-				 function );
-
-				result = -EIO;
-
-				goto on_error;
-			}
-			if( name_size > 0 )
-			{
-				name = libcstring_system_string_allocate(
-					name_size );
-
-				if( name == NULL )
-				{
-					libcerror_error_set(
-					 &error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-					 "%s: unable to create sub file entry name.",
-					 function );
-
-					result = -EIO;
-
-					goto on_error;
-				}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-				result = libewf_file_entry_get_utf16_name(
-					  sub_file_entry,
-					  (uint16_t *) name,
-					  name_size,
-					  &error );
-#else
-				result = libewf_file_entry_get_utf8_name(
-					  sub_file_entry,
-					  (uint8_t *) name,
-					  name_size,
-					  &error );
-#endif
-				if( result != 1 )
-				{
-					libcerror_error_set(
-					 &error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve the sub file entry name.",
-					 function );
-
-					result = -EIO;
-
-					goto on_error;
-				}
-				/* Exchange / for \
-				 */
-				for( name_index = 0;
-				     name_index < name_size;
-				     name_index++ )
-				{
-					if( name[ name_index ] == (libcstring_system_character_t) '/' )
-					{
-						 name[ name_index ] = (libcstring_system_character_t) '\\';
-					}
-				}
-				if( filler(
-				     buffer,
-				     name,
-				     NULL,
-				     0 ) == 1 )
-				{
-					libcerror_error_set(
-					 &error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set directory entry.",
-					 function );
+	if( ewfmount_mount_handle->input_format == MOUNT_HANDLE_INPUT_FORMAT_FILES )
+	{
+		if( mount_handle_get_sub_mount_file_entries(
+		     ewfmount_mount_handle,
+		     mount_file_entry,
+		     &sub_mount_file_entries,
+		     &number_of_sub_file_entries,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entries.",
+			 function );
 
-					result = -EIO;
+			result = -EIO;
 
-					goto on_error;
-				}
-				memory_free(
-				 name );
+			goto on_error;
+		}
+		for( sub_file_entry_index = 0;
+		     sub_file_entry_index < number_of_sub_file_entries;
+		     sub_file_entry_index++ )
+		{
+			sub_mount_file_entry = sub_mount_file_entries[ sub_file_entry_index ];
 
-				name = NULL;
+			if( memory_set(
+			     &stat_info,
+			     0,
+			     sizeof( struct stat ) ) == NULL )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear stat info.",
+				 function );
+
+				result = -EIO;
+
+				goto on_error;
 			}
-			if( libewf_file_entry_free(
-			     &sub_file_entry,
+			if( ewfmount_fuse_set_stat_info(
+			     &stat_info,
+			     sub_mount_file_entry,
 			     &error ) != 1 )
 			{
 				libcerror_error_set(
 				 &error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free sub file entry: %d.",
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set stat info of sub file entry: %d.",
 				 function,
 				 sub_file_entry_index );
 
 				result = -EIO;
 
+				goto on_error;
+			}
+			if( filler(
+			     buffer,
+			     &( sub_mount_file_entry->path[ sub_mount_file_entry->name_index ] ),
+			     &stat_info,
+			     0 ) == 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set directory entry.",
+				 function );
+
+				result = -EIO;
+
 				goto on_error;
 			}
 		}
-		if( libewf_file_entry_free(
-		     &file_entry,
+		sub_mount_file_entries = NULL;
+
+		if( mount_handle_close_sub_mount_file_entries(
+		     ewfmount_mount_handle,
+		     mount_file_entry,
 		     &error ) != 1 )
 		{
 			libcerror_error_set(
 			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file entry.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close sub file entries.",
+			 function );
+
+			result = -EIO;
+
+			goto on_error;
+		}
+		if( mount_file_entry_close(
+		     mount_file_entry,
+		     &error ) != 0 )
+		{
+			mount_file_entry = NULL;
+
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file entry.",
 			 function );
 
 			result = -EIO;
 
 			goto on_error;
 		}
+		mount_file_entry = NULL;
 	}
 	else if( ewfmount_mount_handle->input_format == MOUNT_HANDLE_INPUT_FORMAT_RAW )
 	{
@@ -809,21 +862,17 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( name != NULL )
-	{
-		memory_free(
-		 name );
-	}
-	if( sub_file_entry != NULL )
+	if( sub_mount_file_entries != NULL )
 	{
-		libewf_file_entry_free(
-		 &sub_file_entry,
+		mount_handle_close_sub_mount_file_entries(
+		 ewfmount_mount_handle,
+		 mount_file_entry,
 		 NULL );
 	}
-	if( file_entry != NULL )
+	if( mount_file_entry != NULL )
 	{
-		libewf_file_entry_free(
-		 &file_entry,
+		mount_file_entry_close(
+		 mount_file_entry,
 		 NULL );
 	}
 	return( result );
@@ -836,17 +885,15 @@ int ewfmount_fuse_getattr(
      const char *path,
      struct stat *stat_info )
 {
-	libcerror_error_t *error        = NULL;
-	libewf_file_entry_t *file_entry = NULL;
-	static char *function           = "ewfmount_fuse_getattr";
-	size64_t file_size              = 0;
-	size_t path_length              = 0;
-	uint32_t value_32bit            = 0;
-	int number_of_sub_file_entries  = 0;
-	int result                      = -ENOENT;
+	libcerror_error_t *error             = NULL;
+	mount_file_entry_t *mount_file_entry = NULL;
+	static char *function                = "ewfmount_fuse_getattr";
+	size64_t file_size                   = 0;
+	size_t path_length                   = 0;
+	int result                           = -ENOENT;
 
 #if defined( HAVE_TIME )
-	time_t timestamp                = 0;
+	time_t timestamp                     = 0;
 #endif
 
 	if( path == NULL )
@@ -899,6 +946,7 @@ int ewfmount_fuse_getattr(
 		if( path[ 0 ] == '/' )
 		{
 			stat_info->st_mode  = S_IFDIR | 0755;
+			stat_info->st_ino   = 1;
 			stat_info->st_nlink = 2;
 
 			result = 0;
@@ -906,11 +954,11 @@ int ewfmount_fuse_getattr(
 	}
 	else if( ewfmount_mount_handle->input_format == MOUNT_HANDLE_INPUT_FORMAT_FILES )
 	{
-		result = mount_handle_get_file_entry_by_path(
+		result = mount_handle_get_mount_file_entry_by_path(
 		          ewfmount_mount_handle,
 		          path,
 		          path_length,
-		          &file_entry,
+		          &mount_file_entry,
 		          &error );
 
 		if( result == -1 )
@@ -929,136 +977,47 @@ int ewfmount_fuse_getattr(
 		}
 		else if( result == 1 )
 		{
-			if( libewf_file_entry_get_number_of_sub_file_entries(
-			     file_entry,
-			     &number_of_sub_file_entries,
-			     &error ) != 1 )
-			{
-				libcerror_error_set(
-				 &error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve number of sub file entries.",
-				 function );
-
-				result = -EIO;
-
-				goto on_error;
-			}
-			if( number_of_sub_file_entries == 0 )
-			{
-				stat_info->st_mode = S_IFREG | 0444;
-			}
-			else
-			{
-				stat_info->st_mode = S_IFDIR | 0555;
-			}
-			stat_info->st_nlink = 1;
-
-			if( libewf_file_entry_get_size(
-			     file_entry,
-			     &file_size,
+			if( ewfmount_fuse_set_stat_info(
+			     stat_info,
+			     mount_file_entry,
 			     &error ) != 1 )
 			{
 				libcerror_error_set(
 				 &error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve file entry size.",
-				 function );
-
-				result = -EIO;
-
-				goto on_error;
-			}
-#if SIZEOF_OFF_T == 4
-			if( file_size > (size64_t) UINT32_MAX )
-			{
-				libcerror_error_set(
-				 &error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid to file entry size value out of bounds.",
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set stat info.",
 				 function );
 
 				result = -ERANGE;
 
 				goto on_error;
 			}
-#endif
-			stat_info->st_size = (off_t) file_size;
-
-			if( libewf_file_entry_get_modification_time(
-			     file_entry,
-			     &value_32bit,
-			     &error ) != 1 )
-			{
-				libcerror_error_set(
-				 &error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve file entry modification time.",
-				 function );
-
-				result = -EIO;
-
-				goto on_error;
-			}
-			stat_info->st_mtime = value_32bit;
-
-			if( libewf_file_entry_get_access_time(
-			     file_entry,
-			     &value_32bit,
-			     &error ) != 1 )
+			if( mount_file_entry_close(
+			     mount_file_entry,
+			     &error ) != 0 )
 			{
-				libcerror_error_set(
-				 &error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve file entry access time.",
-				 function );
-
-				result = -EIO;
-
-				goto on_error;
-			}
-			stat_info->st_atime = value_32bit;
+				mount_file_entry = NULL;
 
-			if( libewf_file_entry_get_entry_modification_time(
-			     file_entry,
-			     &value_32bit,
-			     &error ) != 1 )
-			{
 				libcerror_error_set(
 				 &error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve file entry entry modification time.",
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file entry.",
 				 function );
 
 				result = -EIO;
 
 				goto on_error;
 			}
-			stat_info->st_ctime = value_32bit;
-
-			if( libewf_file_entry_free(
-			     &file_entry,
-			     &error ) != 1 )
-			{
-				libcerror_error_set(
-				 &error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free file entry.",
-				 function );
+			mount_file_entry = NULL;
 
-				result = -EIO;
-
-				goto on_error;
-			}
 			result = 0;
 		}
+		else
+		{
+			result = -ENOENT;
+		}
 	}
 	else if( ewfmount_mount_handle->input_format == MOUNT_HANDLE_INPUT_FORMAT_RAW )
 	{
@@ -1070,6 +1029,7 @@ int ewfmount_fuse_getattr(
 			     ewfmount_fuse_path_length ) == 0 )
 			{
 				stat_info->st_mode  = S_IFREG | 0444;
+				stat_info->st_ino   = 2;
 				stat_info->st_nlink = 1;
 
 				if( mount_handle_get_media_size(
@@ -1144,10 +1104,10 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( file_entry != NULL )
+	if( mount_file_entry != NULL )
 	{
-		libewf_file_entry_free(
-		 &file_entry,
+		mount_file_entry_close(
+		 mount_file_entry,
 		 NULL );
 	}
 	return( result );
@@ -1545,27 +1505,11 @@ int ewfmount_dokan_ReadFile(
 
 			goto on_error;
 		}
-		if( mount_handle_seek_offset(
-		     ewfmount_mount_handle,
-		     (off64_t) offset,
-		     SEEK_SET,
-		     &error ) == -1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_SEEK_FAILED,
-			 "%s: unable to seek offset in mount handle.",
-			 function );
-
-			result = -ERROR_SEEK_ON_DEVICE;
-
-			goto on_error;
-		}
-		read_count = mount_handle_read_buffer(
+		read_count = mount_handle_read_buffer_at_offset(
 			      ewfmount_mount_handle,
 			      (uint8_t *) buffer,
 			      (size_t) number_of_bytes_to_read,
+			      (off64_t) offset,
 			      &error );
 
 		if( read_count == -1 )
@@ -1973,8 +1917,10 @@ int main( int argc, char * const argv[] )
 	libcstring_system_character_t * const *argv_filenames  = NULL;
 
 	libewf_error_t *error                                  = NULL;
+	libcstring_system_character_t *option_cache_size       = NULL;
 	libcstring_system_character_t *option_extended_options = NULL;
 	libcstring_system_character_t *option_format           = NULL;
+	libcstring_system_character_t *option_jobs             = NULL;
 	libcstring_system_character_t *mount_point             = NULL;
 	char *program                                          = "ewfmount";
 	libcstring_system_integer_t option                     = 0;
@@ -2037,7 +1983,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = libcsystem_getopt(
 	                   argc,
 	                   argv,
-	                   _LIBCSTRING_SYSTEM_STRING( "f:hvVX:" ) ) ) != (libcstring_system_integer_t) -1 )
+	                   _LIBCSTRING_SYSTEM_STRING( "c:f:hj:vVX:" ) ) ) != (libcstring_system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -2053,6 +1999,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (libcstring_system_integer_t) 'c':
+				option_cache_size = optarg;
+
+				break;
+
 			case (libcstring_system_integer_t) 'f':
 				option_format = optarg;
 
@@ -2064,6 +2015,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (libcstring_system_integer_t) 'j':
+				option_jobs = optarg;
+
+				break;
+
 			case (libcstring_system_integer_t) 'v':
 				verbose = 1;
 
@@ -2179,6 +2135,51 @@ int main( int argc, char * const argv[] )
 			 "Unsupported input format defaulting to: raw.\n" );
 		}
 	}
+	if( option_jobs != NULL )
+	{
+		result = mount_handle_set_number_of_threads(
+			  ewfmount_mount_handle,
+			  option_jobs,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of jobs.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of jobs defaulting to: %d.\n",
+			 ewfmount_mount_handle->number_of_threads );
+		}
+	}
+	if( option_cache_size != NULL )
+	{
+		result = mount_handle_set_maximum_cache_size(
+			  ewfmount_mount_handle,
+			  option_cache_size,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set cache size.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported cache size defaulting to: default.\n" );
+		}
+	}
 #if defined( HAVE_GETRLIMIT )
 	if( getrlimit(
             RLIMIT_NOFILE,
@@ -2220,6 +2221,17 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( mount_handle_set_read_ahead_size(
+	     ewfmount_mount_handle,
+	     EWFMOUNT_READ_AHEAD_SIZE,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set read-ahead size.\n" );
+
+		goto on_error;
+	}
 #if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBOSXFUSE )
 	if( memory_set(
 	     &ewfmount_fuse_operations,
@@ -2232,7 +2244,8 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( option_extended_options != NULL )
+	if( ( option_extended_options != NULL )
+	 || ( ewfmount_mount_handle->input_format == MOUNT_HANDLE_INPUT_FORMAT_FILES ) )
 	{
 		/* This argument is required but ignored
 		 */
@@ -2246,6 +2259,9 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
+	}
+	if( option_extended_options != NULL )
+	{
 		if( fuse_opt_add_arg(
 		     &ewfmount_fuse_arguments,
 		     "-o" ) != 0 )
@@ -2267,7 +2283,33 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( ewfmount_mount_handle->input_format == MOUNT_HANDLE_INPUT_FORMAT_FILES )
+	{
+		/* Report the inode numbers of the file entries
+		 */
+		if( fuse_opt_add_arg(
+		     &ewfmount_fuse_arguments,
+		     "-o" ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable add fuse arguments.\n" );
+
+			goto on_error;
+		}
+		if( fuse_opt_add_arg(
+		     &ewfmount_fuse_arguments,
+		     "use_ino" ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable add fuse arguments.\n" );
+
+			goto on_error;
+		}
+	}
 	ewfmount_fuse_operations.open    = &ewfmount_fuse_open;
+	ewfmount_fuse_operations.release = &ewfmount_fuse_release;
 	ewfmount_fuse_operations.read    = &ewfmount_fuse_read;
 	ewfmount_fuse_operations.readdir = &ewfmount_fuse_readdir;
 	ewfmount_fuse_operations.getattr = &ewfmount_fuse_getattr;
@@ -2312,8 +2354,16 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
-	result = fuse_loop(
-	          ewfmount_fuse_handle );
+	if( ewfmount_mount_handle->number_of_threads > 1 )
+	{
+		result = fuse_loop_mt(
+		          ewfmount_fuse_handle );
+	}
+	else
+	{
+		result = fuse_loop(
+		          ewfmount_fuse_handle );
+	}
 
 	if( result != 0 )
 	{
@@ -2355,7 +2405,7 @@ int main( int argc, char * const argv[] )
 		goto on_error;
 	}
 	ewfmount_dokan_options.Version     = 600;
-	ewfmount_dokan_options.ThreadCount = 1;
+	ewfmount_dokan_options.ThreadCount = (USHORT) ewfmount_mount_handle->number_of_threads;
 
 	DokanMain(
 	 &ewfmount_dokan_options,
@@ -60,8 +60,9 @@ void usage_fprint(
 	                 "Compression Format).\n\n" );
 
 	fprintf( stream, "Usage: ewfverify [ -A codepage ] [ -d digest_type ] [ -f format ]\n"
-	                 "                 [ -l log_filename ] [ -p process_buffer_size ]\n"
-	                 "                 [ -hqvVw ] ewf_files\n\n" );
+	                 "                 [ -j jobs ] [ -l log_filename ]\n"
+	                 "                 [ -p process_buffer_size ] [ -r read_ahead ]\n"
+	                 "                 [ -hmqvVw ] ewf_files\n\n" );
 
 	fprintf( stream, "\tewf_files: the first or the entire set of EWF segment files\n\n" );
 
@@ -75,10 +76,22 @@ void usage_fprint(
 	fprintf( stream, "\t-f:        specify the input format, options: raw (default),\n"
 	                 "\t           files (restricted to logical volume files)\n" );
 	fprintf( stream, "\t-h:        shows this help\n" );
+	fprintf( stream, "\t-j:        specify the number of concurrent processing jobs (threads)\n"
+	                 "\t           used to decompress and validate the chunks, options: 0\n"
+	                 "\t           (default) to %d (0 represents that the chunks are processed\n"
+	                 "\t           by the main thread)\n",
+	 VERIFICATION_HANDLE_MAXIMUM_NUMBER_OF_THREADS );
 	fprintf( stream, "\t-l:        logs verification errors and the digest (hash) to the\n"
 	                 "\t           log_filename\n" );
+	fprintf( stream, "\t-m:        memory map the input segment files, uncompressed chunks are\n"
+	                 "\t           read directly from the mapping (an IO error while reading\n"
+	                 "\t           the mapped data terminates the program)\n" );
 	fprintf( stream, "\t-p:        specify the process buffer size (default is the chunk size)\n" );
 	fprintf( stream, "\t-q:        quiet shows minimal status information\n" );
+	fprintf( stream, "\t-r:        specify the number of chunks to read ahead in the background,\n"
+	                 "\t           options: 0 (default) to %d (0 represents that read-ahead\n"
+	                 "\t           is disabled)\n",
+	 VERIFICATION_HANDLE_MAXIMUM_NUMBER_OF_READ_AHEAD_CHUNKS );
 	fprintf( stream, "\t-v:        verbose output to stderr\n" );
 	fprintf( stream, "\t-V:        print version\n" );
 	fprintf( stream, "\t-w:        zero sectors on checksum error (mimic EnCase like behavior)\n" );
@@ -147,13 +160,16 @@ int main( int argc, char * const argv[] )
 	libcstring_system_character_t *option_additional_digest_types = NULL;
 	libcstring_system_character_t *option_format                  = NULL;
 	libcstring_system_character_t *option_header_codepage         = NULL;
+	libcstring_system_character_t *option_number_of_jobs          = NULL;
 	libcstring_system_character_t *option_process_buffer_size     = NULL;
+	libcstring_system_character_t *option_read_ahead              = NULL;
 
 	log_handle_t *log_handle                                      = NULL;
 
 	libcstring_system_integer_t option                            = 0;
 	uint8_t calculate_md5                                         = 1;
 	uint8_t print_status_information                              = 1;
+	uint8_t use_memory_map                                        = 0;
 	uint8_t zero_chunk_on_error                                   = 0;
 	uint8_t verbose                                               = 0;
 	int number_of_filenames                                       = 0;
@@ -192,7 +208,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = libcsystem_getopt(
 	                   argc,
 	                   argv,
-	                   _LIBCSTRING_SYSTEM_STRING( "A:d:f:hl:p:qvVw" ) ) ) != (libcstring_system_integer_t) -1 )
+	                   _LIBCSTRING_SYSTEM_STRING( "A:d:f:hj:l:mp:qr:vVw" ) ) ) != (libcstring_system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -229,11 +245,21 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (libcstring_system_integer_t) 'j':
+				option_number_of_jobs = optarg;
+
+				break;
+
 			case (libcstring_system_integer_t) 'l':
 				log_filename = optarg;
 
 				break;
 
+			case (libcstring_system_integer_t) 'm':
+				use_memory_map = 1;
+
+				break;
+
 			case (libcstring_system_integer_t) 'p':
 				option_process_buffer_size = optarg;
 
@@ -244,6 +270,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (libcstring_system_integer_t) 'r':
+				option_read_ahead = optarg;
+
+				break;
+
 			case (libcstring_system_integer_t) 'v':
 				verbose = 1;
 
@@ -363,6 +394,50 @@ int main( int argc, char * const argv[] )
 			 "Unsupported process buffer size defaulting to: chunk size.\n" );
 		}
 	}
+	if( option_number_of_jobs != NULL )
+	{
+		result = verification_handle_set_number_of_threads(
+			  ewfverify_verification_handle,
+			  option_number_of_jobs,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of jobs (threads).\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of jobs (threads) defaulting to: 0.\n" );
+		}
+	}
+	if( option_read_ahead != NULL )
+	{
+		result = verification_handle_set_number_of_read_ahead_chunks(
+			  ewfverify_verification_handle,
+			  option_read_ahead,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of read-ahead chunks.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of read-ahead chunks defaulting to: 0.\n" );
+		}
+	}
 	if( option_additional_digest_types != NULL )
 	{
 		result = verification_handle_set_additional_digest_types(
@@ -438,6 +513,17 @@ int main( int argc, char * const argv[] )
 		goto on_error;
 	}
 #endif
+	if( verification_handle_set_use_memory_map(
+	     ewfverify_verification_handle,
+	     use_memory_map,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set use memory map.\n" );
+
+		goto on_error;
+	}
 	if( libcsystem_signal_attach(
 	     ewfverify_signal_handler,
 	     &error ) != 1 )
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
@@ -36,6 +37,7 @@
 #include "ewfinput.h"
 #include "ewftools_libcerror.h"
 #include "ewftools_libcfile.h"
+#include "ewftools_libcnotify.h"
 #include "ewftools_libcpath.h"
 #include "ewftools_libcsplit.h"
 #include "ewftools_libcstring.h"
@@ -45,7 +47,9 @@
 #include "ewftools_libhmac.h"
 #include "export_handle.h"
 #include "guid.h"
+#include "integrity_hash.h"
 #include "process_status.h"
+#include "process_threads.h"
 
 #define EXPORT_HANDLE_BUFFER_SIZE		8192
 #define EXPORT_HANDLE_INPUT_BUFFER_SIZE		64
@@ -236,6 +240,24 @@ int export_handle_free(
 	}
 	if( *export_handle != NULL )
 	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *export_handle )->process_threads != NULL )
+		{
+			if( export_handle_threads_stop(
+			     *export_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to stop threads.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
 		memory_free(
 		 ( *export_handle )->input_buffer );
 
@@ -437,6 +459,44 @@ int export_handle_signal_abort(
 	return( 1 );
 }
 
+/* Sets the value to indicate the input segment files should be memory mapped
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_use_memory_map(
+     export_handle_t *export_handle,
+     uint8_t use_memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_use_memory_map";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_handle_set_use_memory_map(
+	     export_handle->input_handle,
+	     use_memory_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set use memory map in input handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Sets the maximum number of (concurrent) open file handles
  * Returns 1 if successful or -1 on error
  */
@@ -618,6 +678,23 @@ int export_handle_open_input(
 			return( -1 );
 		}
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( export_handle->number_of_read_ahead_chunks > 0 )
+	 && ( libewf_handle_set_read_ahead(
+	       export_handle->input_handle,
+	       export_handle->number_of_read_ahead_chunks,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( libewf_handle_set_header_codepage(
 	     export_handle->input_handle,
 	     export_handle->header_codepage,
@@ -945,91 +1022,84 @@ ssize_t export_handle_prepare_read_buffer(
 
 		return( -1 );
 	}
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-	storage_media_buffer->raw_buffer_data_size = storage_media_buffer->raw_buffer_size;
-
-	process_count = libewf_handle_prepare_read_chunk(
-	                 export_handle->input_handle,
-	                 storage_media_buffer->compression_buffer,
-	                 storage_media_buffer->compression_buffer_data_size,
-	                 storage_media_buffer->raw_buffer,
-	                 &( storage_media_buffer->raw_buffer_data_size ),
-	                 storage_media_buffer->is_compressed,
-	                 storage_media_buffer->checksum,
-	                 storage_media_buffer->process_checksum,
-	                 error );
+	storage_media_buffer->is_corrupted = 0;
 
-	if( process_count == -1 )
+	if( storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
 	{
-		libcerror_error_free(
-		 error );
+		storage_media_buffer->raw_buffer_data_size = storage_media_buffer->raw_buffer_size;
 
-		/* Wipe the chunk if nescessary
-		 */
-		if( export_handle->zero_chunk_on_error != 0 )
+		process_count = libewf_handle_prepare_read_chunk(
+		                 export_handle->input_handle,
+		                 storage_media_buffer->compression_buffer,
+		                 storage_media_buffer->compression_buffer_data_size,
+		                 storage_media_buffer->raw_buffer,
+		                 &( storage_media_buffer->raw_buffer_data_size ),
+		                 storage_media_buffer->is_compressed,
+		                 storage_media_buffer->checksum,
+		                 storage_media_buffer->process_checksum,
+		                 error );
+
+		if( process_count == -1 )
 		{
-			if( ( storage_media_buffer->is_compressed != 0 )
-			 && ( memory_set(
-			       storage_media_buffer->compression_buffer,
-			       0,
-			       storage_media_buffer->compression_buffer_size ) == NULL ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-				 "%s: unable to zero compression buffer.",
-				 function );
+			libcerror_error_free(
+			 error );
 
-				return( -1 );
-			}
-			if( memory_set(
-			     storage_media_buffer->raw_buffer,
-			     0,
-			     storage_media_buffer->raw_buffer_size ) == NULL )
+			/* Wipe the chunk if nescessary
+			 */
+			if( export_handle->zero_chunk_on_error != 0 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-				 "%s: unable to zero raw buffer.",
-				 function );
+				if( ( storage_media_buffer->is_compressed != 0 )
+				 && ( memory_set(
+				       storage_media_buffer->raw_buffer,
+				       0,
+				       storage_media_buffer->raw_buffer_size ) == NULL ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to zero raw buffer.",
+					 function );
 
-				return( -1 );
+					return( -1 );
+				}
+				/* The data of an uncompressed chunk is in the compression buffer
+				 */
+				if( memory_set(
+				     storage_media_buffer->compression_buffer,
+				     0,
+				     storage_media_buffer->compression_buffer_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to zero compression buffer.",
+					 function );
+
+					return( -1 );
+				}
 			}
-		}
-		process_count = export_handle->input_chunk_size;
+			process_count = export_handle->input_chunk_size;
 
-		/* Appends a read error
-		 */
-		if( export_handle_append_read_error(
-		     export_handle,
-		     export_handle->input_offset,
-		     process_count,
-		     error ) != 1 )
+			/* The read error is appended when the storage media buffer is written
+			 * since the buffers can be prepared by multiple threads
+			 */
+			storage_media_buffer->is_corrupted = 1;
+		}
+		if( storage_media_buffer->is_compressed == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append read error.",
-			 function );
-
-			return( -1 );
+			storage_media_buffer->data_in_compression_buffer = 1;
+		}
+		else
+		{
+			storage_media_buffer->data_in_compression_buffer = 0;
 		}
-	}
-	if( storage_media_buffer->is_compressed == 0 )
-	{
-		storage_media_buffer->data_in_compression_buffer = 1;
 	}
 	else
 	{
-		storage_media_buffer->data_in_compression_buffer = 0;
+		process_count = (ssize_t) storage_media_buffer->raw_buffer_data_size;
 	}
-	export_handle->input_offset += process_count;
-#else
-	process_count = (ssize_t) storage_media_buffer->raw_buffer_data_size;
-#endif
 	return( process_count );
 }
 
@@ -1067,24 +1137,26 @@ ssize_t export_handle_read_buffer(
 
 		return( -1 );
 	}
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-	read_count = libewf_handle_read_chunk(
-                      export_handle->input_handle,
-                      storage_media_buffer->compression_buffer,
-                      storage_media_buffer->compression_buffer_size,
-	              &( storage_media_buffer->is_compressed ),
-	              &( storage_media_buffer->compression_buffer[ storage_media_buffer->raw_buffer_size ] ),
-	              &( storage_media_buffer->checksum ),
-	              &( storage_media_buffer->process_checksum ),
-	              error );
-#else
-	read_count = libewf_handle_read_buffer(
-                      export_handle->input_handle,
-                      storage_media_buffer->raw_buffer,
-                      read_size,
-	              error );
-#endif
-
+	if( storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
+	{
+		read_count = libewf_handle_read_chunk(
+		              export_handle->input_handle,
+		              storage_media_buffer->compression_buffer,
+		              storage_media_buffer->compression_buffer_size,
+		              &( storage_media_buffer->is_compressed ),
+		              &( storage_media_buffer->compression_buffer[ storage_media_buffer->raw_buffer_size ] ),
+		              &( storage_media_buffer->checksum ),
+		              &( storage_media_buffer->process_checksum ),
+		              error );
+	}
+	else
+	{
+		read_count = libewf_handle_read_buffer(
+		              export_handle->input_handle,
+		              storage_media_buffer->raw_buffer,
+		              read_size,
+		              error );
+	}
 	if( read_count == -1 )
 	{
 		libcerror_error_set(
@@ -1096,12 +1168,14 @@ ssize_t export_handle_read_buffer(
 
 		return( -1 );
 	}
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-	storage_media_buffer->compression_buffer_data_size = (size_t) read_count;
-#else
-	storage_media_buffer->raw_buffer_data_size         = (size_t) read_count;
-#endif
-
+	if( storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
+	{
+		storage_media_buffer->compression_buffer_data_size = (size_t) read_count;
+	}
+	else
+	{
+		storage_media_buffer->raw_buffer_data_size = (size_t) read_count;
+	}
 	return( read_count );
 }
 
@@ -1151,38 +1225,48 @@ ssize_t export_handle_prepare_write_buffer(
 
 			return( -1 );
 		}
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-		storage_media_buffer->compression_buffer_data_size = storage_media_buffer->compression_buffer_size;
-
-		process_count = libewf_handle_prepare_write_chunk(
-				 export_handle->ewf_output_handle,
-				 storage_media_buffer->raw_buffer,
-				 storage_media_buffer->raw_buffer_data_size,
-				 storage_media_buffer->compression_buffer,
-				 &( storage_media_buffer->compression_buffer_data_size ),
-				 &( storage_media_buffer->is_compressed ),
-				 &( storage_media_buffer->checksum ),
-				 &( storage_media_buffer->process_checksum ),
-				 error );
-
-		if( process_count == -1 )
+		if( storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to prepare storage media buffer before writing.",
-			 function );
+			storage_media_buffer->compression_buffer_data_size = storage_media_buffer->compression_buffer_size;
 
-			return( -1 );
+			process_count = libewf_handle_prepare_write_chunk(
+					 export_handle->ewf_output_handle,
+					 storage_media_buffer->raw_buffer,
+					 storage_media_buffer->raw_buffer_data_size,
+					 storage_media_buffer->compression_buffer,
+					 &( storage_media_buffer->compression_buffer_data_size ),
+					 &( storage_media_buffer->is_compressed ),
+					 &( storage_media_buffer->checksum ),
+					 &( storage_media_buffer->process_checksum ),
+					 error );
+
+			if( process_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to prepare storage media buffer before writing.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			process_count = (ssize_t) storage_media_buffer->raw_buffer_data_size;
 		}
-#else
-		process_count = (ssize_t) storage_media_buffer->raw_buffer_data_size;
-#endif
 	}
 	else if( export_handle->output_format == EXPORT_HANDLE_OUTPUT_FORMAT_RAW )
 	{
-		process_count = (ssize_t) storage_media_buffer->raw_buffer_data_size;
+		if( storage_media_buffer->data_in_compression_buffer == 1 )
+		{
+			process_count = (ssize_t) storage_media_buffer->compression_buffer_data_size;
+		}
+		else
+		{
+			process_count = (ssize_t) storage_media_buffer->raw_buffer_data_size;
+		}
 	}
 	return( process_count );
 }
@@ -1196,13 +1280,13 @@ ssize_t export_handle_write_buffer(
          size_t write_size,
          libcerror_error_t **error )
 {
-	static char *function        = "export_handle_write_buffer";
-	ssize_t write_count          = 0;
-
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
+	uint8_t *checksum_buffer     = NULL;
+	uint8_t *data                = NULL;
 	uint8_t *raw_write_buffer    = NULL;
+	static char *function        = "export_handle_write_buffer";
+	size_t data_size             = 0;
 	size_t raw_write_buffer_size = 0;
-#endif
+	ssize_t write_count          = 0;
 
 	if( export_handle == NULL )
 	{
@@ -1230,6 +1314,21 @@ ssize_t export_handle_write_buffer(
 	{
 		return( 0 );
 	}
+	if( storage_media_buffer_get_data(
+	     storage_media_buffer,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve storage media buffer data.",
+		 function );
+
+		return( -1 );
+	}
 	if( export_handle->output_format == EXPORT_HANDLE_OUTPUT_FORMAT_EWF )
 	{
 		if( export_handle->ewf_output_handle == NULL )
@@ -1243,46 +1342,61 @@ ssize_t export_handle_write_buffer(
 
 			return( -1 );
 		}
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-		if( storage_media_buffer->is_compressed == 0 )
+		if( storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
 		{
-			raw_write_buffer      = storage_media_buffer->raw_buffer;
-			raw_write_buffer_size = storage_media_buffer->raw_buffer_data_size;
+			/* Uncompressed chunk data that is passed through is stored
+			 * in the compression buffer
+			 */
+			if( storage_media_buffer->is_compressed == 0 )
+			{
+				raw_write_buffer      = data;
+				raw_write_buffer_size = data_size;
+
+				if( storage_media_buffer->data_in_compression_buffer == 1 )
+				{
+					checksum_buffer = &( data[ data_size ] );
+				}
+				else
+				{
+					checksum_buffer = storage_media_buffer->checksum_buffer;
+				}
+			}
+			else
+			{
+				raw_write_buffer      = storage_media_buffer->compression_buffer;
+				raw_write_buffer_size = storage_media_buffer->compression_buffer_data_size;
+				checksum_buffer       = storage_media_buffer->checksum_buffer;
+			}
+			if( write_size != raw_write_buffer_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: mismatch in write size and number of bytes in storage media buffer.",
+				 function );
+
+				return( -1 );
+			}
+			write_count = libewf_handle_write_chunk(
+				       export_handle->ewf_output_handle,
+				       raw_write_buffer,
+				       raw_write_buffer_size,
+				       data_size,
+				       storage_media_buffer->is_compressed,
+				       checksum_buffer,
+				       storage_media_buffer->checksum,
+				       storage_media_buffer->process_checksum,
+				       error );
 		}
 		else
 		{
-			raw_write_buffer      = storage_media_buffer->compression_buffer;
-			raw_write_buffer_size = storage_media_buffer->compression_buffer_data_size;
-		}
-		if( write_size != raw_write_buffer_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: mismatch in write size and number of bytes in storage media buffer.",
-			 function );
-
-			return( -1 );
+			write_count = libewf_handle_write_buffer(
+				       export_handle->ewf_output_handle,
+				       storage_media_buffer->raw_buffer,
+				       write_size,
+				       error );
 		}
-		write_count = libewf_handle_write_chunk(
-			       export_handle->ewf_output_handle,
-			       raw_write_buffer,
-			       raw_write_buffer_size,
-			       storage_media_buffer->raw_buffer_data_size,
-			       storage_media_buffer->is_compressed,
-			       storage_media_buffer->checksum_buffer,
-			       storage_media_buffer->checksum,
-			       storage_media_buffer->process_checksum,
-			       error );
-#else
-		write_count = libewf_handle_write_buffer(
-			       export_handle->ewf_output_handle,
-			       storage_media_buffer->raw_buffer,
-			       write_size,
-			       error );
-#endif
-
 		if( write_count == -1 )
 		{
 			libcerror_error_set(
@@ -1301,14 +1415,14 @@ ssize_t export_handle_write_buffer(
 		{
 			write_count = libcsystem_file_io_write(
 			               1,
-				       storage_media_buffer->raw_buffer,
+				       data,
 				       write_size );
 		}
 		else
 		{
 			write_count = libsmraw_handle_write_buffer(
 				       export_handle->raw_output_handle,
-				       storage_media_buffer->raw_buffer,
+				       data,
 				       write_size,
 				       error );
 		}
@@ -1327,15 +1441,22 @@ ssize_t export_handle_write_buffer(
 	return( write_count );
 }
 
-/* Seeks the offset
- * Returns the resulting offset or -1 on error
+/* Prepares a storage media buffer that was read from the input for writing to the output
+ * This decompresses the chunk data, validates its checksum, swaps the byte pairs if necessary
+ * and compresses the chunk data for the output
+ * The process count of the buffer must contain the number of bytes requested to be read
+ * and is set to the number of bytes to write afterwards
+ * Returns 1 if successful or -1 on error
  */
-off64_t export_handle_seek_offset(
-         export_handle_t *export_handle,
-         off64_t offset,
-         libcerror_error_t **error )
+int export_handle_prepare_storage_media_buffer(
+     export_handle_t *export_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error )
 {
-	static char *function = "export_handle_seek_offset";
+	static char *function = "export_handle_prepare_storage_media_buffer";
+	size_t read_size      = 0;
+	ssize_t process_count = 0;
+	uint8_t pass_through  = 0;
 
 	if( export_handle == NULL )
 	{
@@ -1348,23 +1469,557 @@ off64_t export_handle_seek_offset(
 
 		return( -1 );
 	}
-	if( libewf_handle_seek_offset(
-	     export_handle->input_handle,
-	     offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( storage_media_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
 		 function );
 
 		return( -1 );
 	}
-	return( offset );
-}
+	if( storage_media_buffer->process_count <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid storage media buffer - process count value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_size = (size_t) storage_media_buffer->process_count;
+
+	process_count = export_handle_prepare_read_buffer(
+	                 export_handle,
+	                 storage_media_buffer,
+	                 error );
+
+	if( process_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to prepare storage media buffer after read.",
+		 function );
+
+		return( -1 );
+	}
+	/* A stored chunk can only be passed through if it contains valid data
+	 * and all of it is exported
+	 */
+	if( ( export_handle->pass_through_chunks != 0 )
+	 && ( storage_media_buffer->is_corrupted == 0 )
+	 && ( process_count <= (ssize_t) read_size ) )
+	{
+		pass_through = 1;
+	}
+	/* The last chunk can contain more data than requested
+	 */
+	if( process_count > (ssize_t) read_size )
+	{
+		process_count = (ssize_t) read_size;
+	}
+	if( storage_media_buffer->data_in_compression_buffer == 1 )
+	{
+		storage_media_buffer->compression_buffer_data_size = (size_t) process_count;
+	}
+	else
+	{
+		storage_media_buffer->raw_buffer_data_size = (size_t) process_count;
+	}
+	if( export_handle->swap_byte_pairs == 1 )
+	{
+		if( export_handle_swap_byte_pairs(
+		     export_handle,
+		     storage_media_buffer,
+		     (size_t) process_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to swap byte pairs.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( export_handle->output_format == EXPORT_HANDLE_OUTPUT_FORMAT_EWF )
+	{
+		if( pass_through != 0 )
+		{
+			if( storage_media_buffer->is_compressed != 0 )
+			{
+				if( storage_media_buffer->compression_buffer_data_size < sizeof( uint32_t ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid storage media buffer - compression buffer data size value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				/* Zlib stores its own checksum at the end of the compressed data
+				 */
+				if( memory_copy(
+				     &( storage_media_buffer->checksum ),
+				     &( storage_media_buffer->compression_buffer[ storage_media_buffer->compression_buffer_data_size - sizeof( uint32_t ) ] ),
+				     sizeof( uint32_t ) ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to set checksum.",
+					 function );
+
+					return( -1 );
+				}
+				storage_media_buffer->process_checksum = 0;
+
+				process_count = (ssize_t) storage_media_buffer->compression_buffer_data_size;
+			}
+			else
+			{
+				/* The checksum was either read separately or is stored after the chunk data
+				 */
+				if( storage_media_buffer->process_checksum == 0 )
+				{
+					byte_stream_copy_to_uint32_little_endian(
+					 &( storage_media_buffer->compression_buffer[ process_count ] ),
+					 storage_media_buffer->checksum );
+				}
+				storage_media_buffer->process_checksum = 1;
+			}
+		}
+		else
+		{
+			/* The compression buffer is used to store the compressed chunk data
+			 */
+			if( storage_media_buffer->data_in_compression_buffer == 1 )
+			{
+				if( memory_copy(
+				     storage_media_buffer->raw_buffer,
+				     storage_media_buffer->compression_buffer,
+				     (size_t) process_count ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy data from compression buffer to raw buffer.",
+					 function );
+
+					return( -1 );
+				}
+				storage_media_buffer->data_in_compression_buffer = 0;
+				storage_media_buffer->raw_buffer_data_size       = (size_t) process_count;
+			}
+			process_count = export_handle_prepare_write_buffer(
+			                 export_handle,
+			                 storage_media_buffer,
+			                 error );
+
+			if( process_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to prepare storage media buffer before write.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	storage_media_buffer->process_count = process_count;
+
+	return( 1 );
+}
+
+/* Appends a read error if the storage media buffer is corrupted,
+ * updates the integrity hash(es) and writes the storage media buffer to the output
+ * The storage media offset and process count of the buffer must be set
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_storage_media_buffer(
+     export_handle_t *export_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error )
+{
+	uint8_t *data         = NULL;
+	static char *function = "export_handle_write_storage_media_buffer";
+	size_t data_size      = 0;
+	ssize_t write_count   = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer->process_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid storage media buffer - process count value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer_get_data(
+	     storage_media_buffer,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine storage media buffer data.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer->is_corrupted != 0 )
+	{
+		if( export_handle_append_read_error(
+		     export_handle,
+		     storage_media_buffer->storage_media_offset,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append read error.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Digest hashes are calcultated after swap
+	 */
+	if( export_handle_update_integrity_hash(
+	     export_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to update integrity hash(es).",
+		 function );
+
+		return( -1 );
+	}
+	write_count = export_handle_write_buffer(
+		       export_handle,
+		       storage_media_buffer,
+		       (size_t) storage_media_buffer->process_count,
+		       error );
+
+	if( write_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Starts the threads that process and write the storage media buffers
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_threads_start(
+     export_handle_t *export_handle,
+     size_t process_buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_threads_start";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->process_threads != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - process threads value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_handle->number_of_threads <= 0 )
+	 || ( export_handle->number_of_threads > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export handle - number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( process_threads_initialize(
+	     &( export_handle->process_threads ),
+	     export_handle->number_of_threads,
+	     process_buffer_size,
+	     (int (*)(storage_media_buffer_t *, void *, libcerror_error_t **)) &export_handle_process_storage_media_buffer_callback,
+	     (int (*)(storage_media_buffer_t *, void *, libcerror_error_t **)) &export_handle_output_storage_media_buffer_callback,
+	     (void *) export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create process threads.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Stops the threads that process and write the storage media buffers
+ * Waits for the pending storage media buffers to be processed and written
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_threads_stop(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_threads_stop";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( process_threads_free(
+	     &( export_handle->process_threads ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free process threads.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Callback function to process a storage media buffer
+ * This decompresses the input chunk data and compresses the output chunk data
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_process_storage_media_buffer_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_process_storage_media_buffer_callback";
+
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The remaining storage media buffers are no longer processed after an abort
+	 */
+	if( export_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	if( export_handle_prepare_storage_media_buffer(
+	     export_handle,
+	     storage_media_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to prepare storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Callback function to write a processed storage media buffer
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_output_storage_media_buffer_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_output_storage_media_buffer_callback";
+
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The remaining storage media buffers are no longer written after an abort
+	 * they are only returned to the queue
+	 */
+	if( export_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	if( export_handle_write_storage_media_buffer(
+	     export_handle,
+	     storage_media_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to write storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Seeks the offset
+ * Returns the resulting offset or -1 on error
+ */
+off64_t export_handle_seek_offset(
+         export_handle_t *export_handle,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "export_handle_seek_offset";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_handle_seek_offset(
+	     export_handle->input_handle,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		return( -1 );
+	}
+	return( offset );
+}
 
 /* Swaps the byte order of byte pairs within a buffer of a certain size
  * Returns 1 if successful, -1 on error
@@ -1599,59 +2254,22 @@ int export_handle_update_integrity_hash(
 
 		return( -1 );
 	}
-	if( export_handle->calculate_md5 != 0 )
-	{
-		if( libhmac_md5_update(
-		     export_handle->md5_context,
-		     buffer,
-		     buffer_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update MD5 digest hash.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	if( export_handle->calculate_sha1 != 0 )
-	{
-		if( libhmac_sha1_update(
-		     export_handle->sha1_context,
-		     buffer,
-		     buffer_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update SHA1 digest hash.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	if( export_handle->calculate_sha256 != 0 )
+	if( integrity_hash_update(
+	     ( export_handle->calculate_md5 != 0 ) ? export_handle->md5_context : NULL,
+	     ( export_handle->calculate_sha1 != 0 ) ? export_handle->sha1_context : NULL,
+	     ( export_handle->calculate_sha256 != 0 ) ? export_handle->sha256_context : NULL,
+	     buffer,
+	     buffer_size,
+	     error ) != 1 )
 	{
-		if( libhmac_sha256_update(
-		     export_handle->sha256_context,
-		     buffer,
-		     buffer_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update SHA256 digest hash.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update integrity hash.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
 	return( 1 );
 }
@@ -2995,6 +3613,10 @@ int export_handle_set_output_format(
 
 			return( -1 );
 		}
+		else if( result == 1 )
+		{
+			export_handle->output_format = EXPORT_HANDLE_OUTPUT_FORMAT_EWF;
+		}
 	}
 	return( result );
 }
@@ -3331,6 +3953,148 @@ int export_handle_set_process_buffer_size(
 	return( result );
 }
 
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function  = "export_handle_set_number_of_threads";
+	size_t string_length   = 0;
+	uint64_t value_64bit   = 0;
+	int result             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] != (libcstring_system_character_t) '-' )
+	{
+		string_length = libcstring_system_string_length(
+				 string );
+
+		if( libcsystem_string_decimal_copy_to_64_bit(
+		     string,
+		     string_length + 1,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine number of threads.",
+			 function );
+
+			return( -1 );
+		}
+		/* Without multi-threading support only 0 threads are supported
+		 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( value_64bit <= (uint64_t) EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+#else
+		if( value_64bit == 0 )
+#endif
+		{
+			export_handle->number_of_threads = (int) value_64bit;
+
+			result = 1;
+		}
+	}
+	return( result );
+}
+
+/* Sets the number of read-ahead chunks
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_number_of_read_ahead_chunks(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function  = "export_handle_set_number_of_read_ahead_chunks";
+	size_t string_length   = 0;
+	uint64_t value_64bit   = 0;
+	int result             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] != (libcstring_system_character_t) '-' )
+	{
+		string_length = libcstring_system_string_length(
+				 string );
+
+		if( libcsystem_string_decimal_copy_to_64_bit(
+		     string,
+		     string_length + 1,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine number of read-ahead chunks.",
+			 function );
+
+			return( -1 );
+		}
+		/* Without multi-threading support read-ahead is not supported
+		 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( value_64bit <= (uint64_t) EXPORT_HANDLE_MAXIMUM_NUMBER_OF_READ_AHEAD_CHUNKS )
+#else
+		if( value_64bit == 0 )
+#endif
+		{
+			export_handle->number_of_read_ahead_chunks = (int) value_64bit;
+
+			result = 1;
+		}
+	}
+	return( result );
+}
+
 /* Sets the additional digest types
  * Returns 1 if successful or -1 on error
  */
@@ -3690,6 +4454,10 @@ int export_handle_set_output_values(
 
 		return( -1 );
 	}
+	/* The chunk data read chunk by chunk is not zeroed by the input handle
+	 */
+	export_handle->zero_chunk_on_error = zero_chunk_on_error;
+
 	if( export_handle->output_format == EXPORT_HANDLE_OUTPUT_FORMAT_EWF )
 	{
 		if( export_handle->ewf_output_handle == NULL )
@@ -4242,7 +5010,6 @@ int export_handle_append_read_error(
 	{
 		number_of_sectors += 1;
 	}
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
 	if( libewf_handle_append_checksum_error(
 	     export_handle->input_handle,
 	     start_sector,
@@ -4258,7 +5025,6 @@ int export_handle_append_read_error(
 
 		return( -1 );
 	}
-#endif
 	if( export_handle->output_format == EXPORT_HANDLE_OUTPUT_FORMAT_EWF )
 	{
 		if( export_handle->ewf_output_handle == NULL )
@@ -4409,6 +5175,7 @@ int export_handle_export_input(
 	static char *function                               = "export_handle_export_input";
 	size64_t export_count                               = 0;
 	size64_t media_size                                 = 0;
+	size32_t output_chunk_size                          = 0;
 	size_t process_buffer_size                          = 0;
 	size_t data_size                                    = 0;
 	size_t read_size                                    = 0;
@@ -4416,14 +5183,21 @@ int export_handle_export_input(
 	ssize_t read_process_count                          = 0;
 	ssize_t write_count                                 = 0;
 	ssize_t write_process_count                         = 0;
+	uint8_t input_compression_flags                     = 0;
+	uint8_t input_ewf_format                            = 0;
+	uint8_t storage_media_buffer_mode                   = 0;
+	int8_t input_compression_level                      = 0;
+	int process_chunks                                  = 0;
 	int status                                          = PROCESS_STATUS_COMPLETED;
 
 #if defined( HAVE_LOW_LEVEL_FUNCTIONS )
 	storage_media_buffer_t *output_storage_media_buffer = NULL;
 	uint8_t *input_buffer                               = NULL;
-	size32_t output_chunk_size                          = 0;
 	size_t write_size                                   = 0;
 #endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int use_threads                                     = 0;
+#endif
 
 	if( export_handle == NULL )
 	{
@@ -4526,7 +5300,6 @@ int export_handle_export_input(
 			goto on_error;
 		}
 	}
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
 	if( export_handle_get_output_chunk_size(
 	     export_handle,
 	     &output_chunk_size,
@@ -4552,21 +5325,99 @@ int export_handle_export_input(
 
 		goto on_error;
 	}
+	export_handle->swap_byte_pairs     = swap_byte_pairs;
+	export_handle->pass_through_chunks = 0;
+
+	/* The stored chunks of the input can be written to the output as-is
+	 * if the output uses the same format, chunk size and compression values
+	 */
+	if( ( export_handle->output_format == EXPORT_HANDLE_OUTPUT_FORMAT_EWF )
+	 && ( swap_byte_pairs == 0 )
+	 && ( output_chunk_size == export_handle->input_chunk_size ) )
+	{
+		if( libewf_handle_get_format(
+		     export_handle->input_handle,
+		     &input_ewf_format,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve input format.",
+			 function );
+
+			goto on_error;
+		}
+		if( libewf_handle_get_compression_values(
+		     export_handle->input_handle,
+		     &input_compression_level,
+		     &input_compression_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve input compression values.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( input_ewf_format == export_handle->ewf_format )
+		 && ( input_compression_level == export_handle->compression_level )
+		 && ( input_compression_flags == export_handle->compression_flags ) )
+		{
+			export_handle->pass_through_chunks = 1;
+		}
+	}
+	/* Processing the input chunk by chunk requires a chunk aligned export offset
+	 * Passed through chunks are copied without being recompressed
+	 */
+	if( ( export_handle->pass_through_chunks != 0 )
+	 && ( ( export_handle->export_offset % export_handle->input_chunk_size ) == 0 ) )
+	{
+		process_chunks = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The process threads operate on the chunks of the input
+	 * which for EWF output requires the output to use the chunk size of the input
+	 */
+	if( ( export_handle->number_of_threads > 0 )
+	 && ( ( export_handle->export_offset % export_handle->input_chunk_size ) == 0 )
+	 && ( ( export_handle->output_format != EXPORT_HANDLE_OUTPUT_FORMAT_EWF )
+	  || ( output_chunk_size == export_handle->input_chunk_size ) ) )
+	{
+		use_threads    = 1;
+		process_chunks = 1;
+	}
 #endif
 #if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-	process_buffer_size = (size_t) export_handle->input_chunk_size;
+	storage_media_buffer_mode = STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA;
+	process_buffer_size       = (size_t) export_handle->input_chunk_size;
 #else
-	if( export_handle->process_buffer_size == 0 )
+	if( process_chunks != 0 )
 	{
-		process_buffer_size = (size_t) export_handle->input_chunk_size;
+		storage_media_buffer_mode = STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA;
+		process_buffer_size       = (size_t) export_handle->input_chunk_size;
 	}
 	else
 	{
-		process_buffer_size = export_handle->process_buffer_size;
+		storage_media_buffer_mode = STORAGE_MEDIA_BUFFER_MODE_BUFFERED;
+
+		if( export_handle->process_buffer_size == 0 )
+		{
+			process_buffer_size = (size_t) export_handle->input_chunk_size;
+		}
+		else
+		{
+			process_buffer_size = export_handle->process_buffer_size;
+		}
 	}
 #endif
 	if( storage_media_buffer_initialize(
 	     &storage_media_buffer,
+	     storage_media_buffer_mode,
 	     process_buffer_size,
 	     error ) != 1 )
 	{
@@ -4582,6 +5433,7 @@ int export_handle_export_input(
 #if defined( HAVE_LOW_LEVEL_FUNCTIONS )
 	if( storage_media_buffer_initialize(
 	     &output_storage_media_buffer,
+	     STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA,
 	     output_chunk_size,
 	     error ) != 1 )
 	{
@@ -4641,11 +5493,73 @@ int export_handle_export_input(
 	}
 	while( export_count < (size64_t) export_handle->export_size )
 	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		/* The first chunk is written by the main thread so that the write values
+		 * of the output handle are initialized before the process threads start
+		 */
+		if( ( use_threads != 0 )
+		 && ( export_handle->process_threads == NULL )
+		 && ( export_count > 0 ) )
+		{
+			if( storage_media_buffer_free(
+			     &storage_media_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free storage media buffer.",
+				 function );
+
+				goto on_error;
+			}
+			if( export_handle_threads_start(
+			     export_handle,
+			     process_buffer_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to start threads.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( export_handle->process_threads != NULL )
+		{
+			/* An error in one of the threads is returned when the threads are stopped
+			 */
+			if( ( export_handle->abort != 0 )
+			 || ( process_threads_has_error(
+			       export_handle->process_threads ) != 0 ) )
+			{
+				break;
+			}
+			if( process_threads_get_storage_media_buffer(
+			     export_handle->process_threads,
+			     &storage_media_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve storage media buffer.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
 		read_size = process_buffer_size;
 
-		if( ( media_size - export_count ) < read_size )
+		if( ( (size64_t) export_handle->export_size - export_count ) < read_size )
 		{
-			read_size = (size_t) ( media_size - export_count );
+			read_size = (size_t) ( export_handle->export_size - export_count );
 		}
 		read_count = export_handle_read_buffer(
 		              export_handle,
@@ -4675,194 +5589,273 @@ int export_handle_export_input(
 
 			goto on_error;
 		}
-		read_process_count = export_handle_prepare_read_buffer(
-		                      export_handle,
-		                      storage_media_buffer,
-		                      error );
-
-		if( read_process_count < 0 )
+		if( process_chunks != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to prepare buffer after read.",
-			 function );
+			storage_media_buffer->storage_media_offset = (off64_t) ( export_handle->export_offset + export_count );
+			storage_media_buffer->process_count        = (ssize_t) read_size;
 
-			goto on_error;
-		}
-		if( read_process_count > (ssize_t) read_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: more bytes read than requested.",
-			 function );
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			if( export_handle->process_threads != NULL )
+			{
+				if( process_threads_push_storage_media_buffer(
+				     export_handle->process_threads,
+				     storage_media_buffer,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to process storage media buffer.",
+					 function );
 
-			goto on_error;
-		}
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-		/* Set the chunk data size in the compression buffer
-		 */
-		if( storage_media_buffer->data_in_compression_buffer == 1 )
-		{
-			storage_media_buffer->compression_buffer_data_size = (size_t) read_process_count;
-		}
+					goto on_error;
+				}
+				storage_media_buffer = NULL;
+			}
+			else
 #endif
-		/* Swap byte pairs
-		 */
-		if( swap_byte_pairs == 1 )
-		{
-			if( export_handle_swap_byte_pairs(
-			     export_handle,
-			     storage_media_buffer,
-			     read_process_count,
-			     error ) != 1 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-				 LIBCERROR_CONVERSION_ERROR_GENERIC,
-				 "%s: unable to swap byte pairs.",
-				 function );
+				if( export_handle_prepare_storage_media_buffer(
+				     export_handle,
+				     storage_media_buffer,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to prepare storage media buffer.",
+					 function );
 
-				goto on_error;
-			}
-		}
-		if( storage_media_buffer_get_data(
-		     storage_media_buffer,
-		     &data,
-		     &data_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve storage media buffer data.",
-			 function );
+					goto on_error;
+				}
+				if( export_handle_write_storage_media_buffer(
+				     export_handle,
+				     storage_media_buffer,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write storage media buffer.",
+					 function );
 
-			goto on_error;
+					goto on_error;
+				}
+			}
+			export_count += read_size;
 		}
-		/* Digest hashes are calcultated after swap
-		 */
-		if( export_handle_update_integrity_hash(
-		     export_handle,
-		     data,
-		     read_process_count,
-		     error ) != 1 )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to update integrity hash(es).",
-			 function );
+			read_process_count = export_handle_prepare_read_buffer(
+			                      export_handle,
+			                      storage_media_buffer,
+			                      error );
 
-			goto on_error;
-		}
-		export_count += read_process_count;
-
-		while( read_process_count > 0 )
-		{
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-			if( read_process_count > (ssize_t) output_chunk_size )
+			if( read_process_count < 0 )
 			{
-				write_size = output_chunk_size;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to prepare buffer after read.",
+				 function );
+
+				goto on_error;
 			}
-			else
+			if( read_process_count > (ssize_t) read_size )
 			{
-				write_size = (size_t) read_process_count;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: more bytes read than requested.",
+				 function );
+
+				goto on_error;
 			}
-			if( ( output_storage_media_buffer->raw_buffer_data_size + write_size ) > output_chunk_size )
+			if( storage_media_buffer->is_corrupted != 0 )
 			{
-				write_size = output_chunk_size -  output_storage_media_buffer->raw_buffer_data_size;
+				if( export_handle_append_read_error(
+				     export_handle,
+				     (off64_t) ( export_handle->export_offset + export_count ),
+				     (size_t) read_process_count,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append read error.",
+					 function );
+
+					goto on_error;
+				}
 			}
+#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
+			/* Set the chunk data size in the compression buffer
+			 */
 			if( storage_media_buffer->data_in_compression_buffer == 1 )
 			{
-				input_buffer = storage_media_buffer->compression_buffer;
+				storage_media_buffer->compression_buffer_data_size = (size_t) read_process_count;
 			}
-			else
+#endif
+			/* Swap byte pairs
+			 */
+			if( swap_byte_pairs == 1 )
 			{
-				input_buffer = storage_media_buffer->raw_buffer;
+				if( export_handle_swap_byte_pairs(
+				     export_handle,
+				     storage_media_buffer,
+				     read_process_count,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+					 LIBCERROR_CONVERSION_ERROR_GENERIC,
+					 "%s: unable to swap byte pairs.",
+					 function );
+
+					goto on_error;
+				}
 			}
-			if( memory_copy(
-			     &( output_storage_media_buffer->raw_buffer[ output_storage_media_buffer->raw_buffer_data_size ] ),
-			     input_buffer,
-			     write_size ) == NULL )
+			if( storage_media_buffer_get_data(
+			     storage_media_buffer,
+			     &data,
+			     &data_size,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy data from input buffer to output raw buffer.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve storage media buffer data.",
 				 function );
 
 				goto on_error;
 			}
-			output_storage_media_buffer->raw_buffer_data_size += write_size;
-
-			/* Make sure the output chunk is filled upto the output chunk size
+			/* Digest hashes are calcultated after swap
 			 */
-			if( ( export_count < (size64_t) export_handle->export_size )
-			 && ( output_storage_media_buffer->raw_buffer_data_size < output_chunk_size ) )
+			if( export_handle_update_integrity_hash(
+			     export_handle,
+			     data,
+			     read_process_count,
+			     error ) != 1 )
 			{
-				continue;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to update integrity hash(es).",
+				 function );
+
+				goto on_error;
 			}
+			export_count += read_process_count;
+
+			while( read_process_count > 0 )
+			{
+#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
+				if( read_process_count > (ssize_t) output_chunk_size )
+				{
+					write_size = output_chunk_size;
+				}
+				else
+				{
+					write_size = (size_t) read_process_count;
+				}
+				if( ( output_storage_media_buffer->raw_buffer_data_size + write_size ) > output_chunk_size )
+				{
+					write_size = output_chunk_size -  output_storage_media_buffer->raw_buffer_data_size;
+				}
+				if( storage_media_buffer->data_in_compression_buffer == 1 )
+				{
+					input_buffer = storage_media_buffer->compression_buffer;
+				}
+				else
+				{
+					input_buffer = storage_media_buffer->raw_buffer;
+				}
+				if( memory_copy(
+				     &( output_storage_media_buffer->raw_buffer[ output_storage_media_buffer->raw_buffer_data_size ] ),
+				     input_buffer,
+				     write_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy data from input buffer to output raw buffer.",
+					 function );
+
+					goto on_error;
+				}
+				output_storage_media_buffer->raw_buffer_data_size += write_size;
+
+				/* Make sure the output chunk is filled upto the output chunk size
+				 */
+				if( ( export_count < (size64_t) export_handle->export_size )
+				 && ( output_storage_media_buffer->raw_buffer_data_size < output_chunk_size ) )
+				{
+					continue;
+				}
 #endif
 #if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-			write_process_count = export_handle_prepare_write_buffer(
-			                       export_handle,
-			                       output_storage_media_buffer,
-			                       error );
+				write_process_count = export_handle_prepare_write_buffer(
+				                       export_handle,
+				                       output_storage_media_buffer,
+				                       error );
 #else
-			write_process_count = export_handle_prepare_write_buffer(
-			                       export_handle,
-			                       storage_media_buffer,
-			                       error );
+				write_process_count = export_handle_prepare_write_buffer(
+				                       export_handle,
+				                       storage_media_buffer,
+				                       error );
 #endif
 
-			if( write_process_count < 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				"%s: unable to prepare buffer before write.",
-				 function );
+				if( write_process_count < 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					"%s: unable to prepare buffer before write.",
+					 function );
 
-				goto on_error;
-			}
+					goto on_error;
+				}
 #if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-			write_count = export_handle_write_buffer(
-				       export_handle,
-				       output_storage_media_buffer,
-				       write_process_count,
-				       error );
+				write_count = export_handle_write_buffer(
+					       export_handle,
+					       output_storage_media_buffer,
+					       write_process_count,
+					       error );
 #else
-			write_count = export_handle_write_buffer(
-				       export_handle,
-				       storage_media_buffer,
-				       write_process_count,
-				       error );
+				write_count = export_handle_write_buffer(
+					       export_handle,
+					       storage_media_buffer,
+					       write_process_count,
+					       error );
 #endif
 
-			if( write_count < 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write data to file.",
-				 function );
+				if( write_count < 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write data to file.",
+					 function );
 
-				goto on_error;
-			}
+					goto on_error;
+				}
 #if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-			output_storage_media_buffer->raw_buffer_data_size = 0;
+				output_storage_media_buffer->raw_buffer_data_size = 0;
 #endif
-			read_process_count -= write_process_count;
+				read_process_count -= write_process_count;
+			}
 		}
 		if( process_status_update(
 		     process_status,
@@ -4884,6 +5877,24 @@ int export_handle_export_input(
 			break;
 		}
   	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->process_threads != NULL )
+	{
+		if( export_handle_threads_stop(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to stop threads.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
 #if defined( HAVE_LOW_LEVEL_FUNCTIONS )
 	if( storage_media_buffer_free(
 	     &output_storage_media_buffer,
@@ -5062,6 +6073,14 @@ on_error:
 		 &storage_media_buffer,
 		 NULL );
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->process_threads != NULL )
+	{
+		export_handle_threads_stop(
+		 export_handle,
+		 NULL );
+	}
+#endif
 	return( -1 );
 }
 
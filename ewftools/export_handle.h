@@ -32,12 +32,16 @@
 #include "ewftools_libhmac.h"
 #include "ewftools_libsmraw.h"
 #include "log_handle.h"
+#include "process_threads.h"
 #include "storage_media_buffer.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_READ_AHEAD_CHUNKS	256
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS		128
+
 enum EXPORT_HANDLE_OUTPUT_FORMATS
 {
 	EXPORT_HANDLE_OUTPUT_FORMAT_EWF		= (int) 'e',
@@ -177,16 +181,19 @@ struct export_handle
 	 */
 	size64_t input_media_size;
 
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-	/* The last offset of the input data
-	 */
-	off64_t input_offset;
-#endif
-
 	/* Value to indicate if the write is compressed
 	 */
 	int write_compressed;
 
+	/* Value to indicate if the byte pairs should be swapped
+	 */
+	uint8_t swap_byte_pairs;
+
+	/* Value to indicate if the stored chunks of the input can be written
+	 * to the output without compressing them again
+	 */
+	uint8_t pass_through_chunks;
+
 	/* Value to indicate if the chunk should be zeroed on error
 	 */
 	int zero_chunk_on_error;
@@ -195,6 +202,22 @@ struct export_handle
 	 */
 	size_t process_buffer_size;
 
+	/* The number of threads used to process the storage media buffers
+	 * 0 represents that no threads are used
+	 */
+	int number_of_threads;
+
+	/* The number of chunks the input handle reads ahead
+	 * 0 represents that read-ahead is disabled
+	 */
+	int number_of_read_ahead_chunks;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The process threads
+	 */
+	process_threads_t *process_threads;
+#endif
+
 	/* The nofication output stream
 	 */
 	FILE *notify_stream;
@@ -217,6 +240,11 @@ int export_handle_signal_abort(
      export_handle_t *export_handle,
      libcerror_error_t **error );
 
+int export_handle_set_use_memory_map(
+     export_handle_t *export_handle,
+     uint8_t use_memory_map,
+     libcerror_error_t **error );
+
 int export_handle_set_maximum_number_of_open_handles(
      export_handle_t *export_handle,
      int maximum_number_of_open_handles,
@@ -259,6 +287,37 @@ ssize_t export_handle_write_buffer(
          size_t write_size,
          libcerror_error_t **error );
 
+int export_handle_prepare_storage_media_buffer(
+     export_handle_t *export_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error );
+
+int export_handle_write_storage_media_buffer(
+     export_handle_t *export_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+int export_handle_threads_start(
+     export_handle_t *export_handle,
+     size_t process_buffer_size,
+     libcerror_error_t **error );
+
+int export_handle_threads_stop(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_process_storage_media_buffer_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_output_storage_media_buffer_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 off64_t export_handle_seek_offset(
          export_handle_t *export_handle,
          off64_t offset,
@@ -382,6 +441,16 @@ int export_handle_set_process_buffer_size(
      const libcstring_system_character_t *string,
      libcerror_error_t **error );
 
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_number_of_read_ahead_chunks(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error );
+
 int export_handle_set_additional_digest_types(
      export_handle_t *export_handle,
      const libcstring_system_character_t *string,
@@ -404,13 +473,11 @@ int export_handle_set_hash_value(
      size_t hash_value_length,
      libcerror_error_t **error );
 
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
 int export_handle_append_read_error(
       export_handle_t *export_handle,
       off64_t start_offset,
       size_t number_of_bytes,
       libcerror_error_t **error );
-#endif
 
 ssize_t export_handle_finalize(
          export_handle_t *export_handle,
@@ -43,7 +43,9 @@
 #include "ewftools_libhmac.h"
 #include "guid.h"
 #include "imaging_handle.h"
+#include "integrity_hash.h"
 #include "platform.h"
+#include "process_threads.h"
 #include "storage_media_buffer.h"
 
 #define IMAGING_HANDLE_INPUT_BUFFER_SIZE	64
@@ -244,6 +246,24 @@ int imaging_handle_free(
 	}
 	if( *imaging_handle != NULL )
 	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *imaging_handle )->process_threads != NULL )
+		{
+			if( imaging_handle_threads_stop(
+			     *imaging_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to stop threads.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
 		memory_free(
 		 ( *imaging_handle )->input_buffer );
 
@@ -402,6 +422,8 @@ int imaging_handle_signal_abort(
 
 		return( -1 );
 	}
+	imaging_handle->abort = 1;
+
 	if( libewf_handle_signal_abort(
 	     imaging_handle->output_handle,
 	     error ) != 1 )
@@ -698,6 +720,41 @@ int imaging_handle_open_secondary_output(
 		}
 		return( -1 );
 	}
+	if( imaging_handle->drop_cached_data != 0 )
+	{
+		if( libewf_handle_set_drop_cached_data(
+		     imaging_handle->secondary_output_handle,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set drop cached data in secondary output handle.",
+			 function );
+
+			libewf_handle_free(
+			 &( imaging_handle->secondary_output_handle ),
+			 NULL );
+
+			if( libewf_filenames != filenames )
+			{
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+				libewf_glob_wide_free(
+				 libewf_filenames,
+				 number_of_filenames,
+				 NULL );
+#else
+				libewf_glob_free(
+				 libewf_filenames,
+				 number_of_filenames,
+				 NULL );
+#endif
+			}
+			return( -1 );
+		}
+	}
 #if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
 	if( libewf_handle_open_wide(
 	     imaging_handle->secondary_output_handle,
@@ -857,42 +914,45 @@ ssize_t imaging_handle_prepare_read_buffer(
 
 		return( -1 );
 	}
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-	storage_media_buffer->raw_buffer_data_size = storage_media_buffer->raw_buffer_size;
+	if( storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
+	{
+		storage_media_buffer->raw_buffer_data_size = storage_media_buffer->raw_buffer_size;
 
-	process_count = libewf_handle_prepare_read_chunk(
-	                 imaging_handle->output_handle,
-	                 storage_media_buffer->compression_buffer,
-	                 storage_media_buffer->compression_buffer_data_size,
-	                 storage_media_buffer->raw_buffer,
-	                 &( storage_media_buffer->raw_buffer_data_size ),
-	                 storage_media_buffer->is_compressed,
-	                 storage_media_buffer->checksum,
-	                 storage_media_buffer->process_checksum,
-	                 error );
+		process_count = libewf_handle_prepare_read_chunk(
+		                 imaging_handle->output_handle,
+		                 storage_media_buffer->compression_buffer,
+		                 storage_media_buffer->compression_buffer_data_size,
+		                 storage_media_buffer->raw_buffer,
+		                 &( storage_media_buffer->raw_buffer_data_size ),
+		                 storage_media_buffer->is_compressed,
+		                 storage_media_buffer->checksum,
+		                 storage_media_buffer->process_checksum,
+		                 error );
 
-	if( process_count == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read storage media buffer.",
-		 function );
+		if( process_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read storage media buffer.",
+			 function );
 
-		return( -1 );
-	}
-	if( storage_media_buffer->is_compressed == 0 )
-	{
-		storage_media_buffer->data_in_compression_buffer = 1;
+			return( -1 );
+		}
+		if( storage_media_buffer->is_compressed == 0 )
+		{
+			storage_media_buffer->data_in_compression_buffer = 1;
+		}
+		else
+		{
+			storage_media_buffer->data_in_compression_buffer = 0;
+		}
 	}
 	else
 	{
-		storage_media_buffer->data_in_compression_buffer = 0;
+		process_count = (ssize_t) storage_media_buffer->raw_buffer_data_size;
 	}
-#else
-	process_count = (ssize_t) storage_media_buffer->raw_buffer_data_size;
-#endif
 	return( process_count );
 }
 
@@ -931,23 +991,26 @@ ssize_t imaging_handle_read_buffer(
 
 		return( -1 );
 	}
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-	read_count = libewf_handle_read_chunk(
-                      imaging_handle->output_handle,
-                      storage_media_buffer->compression_buffer,
-                      storage_media_buffer->compression_buffer_size,
-	              &( storage_media_buffer->is_compressed ),
-	              &( storage_media_buffer->compression_buffer[ storage_media_buffer->raw_buffer_size ] ),
-	              &( storage_media_buffer->checksum ),
-	              &( storage_media_buffer->process_checksum ),
-	              error );
-#else
-	read_count = libewf_handle_read_buffer(
-                      imaging_handle->output_handle,
-                      storage_media_buffer->raw_buffer,
-                      read_size,
-	              error );
-#endif
+	if( storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
+	{
+		read_count = libewf_handle_read_chunk(
+	                      imaging_handle->output_handle,
+	                      storage_media_buffer->compression_buffer,
+	                      storage_media_buffer->compression_buffer_size,
+		              &( storage_media_buffer->is_compressed ),
+		              &( storage_media_buffer->compression_buffer[ storage_media_buffer->raw_buffer_size ] ),
+		              &( storage_media_buffer->checksum ),
+		              &( storage_media_buffer->process_checksum ),
+		              error );
+	}
+	else
+	{
+		read_count = libewf_handle_read_buffer(
+	                      imaging_handle->output_handle,
+	                      storage_media_buffer->raw_buffer,
+	                      read_size,
+		              error );
+	}
 
 	if( read_count == -1 )
 	{
@@ -962,23 +1025,26 @@ ssize_t imaging_handle_read_buffer(
 	}
 	if( imaging_handle->secondary_output_handle != NULL )
 	{
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-		secondary_read_count = libewf_handle_read_chunk(
-			                imaging_handle->secondary_output_handle,
-			                storage_media_buffer->compression_buffer,
-			                storage_media_buffer->compression_buffer_size,
-			                &( storage_media_buffer->is_compressed ),
-			                &( storage_media_buffer->compression_buffer[ storage_media_buffer->raw_buffer_size ] ),
-			                &( storage_media_buffer->checksum ),
-			                &( storage_media_buffer->process_checksum ),
-			                error );
-#else
-		secondary_read_count = libewf_handle_read_buffer(
-		                        imaging_handle->secondary_output_handle,
-		                        storage_media_buffer->raw_buffer,
-		                        read_size,
-		                        error );
-#endif
+		if( storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
+		{
+			secondary_read_count = libewf_handle_read_chunk(
+				                imaging_handle->secondary_output_handle,
+				                storage_media_buffer->compression_buffer,
+				                storage_media_buffer->compression_buffer_size,
+				                &( storage_media_buffer->is_compressed ),
+				                &( storage_media_buffer->compression_buffer[ storage_media_buffer->raw_buffer_size ] ),
+				                &( storage_media_buffer->checksum ),
+				                &( storage_media_buffer->process_checksum ),
+				                error );
+		}
+		else
+		{
+			secondary_read_count = libewf_handle_read_buffer(
+			                        imaging_handle->secondary_output_handle,
+			                        storage_media_buffer->raw_buffer,
+			                        read_size,
+			                        error );
+		}
 
 		if( secondary_read_count == -1 )
 		{
@@ -992,11 +1058,14 @@ ssize_t imaging_handle_read_buffer(
 			return( -1 );
 		}
 	}
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-	storage_media_buffer->compression_buffer_data_size = (ssize_t) read_count;
-#else
-	storage_media_buffer->raw_buffer_data_size         = (ssize_t) read_count;
-#endif
+	if( storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
+	{
+		storage_media_buffer->compression_buffer_data_size = (ssize_t) read_count;
+	}
+	else
+	{
+		storage_media_buffer->raw_buffer_data_size         = (ssize_t) read_count;
+	}
 
 	return( read_count );
 }
@@ -1034,34 +1103,37 @@ ssize_t imaging_handle_prepare_write_buffer(
 
 		return( -1 );
 	}
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-	storage_media_buffer->compression_buffer_data_size = storage_media_buffer->compression_buffer_size;
+	if( storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
+	{
+		storage_media_buffer->compression_buffer_data_size = storage_media_buffer->compression_buffer_size;
 
-	process_count = libewf_handle_prepare_write_chunk(
-	                 imaging_handle->output_handle,
-	                 storage_media_buffer->raw_buffer,
-	                 storage_media_buffer->raw_buffer_data_size,
-	                 storage_media_buffer->compression_buffer,
-	                 &( storage_media_buffer->compression_buffer_data_size ),
-	                 &( storage_media_buffer->is_compressed ),
-	                 &( storage_media_buffer->checksum ),
-	                 &( storage_media_buffer->process_checksum ),
-	                 error );
+		process_count = libewf_handle_prepare_write_chunk(
+		                 imaging_handle->output_handle,
+		                 storage_media_buffer->raw_buffer,
+		                 storage_media_buffer->raw_buffer_data_size,
+		                 storage_media_buffer->compression_buffer,
+		                 &( storage_media_buffer->compression_buffer_data_size ),
+		                 &( storage_media_buffer->is_compressed ),
+		                 &( storage_media_buffer->checksum ),
+		                 &( storage_media_buffer->process_checksum ),
+		                 error );
 
-	if( process_count == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to prepare storage media buffer before writing.",
-		 function );
+		if( process_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to prepare storage media buffer before writing.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
+	}
+	else
+	{
+		process_count = storage_media_buffer->raw_buffer_data_size;
 	}
-#else
-	process_count = storage_media_buffer->raw_buffer_data_size;
-#endif
 
 	return( process_count );
 }
@@ -1079,10 +1151,8 @@ ssize_t imaging_handle_write_buffer(
 	ssize_t secondary_write_count = 0;
 	ssize_t write_count           = 0;
 
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
 	uint8_t *raw_write_buffer     = NULL;
 	size_t raw_write_buffer_size  = 0;
-#endif
 
 	if( imaging_handle == NULL )
 	{
@@ -1110,45 +1180,48 @@ ssize_t imaging_handle_write_buffer(
 	{
 		return( 0 );
 	}
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-	if( storage_media_buffer->is_compressed == 0 )
+	if( storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
 	{
-		raw_write_buffer      = storage_media_buffer->raw_buffer;
-		raw_write_buffer_size = storage_media_buffer->raw_buffer_data_size;
+		if( storage_media_buffer->is_compressed == 0 )
+		{
+			raw_write_buffer      = storage_media_buffer->raw_buffer;
+			raw_write_buffer_size = storage_media_buffer->raw_buffer_data_size;
+		}
+		else
+		{
+			raw_write_buffer      = storage_media_buffer->compression_buffer;
+			raw_write_buffer_size = storage_media_buffer->compression_buffer_data_size;
+		}
+		if( write_size != raw_write_buffer_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: mismatch in write size and number of bytes in storage media buffer.",
+			 function );
+
+			return( -1 );
+		}
+		write_count = libewf_handle_write_chunk(
+		               imaging_handle->output_handle,
+		               raw_write_buffer,
+		               raw_write_buffer_size,
+		               storage_media_buffer->raw_buffer_data_size,
+		               storage_media_buffer->is_compressed,
+		               storage_media_buffer->checksum_buffer,
+		               storage_media_buffer->checksum,
+		               storage_media_buffer->process_checksum,
+		               error );
 	}
 	else
 	{
-		raw_write_buffer      = storage_media_buffer->compression_buffer;
-		raw_write_buffer_size = storage_media_buffer->compression_buffer_data_size;
+		write_count = libewf_handle_write_buffer(
+		               imaging_handle->output_handle,
+		               storage_media_buffer->raw_buffer,
+		               write_size,
+		               error );
 	}
-	if( write_size != raw_write_buffer_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: mismatch in write size and number of bytes in storage media buffer.",
-		 function );
-
-		return( -1 );
-	}
-	write_count = libewf_handle_write_chunk(
-	               imaging_handle->output_handle,
-	               raw_write_buffer,
-	               raw_write_buffer_size,
-	               storage_media_buffer->raw_buffer_data_size,
-	               storage_media_buffer->is_compressed,
-	               storage_media_buffer->checksum_buffer,
-	               storage_media_buffer->checksum,
-	               storage_media_buffer->process_checksum,
-	               error );
-#else
-	write_count = libewf_handle_write_buffer(
-	               imaging_handle->output_handle,
-	               storage_media_buffer->raw_buffer,
-	               write_size,
-	               error );
-#endif
 
 	if( write_count == -1 )
 	{
@@ -1172,49 +1245,276 @@ ssize_t imaging_handle_write_buffer(
 	}
 	if( imaging_handle->secondary_output_handle != NULL )
 	{
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-		secondary_write_count = libewf_handle_write_chunk(
-		                         imaging_handle->secondary_output_handle,
-		                         raw_write_buffer,
-		                         raw_write_buffer_size,
-		                         storage_media_buffer->raw_buffer_data_size,
-		                         storage_media_buffer->is_compressed,
-		                         storage_media_buffer->checksum_buffer,
-		                         storage_media_buffer->checksum,
-		                         storage_media_buffer->process_checksum,
-		                         error );
-#else
-		secondary_write_count = libewf_handle_write_buffer(
-		                         imaging_handle->secondary_output_handle,
-		                         storage_media_buffer->raw_buffer,
-		                         write_size,
-		                         error );
-#endif
+		if( storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
+		{
+			secondary_write_count = libewf_handle_write_chunk(
+			                         imaging_handle->secondary_output_handle,
+			                         raw_write_buffer,
+			                         raw_write_buffer_size,
+			                         storage_media_buffer->raw_buffer_data_size,
+			                         storage_media_buffer->is_compressed,
+			                         storage_media_buffer->checksum_buffer,
+			                         storage_media_buffer->checksum,
+			                         storage_media_buffer->process_checksum,
+			                         error );
+		}
+		else
+		{
+			secondary_write_count = libewf_handle_write_buffer(
+			                         imaging_handle->secondary_output_handle,
+			                         storage_media_buffer->raw_buffer,
+			                         write_size,
+			                         error );
+		}
+
+		if( secondary_write_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write storage media buffer to secondary output handle.",
+			 function );
+
+			if( ( error != NULL )
+			 && ( libcerror_error_matches(
+			       *error,
+			       LIBCERROR_ERROR_DOMAIN_OUTPUT,
+			       LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE ) == 0 ) )
+			{
+				return( -1 );
+			}
+/* TODO ask for alternative segment file location and try again */
+			return( -1 );
+		}
+	}
+	return( write_count );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Starts the threads that process and write the storage media buffers
+ * Returns 1 if successful or -1 on error
+ */
+int imaging_handle_threads_start(
+     imaging_handle_t *imaging_handle,
+     size_t process_buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "imaging_handle_threads_start";
+
+	if( imaging_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid imaging handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( imaging_handle->process_threads != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid imaging handle - process threads value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( imaging_handle->number_of_threads <= 0 )
+	 || ( imaging_handle->number_of_threads > IMAGING_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid imaging handle - number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( process_threads_initialize(
+	     &( imaging_handle->process_threads ),
+	     imaging_handle->number_of_threads,
+	     process_buffer_size,
+	     (int (*)(storage_media_buffer_t *, void *, libcerror_error_t **)) &imaging_handle_process_storage_media_buffer_callback,
+	     (int (*)(storage_media_buffer_t *, void *, libcerror_error_t **)) &imaging_handle_output_storage_media_buffer_callback,
+	     (void *) imaging_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create process threads.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Stops the threads that process and write the storage media buffers
+ * Waits for the pending storage media buffers to be processed and written
+ * Returns 1 if successful or -1 on error
+ */
+int imaging_handle_threads_stop(
+     imaging_handle_t *imaging_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "imaging_handle_threads_stop";
+
+	if( imaging_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid imaging handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( process_threads_free(
+	     &( imaging_handle->process_threads ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free process threads.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Callback function to process a storage media buffer
+ * This compresses the chunk data
+ * Returns 1 if successful or -1 on error
+ */
+int imaging_handle_process_storage_media_buffer_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     imaging_handle_t *imaging_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "imaging_handle_process_storage_media_buffer_callback";
+
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( imaging_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid imaging handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The remaining storage media buffers are no longer processed after an abort
+	 */
+	if( imaging_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	storage_media_buffer->process_count = imaging_handle_prepare_write_buffer(
+	                                       imaging_handle,
+	                                       storage_media_buffer,
+	                                       error );
+
+	if( storage_media_buffer->process_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to prepare storage media buffer before write.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Callback function to write a processed storage media buffer
+ * Returns 1 if successful or -1 on error
+ */
+int imaging_handle_output_storage_media_buffer_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     imaging_handle_t *imaging_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "imaging_handle_output_storage_media_buffer_callback";
+	ssize_t write_count   = 0;
+
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( imaging_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid imaging handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The remaining storage media buffers are no longer written after an abort
+	 * they are only returned to the queue
+	 */
+	if( imaging_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	write_count = imaging_handle_write_buffer(
+	               imaging_handle,
+	               storage_media_buffer,
+	               (size_t) storage_media_buffer->process_count,
+	               error );
 
-		if( secondary_write_count == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write storage media buffer to secondary output handle.",
-			 function );
+	if( write_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write storage media buffer.",
+		 function );
 
-			if( ( error != NULL )
-			 && ( libcerror_error_matches(
-			       *error,
-			       LIBCERROR_ERROR_DOMAIN_OUTPUT,
-			       LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE ) == 0 ) )
-			{
-				return( -1 );
-			}
-/* TODO ask for alternative segment file location and try again */
-			return( -1 );
-		}
+		return( -1 );
 	}
-	return( write_count );
+	return( 1 );
 }
 
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 /* Seeks the offset in the input file
  * Returns the new offset if successful or -1 on error
  */
@@ -1557,59 +1857,22 @@ int imaging_handle_update_integrity_hash(
 
 		return( -1 );
 	}
-	if( imaging_handle->calculate_md5 != 0 )
-	{
-		if( libhmac_md5_update(
-		     imaging_handle->md5_context,
-		     buffer,
-		     buffer_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update MD5 digest hash.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	if( imaging_handle->calculate_sha1 != 0 )
-	{
-		if( libhmac_sha1_update(
-		     imaging_handle->sha1_context,
-		     buffer,
-		     buffer_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update SHA1 digest hash.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	if( imaging_handle->calculate_sha256 != 0 )
+	if( integrity_hash_update(
+	     ( imaging_handle->calculate_md5 != 0 ) ? imaging_handle->md5_context : NULL,
+	     ( imaging_handle->calculate_sha1 != 0 ) ? imaging_handle->sha1_context : NULL,
+	     ( imaging_handle->calculate_sha256 != 0 ) ? imaging_handle->sha256_context : NULL,
+	     buffer,
+	     buffer_size,
+	     error ) != 1 )
 	{
-		if( libhmac_sha256_update(
-		     imaging_handle->sha256_context,
-		     buffer,
-		     buffer_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update SHA256 digest hash.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update integrity hash.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
 	return( 1 );
 }
@@ -3848,6 +4111,117 @@ int imaging_handle_set_process_buffer_size(
 	return( result );
 }
 
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int imaging_handle_set_number_of_threads(
+     imaging_handle_t *imaging_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function  = "imaging_handle_set_number_of_threads";
+	size_t string_length   = 0;
+	uint64_t value_64bit   = 0;
+	int result             = 0;
+
+	if( imaging_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid imaging handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] != (libcstring_system_character_t) '-' )
+	{
+		string_length = libcstring_system_string_length(
+				 string );
+
+		if( libcsystem_string_decimal_copy_to_64_bit(
+		     string,
+		     string_length + 1,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine number of threads.",
+			 function );
+
+			return( -1 );
+		}
+		/* Without multi-threading support only 0 threads are supported
+		 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( value_64bit <= (uint64_t) IMAGING_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+#else
+		if( value_64bit == 0 )
+#endif
+		{
+			imaging_handle->number_of_threads = (int) value_64bit;
+
+			result = 1;
+		}
+	}
+	return( result );
+}
+
+/* Sets the value to indicate the output data should be dropped from the system page cache
+ * Returns 1 if successful or -1 on error
+ */
+int imaging_handle_set_drop_cached_data(
+     imaging_handle_t *imaging_handle,
+     uint8_t drop_cached_data,
+     libcerror_error_t **error )
+{
+	static char *function = "imaging_handle_set_drop_cached_data";
+
+	if( imaging_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid imaging handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_handle_set_drop_cached_data(
+	     imaging_handle->output_handle,
+	     drop_cached_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set drop cached data in output handle.",
+		 function );
+
+		return( -1 );
+	}
+	imaging_handle->drop_cached_data = drop_cached_data;
+
+	return( 1 );
+}
+
 /* Sets the additional digest types
  * Returns 1 if successful or -1 on error
  */
@@ -6075,3 +6449,128 @@ int imaging_handle_print_hashes(
 	return( 1 );
 }
 
+/* Prints the zero run statistics of the output handle
+ * Returns 1 if successful or -1 on error
+ */
+int imaging_handle_print_zero_run_statistics(
+     imaging_handle_t *imaging_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	libcstring_system_character_t largest_zero_run_size_string[ 16 ];
+	libcstring_system_character_t zero_data_size_string[ 16 ];
+
+	static char *function          = "imaging_handle_print_zero_run_statistics";
+	size64_t largest_zero_run_size = 0;
+	size64_t zero_data_size        = 0;
+	uint64_t number_of_zero_runs   = 0;
+	int result                     = 0;
+
+	if( imaging_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid imaging handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid imaging stream.",
+		 function );
+
+		return( -1 );
+	}
+	/* Empty blocks are only detected if the chunks are compressed
+	 */
+	if( ( imaging_handle->compression_level == LIBEWF_COMPRESSION_NONE )
+	 && ( ( imaging_handle->compression_flags & LIBEWF_COMPRESS_FLAG_USE_EMPTY_BLOCK_COMPRESSION ) == 0 ) )
+	{
+		return( 1 );
+	}
+	if( libewf_handle_get_zero_run_statistics(
+	     imaging_handle->output_handle,
+	     &zero_data_size,
+	     &number_of_zero_runs,
+	     &largest_zero_run_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve zero run statistics.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stream,
+	 "Empty blocks of zero bytes:\t\t" );
+
+	result = byte_size_string_create(
+	          zero_data_size_string,
+	          16,
+	          zero_data_size,
+	          BYTE_SIZE_STRING_UNIT_MEBIBYTE,
+	          NULL );
+
+	if( result == 1 )
+	{
+		fprintf(
+		 stream,
+		 "%" PRIs_LIBCSTRING_SYSTEM " (%" PRIu64 " bytes)",
+		 zero_data_size_string,
+		 zero_data_size );
+	}
+	else
+	{
+		fprintf(
+		 stream,
+		 "%" PRIu64 " bytes",
+		 zero_data_size );
+	}
+	fprintf(
+	 stream,
+	 " in %" PRIu64 " runs\n",
+	 number_of_zero_runs );
+
+	if( number_of_zero_runs > 0 )
+	{
+		fprintf(
+		 stream,
+		 "Largest run of zero bytes:\t\t" );
+
+		result = byte_size_string_create(
+		          largest_zero_run_size_string,
+		          16,
+		          largest_zero_run_size,
+		          BYTE_SIZE_STRING_UNIT_MEBIBYTE,
+		          NULL );
+
+		if( result == 1 )
+		{
+			fprintf(
+			 stream,
+			 "%" PRIs_LIBCSTRING_SYSTEM " (%" PRIu64 " bytes)\n",
+			 largest_zero_run_size_string,
+			 largest_zero_run_size );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "%" PRIu64 " bytes\n",
+			 largest_zero_run_size );
+		}
+	}
+	return( 1 );
+}
+
@@ -30,12 +30,15 @@
 #include "ewftools_libcstring.h"
 #include "ewftools_libewf.h"
 #include "ewftools_libhmac.h"
+#include "process_threads.h"
 #include "storage_media_buffer.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+#define IMAGING_HANDLE_MAXIMUM_NUMBER_OF_THREADS	128
+
 typedef struct imaging_handle imaging_handle_t;
 
 struct imaging_handle
@@ -216,6 +219,21 @@ struct imaging_handle
 	 */
 	size_t process_buffer_size;
 
+	/* The number of threads used to process the storage media buffers
+	 * 0 represents that no threads are used
+	 */
+	int number_of_threads;
+
+	/* Value to indicate the output data should be dropped from the system page cache
+	 */
+	uint8_t drop_cached_data;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The process threads
+	 */
+	process_threads_t *process_threads;
+#endif
+
 	/* The nofication output stream
 	 */
 	FILE *notify_stream;
@@ -276,6 +294,27 @@ ssize_t imaging_handle_write_buffer(
          size_t write_size,
          libcerror_error_t **error );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+int imaging_handle_threads_start(
+     imaging_handle_t *imaging_handle,
+     size_t process_buffer_size,
+     libcerror_error_t **error );
+
+int imaging_handle_threads_stop(
+     imaging_handle_t *imaging_handle,
+     libcerror_error_t **error );
+
+int imaging_handle_process_storage_media_buffer_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     imaging_handle_t *imaging_handle,
+     libcerror_error_t **error );
+
+int imaging_handle_output_storage_media_buffer_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     imaging_handle_t *imaging_handle,
+     libcerror_error_t **error );
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 off64_t imaging_handle_seek_offset(
          imaging_handle_t *imaging_handle,
          off64_t offset,
@@ -444,6 +483,16 @@ int imaging_handle_set_process_buffer_size(
      const libcstring_system_character_t *string,
      libcerror_error_t **error );
 
+int imaging_handle_set_number_of_threads(
+     imaging_handle_t *imaging_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error );
+
+int imaging_handle_set_drop_cached_data(
+     imaging_handle_t *imaging_handle,
+     uint8_t drop_cached_data,
+     libcerror_error_t **error );
+
 int imaging_handle_set_additional_digest_types(
      imaging_handle_t *imaging_handle,
      const libcstring_system_character_t *string,
@@ -515,6 +564,11 @@ int imaging_handle_print_hashes(
      FILE *stream,
      libcerror_error_t **error );
 
+int imaging_handle_print_zero_run_statistics(
+     imaging_handle_t *imaging_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,133 @@
+/*
+ * Integrity hash
+ *
+ * Copyright (c) 2006-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "ewftools_libcerror.h"
+#include "ewftools_libhmac.h"
+#include "integrity_hash.h"
+
+/* Updates the digest hashes
+ * The digest hashes are skipped if their context is NULL
+ * Returns 1 if successful or -1 on error
+ */
+int integrity_hash_update(
+     libhmac_md5_context_t *md5_context,
+     libhmac_sha1_context_t *sha1_context,
+     libhmac_sha256_context_t *sha256_context,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "integrity_hash_update";
+	size_t block_size     = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_size > 0 )
+	{
+		block_size = buffer_size;
+
+		if( block_size > INTEGRITY_HASH_BLOCK_SIZE )
+		{
+			block_size = INTEGRITY_HASH_BLOCK_SIZE;
+		}
+		if( md5_context != NULL )
+		{
+			if( libhmac_md5_update(
+			     md5_context,
+			     buffer,
+			     block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update MD5 digest hash.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( sha1_context != NULL )
+		{
+			if( libhmac_sha1_update(
+			     sha1_context,
+			     buffer,
+			     block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update SHA1 digest hash.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( sha256_context != NULL )
+		{
+			if( libhmac_sha256_update(
+			     sha256_context,
+			     buffer,
+			     block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update SHA256 digest hash.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		buffer      += block_size;
+		buffer_size -= block_size;
+	}
+	return( 1 );
+}
+
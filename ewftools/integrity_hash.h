@@ -0,0 +1,54 @@
+/*
+ * Integrity hash
+ *
+ * Copyright (c) 2006-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _INTEGRITY_HASH_H )
+#define _INTEGRITY_HASH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "ewftools_libcerror.h"
+#include "ewftools_libhmac.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the blocks in which a buffer is passed to the digest hashes
+ * All digest hashes are updated per block so that the block is read from memory
+ * once and remains in the CPU cache for the other digest hashes
+ */
+#define INTEGRITY_HASH_BLOCK_SIZE			( 16 * 1024 )
+
+int integrity_hash_update(
+     libhmac_md5_context_t *md5_context,
+     libhmac_sha1_context_t *sha1_context,
+     libhmac_sha256_context_t *sha256_context,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -0,0 +1,911 @@
+/*
+ * Mount file entry
+ *
+ * Copyright (c) 2006-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "ewftools_libcerror.h"
+#include "ewftools_libcstring.h"
+#include "ewftools_libcthreads.h"
+#include "ewftools_libewf.h"
+#include "mount_file_entry.h"
+
+/* Creates a mount file entry
+ * Make sure the value mount_file_entry is pointing to is set to NULL
+ * The mount file entry takes over the management of the libewf file entry on success
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_entry_initialize(
+     mount_file_entry_t **mount_file_entry,
+     const libcstring_system_character_t *path,
+     size_t path_length,
+     uint32_t path_hash,
+     libewf_file_entry_t *file_entry,
+     uint64_t inode_number,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_initialize";
+	size_t path_index     = 0;
+
+	if( mount_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mount_file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mount file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	*mount_file_entry = memory_allocate_structure(
+	                     mount_file_entry_t );
+
+	if( *mount_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create mount file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *mount_file_entry,
+	     0,
+	     sizeof( mount_file_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear mount file entry.",
+		 function );
+
+		memory_free(
+		 *mount_file_entry );
+
+		*mount_file_entry = NULL;
+
+		return( -1 );
+	}
+	( *mount_file_entry )->path = libcstring_system_string_allocate(
+	                               path_length + 1 );
+
+	if( ( *mount_file_entry )->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcstring_system_string_copy(
+	     ( *mount_file_entry )->path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		goto on_error;
+	}
+	( *mount_file_entry )->path[ path_length ] = 0;
+
+	for( path_index = 0;
+	     path_index < path_length;
+	     path_index++ )
+	{
+		if( path[ path_index ] == (libcstring_system_character_t) '/' )
+		{
+			( *mount_file_entry )->name_index = path_index + 1;
+		}
+	}
+	if( libewf_file_entry_get_number_of_sub_file_entries(
+	     file_entry,
+	     &( ( *mount_file_entry )->number_of_sub_file_entries ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub file entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_file_entry_get_size(
+	     file_entry,
+	     &( ( *mount_file_entry )->size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_file_entry_get_modification_time(
+	     file_entry,
+	     &( ( *mount_file_entry )->modification_time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve modification time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_file_entry_get_access_time(
+	     file_entry,
+	     &( ( *mount_file_entry )->access_time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve access time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_file_entry_get_entry_modification_time(
+	     file_entry,
+	     &( ( *mount_file_entry )->entry_modification_time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry modification time.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *mount_file_entry )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *mount_file_entry )->path_length  = path_length;
+	( *mount_file_entry )->path_hash    = path_hash;
+	( *mount_file_entry )->file_entry   = file_entry;
+	( *mount_file_entry )->inode_number = inode_number;
+
+	return( 1 );
+
+on_error:
+	if( *mount_file_entry != NULL )
+	{
+		if( ( *mount_file_entry )->path != NULL )
+		{
+			memory_free(
+			 ( *mount_file_entry )->path );
+		}
+		memory_free(
+		 *mount_file_entry );
+
+		*mount_file_entry = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a mount file entry
+ * The sub file entries are not freed since they are managed by the mount handle
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_entry_free(
+     mount_file_entry_t **mount_file_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_free";
+	int result            = 1;
+
+	if( mount_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mount_file_entry != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *mount_file_entry )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *mount_file_entry )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( libewf_file_entry_free(
+		     &( ( *mount_file_entry )->file_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *mount_file_entry )->read_ahead_buffer != NULL )
+		{
+			memory_free(
+			 ( *mount_file_entry )->read_ahead_buffer );
+		}
+		if( ( *mount_file_entry )->sub_file_entries != NULL )
+		{
+			memory_free(
+			 ( *mount_file_entry )->sub_file_entries );
+		}
+		memory_free(
+		 ( *mount_file_entry )->path );
+
+		memory_free(
+		 *mount_file_entry );
+
+		*mount_file_entry = NULL;
+	}
+	return( result );
+}
+
+/* Calculates the hash of a path
+ * The hash is a 32-bit FNV-1a of the path characters
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_entry_get_path_hash(
+     const libcstring_system_character_t *path,
+     size_t path_length,
+     uint32_t *path_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_get_path_hash";
+	size_t path_index     = 0;
+	uint32_t hash         = 0x811c9dc5UL;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path hash.",
+		 function );
+
+		return( -1 );
+	}
+	for( path_index = 0;
+	     path_index < path_length;
+	     path_index++ )
+	{
+		hash ^= (uint32_t) path[ path_index ];
+		hash *= 0x01000193UL;
+	}
+	*path_hash = hash;
+
+	return( 1 );
+}
+
+/* Opens the mount file entry for reading
+ * Every open must be matched by a close
+ * An open mount file entry is not evicted from the mount handle cache
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_entry_open(
+     mount_file_entry_t *mount_file_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_open";
+
+	if( mount_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount file entry.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     mount_file_entry->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( mount_file_entry->reference_count == 0 )
+	{
+		mount_file_entry->read_ahead_offset    = 0;
+		mount_file_entry->read_ahead_data_size = 0;
+		mount_file_entry->last_read_offset     = 0;
+	}
+	mount_file_entry->reference_count += 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     mount_file_entry->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Closes the mount file entry
+ * The read-ahead buffer is freed when the last reference is closed
+ * Returns 0 if successful or -1 on error
+ */
+int mount_file_entry_close(
+     mount_file_entry_t *mount_file_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_close";
+	int result            = 0;
+
+	if( mount_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount file entry.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     mount_file_entry->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( mount_file_entry->reference_count <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid mount file entry - reference count value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		mount_file_entry->reference_count -= 1;
+
+		if( ( mount_file_entry->reference_count == 0 )
+		 && ( mount_file_entry->read_ahead_buffer != NULL ) )
+		{
+			memory_free(
+			 mount_file_entry->read_ahead_buffer );
+
+			mount_file_entry->read_ahead_buffer      = NULL;
+			mount_file_entry->read_ahead_buffer_size = 0;
+			mount_file_entry->read_ahead_data_size   = 0;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     mount_file_entry->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads a buffer at a specific offset from the mount file entry
+ * Sequential reads of an open file entry are served from a read-ahead buffer
+ * The mutex only protects the read-ahead buffer state, the data is read without holding it
+ * Returns the number of bytes read if successful or -1 on error
+ */
+ssize_t mount_file_entry_read_buffer_at_offset(
+         mount_file_entry_t *mount_file_entry,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	uint8_t *read_ahead_buffer    = NULL;
+	static char *function         = "mount_file_entry_read_buffer_at_offset";
+	size64_t remaining_size       = 0;
+	size_t buffer_offset          = 0;
+	size_t read_ahead_buffer_size = 0;
+	size_t read_ahead_size        = 0;
+	ssize_t read_count            = 0;
+	uint8_t fill_read_ahead       = 0;
+
+	if( mount_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= mount_file_entry->size )
+	{
+		return( 0 );
+	}
+	remaining_size = mount_file_entry->size - (size64_t) offset;
+
+	if( (size64_t) size > remaining_size )
+	{
+		size = (size_t) remaining_size;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     mount_file_entry->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( mount_file_entry->read_ahead_data_size > 0 )
+	 && ( offset >= mount_file_entry->read_ahead_offset )
+	 && ( (size64_t) ( offset + size ) <= (size64_t) ( mount_file_entry->read_ahead_offset + mount_file_entry->read_ahead_data_size ) ) )
+	{
+		buffer_offset = (size_t) ( offset - mount_file_entry->read_ahead_offset );
+
+		if( memory_copy(
+		     buffer,
+		     &( mount_file_entry->read_ahead_buffer[ buffer_offset ] ),
+		     size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy read-ahead data.",
+			 function );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			libcthreads_mutex_release(
+			 mount_file_entry->mutex,
+			 NULL );
+#endif
+			return( -1 );
+		}
+		mount_file_entry->last_read_offset = offset + size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     mount_file_entry->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		return( (ssize_t) size );
+	}
+	/* The read-ahead buffer is only used while the file entry is open
+	 * and filled when the read continues where the previous read ended
+	 * While the buffer is filled it is detached from the file entry
+	 * and concurrent reads of the file entry read their data directly
+	 */
+	if( ( mount_file_entry->reference_count > 0 )
+	 && ( mount_file_entry->read_ahead_buffer_in_use == 0 )
+	 && ( offset == mount_file_entry->last_read_offset )
+	 && ( size < MOUNT_FILE_ENTRY_READ_AHEAD_SIZE ) )
+	{
+		read_ahead_buffer      = mount_file_entry->read_ahead_buffer;
+		read_ahead_buffer_size = mount_file_entry->read_ahead_buffer_size;
+
+		mount_file_entry->read_ahead_buffer        = NULL;
+		mount_file_entry->read_ahead_buffer_size   = 0;
+		mount_file_entry->read_ahead_data_size     = 0;
+		mount_file_entry->read_ahead_buffer_in_use = 1;
+
+		fill_read_ahead = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     mount_file_entry->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		fill_read_ahead = 0;
+
+		goto on_error;
+	}
+#endif
+	if( fill_read_ahead != 0 )
+	{
+		read_ahead_size = MOUNT_FILE_ENTRY_READ_AHEAD_SIZE;
+
+		if( (size64_t) read_ahead_size > remaining_size )
+		{
+			read_ahead_size = (size_t) remaining_size;
+		}
+		if( read_ahead_buffer_size < read_ahead_size )
+		{
+			if( read_ahead_buffer != NULL )
+			{
+				memory_free(
+				 read_ahead_buffer );
+
+				read_ahead_buffer_size = 0;
+			}
+			/* Small files only need a buffer of their size
+			 */
+			if( mount_file_entry->size < (size64_t) MOUNT_FILE_ENTRY_READ_AHEAD_SIZE )
+			{
+				read_ahead_buffer_size = (size_t) mount_file_entry->size;
+			}
+			else
+			{
+				read_ahead_buffer_size = MOUNT_FILE_ENTRY_READ_AHEAD_SIZE;
+			}
+			read_ahead_buffer = (uint8_t *) memory_allocate(
+			                                 sizeof( uint8_t ) * read_ahead_buffer_size );
+
+			if( read_ahead_buffer == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create read-ahead buffer.",
+				 function );
+
+				read_ahead_buffer_size = 0;
+
+				goto on_error;
+			}
+		}
+		read_count = libewf_file_entry_read_random(
+		              mount_file_entry->file_entry,
+		              read_ahead_buffer,
+		              read_ahead_size,
+		              offset,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read read-ahead data at offset: %" PRIi64 ".",
+			 function,
+			 offset );
+
+			goto on_error;
+		}
+		read_ahead_size = (size_t) read_count;
+
+		if( size > read_ahead_size )
+		{
+			size = read_ahead_size;
+		}
+		if( memory_copy(
+		     buffer,
+		     read_ahead_buffer,
+		     size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy read-ahead data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = (ssize_t) size;
+	}
+	else
+	{
+		read_count = libewf_file_entry_read_random(
+		              mount_file_entry->file_entry,
+		              buffer,
+		              size,
+		              offset,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 ".",
+			 function,
+			 offset );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     mount_file_entry->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( fill_read_ahead != 0 )
+	{
+		/* The file entry can have been closed while the buffer was filled
+		 */
+		if( mount_file_entry->reference_count > 0 )
+		{
+			mount_file_entry->read_ahead_buffer      = read_ahead_buffer;
+			mount_file_entry->read_ahead_buffer_size = read_ahead_buffer_size;
+			mount_file_entry->read_ahead_offset      = offset;
+			mount_file_entry->read_ahead_data_size   = read_ahead_size;
+
+			read_ahead_buffer = NULL;
+		}
+		mount_file_entry->read_ahead_buffer_in_use = 0;
+	}
+	mount_file_entry->last_read_offset = offset + read_count;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     mount_file_entry->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		fill_read_ahead = 0;
+
+		goto on_error;
+	}
+#endif
+	if( read_ahead_buffer != NULL )
+	{
+		memory_free(
+		 read_ahead_buffer );
+	}
+	return( read_count );
+
+on_error:
+	if( fill_read_ahead != 0 )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     mount_file_entry->mutex,
+		     NULL ) == 1 )
+#endif
+		{
+			mount_file_entry->read_ahead_buffer_in_use = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			libcthreads_mutex_release(
+			 mount_file_entry->mutex,
+			 NULL );
+#endif
+		}
+	}
+	if( read_ahead_buffer != NULL )
+	{
+		memory_free(
+		 read_ahead_buffer );
+	}
+	return( -1 );
+}
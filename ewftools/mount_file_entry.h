@@ -0,0 +1,179 @@
+/*
+ * Mount file entry
+ *
+ * Copyright (c) 2006-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MOUNT_FILE_ENTRY_H )
+#define _MOUNT_FILE_ENTRY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "ewftools_libcerror.h"
+#include "ewftools_libcstring.h"
+#include "ewftools_libcthreads.h"
+#include "ewftools_libewf.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of the read-ahead buffer of an open file entry
+ */
+#define MOUNT_FILE_ENTRY_READ_AHEAD_SIZE	( 512 * 1024 )
+
+typedef struct mount_file_entry mount_file_entry_t;
+
+struct mount_file_entry
+{
+	/* The path
+	 */
+	libcstring_system_character_t *path;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The index of the name in the path
+	 */
+	size_t name_index;
+
+	/* The path hash
+	 */
+	uint32_t path_hash;
+
+	/* The next file entry in the same hash bucket
+	 */
+	mount_file_entry_t *next_file_entry;
+
+	/* The more recently used file entry
+	 */
+	mount_file_entry_t *previous_used_file_entry;
+
+	/* The less recently used file entry
+	 */
+	mount_file_entry_t *next_used_file_entry;
+
+	/* The libewf file entry
+	 */
+	libewf_file_entry_t *file_entry;
+
+	/* The inode number
+	 */
+	uint64_t inode_number;
+
+	/* The number of sub file entries
+	 */
+	int number_of_sub_file_entries;
+
+	/* The sub file entries, which are set once the directory is read
+	 */
+	mount_file_entry_t **sub_file_entries;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The modification time
+	 */
+	uint32_t modification_time;
+
+	/* The access time
+	 */
+	uint32_t access_time;
+
+	/* The entry modification time
+	 */
+	uint32_t entry_modification_time;
+
+	/* The number of times the file entry is open
+	 */
+	int reference_count;
+
+	/* The read-ahead buffer
+	 */
+	uint8_t *read_ahead_buffer;
+
+	/* The read-ahead buffer size
+	 */
+	size_t read_ahead_buffer_size;
+
+	/* The offset of the data in the read-ahead buffer
+	 */
+	off64_t read_ahead_offset;
+
+	/* The size of the data in the read-ahead buffer
+	 */
+	size_t read_ahead_data_size;
+
+	/* Value to indicate the read-ahead buffer is being filled
+	 */
+	uint8_t read_ahead_buffer_in_use;
+
+	/* The offset following the last read
+	 */
+	off64_t last_read_offset;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int mount_file_entry_initialize(
+     mount_file_entry_t **mount_file_entry,
+     const libcstring_system_character_t *path,
+     size_t path_length,
+     uint32_t path_hash,
+     libewf_file_entry_t *file_entry,
+     uint64_t inode_number,
+     libcerror_error_t **error );
+
+int mount_file_entry_free(
+     mount_file_entry_t **mount_file_entry,
+     libcerror_error_t **error );
+
+int mount_file_entry_get_path_hash(
+     const libcstring_system_character_t *path,
+     size_t path_length,
+     uint32_t *path_hash,
+     libcerror_error_t **error );
+
+int mount_file_entry_open(
+     mount_file_entry_t *mount_file_entry,
+     libcerror_error_t **error );
+
+int mount_file_entry_close(
+     mount_file_entry_t *mount_file_entry,
+     libcerror_error_t **error );
+
+ssize_t mount_file_entry_read_buffer_at_offset(
+         mount_file_entry_t *mount_file_entry,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
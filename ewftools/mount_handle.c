@@ -25,6 +25,8 @@
 
 #include "ewftools_libcerror.h"
 #include "ewftools_libcstring.h"
+#include "ewftools_libcsystem.h"
+#include "ewftools_libcthreads.h"
 #include "ewftools_libewf.h"
 #include "mount_handle.h"
 
@@ -100,13 +102,39 @@ int mount_handle_initialize(
 
 		goto on_error;
 	}
-	( *mount_handle )->input_format = MOUNT_HANDLE_INPUT_FORMAT_RAW;
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *mount_handle )->file_entries_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entries mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *mount_handle )->input_format      = MOUNT_HANDLE_INPUT_FORMAT_RAW;
+	( *mount_handle )->number_of_threads = MOUNT_HANDLE_DEFAULT_NUMBER_OF_THREADS;
+
+	/* Inode number 1 is reserved for the root directory
+	 */
+	( *mount_handle )->next_inode_number = 2;
 
 	return( 1 );
 
 on_error:
 	if( *mount_handle != NULL )
 	{
+		if( ( *mount_handle )->input_handle != NULL )
+		{
+			libewf_handle_free(
+			 &( ( *mount_handle )->input_handle ),
+			 NULL );
+		}
 		memory_free(
 		 *mount_handle );
 
@@ -122,8 +150,11 @@ int mount_handle_free(
      mount_handle_t **mount_handle,
      libcerror_error_t **error )
 {
-	static char *function = "mount_handle_free";
-	int result            = 1;
+	mount_file_entry_t *mount_file_entry = NULL;
+	static char *function                = "mount_handle_free";
+	size_t bucket_index                  = 0;
+	int input_handle_index               = 0;
+	int result                           = 1;
 
 	if( mount_handle == NULL )
 	{
@@ -138,6 +169,126 @@ int mount_handle_free(
 	}
 	if( *mount_handle != NULL )
 	{
+		if( ( *mount_handle )->input_handles != NULL )
+		{
+			/* The first input handle is freed as the input handle
+			 */
+			for( input_handle_index = 1;
+			     input_handle_index < ( *mount_handle )->number_of_input_handles;
+			     input_handle_index++ )
+			{
+				if( ( *mount_handle )->input_handles[ input_handle_index ] == NULL )
+				{
+					continue;
+				}
+				if( libewf_handle_free(
+				     &( ( *mount_handle )->input_handles[ input_handle_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free input handle: %d.",
+					 function,
+					 input_handle_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *mount_handle )->input_handles );
+		}
+		if( ( *mount_handle )->input_handle_offsets != NULL )
+		{
+			memory_free(
+			 ( *mount_handle )->input_handle_offsets );
+		}
+		if( ( *mount_handle )->input_handle_in_use != NULL )
+		{
+			memory_free(
+			 ( *mount_handle )->input_handle_in_use );
+		}
+		if( ( *mount_handle )->file_entries != NULL )
+		{
+			for( bucket_index = 0;
+			     bucket_index < ( *mount_handle )->number_of_file_entry_buckets;
+			     bucket_index++ )
+			{
+				while( ( *mount_handle )->file_entries[ bucket_index ] != NULL )
+				{
+					mount_file_entry = ( *mount_handle )->file_entries[ bucket_index ];
+
+					( *mount_handle )->file_entries[ bucket_index ] = mount_file_entry->next_file_entry;
+
+					if( mount_file_entry_free(
+					     &mount_file_entry,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free mount file entry.",
+						 function );
+
+						result = -1;
+					}
+				}
+			}
+			memory_free(
+			 ( *mount_handle )->file_entries );
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *mount_handle )->file_entries_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *mount_handle )->file_entries_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file entries mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *mount_handle )->input_handles_condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *mount_handle )->input_handles_condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input handles condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *mount_handle )->input_handles_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *mount_handle )->input_handles_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input handles mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
 		if( ( *mount_handle )->root_file_entry != NULL )
 		{
 			if( libewf_file_entry_free(
@@ -182,7 +333,8 @@ int mount_handle_signal_abort(
      mount_handle_t *mount_handle,
      libcerror_error_t **error )
 {
-	static char *function = "mount_handle_signal_abort";
+	static char *function  = "mount_handle_signal_abort";
+	int input_handle_index = 0;
 
 	if( mount_handle == NULL )
 	{
@@ -211,6 +363,32 @@ int mount_handle_signal_abort(
 			return( -1 );
 		}
 	}
+	if( mount_handle->input_handles != NULL )
+	{
+		for( input_handle_index = 1;
+		     input_handle_index < mount_handle->number_of_input_handles;
+		     input_handle_index++ )
+		{
+			if( mount_handle->input_handles[ input_handle_index ] == NULL )
+			{
+				continue;
+			}
+			if( libewf_handle_signal_abort(
+			     mount_handle->input_handles[ input_handle_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to signal input handle: %d to abort.",
+				 function,
+				 input_handle_index );
+
+				return( -1 );
+			}
+		}
+	}
 	return( 1 );
 }
 
@@ -235,6 +413,11 @@ int mount_handle_set_maximum_number_of_open_handles(
 
 		return( -1 );
 	}
+	/* The value is stored so that the limit can be divided
+	 * over the input handles when they are opened
+	 */
+	mount_handle->maximum_number_of_open_handles = maximum_number_of_open_handles;
+
 	if( libewf_handle_set_maximum_number_of_open_handles(
 	     mount_handle->input_handle,
 	     maximum_number_of_open_handles,
@@ -252,6 +435,244 @@ int mount_handle_set_maximum_number_of_open_handles(
 	return( 1 );
 }
 
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int mount_handle_set_number_of_threads(
+     mount_handle_t *mount_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_set_number_of_threads";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] != (libcstring_system_character_t) '-' )
+	{
+		string_length = libcstring_system_string_length(
+				 string );
+
+		if( libcsystem_string_decimal_copy_to_64_bit(
+		     string,
+		     string_length + 1,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine number of threads.",
+			 function );
+
+			return( -1 );
+		}
+		/* Without multi-threading support only 1 thread is supported
+		 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( value_64bit >= 1 )
+		 && ( value_64bit <= (uint64_t) MOUNT_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+#else
+		if( value_64bit == 1 )
+#endif
+		{
+			mount_handle->number_of_threads = (int) value_64bit;
+
+			result = 1;
+		}
+	}
+	return( result );
+}
+
+/* Sets the maximum cache size
+ * The size is expressed in MiB and divided over the input handles
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int mount_handle_set_maximum_cache_size(
+     mount_handle_t *mount_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_set_maximum_cache_size";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] != (libcstring_system_character_t) '-' )
+	{
+		string_length = libcstring_system_string_length(
+				 string );
+
+		if( libcsystem_string_decimal_copy_to_64_bit(
+		     string,
+		     string_length + 1,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine maximum cache size.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( value_64bit >= 1 )
+		 && ( value_64bit <= (uint64_t) MOUNT_HANDLE_MAXIMUM_CACHE_SIZE ) )
+		{
+			mount_handle->maximum_cache_size = (size64_t) value_64bit * 1024 * 1024;
+
+			result = 1;
+		}
+	}
+	return( result );
+}
+
+/* Sets the read-ahead size of the input handles
+ * The size is rounded up to a number of chunks, it should correspond
+ * to the size of the reads issued by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_set_read_ahead_size(
+     mount_handle_t *mount_handle,
+     size_t read_ahead_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "mount_handle_set_read_ahead_size";
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libewf_handle_t *input_handle = NULL;
+	size32_t chunk_size           = 0;
+	int input_handle_index        = 0;
+	int number_of_chunks          = 0;
+	int number_of_input_handles   = 1;
+#endif
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_ahead_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid read-ahead size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libewf_handle_get_chunk_size(
+	     mount_handle->input_handle,
+	     &chunk_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_size == 0 )
+	{
+		return( 1 );
+	}
+	number_of_chunks = (int) ( ( read_ahead_size + chunk_size - 1 ) / chunk_size );
+
+	if( mount_handle->input_handles != NULL )
+	{
+		number_of_input_handles = mount_handle->number_of_input_handles;
+	}
+	for( input_handle_index = 0;
+	     input_handle_index < number_of_input_handles;
+	     input_handle_index++ )
+	{
+		if( mount_handle->input_handles != NULL )
+		{
+			input_handle = mount_handle->input_handles[ input_handle_index ];
+		}
+		else
+		{
+			input_handle = mount_handle->input_handle;
+		}
+		if( libewf_handle_set_read_ahead(
+		     input_handle,
+		     number_of_chunks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set read-ahead in input handle: %d.",
+			 function,
+			 input_handle_index );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
 /* Sets the format
  * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
@@ -422,28 +843,66 @@ int mount_handle_open_input(
 		}
 		return( -1 );
 	}
-	if( libewf_filenames != NULL )
+	if( mount_handle->maximum_cache_size > 0 )
 	{
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		if( libewf_glob_wide_free(
-		     libewf_filenames,
-		     number_of_filenames,
-		     error ) != 1 )
-#else
-		if( libewf_glob_free(
-		     libewf_filenames,
-		     number_of_filenames,
+		if( libewf_handle_set_maximum_cache_size(
+		     mount_handle->input_handle,
+		     mount_handle->maximum_cache_size,
 		     error ) != 1 )
-#endif
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free globbed filenames.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum cache size in input handle.",
 			 function );
 
-			return( -1 );
+			goto on_error;
+		}
+	}
+	/* In raw mode the media data is read using an input handle per thread
+	 */
+	if( ( mount_handle->input_format == MOUNT_HANDLE_INPUT_FORMAT_RAW )
+	 && ( mount_handle->number_of_threads > 1 ) )
+	{
+		if( mount_handle_open_input_handles(
+		     mount_handle,
+		     filenames,
+		     number_of_filenames,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open input handles.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libewf_filenames != NULL )
+	{
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libewf_glob_wide_free(
+		     libewf_filenames,
+		     number_of_filenames,
+		     error ) != 1 )
+#else
+		if( libewf_glob_free(
+		     libewf_filenames,
+		     number_of_filenames,
+		     error ) != 1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free globbed filenames.",
+			 function );
+
+			return( -1 );
 		}
 	}
 	if( mount_handle->input_format == MOUNT_HANDLE_INPUT_FORMAT_FILES )
@@ -464,16 +923,42 @@ int mount_handle_open_input(
 		}
 	}
 	return( 1 );
+
+on_error:
+	if( libewf_filenames != NULL )
+	{
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+		libewf_glob_wide_free(
+		 libewf_filenames,
+		 number_of_filenames,
+		 NULL );
+#else
+		libewf_glob_free(
+		 libewf_filenames,
+		 number_of_filenames,
+		 NULL );
+#endif
+	}
+	return( -1 );
 }
 
-/* Closes the mount handle
- * Returns the 0 if succesful or -1 on error
+/* Opens additional input handles to read the media data concurrently
+ * The number of input handles corresponds to the number of threads
+ * the maximum cache size and number of open handles are divided over the input handles
+ * Returns 1 if successful or -1 on error
  */
-int mount_handle_close(
+int mount_handle_open_input_handles(
      mount_handle_t *mount_handle,
+     libcstring_system_character_t * const * filenames,
+     int number_of_filenames,
      libcerror_error_t **error )
 {
-	static char *function = "mount_handle_close";
+	static char *function              = "mount_handle_open_input_handles";
+	size64_t maximum_cache_size        = 0;
+	size_t array_size                  = 0;
+	int input_handle_index             = 0;
+	int maximum_number_of_open_handles = 0;
+	int number_of_input_handles        = 0;
 
 	if( mount_handle == NULL )
 	{
@@ -486,282 +971,2185 @@ int mount_handle_close(
 
 		return( -1 );
 	}
-	if( libewf_handle_close(
-	     mount_handle->input_handle,
-	     error ) != 0 )
+	if( mount_handle->input_handles != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close input handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mount handle - input handles already set.",
 		 function );
 
 		return( -1 );
 	}
-	return( 0 );
-}
-
-/* Read a buffer from the input handle
- * Return the number of bytes read if successful or -1 on error
- */
-ssize_t mount_handle_read_buffer(
-         mount_handle_t *mount_handle,
-         uint8_t *buffer,
-         size_t size,
-         libcerror_error_t **error )
-{
-	static char *function = "mount_handle_read_buffer";
-	ssize_t read_count    = 0;
-
-	if( mount_handle == NULL )
+	if( ( mount_handle->number_of_threads <= 0 )
+	 || ( mount_handle->number_of_threads > MOUNT_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid mount handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid mount handle - number of threads value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	read_count = libewf_handle_read_buffer(
-	              mount_handle->input_handle,
-	              buffer,
-	              size,
-	              error );
+	number_of_input_handles = mount_handle->number_of_threads;
 
-	if( read_count == -1 )
+	array_size = sizeof( libewf_handle_t * ) * number_of_input_handles;
+
+	mount_handle->input_handles = (libewf_handle_t **) memory_allocate(
+	                                                    array_size );
+
+	if( mount_handle->input_handles == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer from input handle.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create input handles.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	return( read_count );
-}
-
-/* Seeks a specific offset from the input handle
- * Return the offset if successful or -1 on error
- */
-off64_t mount_handle_seek_offset(
-         mount_handle_t *mount_handle,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
-{
-	static char *function = "mount_handle_seek_offset";
-
-	if( mount_handle == NULL )
+	if( memory_set(
+	     mount_handle->input_handles,
+	     0,
+	     array_size ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid mount handle.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear input handles.",
 		 function );
 
-		return( -1 );
+		memory_free(
+		 mount_handle->input_handles );
+
+		mount_handle->input_handles = NULL;
+
+		goto on_error;
 	}
-	offset = libewf_handle_seek_offset(
-	          mount_handle->input_handle,
-	          offset,
-	          whence,
-	          error );
+	array_size = sizeof( off64_t ) * number_of_input_handles;
 
-	if( offset == -1 )
+	mount_handle->input_handle_offsets = (off64_t *) memory_allocate(
+	                                                  array_size );
+
+	if( mount_handle->input_handle_offsets == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset in input handle.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create input handle offsets.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	return( offset );
-}
+	array_size = sizeof( uint8_t ) * number_of_input_handles;
 
-/* Retrieves the media size of the input handle
- * Returns 1 if successful or -1 on error
- */
-int mount_handle_get_media_size(
-     mount_handle_t *mount_handle,
-     size64_t *size,
-     libcerror_error_t **error )
-{
-	static char *function = "mount_handle_get_media_size";
+	mount_handle->input_handle_in_use = (uint8_t *) memory_allocate(
+	                                                 array_size );
 
-	if( mount_handle == NULL )
+	if( mount_handle->input_handle_in_use == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid mount handle.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create input handle in use values.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libewf_handle_get_media_size(
-	     mount_handle->input_handle,
-	     size,
-	     error ) != 1 )
+	if( memory_set(
+	     mount_handle->input_handle_in_use,
+	     0,
+	     array_size ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve media size from input handle.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear input handle in use values.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	return( 1 );
-}
+	mount_handle->number_of_input_handles = number_of_input_handles;
 
-/* Retrieves the file entry of a specific path
- * Returns 1 if successful, 0 if no such file entry or -1 on error
- */
-int mount_handle_get_file_entry_by_path(
-     mount_handle_t *mount_handle,
-     const libcstring_system_character_t *path,
-     size_t path_length,
-     libewf_file_entry_t **file_entry,
-     libcerror_error_t **error )
-{
-	libcstring_system_character_t *ewf_path = NULL;
-	static char *function                   = "mount_handle_get_file_entry_by_path";
-	size_t path_index                       = 0;
-	int result                              = 0;
+	if( mount_handle->maximum_number_of_open_handles > 0 )
+	{
+		maximum_number_of_open_handles = mount_handle->maximum_number_of_open_handles / number_of_input_handles;
 
-	if( mount_handle == NULL )
+		/* The file IO pool requires room for at least 2 open handles
+		 */
+		if( maximum_number_of_open_handles < 2 )
+		{
+			maximum_number_of_open_handles = 2;
+		}
+	}
+	maximum_cache_size = mount_handle->maximum_cache_size / number_of_input_handles;
+
+	for( input_handle_index = 0;
+	     input_handle_index < number_of_input_handles;
+	     input_handle_index++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid mount handle.",
-		 function );
+		mount_handle->input_handle_offsets[ input_handle_index ] = -1;
 
-		return( -1 );
+		if( input_handle_index == 0 )
+		{
+			mount_handle->input_handles[ input_handle_index ] = mount_handle->input_handle;
+		}
+		else
+		{
+			if( libewf_handle_initialize(
+			     &( mount_handle->input_handles[ input_handle_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize input handle: %d.",
+				 function,
+				 input_handle_index );
+
+				goto on_error;
+			}
+		}
+		if( maximum_number_of_open_handles > 0 )
+		{
+			if( libewf_handle_set_maximum_number_of_open_handles(
+			     mount_handle->input_handles[ input_handle_index ],
+			     maximum_number_of_open_handles,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set maximum number of open handles in input handle: %d.",
+				 function,
+				 input_handle_index );
+
+				goto on_error;
+			}
+		}
+		if( input_handle_index > 0 )
+		{
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+			if( libewf_handle_open_wide(
+			     mount_handle->input_handles[ input_handle_index ],
+			     filenames,
+			     number_of_filenames,
+			     LIBEWF_OPEN_READ,
+			     error ) != 1 )
+#else
+			if( libewf_handle_open(
+			     mount_handle->input_handles[ input_handle_index ],
+			     filenames,
+			     number_of_filenames,
+			     LIBEWF_OPEN_READ,
+			     error ) != 1 )
+#endif
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open input handle: %d.",
+				 function,
+				 input_handle_index );
+
+				goto on_error;
+			}
+		}
+		if( maximum_cache_size > 0 )
+		{
+			if( libewf_handle_set_maximum_cache_size(
+			     mount_handle->input_handles[ input_handle_index ],
+			     maximum_cache_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set maximum cache size in input handle: %d.",
+				 function,
+				 input_handle_index );
+
+				goto on_error;
+			}
+		}
 	}
-	if( path == NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( mount_handle->input_handles_mutex ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create input handles mutex.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( path_length == 0 )
+	if( libcthreads_condition_initialize(
+	     &( mount_handle->input_handles_condition ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path length.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create input handles condition.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( path[ 0 ] != (libcstring_system_character_t) '/' )
-	{
-		libcerror_error_set(
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( mount_handle->input_handles_mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( mount_handle->input_handles_mutex ),
+		 NULL );
+	}
+#endif
+	if( mount_handle->input_handles != NULL )
+	{
+		for( input_handle_index = 1;
+		     input_handle_index < number_of_input_handles;
+		     input_handle_index++ )
+		{
+			if( mount_handle->input_handles[ input_handle_index ] != NULL )
+			{
+				libewf_handle_free(
+				 &( mount_handle->input_handles[ input_handle_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 mount_handle->input_handles );
+
+		mount_handle->input_handles = NULL;
+	}
+	if( mount_handle->input_handle_offsets != NULL )
+	{
+		memory_free(
+		 mount_handle->input_handle_offsets );
+
+		mount_handle->input_handle_offsets = NULL;
+	}
+	if( mount_handle->input_handle_in_use != NULL )
+	{
+		memory_free(
+		 mount_handle->input_handle_in_use );
+
+		mount_handle->input_handle_in_use = NULL;
+	}
+	mount_handle->number_of_input_handles = 0;
+
+	return( -1 );
+}
+
+/* Closes the mount handle
+ * All input handles are closed, also when closing one of them fails
+ * Returns the 0 if succesful or -1 on error
+ */
+int mount_handle_close(
+     mount_handle_t *mount_handle,
+     libcerror_error_t **error )
+{
+	static char *function  = "mount_handle_close";
+	int input_handle_index = 0;
+	int result             = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported path.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
 		 function );
 
 		return( -1 );
 	}
-	ewf_path = libcstring_system_string_allocate(
-	            path_length + 1 );
+	if( libewf_handle_close(
+	     mount_handle->input_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input handle.",
+		 function );
 
-	if( ewf_path == NULL )
+		result = -1;
+	}
+	if( mount_handle->input_handles != NULL )
+	{
+		for( input_handle_index = 1;
+		     input_handle_index < mount_handle->number_of_input_handles;
+		     input_handle_index++ )
+		{
+			if( libewf_handle_close(
+			     mount_handle->input_handles[ input_handle_index ],
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close input handle: %d.",
+				 function,
+				 input_handle_index );
+
+				result = -1;
+			}
+		}
+	}
+	return( result );
+}
+
+/* Read a buffer from the input handle
+ * Return the number of bytes read if successful or -1 on error
+ */
+ssize_t mount_handle_read_buffer(
+         mount_handle_t *mount_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "mount_handle_read_buffer";
+	ssize_t read_count    = 0;
+
+	if( mount_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create REGF path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( memory_copy(
-	     ewf_path,
-	     path,
-	     path_length + 1 ) == NULL )
+	read_count = libewf_handle_read_buffer(
+	              mount_handle->input_handle,
+	              buffer,
+	              size,
+	              error );
+
+	if( read_count == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy REGF path.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from input handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( path_index = 0;
-	     path_index < path_length;
-	     path_index++ )
+	return( read_count );
+}
+
+/* Read a buffer at a specific offset from the input handles
+ * The read does not change the offset of the input handle and can be issued concurrently
+ * Return the number of bytes read if successful or -1 on error
+ */
+ssize_t mount_handle_read_buffer_at_offset(
+         mount_handle_t *mount_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function  = "mount_handle_read_buffer_at_offset";
+	ssize_t read_count     = 0;
+	int input_handle_index = 0;
+
+	if( mount_handle == NULL )
 	{
-		if( ewf_path[ path_index ] == (libcstring_system_character_t) '/' )
-		{
-			ewf_path[ path_index ] = (libcstring_system_character_t) '\\';
-		}
-		else if( ewf_path[ path_index ] == (libcstring_system_character_t) '\\' )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_handle->input_handles == NULL )
+	{
+		read_count = libewf_handle_read_random(
+		              mount_handle->input_handle,
+		              buffer,
+		              size,
+		              offset,
+		              error );
+
+		if( read_count == -1 )
 		{
-			ewf_path[ path_index ] = (libcstring_system_character_t) '/';
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " from input handle.",
+			 function,
+			 offset );
+
+			return( -1 );
 		}
+		return( read_count );
 	}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libewf_file_get_file_entry_by_utf16_path(
-		  mount_handle->input_handle,
-		  (uint16_t *) ewf_path,
-		  path_length,
-		  file_entry,
-		  error );
-#else
-	result = libewf_file_get_file_entry_by_utf8_path(
-		  mount_handle->input_handle,
-		  (uint8_t *) ewf_path,
-		  path_length,
-		  file_entry,
-		  error );
-#endif
-	if( result == -1 )
+	if( mount_handle_grab_input_handle(
+	     mount_handle,
+	     offset,
+	     &input_handle_index,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry.",
+		 "%s: unable to grab input handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	memory_free(
-	 ewf_path );
+	read_count = libewf_handle_read_random(
+	              mount_handle->input_handles[ input_handle_index ],
+	              buffer,
+	              size,
+	              offset,
+	              error );
 
-	return( result );
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " from input handle: %d.",
+		 function,
+		 offset,
+		 input_handle_index );
 
-on_error:
-	if( ewf_path != NULL )
+		mount_handle_release_input_handle(
+		 mount_handle,
+		 input_handle_index,
+		 -1,
+		 NULL );
+
+		return( -1 );
+	}
+	if( mount_handle_release_input_handle(
+	     mount_handle,
+	     input_handle_index,
+	     offset + read_count,
+	     error ) != 1 )
 	{
-		memory_free(
-		 ewf_path );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release input handle: %d.",
+		 function,
+		 input_handle_index );
+
+		return( -1 );
 	}
-	return( -1 );
+	return( read_count );
+}
+
+/* Grabs an input handle that is not in use
+ * An input handle of which the last read ended at the offset is preferred
+ * so that the read-ahead of sequential readers remains effective
+ * Blocks until an input handle becomes available
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_grab_input_handle(
+     mount_handle_t *mount_handle,
+     off64_t offset,
+     int *input_handle_index,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_grab_input_handle";
+	int free_index        = -1;
+	int index             = 0;
+	int result            = 1;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_handle->input_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid mount handle - missing input handles.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_handle_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input handle index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     mount_handle->input_handles_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab input handles mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	do
+	{
+		for( index = 0;
+		     index < mount_handle->number_of_input_handles;
+		     index++ )
+		{
+			if( mount_handle->input_handle_in_use[ index ] != 0 )
+			{
+				continue;
+			}
+			if( mount_handle->input_handle_offsets[ index ] == offset )
+			{
+				free_index = index;
+
+				break;
+			}
+			if( free_index == -1 )
+			{
+				free_index = index;
+			}
+		}
+		if( free_index != -1 )
+		{
+			break;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_wait(
+		     mount_handle->input_handles_condition,
+		     mount_handle->input_handles_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for input handles condition.",
+			 function );
+
+			result = -1;
+		}
+#else
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: no input handle available.",
+		 function );
+
+		result = -1;
+#endif
+	}
+	while( result == 1 );
+
+	if( result == 1 )
+	{
+		mount_handle->input_handle_in_use[ free_index ] = 1;
+
+		*input_handle_index = free_index;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     mount_handle->input_handles_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release input handles mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Releases an input handle
+ * The offset is the offset following the last read or -1 if not known
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_release_input_handle(
+     mount_handle_t *mount_handle,
+     int input_handle_index,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_release_input_handle";
+	int result            = 1;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_handle->input_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid mount handle - missing input handles.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( input_handle_index < 0 )
+	 || ( input_handle_index >= mount_handle->number_of_input_handles ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input handle index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     mount_handle->input_handles_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab input handles mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	mount_handle->input_handle_in_use[ input_handle_index ]  = 0;
+	mount_handle->input_handle_offsets[ input_handle_index ] = offset;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_condition_signal(
+	     mount_handle->input_handles_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to signal input handles condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     mount_handle->input_handles_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release input handles mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Seeks a specific offset from the input handle
+ * Return the offset if successful or -1 on error
+ */
+off64_t mount_handle_seek_offset(
+         mount_handle_t *mount_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "mount_handle_seek_offset";
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	offset = libewf_handle_seek_offset(
+	          mount_handle->input_handle,
+	          offset,
+	          whence,
+	          error );
+
+	if( offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset in input handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( offset );
+}
+
+/* Retrieves the media size of the input handle
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_get_media_size(
+     mount_handle_t *mount_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_get_media_size";
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_handle_get_media_size(
+	     mount_handle->input_handle,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media size from input handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the file entry of a specific path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int mount_handle_get_file_entry_by_path(
+     mount_handle_t *mount_handle,
+     const libcstring_system_character_t *path,
+     size_t path_length,
+     libewf_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libcstring_system_character_t *ewf_path = NULL;
+	static char *function                   = "mount_handle_get_file_entry_by_path";
+	size_t path_index                       = 0;
+	int result                              = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path length.",
+		 function );
+
+		return( -1 );
+	}
+	if( path[ 0 ] != (libcstring_system_character_t) '/' )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported path.",
+		 function );
+
+		return( -1 );
+	}
+	ewf_path = libcstring_system_string_allocate(
+	            path_length + 1 );
+
+	if( ewf_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create REGF path.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     ewf_path,
+	     path,
+	     path_length + 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy REGF path.",
+		 function );
+
+		goto on_error;
+	}
+	for( path_index = 0;
+	     path_index < path_length;
+	     path_index++ )
+	{
+		if( ewf_path[ path_index ] == (libcstring_system_character_t) '/' )
+		{
+			ewf_path[ path_index ] = (libcstring_system_character_t) '\\';
+		}
+		else if( ewf_path[ path_index ] == (libcstring_system_character_t) '\\' )
+		{
+			ewf_path[ path_index ] = (libcstring_system_character_t) '/';
+		}
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libewf_file_get_file_entry_by_utf16_path(
+		  mount_handle->input_handle,
+		  (uint16_t *) ewf_path,
+		  path_length,
+		  file_entry,
+		  error );
+#else
+	result = libewf_file_get_file_entry_by_utf8_path(
+		  mount_handle->input_handle,
+		  (uint8_t *) ewf_path,
+		  path_length,
+		  file_entry,
+		  error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 ewf_path );
+
+	return( result );
+
+on_error:
+	if( ewf_path != NULL )
+	{
+		memory_free(
+		 ewf_path );
+	}
+	return( -1 );
+}
+
+/* Retrieves a mount file entry for a specific path
+ * The mount file entries are cached, so the path is only resolved while it remains cached
+ * The mount file entry is opened, which prevents it from being evicted from the cache,
+ * and must be closed with mount_file_entry_close
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int mount_handle_get_mount_file_entry_by_path(
+     mount_handle_t *mount_handle,
+     const libcstring_system_character_t *path,
+     size_t path_length,
+     mount_file_entry_t **mount_file_entry,
+     libcerror_error_t **error )
+{
+	libewf_file_entry_t *file_entry = NULL;
+	static char *function           = "mount_handle_get_mount_file_entry_by_path";
+	uint32_t path_hash              = 0;
+	int result                      = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_entry_get_path_hash(
+	     path,
+	     path_length,
+	     &path_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine path hash.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     mount_handle->file_entries_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab file entries mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = mount_handle_get_cached_mount_file_entry(
+	          mount_handle,
+	          path,
+	          path_length,
+	          path_hash,
+	          mount_file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached mount file entry.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		result = mount_handle_get_file_entry_by_path(
+		          mount_handle,
+		          path,
+		          path_length,
+		          &file_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( mount_handle_append_mount_file_entry(
+			     mount_handle,
+			     path,
+			     path_length,
+			     path_hash,
+			     file_entry,
+			     mount_file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append mount file entry.",
+				 function );
+
+				goto on_error;
+			}
+			file_entry = NULL;
+		}
+	}
+	if( result != 0 )
+	{
+		if( mount_file_entry_open(
+		     *mount_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open mount file entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     mount_handle->file_entries_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file entries mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+	if( file_entry != NULL )
+	{
+		libewf_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 mount_handle->file_entries_mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the sub mount file entries of a mount file entry
+ * The sub mount file entries are determined once and cached with their attributes
+ * The mount file entry must be open. The sub mount file entries are opened
+ * and must be closed with mount_handle_close_sub_mount_file_entries
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_get_sub_mount_file_entries(
+     mount_handle_t *mount_handle,
+     mount_file_entry_t *mount_file_entry,
+     mount_file_entry_t ***sub_mount_file_entries,
+     int *number_of_sub_mount_file_entries,
+     libcerror_error_t **error )
+{
+	libcstring_system_character_t *sub_path = NULL;
+	libewf_file_entry_t *sub_file_entry     = NULL;
+	mount_file_entry_t **sub_file_entries   = NULL;
+	static char *function                   = "mount_handle_get_sub_mount_file_entries";
+	size_t name_size                        = 0;
+	size_t parent_path_length               = 0;
+	size_t path_index                       = 0;
+	size_t sub_path_length                  = 0;
+	uint32_t sub_path_hash                  = 0;
+	int number_of_open_sub_file_entries     = 0;
+	int result                              = 0;
+	int sub_file_entry_index                = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_mount_file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub mount file entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_mount_file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sub mount file entries.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     mount_handle->file_entries_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab file entries mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( mount_file_entry->sub_file_entries == NULL )
+	 && ( mount_file_entry->number_of_sub_file_entries > 0 ) )
+	{
+		sub_file_entries = (mount_file_entry_t **) memory_allocate(
+		                                            sizeof( mount_file_entry_t * ) * mount_file_entry->number_of_sub_file_entries );
+
+		if( sub_file_entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sub file entries.",
+			 function );
+
+			goto on_error;
+		}
+		/* The sub path of the root directory does not need an additional separator
+		 */
+		parent_path_length = mount_file_entry->path_length;
+
+		if( parent_path_length == 1 )
+		{
+			parent_path_length = 0;
+		}
+		for( sub_file_entry_index = 0;
+		     sub_file_entry_index < mount_file_entry->number_of_sub_file_entries;
+		     sub_file_entry_index++ )
+		{
+			if( libewf_file_entry_get_sub_file_entry(
+			     mount_file_entry->file_entry,
+			     sub_file_entry_index,
+			     &sub_file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub file entry: %d.",
+				 function,
+				 sub_file_entry_index );
+
+				goto on_error;
+			}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libewf_file_entry_get_utf16_name_size(
+				  sub_file_entry,
+				  &name_size,
+				  error );
+#else
+			result = libewf_file_entry_get_utf8_name_size(
+				  sub_file_entry,
+				  &name_size,
+				  error );
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub file entry: %d name size.",
+				 function,
+				 sub_file_entry_index );
+
+				goto on_error;
+			}
+			if( name_size == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing sub file entry: %d name.",
+				 function,
+				 sub_file_entry_index );
+
+				goto on_error;
+			}
+			sub_path = libcstring_system_string_allocate(
+			            parent_path_length + 1 + name_size );
+
+			if( sub_path == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create sub path.",
+				 function );
+
+				goto on_error;
+			}
+			if( parent_path_length > 0 )
+			{
+				if( libcstring_system_string_copy(
+				     sub_path,
+				     mount_file_entry->path,
+				     parent_path_length ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy path to sub path.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			sub_path[ parent_path_length ] = (libcstring_system_character_t) '/';
+
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libewf_file_entry_get_utf16_name(
+				  sub_file_entry,
+				  (uint16_t *) &( sub_path[ parent_path_length + 1 ] ),
+				  name_size,
+				  error );
+#else
+			result = libewf_file_entry_get_utf8_name(
+				  sub_file_entry,
+				  (uint8_t *) &( sub_path[ parent_path_length + 1 ] ),
+				  name_size,
+				  error );
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub file entry: %d name.",
+				 function,
+				 sub_file_entry_index );
+
+				goto on_error;
+			}
+			sub_path_length = parent_path_length + name_size;
+
+			/* Exchange / for \ in the name
+			 */
+			for( path_index = parent_path_length + 1;
+			     path_index < sub_path_length;
+			     path_index++ )
+			{
+				if( sub_path[ path_index ] == (libcstring_system_character_t) '/' )
+				{
+					sub_path[ path_index ] = (libcstring_system_character_t) '\\';
+				}
+			}
+			if( mount_file_entry_get_path_hash(
+			     sub_path,
+			     sub_path_length,
+			     &sub_path_hash,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine sub path hash.",
+				 function );
+
+				goto on_error;
+			}
+			result = mount_handle_get_cached_mount_file_entry(
+			          mount_handle,
+			          sub_path,
+			          sub_path_length,
+			          sub_path_hash,
+			          &( sub_file_entries[ sub_file_entry_index ] ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve cached mount file entry.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				if( mount_handle_append_mount_file_entry(
+				     mount_handle,
+				     sub_path,
+				     sub_path_length,
+				     sub_path_hash,
+				     sub_file_entry,
+				     &( sub_file_entries[ sub_file_entry_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append mount file entry.",
+					 function );
+
+					goto on_error;
+				}
+				sub_file_entry = NULL;
+			}
+			else if( libewf_file_entry_free(
+			          &sub_file_entry,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sub file entry: %d.",
+				 function,
+				 sub_file_entry_index );
+
+				goto on_error;
+			}
+			memory_free(
+			 sub_path );
+
+			sub_path = NULL;
+
+			/* The sub mount file entry is opened directly so that it cannot be evicted
+			 * by the appends of the remaining sub mount file entries
+			 */
+			if( mount_file_entry_open(
+			     sub_file_entries[ sub_file_entry_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open sub mount file entry: %d.",
+				 function,
+				 sub_file_entry_index );
+
+				goto on_error;
+			}
+			number_of_open_sub_file_entries++;
+		}
+		mount_file_entry->sub_file_entries = sub_file_entries;
+	}
+	else
+	{
+		for( sub_file_entry_index = 0;
+		     sub_file_entry_index < mount_file_entry->number_of_sub_file_entries;
+		     sub_file_entry_index++ )
+		{
+			if( mount_file_entry_open(
+			     mount_file_entry->sub_file_entries[ sub_file_entry_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open sub mount file entry: %d.",
+				 function,
+				 sub_file_entry_index );
+
+				goto on_error;
+			}
+			number_of_open_sub_file_entries++;
+		}
+	}
+	*sub_mount_file_entries           = mount_file_entry->sub_file_entries;
+	*number_of_sub_mount_file_entries = mount_file_entry->number_of_sub_file_entries;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     mount_handle->file_entries_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file entries mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( sub_path != NULL )
+	{
+		memory_free(
+		 sub_path );
+	}
+	if( sub_file_entry != NULL )
+	{
+		libewf_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	/* The sub mount file entries that were appended remain cached
+	 */
+	if( sub_file_entries != NULL )
+	{
+		for( sub_file_entry_index = 0;
+		     sub_file_entry_index < number_of_open_sub_file_entries;
+		     sub_file_entry_index++ )
+		{
+			mount_file_entry_close(
+			 sub_file_entries[ sub_file_entry_index ],
+			 NULL );
+		}
+		memory_free(
+		 sub_file_entries );
+	}
+	else if( mount_file_entry->sub_file_entries != NULL )
+	{
+		for( sub_file_entry_index = 0;
+		     sub_file_entry_index < number_of_open_sub_file_entries;
+		     sub_file_entry_index++ )
+		{
+			mount_file_entry_close(
+			 mount_file_entry->sub_file_entries[ sub_file_entry_index ],
+			 NULL );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 mount_handle->file_entries_mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Closes the sub mount file entries opened by mount_handle_get_sub_mount_file_entries
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_close_sub_mount_file_entries(
+     mount_handle_t *mount_handle,
+     mount_file_entry_t *mount_file_entry,
+     libcerror_error_t **error )
+{
+	static char *function    = "mount_handle_close_sub_mount_file_entries";
+	int result               = 1;
+	int sub_file_entry_index = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_entry->sub_file_entries == NULL )
+	{
+		return( 1 );
+	}
+	/* The file entries mutex is held so that the sub file entries cannot be evicted,
+	 * which would free the sub file entries of the mount file entry, before all are closed
+	 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     mount_handle->file_entries_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab file entries mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( sub_file_entry_index = 0;
+	     sub_file_entry_index < mount_file_entry->number_of_sub_file_entries;
+	     sub_file_entry_index++ )
+	{
+		if( mount_file_entry_close(
+		     mount_file_entry->sub_file_entries[ sub_file_entry_index ],
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close sub mount file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     mount_handle->file_entries_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file entries mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a cached mount file entry
+ * The mount file entry is marked as the most recently used
+ * The file entries mutex should be held by the caller
+ * Returns 1 if successful, 0 if not cached or -1 on error
+ */
+int mount_handle_get_cached_mount_file_entry(
+     mount_handle_t *mount_handle,
+     const libcstring_system_character_t *path,
+     size_t path_length,
+     uint32_t path_hash,
+     mount_file_entry_t **mount_file_entry,
+     libcerror_error_t **error )
+{
+	mount_file_entry_t *cached_file_entry = NULL;
+	static char *function                 = "mount_handle_get_cached_mount_file_entry";
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_handle->file_entries == NULL )
+	{
+		return( 0 );
+	}
+	cached_file_entry = mount_handle->file_entries[ path_hash & ( mount_handle->number_of_file_entry_buckets - 1 ) ];
+
+	while( cached_file_entry != NULL )
+	{
+		if( ( cached_file_entry->path_hash == path_hash )
+		 && ( cached_file_entry->path_length == path_length )
+		 && ( libcstring_system_string_compare(
+		       cached_file_entry->path,
+		       path,
+		       path_length ) == 0 ) )
+		{
+			if( mount_handle_use_mount_file_entry(
+			     mount_handle,
+			     cached_file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to mark mount file entry as used.",
+				 function );
+
+				return( -1 );
+			}
+			*mount_file_entry = cached_file_entry;
+
+			return( 1 );
+		}
+		cached_file_entry = cached_file_entry->next_file_entry;
+	}
+	return( 0 );
+}
+
+/* Appends a mount file entry to the cache
+ * The mount file entry takes over the management of the libewf file entry on success
+ * When the cache is full the least recently used mount file entries that are not open are evicted
+ * The file entries mutex should be held by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_append_mount_file_entry(
+     mount_handle_t *mount_handle,
+     const libcstring_system_character_t *path,
+     size_t path_length,
+     uint32_t path_hash,
+     libewf_file_entry_t *file_entry,
+     mount_file_entry_t **mount_file_entry,
+     libcerror_error_t **error )
+{
+	mount_file_entry_t **file_entries     = NULL;
+	mount_file_entry_t *cached_file_entry = NULL;
+	static char *function                 = "mount_handle_append_mount_file_entry";
+	size_t bucket_index                   = 0;
+	size_t number_of_buckets              = 0;
+	uint64_t inode_number                 = 0;
+	int result                            = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount file entry.",
+		 function );
+
+		return( -1 );
+	}
+	/* The cache can exceed its maximum size when all mount file entries are open
+	 */
+	while( mount_handle->number_of_file_entries >= MOUNT_HANDLE_MAXIMUM_NUMBER_OF_FILE_ENTRIES )
+	{
+		result = mount_handle_evict_mount_file_entry(
+		          mount_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to evict mount file entry.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+	}
+	/* The hash table is grown when it contains on average more than 2 entries per bucket
+	 */
+	if( ( mount_handle->file_entries == NULL )
+	 || ( mount_handle->number_of_file_entries >= ( mount_handle->number_of_file_entry_buckets * 2 ) ) )
+	{
+		if( mount_handle->file_entries == NULL )
+		{
+			number_of_buckets = MOUNT_HANDLE_NUMBER_OF_FILE_ENTRY_BUCKETS;
+		}
+		else
+		{
+			number_of_buckets = mount_handle->number_of_file_entry_buckets * 2;
+		}
+		if( number_of_buckets > (size_t) ( SSIZE_MAX / sizeof( mount_file_entry_t * ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of buckets value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		file_entries = (mount_file_entry_t **) memory_allocate(
+		                                        sizeof( mount_file_entry_t * ) * number_of_buckets );
+
+		if( file_entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file entries.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     file_entries,
+		     0,
+		     sizeof( mount_file_entry_t * ) * number_of_buckets ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear file entries.",
+			 function );
+
+			memory_free(
+			 file_entries );
+
+			return( -1 );
+		}
+		if( mount_handle->file_entries != NULL )
+		{
+			for( bucket_index = 0;
+			     bucket_index < mount_handle->number_of_file_entry_buckets;
+			     bucket_index++ )
+			{
+				while( mount_handle->file_entries[ bucket_index ] != NULL )
+				{
+					cached_file_entry = mount_handle->file_entries[ bucket_index ];
+
+					mount_handle->file_entries[ bucket_index ] = cached_file_entry->next_file_entry;
+
+					cached_file_entry->next_file_entry = file_entries[ cached_file_entry->path_hash & ( number_of_buckets - 1 ) ];
+
+					file_entries[ cached_file_entry->path_hash & ( number_of_buckets - 1 ) ] = cached_file_entry;
+				}
+			}
+			memory_free(
+			 mount_handle->file_entries );
+		}
+		mount_handle->file_entries                 = file_entries;
+		mount_handle->number_of_file_entry_buckets = number_of_buckets;
+	}
+	/* The inode numbers are assigned in order of first use and remain the same
+	 * while the mount file entry is cached, a mount file entry that was evicted
+	 * is assigned a new inode number
+	 */
+	if( ( path_length == 1 )
+	 && ( path[ 0 ] == (libcstring_system_character_t) '/' ) )
+	{
+		inode_number = 1;
+	}
+	else
+	{
+		inode_number = mount_handle->next_inode_number;
+	}
+	if( mount_file_entry_initialize(
+	     &cached_file_entry,
+	     path,
+	     path_length,
+	     path_hash,
+	     file_entry,
+	     inode_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mount file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_number != 1 )
+	{
+		mount_handle->next_inode_number += 1;
+	}
+	bucket_index = (size_t) ( path_hash & ( mount_handle->number_of_file_entry_buckets - 1 ) );
+
+	cached_file_entry->next_file_entry = mount_handle->file_entries[ bucket_index ];
+
+	mount_handle->file_entries[ bucket_index ] = cached_file_entry;
+
+	mount_handle->number_of_file_entries += 1;
+
+	cached_file_entry->next_used_file_entry = mount_handle->most_recently_used_file_entry;
+
+	if( mount_handle->most_recently_used_file_entry != NULL )
+	{
+		mount_handle->most_recently_used_file_entry->previous_used_file_entry = cached_file_entry;
+	}
+	mount_handle->most_recently_used_file_entry = cached_file_entry;
+
+	if( mount_handle->least_recently_used_file_entry == NULL )
+	{
+		mount_handle->least_recently_used_file_entry = cached_file_entry;
+	}
+	*mount_file_entry = cached_file_entry;
+
+	return( 1 );
+}
+
+/* Marks a cached mount file entry as the most recently used
+ * The file entries mutex should be held by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_use_mount_file_entry(
+     mount_handle_t *mount_handle,
+     mount_file_entry_t *mount_file_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_use_mount_file_entry";
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_handle->most_recently_used_file_entry == mount_file_entry )
+	{
+		return( 1 );
+	}
+	/* Unlink the mount file entry, it is not the most recently used
+	 * so it has a more recently used mount file entry
+	 */
+	mount_file_entry->previous_used_file_entry->next_used_file_entry = mount_file_entry->next_used_file_entry;
+
+	if( mount_file_entry->next_used_file_entry != NULL )
+	{
+		mount_file_entry->next_used_file_entry->previous_used_file_entry = mount_file_entry->previous_used_file_entry;
+	}
+	else
+	{
+		mount_handle->least_recently_used_file_entry = mount_file_entry->previous_used_file_entry;
+	}
+	mount_file_entry->previous_used_file_entry = NULL;
+	mount_file_entry->next_used_file_entry     = mount_handle->most_recently_used_file_entry;
+
+	mount_handle->most_recently_used_file_entry->previous_used_file_entry = mount_file_entry;
+	mount_handle->most_recently_used_file_entry                           = mount_file_entry;
+
+	return( 1 );
+}
+
+/* Evicts the least recently used mount file entry that is not open from the cache
+ * The sub file entries of the cached parent mount file entry are freed
+ * so that they are determined again when the directory is read
+ * The file entries mutex should be held by the caller
+ * Returns 1 if successful, 0 if no mount file entry could be evicted or -1 on error
+ */
+int mount_handle_evict_mount_file_entry(
+     mount_handle_t *mount_handle,
+     libcerror_error_t **error )
+{
+	mount_file_entry_t *evicted_file_entry = NULL;
+	mount_file_entry_t *parent_file_entry  = NULL;
+	mount_file_entry_t **file_entry_slot   = NULL;
+	static char *function                  = "mount_handle_evict_mount_file_entry";
+	size_t parent_path_length              = 0;
+	uint32_t parent_path_hash              = 0;
+	int reference_count                    = 0;
+	int result                             = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The mount file entries are only opened while the file entries mutex is held
+	 * so a mount file entry that is not open cannot become open while it is evicted
+	 */
+	evicted_file_entry = mount_handle->least_recently_used_file_entry;
+
+	while( evicted_file_entry != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     evicted_file_entry->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mount file entry mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		reference_count = evicted_file_entry->reference_count;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     evicted_file_entry->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mount file entry mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( reference_count == 0 )
+		{
+			break;
+		}
+		evicted_file_entry = evicted_file_entry->previous_used_file_entry;
+	}
+	if( evicted_file_entry == NULL )
+	{
+		return( 0 );
+	}
+	if( evicted_file_entry->path_length > 1 )
+	{
+		/* The parent path of a file entry in the root directory is the root directory
+		 */
+		parent_path_length = evicted_file_entry->name_index - 1;
+
+		if( parent_path_length == 0 )
+		{
+			parent_path_length = 1;
+		}
+		if( mount_file_entry_get_path_hash(
+		     evicted_file_entry->path,
+		     parent_path_length,
+		     &parent_path_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine parent path hash.",
+			 function );
+
+			return( -1 );
+		}
+		result = mount_handle_get_cached_mount_file_entry(
+		          mount_handle,
+		          evicted_file_entry->path,
+		          parent_path_length,
+		          parent_path_hash,
+		          &parent_file_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cached parent mount file entry.",
+			 function );
+
+			return( -1 );
+		}
+		else if( ( result != 0 )
+		      && ( parent_file_entry->sub_file_entries != NULL ) )
+		{
+			memory_free(
+			 parent_file_entry->sub_file_entries );
+
+			parent_file_entry->sub_file_entries = NULL;
+		}
+	}
+	file_entry_slot = &( mount_handle->file_entries[ evicted_file_entry->path_hash & ( mount_handle->number_of_file_entry_buckets - 1 ) ] );
+
+	while( *file_entry_slot != evicted_file_entry )
+	{
+		file_entry_slot = &( ( *file_entry_slot )->next_file_entry );
+	}
+	*file_entry_slot = evicted_file_entry->next_file_entry;
+
+	if( evicted_file_entry->previous_used_file_entry != NULL )
+	{
+		evicted_file_entry->previous_used_file_entry->next_used_file_entry = evicted_file_entry->next_used_file_entry;
+	}
+	else
+	{
+		mount_handle->most_recently_used_file_entry = evicted_file_entry->next_used_file_entry;
+	}
+	if( evicted_file_entry->next_used_file_entry != NULL )
+	{
+		evicted_file_entry->next_used_file_entry->previous_used_file_entry = evicted_file_entry->previous_used_file_entry;
+	}
+	else
+	{
+		mount_handle->least_recently_used_file_entry = evicted_file_entry->previous_used_file_entry;
+	}
+	mount_handle->number_of_file_entries -= 1;
+
+	if( mount_file_entry_free(
+	     &evicted_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free mount file entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
 }
 
@@ -28,12 +28,31 @@
 
 #include "ewftools_libcerror.h"
 #include "ewftools_libcstring.h"
+#include "ewftools_libcthreads.h"
 #include "ewftools_libewf.h"
+#include "mount_file_entry.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+#define MOUNT_HANDLE_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The maximum cache size in MiB
+ */
+#define MOUNT_HANDLE_MAXIMUM_CACHE_SIZE		65536
+
+/* The initial number of hash buckets of the mount file entries
+ */
+#define MOUNT_HANDLE_NUMBER_OF_FILE_ENTRY_BUCKETS	1024
+
+/* The maximum number of cached mount file entries
+ * beyond which the least recently used file entries that are not open are evicted
+ */
+#define MOUNT_HANDLE_MAXIMUM_NUMBER_OF_FILE_ENTRIES	65536
+
+#define MOUNT_HANDLE_DEFAULT_NUMBER_OF_THREADS	1
+
 enum MOUNT_HANDLE_INPUT_FORMATS
 {
 	MOUNT_HANDLE_INPUT_FORMAT_FILES	= (int) 'f',
@@ -56,6 +75,75 @@ struct mount_handle
 	 */
 	libewf_file_entry_t *root_file_entry;
 
+	/* The number of (concurrent) read threads
+	 */
+	int number_of_threads;
+
+	/* The maximum number of open file handles
+	 */
+	int maximum_number_of_open_handles;
+
+	/* The maximum size of the chunk cache
+	 */
+	size64_t maximum_cache_size;
+
+	/* The number of libewf input handles used to read the media data
+	 */
+	int number_of_input_handles;
+
+	/* The libewf input handles used to read the media data
+	 * the first one is the libewf input handle
+	 */
+	libewf_handle_t **input_handles;
+
+	/* The media offset following the last read of each input handle
+	 */
+	off64_t *input_handle_offsets;
+
+	/* Values to indicate an input handle is in use
+	 */
+	uint8_t *input_handle_in_use;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The input handles mutex
+	 */
+	libcthreads_mutex_t *input_handles_mutex;
+
+	/* The input handles condition
+	 */
+	libcthreads_condition_t *input_handles_condition;
+#endif
+
+	/* The mount file entries hash table
+	 */
+	mount_file_entry_t **file_entries;
+
+	/* The number of hash buckets of the mount file entries
+	 */
+	size_t number_of_file_entry_buckets;
+
+	/* The number of mount file entries
+	 */
+	size_t number_of_file_entries;
+
+	/* The most recently used mount file entry
+	 */
+	mount_file_entry_t *most_recently_used_file_entry;
+
+	/* The least recently used mount file entry
+	 */
+	mount_file_entry_t *least_recently_used_file_entry;
+
+	/* The inode number of the next mount file entry
+	 */
+	uint64_t next_inode_number;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mount file entries mutex
+	 */
+	libcthreads_mutex_t *file_entries_mutex;
+#endif
+
 	/* The nofication output stream
 	 */
 	FILE *notify_stream;
@@ -78,6 +166,21 @@ int mount_handle_set_maximum_number_of_open_handles(
      int maximum_number_of_open_handles,
      libcerror_error_t **error );
 
+int mount_handle_set_number_of_threads(
+     mount_handle_t *mount_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error );
+
+int mount_handle_set_maximum_cache_size(
+     mount_handle_t *mount_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error );
+
+int mount_handle_set_read_ahead_size(
+     mount_handle_t *mount_handle,
+     size_t read_ahead_size,
+     libcerror_error_t **error );
+
 int mount_handle_set_format(
      mount_handle_t *mount_handle,
      const libcstring_system_character_t *string,
@@ -89,6 +192,12 @@ int mount_handle_open_input(
      int number_of_filenames,
      libcerror_error_t **error );
 
+int mount_handle_open_input_handles(
+     mount_handle_t *mount_handle,
+     libcstring_system_character_t * const * filenames,
+     int number_of_filenames,
+     libcerror_error_t **error );
+
 int mount_handle_close(
      mount_handle_t *mount_handle,
      libcerror_error_t **error );
@@ -99,6 +208,25 @@ ssize_t mount_handle_read_buffer(
          size_t size,
          libcerror_error_t **error );
 
+ssize_t mount_handle_read_buffer_at_offset(
+         mount_handle_t *mount_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int mount_handle_grab_input_handle(
+     mount_handle_t *mount_handle,
+     off64_t offset,
+     int *input_handle_index,
+     libcerror_error_t **error );
+
+int mount_handle_release_input_handle(
+     mount_handle_t *mount_handle,
+     int input_handle_index,
+     off64_t offset,
+     libcerror_error_t **error );
+
 off64_t mount_handle_seek_offset(
          mount_handle_t *mount_handle,
          off64_t offset,
@@ -117,6 +245,51 @@ int mount_handle_get_file_entry_by_path(
      libewf_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+int mount_handle_get_mount_file_entry_by_path(
+     mount_handle_t *mount_handle,
+     const libcstring_system_character_t *path,
+     size_t path_length,
+     mount_file_entry_t **mount_file_entry,
+     libcerror_error_t **error );
+
+int mount_handle_get_sub_mount_file_entries(
+     mount_handle_t *mount_handle,
+     mount_file_entry_t *mount_file_entry,
+     mount_file_entry_t ***sub_mount_file_entries,
+     int *number_of_sub_mount_file_entries,
+     libcerror_error_t **error );
+
+int mount_handle_close_sub_mount_file_entries(
+     mount_handle_t *mount_handle,
+     mount_file_entry_t *mount_file_entry,
+     libcerror_error_t **error );
+
+int mount_handle_get_cached_mount_file_entry(
+     mount_handle_t *mount_handle,
+     const libcstring_system_character_t *path,
+     size_t path_length,
+     uint32_t path_hash,
+     mount_file_entry_t **mount_file_entry,
+     libcerror_error_t **error );
+
+int mount_handle_append_mount_file_entry(
+     mount_handle_t *mount_handle,
+     const libcstring_system_character_t *path,
+     size_t path_length,
+     uint32_t path_hash,
+     libewf_file_entry_t *file_entry,
+     mount_file_entry_t **mount_file_entry,
+     libcerror_error_t **error );
+
+int mount_handle_use_mount_file_entry(
+     mount_handle_t *mount_handle,
+     mount_file_entry_t *mount_file_entry,
+     libcerror_error_t **error );
+
+int mount_handle_evict_mount_file_entry(
+     mount_handle_t *mount_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,909 @@
+/*
+ * Process threads functions
+ *
+ * Copyright (c) 2006-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "ewftools_libcerror.h"
+#include "ewftools_libcnotify.h"
+#include "ewftools_libcthreads.h"
+#include "process_threads.h"
+#include "storage_media_buffer.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates the process threads and starts the threads that process and output the storage media buffers
+ * The process callback function is called by the process threads for every storage media buffer
+ * The output callback function is called by a single output thread in the order the storage media buffers were pushed
+ * Make sure the value process_threads is pointing to is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int process_threads_initialize(
+     process_threads_t **process_threads,
+     int number_of_threads,
+     size_t storage_media_buffer_size,
+     int (*process_callback_function)(
+            storage_media_buffer_t *storage_media_buffer,
+            void *arguments,
+            libcerror_error_t **error ),
+     int (*output_callback_function)(
+            storage_media_buffer_t *storage_media_buffer,
+            void *arguments,
+            libcerror_error_t **error ),
+     void *callback_function_arguments,
+     libcerror_error_t **error )
+{
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	static char *function                        = "process_threads_initialize";
+	size_t array_size                            = 0;
+	int storage_media_buffer_index               = 0;
+
+	if( process_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( *process_threads != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid process threads value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( process_callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output callback function.",
+		 function );
+
+		return( -1 );
+	}
+	*process_threads = memory_allocate_structure(
+	                    process_threads_t );
+
+	if( *process_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create process threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *process_threads,
+	     0,
+	     sizeof( process_threads_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear process threads.",
+		 function );
+
+		memory_free(
+		 *process_threads );
+
+		*process_threads = NULL;
+
+		return( -1 );
+	}
+	( *process_threads )->process_callback_function   = process_callback_function;
+	( *process_threads )->output_callback_function    = output_callback_function;
+	( *process_threads )->callback_function_arguments = callback_function_arguments;
+
+	/* Use twice the number of storage media buffers than threads
+	 * so that the next storage media buffers can be read
+	 * while the previous ones are being processed and output
+	 */
+	( *process_threads )->number_of_storage_media_buffers = number_of_threads * 2;
+
+	if( libcthreads_mutex_initialize(
+	     &( ( *process_threads )->error_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create error mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_initialize(
+	     &( ( *process_threads )->storage_media_buffer_queue ),
+	     ( *process_threads )->number_of_storage_media_buffers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create storage media buffer queue.",
+		 function );
+
+		goto on_error;
+	}
+	for( storage_media_buffer_index = 0;
+	     storage_media_buffer_index < ( *process_threads )->number_of_storage_media_buffers;
+	     storage_media_buffer_index++ )
+	{
+		if( storage_media_buffer_initialize(
+		     &storage_media_buffer,
+		     STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA,
+		     storage_media_buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create storage media buffer: %d.",
+			 function,
+			 storage_media_buffer_index );
+
+			goto on_error;
+		}
+		if( libcthreads_queue_push(
+		     ( *process_threads )->storage_media_buffer_queue,
+		     (intptr_t *) storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push storage media buffer: %d onto queue.",
+			 function,
+			 storage_media_buffer_index );
+
+			goto on_error;
+		}
+		storage_media_buffer = NULL;
+	}
+	array_size = sizeof( storage_media_buffer_t * ) * ( *process_threads )->number_of_storage_media_buffers;
+
+	( *process_threads )->output_storage_media_buffers = (storage_media_buffer_t **) memory_allocate(
+	                                                      array_size );
+
+	if( ( *process_threads )->output_storage_media_buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create output storage media buffers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *process_threads )->output_storage_media_buffers,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear output storage media buffers.",
+		 function );
+
+		goto on_error;
+	}
+	/* The storage media buffers are output by a single thread
+	 * to make sure they are output in order
+	 */
+	if( libcthreads_thread_pool_create(
+	     &( ( *process_threads )->output_thread_pool ),
+	     1,
+	     ( *process_threads )->number_of_storage_media_buffers,
+	     (int (*)(intptr_t *, void *)) &process_threads_output_storage_media_buffer_callback,
+	     (void *) *process_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_create(
+	     &( ( *process_threads )->process_thread_pool ),
+	     number_of_threads,
+	     ( *process_threads )->number_of_storage_media_buffers,
+	     (int (*)(intptr_t *, void *)) &process_threads_process_storage_media_buffer_callback,
+	     (void *) *process_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create process thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( storage_media_buffer != NULL )
+	{
+		storage_media_buffer_free(
+		 &storage_media_buffer,
+		 NULL );
+	}
+	if( *process_threads != NULL )
+	{
+		process_threads_free(
+		 process_threads,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Stops the process threads and frees the process threads
+ * Waits for the pending storage media buffers to be processed and output
+ * Returns 1 if successful or -1 on error
+ */
+int process_threads_free(
+     process_threads_t **process_threads,
+     libcerror_error_t **error )
+{
+	static char *function          = "process_threads_free";
+	int result                     = 1;
+	int storage_media_buffer_index = 0;
+
+	if( process_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( *process_threads != NULL )
+	{
+		/* The process threads push onto the output thread pool
+		 * hence they are joined before the output thread
+		 */
+		if( ( *process_threads )->process_thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *process_threads )->process_thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join process thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *process_threads )->output_thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *process_threads )->output_thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join output thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *process_threads )->output_storage_media_buffers != NULL )
+		{
+			for( storage_media_buffer_index = 0;
+			     storage_media_buffer_index < ( *process_threads )->number_of_storage_media_buffers;
+			     storage_media_buffer_index++ )
+			{
+				if( ( *process_threads )->output_storage_media_buffers[ storage_media_buffer_index ] != NULL )
+				{
+					if( storage_media_buffer_free(
+					     &( ( *process_threads )->output_storage_media_buffers[ storage_media_buffer_index ] ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free output storage media buffer: %d.",
+						 function,
+						 storage_media_buffer_index );
+
+						result = -1;
+					}
+				}
+			}
+			memory_free(
+			 ( *process_threads )->output_storage_media_buffers );
+		}
+		if( ( *process_threads )->storage_media_buffer_queue != NULL )
+		{
+			if( libcthreads_queue_free(
+			     &( ( *process_threads )->storage_media_buffer_queue ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &storage_media_buffer_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free storage media buffer queue.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *process_threads )->error_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *process_threads )->error_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free error mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The threads have been joined hence the error can be accessed
+		 * without the mutex. The error of the threads replaces the errors
+		 * of joining the threads since those only indicate that a callback failed
+		 */
+		if( ( *process_threads )->error != NULL )
+		{
+			if( error != NULL )
+			{
+				if( *error != NULL )
+				{
+					libcerror_error_free(
+					 error );
+				}
+				*error = ( *process_threads )->error;
+			}
+			else
+			{
+				libcerror_error_free(
+				 &( ( *process_threads )->error ) );
+			}
+			( *process_threads )->error = NULL;
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: error in process or output thread.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *process_threads );
+
+		*process_threads = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves an unused storage media buffer
+ * Blocks until a storage media buffer becomes available
+ * Returns 1 if successful or -1 on error
+ */
+int process_threads_get_storage_media_buffer(
+     process_threads_t *process_threads,
+     storage_media_buffer_t **storage_media_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "process_threads_get_storage_media_buffer";
+
+	if( process_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_queue_pop(
+	     process_threads->storage_media_buffer_queue,
+	     (intptr_t **) storage_media_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to pop storage media buffer from queue.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Hands a storage media buffer over to the process threads
+ * The storage media buffers must be pushed by a single thread
+ * since they are output in the order they were pushed
+ * Returns 1 if successful or -1 on error
+ */
+int process_threads_push_storage_media_buffer(
+     process_threads_t *process_threads,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "process_threads_push_storage_media_buffer";
+
+	if( process_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	storage_media_buffer->process_index = process_threads->process_index;
+
+	if( libcthreads_thread_pool_push(
+	     process_threads->process_thread_pool,
+	     (intptr_t *) storage_media_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push storage media buffer onto process thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	process_threads->process_index += 1;
+
+	return( 1 );
+}
+
+/* Sets the error of a process or output thread
+ * Only the first error is kept, the thread error is freed otherwise
+ * The thread error is no longer owned by the caller afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int process_threads_set_error(
+     process_threads_t *process_threads,
+     libcerror_error_t **thread_error )
+{
+	int result = 1;
+
+	if( ( process_threads == NULL )
+	 || ( thread_error == NULL ) )
+	{
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     process_threads->error_mutex,
+	     NULL ) != 1 )
+	{
+		result = -1;
+	}
+	else
+	{
+		if( process_threads->error == NULL )
+		{
+			process_threads->error = *thread_error;
+
+			*thread_error = NULL;
+		}
+		if( libcthreads_mutex_release(
+		     process_threads->error_mutex,
+		     NULL ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *thread_error != NULL )
+	{
+		libcerror_error_free(
+		 thread_error );
+	}
+	return( result );
+}
+
+/* Determines if a process or output thread has failed
+ * Returns 1 if a thread has failed or 0 if not
+ */
+int process_threads_has_error(
+     process_threads_t *process_threads )
+{
+	int result = 0;
+
+	if( process_threads == NULL )
+	{
+		return( 0 );
+	}
+	if( libcthreads_mutex_grab(
+	     process_threads->error_mutex,
+	     NULL ) != 1 )
+	{
+		return( 1 );
+	}
+	if( process_threads->error != NULL )
+	{
+		result = 1;
+	}
+	if( libcthreads_mutex_release(
+	     process_threads->error_mutex,
+	     NULL ) != 1 )
+	{
+		return( 1 );
+	}
+	return( result );
+}
+
+/* Callback function to process a storage media buffer
+ * The storage media buffer is handed over to the output thread afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int process_threads_process_storage_media_buffer_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     process_threads_t *process_threads )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "process_threads_process_storage_media_buffer_callback";
+	int result               = 1;
+
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_threads == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_threads_has_error(
+	     process_threads ) == 0 )
+	{
+		if( process_threads->process_callback_function(
+		     storage_media_buffer,
+		     process_threads->callback_function_arguments,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process storage media buffer.",
+			 function );
+
+			process_threads_set_error(
+			 process_threads,
+			 &error );
+
+			result = -1;
+		}
+	}
+	/* The storage media buffer is always handed over to the output thread
+	 * which is responsible for returning it to the storage media buffer queue
+	 */
+	if( libcthreads_thread_pool_push(
+	     process_threads->output_thread_pool,
+	     (intptr_t *) storage_media_buffer,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push storage media buffer onto output thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( error != NULL )
+	{
+		if( process_threads != NULL )
+		{
+			process_threads_set_error(
+			 process_threads,
+			 &error );
+		}
+		else
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	return( -1 );
+}
+
+/* Callback function to output a processed storage media buffer
+ * The storage media buffers are output in the order they were pushed
+ * Storage media buffers that were output are returned to the storage media buffer queue
+ * Returns 1 if successful or -1 on error
+ */
+int process_threads_output_storage_media_buffer_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     process_threads_t *process_threads )
+{
+	storage_media_buffer_t *output_storage_media_buffer = NULL;
+	libcerror_error_t *error                            = NULL;
+	static char *function                               = "process_threads_output_storage_media_buffer_callback";
+	int abort_output                                    = 0;
+	int free_storage_media_buffer_index                 = -1;
+	int result                                          = 1;
+	int storage_media_buffer_index                      = 0;
+
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_threads == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process threads.",
+		 function );
+
+		goto on_error;
+	}
+	for( storage_media_buffer_index = 0;
+	     storage_media_buffer_index < process_threads->number_of_storage_media_buffers;
+	     storage_media_buffer_index++ )
+	{
+		if( process_threads->output_storage_media_buffers[ storage_media_buffer_index ] == NULL )
+		{
+			free_storage_media_buffer_index = storage_media_buffer_index;
+
+			break;
+		}
+	}
+	if( free_storage_media_buffer_index == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid process threads - missing free output storage media buffer entry.",
+		 function );
+
+		goto on_error;
+	}
+	process_threads->output_storage_media_buffers[ free_storage_media_buffer_index ] = storage_media_buffer;
+	process_threads->number_of_output_storage_media_buffers                         += 1;
+
+	storage_media_buffer = NULL;
+
+	/* The remaining storage media buffers are no longer output after an error
+	 * in one of the threads, they are only returned to the queue
+	 */
+	if( process_threads_has_error(
+	     process_threads ) != 0 )
+	{
+		abort_output = 1;
+	}
+	storage_media_buffer_index = 0;
+
+	while( storage_media_buffer_index < process_threads->number_of_storage_media_buffers )
+	{
+		output_storage_media_buffer = process_threads->output_storage_media_buffers[ storage_media_buffer_index ];
+
+		if( ( output_storage_media_buffer == NULL )
+		 || ( ( abort_output == 0 )
+		  && ( output_storage_media_buffer->process_index != process_threads->output_process_index ) ) )
+		{
+			storage_media_buffer_index++;
+
+			continue;
+		}
+		if( abort_output == 0 )
+		{
+			if( process_threads->output_callback_function(
+			     output_storage_media_buffer,
+			     process_threads->callback_function_arguments,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to output storage media buffer.",
+				 function );
+
+				process_threads_set_error(
+				 process_threads,
+				 &error );
+
+				abort_output = 1;
+				result       = -1;
+			}
+			else
+			{
+				process_threads->output_process_index += 1;
+			}
+		}
+		process_threads->output_storage_media_buffers[ storage_media_buffer_index ] = NULL;
+		process_threads->number_of_output_storage_media_buffers                    -= 1;
+
+		if( libcthreads_queue_push(
+		     process_threads->storage_media_buffer_queue,
+		     (intptr_t *) output_storage_media_buffer,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push storage media buffer onto queue.",
+			 function );
+
+			storage_media_buffer = output_storage_media_buffer;
+
+			goto on_error;
+		}
+		/* Restart the search since the storage media buffer with the next process index
+		 * can be stored in any of the entries
+		 */
+		storage_media_buffer_index = 0;
+	}
+	return( result );
+
+on_error:
+	if( error != NULL )
+	{
+		if( process_threads != NULL )
+		{
+			process_threads_set_error(
+			 process_threads,
+			 &error );
+		}
+		else
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	if( storage_media_buffer != NULL )
+	{
+		storage_media_buffer_free(
+		 &storage_media_buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
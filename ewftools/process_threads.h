@@ -0,0 +1,152 @@
+/*
+ * Process threads functions
+ *
+ * Copyright (c) 2006-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PROCESS_THREADS_H )
+#define _PROCESS_THREADS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "ewftools_libcerror.h"
+#include "ewftools_libcthreads.h"
+#include "storage_media_buffer.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct process_threads process_threads_t;
+
+struct process_threads
+{
+	/* The process thread pool
+	 */
+	libcthreads_thread_pool_t *process_thread_pool;
+
+	/* The output thread pool
+	 */
+	libcthreads_thread_pool_t *output_thread_pool;
+
+	/* The storage media buffer queue
+	 */
+	libcthreads_queue_t *storage_media_buffer_queue;
+
+	/* The number of storage media buffers
+	 */
+	int number_of_storage_media_buffers;
+
+	/* The storage media buffers that are waiting to be output
+	 */
+	storage_media_buffer_t **output_storage_media_buffers;
+
+	/* The number of storage media buffers that are waiting to be output
+	 */
+	int number_of_output_storage_media_buffers;
+
+	/* The process index of the next storage media buffer to be processed
+	 */
+	uint64_t process_index;
+
+	/* The process index of the next storage media buffer to be output
+	 */
+	uint64_t output_process_index;
+
+	/* The process callback function
+	 */
+	int (*process_callback_function)(
+	       storage_media_buffer_t *storage_media_buffer,
+	       void *arguments,
+	       libcerror_error_t **error );
+
+	/* The output callback function
+	 */
+	int (*output_callback_function)(
+	       storage_media_buffer_t *storage_media_buffer,
+	       void *arguments,
+	       libcerror_error_t **error );
+
+	/* The callback function arguments
+	 */
+	void *callback_function_arguments;
+
+	/* The mutex that protects the error
+	 */
+	libcthreads_mutex_t *error_mutex;
+
+	/* The first error of the process or output threads
+	 */
+	libcerror_error_t *error;
+};
+
+int process_threads_initialize(
+     process_threads_t **process_threads,
+     int number_of_threads,
+     size_t storage_media_buffer_size,
+     int (*process_callback_function)(
+            storage_media_buffer_t *storage_media_buffer,
+            void *arguments,
+            libcerror_error_t **error ),
+     int (*output_callback_function)(
+            storage_media_buffer_t *storage_media_buffer,
+            void *arguments,
+            libcerror_error_t **error ),
+     void *callback_function_arguments,
+     libcerror_error_t **error );
+
+int process_threads_free(
+     process_threads_t **process_threads,
+     libcerror_error_t **error );
+
+int process_threads_get_storage_media_buffer(
+     process_threads_t *process_threads,
+     storage_media_buffer_t **storage_media_buffer,
+     libcerror_error_t **error );
+
+int process_threads_push_storage_media_buffer(
+     process_threads_t *process_threads,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error );
+
+int process_threads_set_error(
+     process_threads_t *process_threads,
+     libcerror_error_t **thread_error );
+
+int process_threads_has_error(
+     process_threads_t *process_threads );
+
+int process_threads_process_storage_media_buffer_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     process_threads_t *process_threads );
+
+int process_threads_output_storage_media_buffer_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     process_threads_t *process_threads );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
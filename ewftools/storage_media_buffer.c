@@ -31,6 +31,7 @@
  */
 int storage_media_buffer_initialize(
      storage_media_buffer_t **buffer,
+     uint8_t mode,
      size_t size,
      libcerror_error_t **error )
 {
@@ -59,6 +60,18 @@ int storage_media_buffer_initialize(
 
 		return( -1 );
 	}
+	if( ( mode != STORAGE_MEDIA_BUFFER_MODE_BUFFERED )
+	 && ( mode != STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
 	if( size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
@@ -103,15 +116,18 @@ int storage_media_buffer_initialize(
 
 		return( -1 );
 	}
+	( *buffer )->mode = mode;
+
 	if( size > 0 )
 	{
 		raw_buffer_size = size;
 
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-		/* Add 4 bytes to allow for write checksum buffer alignment
-		 */
-		raw_buffer_size += 4;
-#endif
+		if( mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
+		{
+			/* Add 4 bytes to allow for write checksum buffer alignment
+			 */
+			raw_buffer_size += 4;
+		}
 
 /* TODO can low level functions and direct IO be combined ? */
 #if defined( memory_allocate_aligned )
@@ -148,25 +164,26 @@ int storage_media_buffer_initialize(
 
 		( *buffer )->raw_buffer_size = size;
 
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-		( *buffer )->checksum_buffer = &( ( ( *buffer )->raw_buffer )[ size ] );
-
-		( *buffer )->compression_buffer = (uint8_t *) memory_allocate(
-		                                               sizeof( uint8_t ) * ( size * 2 ) );
-			
-		if( ( *buffer )->compression_buffer == NULL )
+		if( mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create compression buffer.",
-			 function );
+			( *buffer )->checksum_buffer = &( ( ( *buffer )->raw_buffer )[ size ] );
 
-			goto on_error;
+			( *buffer )->compression_buffer = (uint8_t *) memory_allocate(
+			                                               sizeof( uint8_t ) * ( size * 2 ) );
+			
+			if( ( *buffer )->compression_buffer == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create compression buffer.",
+				 function );
+
+				goto on_error;
+			}
+			( *buffer )->compression_buffer_size = size * 2;
 		}
-		( *buffer )->compression_buffer_size = size * 2;
-#endif
 	}
 	return( 1 );
 
@@ -213,13 +230,11 @@ int storage_media_buffer_free(
 			memory_free(
 			 ( *buffer )->raw_buffer );
 		}
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
 		if( ( *buffer )->compression_buffer != NULL )
 		{
 			memory_free(
 			 ( *buffer )->compression_buffer );
 		}
-#endif
 		memory_free(
 		 *buffer );
 
@@ -271,7 +286,6 @@ int storage_media_buffer_resize(
 		buffer->raw_buffer_size      = size;
 		buffer->raw_buffer_data_size = 0;
 
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
 		/* The compression buffer is cleared
 		 */
 		if( buffer->compression_buffer != NULL )
@@ -283,7 +297,6 @@ int storage_media_buffer_resize(
 			buffer->compression_buffer_size      = 0;
 			buffer->compression_buffer_data_size = 0;
 		}
-#endif
 	}
 	return( 1 );
 }
@@ -332,7 +345,6 @@ int storage_media_buffer_get_data(
 
 		return( -1 );
 	}
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
 	if( buffer->data_in_compression_buffer == 0 )
 	{
 		*data      = buffer->raw_buffer;
@@ -343,10 +355,6 @@ int storage_media_buffer_get_data(
 		*data      = buffer->compression_buffer;
 		*data_size = buffer->compression_buffer_data_size;
 	}
-#else
-	*data      = buffer->raw_buffer;
-	*data_size = buffer->raw_buffer_data_size;
-#endif
 	return( 1 );
 }
 
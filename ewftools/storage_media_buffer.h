@@ -31,10 +31,28 @@
 extern "C" {
 #endif
 
+enum STORAGE_MEDIA_BUFFER_MODES
+{
+	STORAGE_MEDIA_BUFFER_MODE_BUFFERED	= (uint8_t) 'b',
+	STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA	= (uint8_t) 'c'
+};
+
 typedef struct storage_media_buffer storage_media_buffer_t;
 
 struct storage_media_buffer
 {
+	/* The mode
+	 */
+	uint8_t mode;
+
+	/* The storage media offset of the data in the buffer
+	 */
+	off64_t storage_media_offset;
+
+	/* The index of the buffer in the order it was handed over to the process threads
+	 */
+	uint64_t process_index;
+
 	/* The raw buffer
 	 */
 	uint8_t *raw_buffer;
@@ -47,7 +65,6 @@ struct storage_media_buffer
 	 */
 	size_t raw_buffer_data_size;
 
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
         /* Value to indicate if the compression buffer
 	 * contains uncompressed data
 	 */
@@ -81,11 +98,20 @@ struct storage_media_buffer
 	/* The checksum of the data within the buffer
 	 */
 	uint32_t checksum;
-#endif
+
+	/* The number of bytes to write after the buffer was processed
+	 */
+	ssize_t process_count;
+
+	/* Value to indicate if the data in the buffer is corrupted
+	 * e.g. the checksum of the chunk data does not match
+	 */
+	int8_t is_corrupted;
 };
 
 int storage_media_buffer_initialize(
      storage_media_buffer_t **buffer,
+     uint8_t mode,
      size_t size,
      libcerror_error_t **error );
 
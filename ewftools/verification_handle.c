@@ -28,13 +28,17 @@
 #include "ewfcommon.h"
 #include "ewfinput.h"
 #include "ewftools_libcerror.h"
+#include "ewftools_libcnotify.h"
 #include "ewftools_libcpath.h"
 #include "ewftools_libcsplit.h"
 #include "ewftools_libcstring.h"
+#include "ewftools_libcsystem.h"
 #include "ewftools_libewf.h"
 #include "ewftools_libhmac.h"
+#include "integrity_hash.h"
 #include "log_handle.h"
 #include "process_status.h"
+#include "process_threads.h"
 #include "storage_media_buffer.h"
 #include "verification_handle.h"
 
@@ -264,6 +268,24 @@ int verification_handle_free(
 	}
 	if( *verification_handle != NULL )
 	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *verification_handle )->process_threads != NULL )
+		{
+			if( verification_handle_threads_stop(
+			     *verification_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to stop threads.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
 		if( ( ( *verification_handle )->input_handle != NULL )
 		 && ( libewf_handle_free(
 		       &( ( *verification_handle )->input_handle ),
@@ -405,6 +427,44 @@ int verification_handle_signal_abort(
 	return( 1 );
 }
 
+/* Sets the value to indicate the input segment files should be memory mapped
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_set_use_memory_map(
+     verification_handle_t *verification_handle,
+     uint8_t use_memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_set_use_memory_map";
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_handle_set_use_memory_map(
+	     verification_handle->input_handle,
+	     use_memory_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set use memory map in input handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Sets the maximum number of (concurrent) open file handles
  * Returns 1 if successful or -1 on error
  */
@@ -590,6 +650,23 @@ int verification_handle_open_input(
 		}
 		libewf_filenames = NULL;
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( verification_handle->number_of_read_ahead_chunks > 0 )
+	 && ( libewf_handle_set_read_ahead(
+	       verification_handle->input_handle,
+	       verification_handle->number_of_read_ahead_chunks,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read-ahead.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	if( libewf_handle_get_chunk_size(
 	     verification_handle->input_handle,
 	     &( verification_handle->chunk_size ),
@@ -708,67 +785,214 @@ ssize_t verification_handle_prepare_read_buffer(
 
 		return( -1 );
 	}
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-	storage_media_buffer->raw_buffer_data_size = storage_media_buffer->raw_buffer_size;
+	storage_media_buffer->is_corrupted = 0;
 
-	process_count = libewf_handle_prepare_read_chunk(
-	                 verification_handle->input_handle,
-	                 storage_media_buffer->compression_buffer,
-	                 storage_media_buffer->compression_buffer_data_size,
-	                 storage_media_buffer->raw_buffer,
-	                 &( storage_media_buffer->raw_buffer_data_size ),
-	                 storage_media_buffer->is_compressed,
-	                 storage_media_buffer->checksum,
-	                 storage_media_buffer->process_checksum,
-	                 error );
-
-	if( process_count == -1 )
+	if( storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
 	{
-		libcerror_error_free(
-		 error );
+		storage_media_buffer->raw_buffer_data_size = storage_media_buffer->raw_buffer_size;
 
-		/* Wipe the chunk if nescessary
-		 */
-		if( verification_handle->zero_chunk_on_error != 0 )
+		process_count = libewf_handle_prepare_read_chunk(
+		                 verification_handle->input_handle,
+		                 storage_media_buffer->compression_buffer,
+		                 storage_media_buffer->compression_buffer_data_size,
+		                 storage_media_buffer->raw_buffer,
+		                 &( storage_media_buffer->raw_buffer_data_size ),
+		                 storage_media_buffer->is_compressed,
+		                 storage_media_buffer->checksum,
+		                 storage_media_buffer->process_checksum,
+		                 error );
+
+		if( process_count == -1 )
 		{
-			if( ( storage_media_buffer->is_compressed != 0 )
-			 && ( memory_set(
-			       storage_media_buffer->raw_buffer,
-			       0,
-			       storage_media_buffer->raw_buffer_size ) == NULL ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-				 "%s: unable to zero raw buffer.",
-				 function );
+			libcerror_error_free(
+			 error );
 
-				return( -1 );
-			}
-			if( memory_set(
-			     storage_media_buffer->compression_buffer,
-			     0,
-			     storage_media_buffer->compression_buffer_size ) == NULL )
+			/* Wipe the chunk if nescessary
+			 */
+			if( verification_handle->zero_chunk_on_error != 0 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-				 "%s: unable to zero compression buffer.",
-				 function );
+				if( ( storage_media_buffer->is_compressed != 0 )
+				 && ( memory_set(
+				       storage_media_buffer->raw_buffer,
+				       0,
+				       storage_media_buffer->raw_buffer_size ) == NULL ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to zero raw buffer.",
+					 function );
 
-				return( -1 );
+					return( -1 );
+				}
+				if( memory_set(
+				     storage_media_buffer->compression_buffer,
+				     0,
+				     storage_media_buffer->compression_buffer_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to zero compression buffer.",
+					 function );
+
+					return( -1 );
+				}
 			}
+			process_count = verification_handle->chunk_size;
+
+			/* The read error is appended when the storage media buffer is hashed
+			 * since the buffers can be prepared by multiple threads
+			 */
+			storage_media_buffer->is_corrupted = 1;
+		}
+		if( storage_media_buffer->is_compressed == 0 )
+		{
+			storage_media_buffer->data_in_compression_buffer = 1;
+		}
+		else
+		{
+			storage_media_buffer->data_in_compression_buffer = 0;
 		}
-		process_count = verification_handle->chunk_size;
+	}
+	else
+	{
+		process_count = (ssize_t) storage_media_buffer->raw_buffer_data_size;
+	}
+	return( process_count );
+}
 
-		/* Append a read error
-		 */
+/* Reads a buffer from the input of the verification handle
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t verification_handle_read_buffer(
+         verification_handle_t *verification_handle,
+         storage_media_buffer_t *storage_media_buffer,
+         size_t read_size,
+         libcerror_error_t **error )
+{
+	static char *function = "verification_handle_read_buffer";
+	ssize_t read_count    = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
+	{
+		read_count = libewf_handle_read_chunk(
+		              verification_handle->input_handle,
+		              storage_media_buffer->compression_buffer,
+		              storage_media_buffer->compression_buffer_size,
+		              &( storage_media_buffer->is_compressed ),
+		              &( storage_media_buffer->compression_buffer[ storage_media_buffer->raw_buffer_size ] ),
+		              &( storage_media_buffer->checksum ),
+		              &( storage_media_buffer->process_checksum ),
+		              error );
+	}
+	else
+	{
+		read_count = libewf_handle_read_buffer(
+		              verification_handle->input_handle,
+		              storage_media_buffer->raw_buffer,
+		              read_size,
+		              error );
+	}
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
+	{
+		storage_media_buffer->compression_buffer_data_size = (size_t) read_count;
+	}
+	else
+	{
+		storage_media_buffer->raw_buffer_data_size = (size_t) read_count;
+	}
+	return( read_count );
+}
+
+/* Appends a read error if the storage media buffer is corrupted
+ * and updates the integrity hash(es) with the data in the storage media buffer
+ * The storage media offset and process count of the buffer must be set
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_hash_storage_media_buffer(
+     verification_handle_t *verification_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error )
+{
+	uint8_t *data         = NULL;
+	static char *function = "verification_handle_hash_storage_media_buffer";
+	size_t data_size      = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer->process_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid storage media buffer - process count value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer->is_corrupted != 0 )
+	{
 		if( verification_handle_append_read_error(
 		     verification_handle,
-		     verification_handle->last_offset_read,
-		     process_count,
+		     storage_media_buffer->storage_media_offset,
+		     (size_t) storage_media_buffer->process_count,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -781,33 +1005,56 @@ ssize_t verification_handle_prepare_read_buffer(
 			return( -1 );
 		}
 	}
-	if( storage_media_buffer->is_compressed == 0 )
+	/* Set the chunk data size in the compression buffer
+	 */
+	if( storage_media_buffer->data_in_compression_buffer == 1 )
 	{
-		storage_media_buffer->data_in_compression_buffer = 1;
+		storage_media_buffer->compression_buffer_data_size = (size_t) storage_media_buffer->process_count;
 	}
-	else
+	if( storage_media_buffer_get_data(
+	     storage_media_buffer,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
 	{
-		storage_media_buffer->data_in_compression_buffer = 0;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine storage media buffer data.",
+		 function );
+
+		return( -1 );
 	}
-#else
-	process_count = (ssize_t) storage_media_buffer->raw_buffer_data_size;
-#endif
-	verification_handle->last_offset_read += process_count;
+	if( verification_handle_update_integrity_hash(
+	     verification_handle,
+	     data,
+	     (size_t) storage_media_buffer->process_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to update integrity hash(es).",
+		 function );
 
-	return( process_count );
+		return( -1 );
+	}
+	return( 1 );
 }
 
-/* Reads a buffer from the input of the verification handle
- * Returns the number of bytes written or -1 on error
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Starts the threads that process and hash the storage media buffers
+ * Returns 1 if successful or -1 on error
  */
-ssize_t verification_handle_read_buffer(
-         verification_handle_t *verification_handle,
-         storage_media_buffer_t *storage_media_buffer,
-         size_t read_size,
-         libcerror_error_t **error )
+int verification_handle_threads_start(
+     verification_handle_t *verification_handle,
+     size_t process_buffer_size,
+     libcerror_error_t **error )
 {
-	static char *function = "verification_handle_read_buffer";
-	ssize_t read_count    = 0;
+	static char *function = "verification_handle_threads_start";
 
 	if( verification_handle == NULL )
 	{
@@ -820,6 +1067,98 @@ ssize_t verification_handle_read_buffer(
 
 		return( -1 );
 	}
+	if( verification_handle->process_threads != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verification handle - process threads value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( verification_handle->number_of_threads <= 0 )
+	 || ( verification_handle->number_of_threads > VERIFICATION_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid verification handle - number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( process_threads_initialize(
+	     &( verification_handle->process_threads ),
+	     verification_handle->number_of_threads,
+	     process_buffer_size,
+	     (int (*)(storage_media_buffer_t *, void *, libcerror_error_t **)) &verification_handle_process_storage_media_buffer_callback,
+	     (int (*)(storage_media_buffer_t *, void *, libcerror_error_t **)) &verification_handle_output_storage_media_buffer_callback,
+	     (void *) verification_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create process threads.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Stops the threads that process and hash the storage media buffers
+ * Waits for the pending storage media buffers to be processed and hashed
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_threads_stop(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_threads_stop";
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( process_threads_free(
+	     &( verification_handle->process_threads ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free process threads.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Callback function to process a storage media buffer
+ * This decompresses the chunk data and validates its checksum
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_process_storage_media_buffer_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_process_storage_media_buffer_callback";
+
 	if( storage_media_buffer == NULL )
 	{
 		libcerror_error_set(
@@ -831,44 +1170,109 @@ ssize_t verification_handle_read_buffer(
 
 		return( -1 );
 	}
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-	read_count = libewf_handle_read_chunk(
-                      verification_handle->input_handle,
-                      storage_media_buffer->compression_buffer,
-                      storage_media_buffer->compression_buffer_size,
-	              &( storage_media_buffer->is_compressed ),
-	              &( storage_media_buffer->compression_buffer[ storage_media_buffer->raw_buffer_size ] ),
-	              &( storage_media_buffer->checksum ),
-	              &( storage_media_buffer->process_checksum ),
-	              error );
-#else
-	read_count = libewf_handle_read_buffer(
-                      verification_handle->input_handle,
-                      storage_media_buffer->raw_buffer,
-                      read_size,
-	              error );
-#endif
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
 
-	if( read_count == -1 )
+		return( -1 );
+	}
+	/* The remaining storage media buffers are no longer processed after an abort
+	 */
+	if( verification_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	storage_media_buffer->process_count = verification_handle_prepare_read_buffer(
+	                                       verification_handle,
+	                                       storage_media_buffer,
+	                                       error );
+
+	if( storage_media_buffer->process_count < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read storage media buffer.",
+		 "%s: unable to prepare storage media buffer after read.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-	storage_media_buffer->compression_buffer_data_size = (size_t) read_count;
-#else
-	storage_media_buffer->raw_buffer_data_size         = (size_t) read_count;
-#endif
+	/* The last chunk can contain more data than the media size
+	 * or a corrupted chunk is returned as a full chunk hence only
+	 * the data up to the media size is hashed like when verifying
+	 * without threads
+	 */
+	if( (size64_t) storage_media_buffer->process_count > ( verification_handle->input_media_size - (size64_t) storage_media_buffer->storage_media_offset ) )
+	{
+		storage_media_buffer->process_count = (ssize_t) ( verification_handle->input_media_size - (size64_t) storage_media_buffer->storage_media_offset );
+	}
+	return( 1 );
+}
 
-	return( read_count );
+/* Callback function to hash a processed storage media buffer
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_output_storage_media_buffer_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_output_storage_media_buffer_callback";
+
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The remaining storage media buffers are no longer hashed after an abort
+	 * they are only returned to the queue
+	 */
+	if( verification_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	if( verification_handle_hash_storage_media_buffer(
+	     verification_handle,
+	     storage_media_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to hash storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
 }
 
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 /* Initializes the integrity hash(es)
  * Returns 1 if successful or -1 on error
  */
@@ -1003,59 +1407,22 @@ int verification_handle_update_integrity_hash(
 
 		return( -1 );
 	}
-	if( verification_handle->calculate_md5 != 0 )
-	{
-		if( libhmac_md5_update(
-		     verification_handle->md5_context,
-		     buffer,
-		     buffer_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update MD5 digest hash.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	if( verification_handle->calculate_sha1 != 0 )
-	{
-		if( libhmac_sha1_update(
-		     verification_handle->sha1_context,
-		     buffer,
-		     buffer_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update SHA1 digest hash.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	if( verification_handle->calculate_sha256 != 0 )
+	if( integrity_hash_update(
+	     ( verification_handle->calculate_md5 != 0 ) ? verification_handle->md5_context : NULL,
+	     ( verification_handle->calculate_sha1 != 0 ) ? verification_handle->sha1_context : NULL,
+	     ( verification_handle->calculate_sha256 != 0 ) ? verification_handle->sha256_context : NULL,
+	     buffer,
+	     buffer_size,
+	     error ) != 1 )
 	{
-		if( libhmac_sha256_update(
-		     verification_handle->sha256_context,
-		     buffer,
-		     buffer_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update SHA256 digest hash.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update integrity hash.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
 	return( 1 );
 }
@@ -1272,16 +1639,15 @@ int verification_handle_verify_input(
 {
 	process_status_t *process_status             = NULL;
 	storage_media_buffer_t *storage_media_buffer = NULL;
-	uint8_t *data                                = NULL;
 	static char *function                        = "verification_handle_verify_input";
 	size64_t media_size                          = 0;
 	size64_t verify_count                        = 0;
-	size_t data_size                             = 0;
 	size_t process_buffer_size                   = 0;
 	size_t read_size                             = 0;
 	ssize_t process_count                        = 0;
 	ssize_t read_count                           = 0;
 	uint32_t number_of_checksum_errors           = 0;
+	uint8_t storage_media_buffer_mode            = 0;
 	int is_corrupted                             = 0;
 	int md5_hash_compare                         = 0;
 	int sha1_hash_compare                        = 0;
@@ -1349,31 +1715,30 @@ int verification_handle_verify_input(
 		goto on_error;
 	}
 #if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-	process_buffer_size = verification_handle->chunk_size;
+	storage_media_buffer_mode = STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA;
+	process_buffer_size       = verification_handle->chunk_size;
 #else
-	if( verification_handle->process_buffer_size == 0 )
+	/* The process threads operate on chunks
+	 */
+	if( verification_handle->number_of_threads > 0 )
 	{
-		process_buffer_size = verification_handle->chunk_size;
+		storage_media_buffer_mode = STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA;
+		process_buffer_size       = verification_handle->chunk_size;
 	}
 	else
-	{
-		process_buffer_size = verification_handle->process_buffer_size;
-	}
-#endif
-	if( storage_media_buffer_initialize(
-	     &storage_media_buffer,
-	     process_buffer_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create storage media buffer.",
-		 function );
+	{
+		storage_media_buffer_mode = STORAGE_MEDIA_BUFFER_MODE_BUFFERED;
 
-		goto on_error;
+		if( verification_handle->process_buffer_size == 0 )
+		{
+			process_buffer_size = verification_handle->chunk_size;
+		}
+		else
+		{
+			process_buffer_size = verification_handle->process_buffer_size;
+		}
 	}
+#endif
 	if( verification_handle_initialize_integrity_hash(
 	     verification_handle,
 	     error ) != 1 )
@@ -1387,6 +1752,48 @@ int verification_handle_verify_input(
 
 		goto on_error;
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The chunks are read by the main thread, decompressed and validated
+	 * by the process threads and hashed in order by the output thread
+	 */
+	if( verification_handle->number_of_threads > 0 )
+	{
+		verification_handle->input_media_size = media_size;
+
+		if( verification_handle_threads_start(
+		     verification_handle,
+		     process_buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to start threads.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#endif
+	{
+		if( storage_media_buffer_initialize(
+		     &storage_media_buffer,
+		     storage_media_buffer_mode,
+		     process_buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create storage media buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( process_status_initialize(
 	     &process_status,
 	     _LIBCSTRING_SYSTEM_STRING( "Verify" ),
@@ -1420,6 +1827,33 @@ int verification_handle_verify_input(
 	}
 	while( verify_count < media_size )
 	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( verification_handle->process_threads != NULL )
+		{
+			/* An error in one of the threads is returned when the threads are stopped
+			 */
+			if( ( verification_handle->abort != 0 )
+			 || ( process_threads_has_error(
+			       verification_handle->process_threads ) != 0 ) )
+			{
+				break;
+			}
+			if( process_threads_get_storage_media_buffer(
+			     verification_handle->process_threads,
+			     &storage_media_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve storage media buffer.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
 		read_size = process_buffer_size;
 
 		if( ( media_size - verify_count ) < read_size )
@@ -1454,73 +1888,78 @@ int verification_handle_verify_input(
 
 			goto on_error;
 		}
-		process_count = verification_handle_prepare_read_buffer(
-		                 verification_handle,
-		                 storage_media_buffer,
-		                 error );
+		storage_media_buffer->storage_media_offset = (off64_t) verify_count;
 
-		if( process_count < 0 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( verification_handle->process_threads != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			"%s: unable to prepare buffer after read.",
-			 function );
+			if( process_threads_push_storage_media_buffer(
+			     verification_handle->process_threads,
+			     storage_media_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to process storage media buffer.",
+				 function );
 
-			goto on_error;
-		}
-		if( process_count > (ssize_t) read_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: more bytes read than requested.",
-			 function );
+				goto on_error;
+			}
+			storage_media_buffer = NULL;
 
-			goto on_error;
-		}
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-		/* Set the chunk data size in the compression buffer
-		 */
-		if( storage_media_buffer->data_in_compression_buffer == 1 )
-		{
-			storage_media_buffer->compression_buffer_data_size = (ssize_t) process_count;
+			process_count = (ssize_t) read_size;
 		}
+		else
 #endif
-		verify_count += (size64_t) process_count;
-
-		if( storage_media_buffer_get_data(
-		     storage_media_buffer,
-		     &data,
-		     &data_size,
-		     error ) != 1 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine storage media buffer data.",
-			 function );
+			process_count = verification_handle_prepare_read_buffer(
+			                 verification_handle,
+			                 storage_media_buffer,
+			                 error );
 
-			goto on_error;
-		}
-		if( verification_handle_update_integrity_hash(
-		     verification_handle,
-		     data,
-		     process_count,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to update integrity hash(es).",
-			 function );
+			if( process_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				"%s: unable to prepare buffer after read.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
+			if( process_count > (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: more bytes read than requested.",
+				 function );
+
+				goto on_error;
+			}
+			storage_media_buffer->process_count = process_count;
+
+			if( verification_handle_hash_storage_media_buffer(
+			     verification_handle,
+			     storage_media_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to hash storage media buffer.",
+				 function );
+
+				goto on_error;
+			}
 		}
+		verify_count += (size64_t) process_count;
+
 		if( process_status_update(
 		     process_status,
 		     verify_count,
@@ -1541,6 +1980,24 @@ int verification_handle_verify_input(
 			break;
 		}
   	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verification_handle->process_threads != NULL )
+	{
+		if( verification_handle_threads_stop(
+		     verification_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to stop threads.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
 	if( storage_media_buffer_free(
 	     &storage_media_buffer,
 	     error ) != 1 )
@@ -1793,6 +2250,14 @@ on_error:
 		 &storage_media_buffer,
 		 NULL );
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verification_handle->process_threads != NULL )
+	{
+		verification_handle_threads_stop(
+		 verification_handle,
+		 NULL );
+	}
+#endif
 	return( -1 );
 }
 
@@ -2994,6 +3459,148 @@ int verification_handle_set_process_buffer_size(
 	return( result );
 }
 
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int verification_handle_set_number_of_threads(
+     verification_handle_t *verification_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function  = "verification_handle_set_number_of_threads";
+	size_t string_length   = 0;
+	uint64_t value_64bit   = 0;
+	int result             = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] != (libcstring_system_character_t) '-' )
+	{
+		string_length = libcstring_system_string_length(
+				 string );
+
+		if( libcsystem_string_decimal_copy_to_64_bit(
+		     string,
+		     string_length + 1,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine number of threads.",
+			 function );
+
+			return( -1 );
+		}
+		/* Without multi-threading support only 0 threads are supported
+		 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( value_64bit <= (uint64_t) VERIFICATION_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+#else
+		if( value_64bit == 0 )
+#endif
+		{
+			verification_handle->number_of_threads = (int) value_64bit;
+
+			result = 1;
+		}
+	}
+	return( result );
+}
+
+/* Sets the number of read-ahead chunks
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int verification_handle_set_number_of_read_ahead_chunks(
+     verification_handle_t *verification_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function  = "verification_handle_set_number_of_read_ahead_chunks";
+	size_t string_length   = 0;
+	uint64_t value_64bit   = 0;
+	int result             = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] != (libcstring_system_character_t) '-' )
+	{
+		string_length = libcstring_system_string_length(
+				 string );
+
+		if( libcsystem_string_decimal_copy_to_64_bit(
+		     string,
+		     string_length + 1,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine number of read-ahead chunks.",
+			 function );
+
+			return( -1 );
+		}
+		/* Without multi-threading support read-ahead is not supported
+		 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( value_64bit <= (uint64_t) VERIFICATION_HANDLE_MAXIMUM_NUMBER_OF_READ_AHEAD_CHUNKS )
+#else
+		if( value_64bit == 0 )
+#endif
+		{
+			verification_handle->number_of_read_ahead_chunks = (int) value_64bit;
+
+			result = 1;
+		}
+	}
+	return( result );
+}
+
 /* Sets the additional digest types
  * Returns 1 if successful or -1 on error
  */
@@ -3332,8 +3939,6 @@ int verification_handle_set_zero_chunk_on_error(
 	return( 1 );
 }
 
-#if defined( HAVE_LOW_LEVEL_FUNCTIONS )
-
 /* Appends a read error to the output handle
  * Returns 1 if successful or -1 on error
  */
@@ -3393,7 +3998,6 @@ int verification_handle_append_read_error(
 	}
 	return( 1 );
 }
-#endif
 
 /* Print the hash values to a stream
  * Returns 1 if successful or -1 on error
@@ -31,12 +31,16 @@
 #include "ewftools_libewf.h"
 #include "ewftools_libhmac.h"
 #include "log_handle.h"
+#include "process_threads.h"
 #include "storage_media_buffer.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+#define VERIFICATION_HANDLE_MAXIMUM_NUMBER_OF_THREADS		128
+#define VERIFICATION_HANDLE_MAXIMUM_NUMBER_OF_READ_AHEAD_CHUNKS	256
+
 enum VERIFICATION_HANDLE_INPUT_FORMATS
 {
 	VERIFICATION_HANDLE_INPUT_FORMAT_FILES	= (int) 'f',
@@ -143,14 +147,30 @@ struct verification_handle
 	 */
 	uint32_t bytes_per_sector;
 
-	/* The last offset read
-	 */
-	off64_t last_offset_read;
-
 	/* The process buffer size
 	 */
 	size_t process_buffer_size;
 
+	/* The number of threads used to process the storage media buffers
+	 * 0 represents that no threads are used
+	 */
+	int number_of_threads;
+
+	/* The number of chunks the input handle reads ahead
+	 * 0 represents that read-ahead is disabled
+	 */
+	int number_of_read_ahead_chunks;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The process threads
+	 */
+	process_threads_t *process_threads;
+
+	/* The media size of the input
+	 */
+	size64_t input_media_size;
+#endif
+
 	/* The nofication output stream
 	 */
 	FILE *notify_stream;
@@ -173,6 +193,11 @@ int verification_handle_signal_abort(
      verification_handle_t *verification_handle,
      libcerror_error_t **error );
 
+int verification_handle_set_use_memory_map(
+     verification_handle_t *verification_handle,
+     uint8_t use_memory_map,
+     libcerror_error_t **error );
+
 int verification_handle_set_maximum_number_of_open_handles(
      verification_handle_t *verification_handle,
      int maximum_number_of_open_handles,
@@ -199,6 +224,33 @@ ssize_t verification_handle_read_buffer(
          size_t read_size,
          libcerror_error_t **error );
 
+int verification_handle_hash_storage_media_buffer(
+     verification_handle_t *verification_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+int verification_handle_threads_start(
+     verification_handle_t *verification_handle,
+     size_t process_buffer_size,
+     libcerror_error_t **error );
+
+int verification_handle_threads_stop(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error );
+
+int verification_handle_process_storage_media_buffer_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error );
+
+int verification_handle_output_storage_media_buffer_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 int verification_handle_initialize_integrity_hash(
      verification_handle_t *verification_handle,
      libcerror_error_t **error );
@@ -265,6 +317,16 @@ int verification_handle_set_process_buffer_size(
      const libcstring_system_character_t *string,
      libcerror_error_t **error );
 
+int verification_handle_set_number_of_threads(
+     verification_handle_t *verification_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error );
+
+int verification_handle_set_number_of_read_ahead_chunks(
+     verification_handle_t *verification_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error );
+
 int verification_handle_set_additional_digest_types(
      verification_handle_t *verification_handle,
      const libcstring_system_character_t *string,
@@ -421,6 +421,8 @@ ssize_t libewf_handle_read_buffer(
          libewf_error_t **error );
 
 /* Reads (media) data at a specific offset
+ * This function does not change the current offset and can be called
+ * concurrently by multiple threads on a handle that is opened for reading
  * Returns the number of bytes read or -1 on error
  */
 LIBEWF_EXTERN \
@@ -530,6 +532,134 @@ int libewf_handle_set_maximum_number_of_open_handles(
      int maximum_number_of_open_handles,
      libewf_error_t **error );
 
+/* Retrieves the segment file open and close statistics
+ * The number of closes and reopens only contain the segment files that were closed
+ * to limit the number of (concurrent) open file handles
+ * Returns 1 if successful or -1 on error
+ */
+LIBEWF_EXTERN \
+int libewf_handle_get_segment_file_statistics(
+     libewf_handle_t *handle,
+     uint64_t *number_of_opens,
+     uint64_t *number_of_closes,
+     uint64_t *number_of_reopens,
+     libewf_error_t **error );
+
+/* Retrieves the number of times a specific segment file was accessed
+ * Returns 1 if successful, 0 if no such segment file or -1 on error
+ */
+LIBEWF_EXTERN \
+int libewf_handle_get_segment_file_access_count(
+     libewf_handle_t *handle,
+     uint32_t segment_number,
+     uint64_t *access_count,
+     libewf_error_t **error );
+
+/* Sets the maximum size of the chunk data cache
+ * The size is expressed in bytes of decompressed chunk data,
+ * 0 represents the default (minimal) cache size
+ * Returns 1 if successful or -1 on error
+ */
+LIBEWF_EXTERN \
+int libewf_handle_set_maximum_cache_size(
+     libewf_handle_t *handle,
+     size64_t maximum_cache_size,
+     libewf_error_t **error );
+
+/* Sets the number of chunks to read ahead
+ * When the chunks are read sequentially a background thread reads
+ * and decompresses the next chunks, 0 disables read-ahead
+ * Read-ahead requires multi-threading support
+ * Returns 1 if successful or -1 on error
+ */
+LIBEWF_EXTERN \
+int libewf_handle_set_read_ahead(
+     libewf_handle_t *handle,
+     int number_of_chunks,
+     libewf_error_t **error );
+
+/* Sets the value to indicate the segment files should be memory mapped
+ * When the handle is opened for reading only, uncompressed chunks with a matching
+ * checksum are then read directly from the memory mapped segment files
+ * Memory mapped segment files are kept open until the handle is closed
+ * An IO error or a truncated segment file while accessing the mapped data
+ * raises SIGBUS instead of returning an error, hence memory mapping is off by default
+ * The value must be set before the handle is opened
+ * Returns 1 if successful or -1 on error
+ */
+LIBEWF_EXTERN \
+int libewf_handle_set_use_memory_map(
+     libewf_handle_t *handle,
+     uint8_t use_memory_map,
+     libewf_error_t **error );
+
+/* Sets the value to indicate the segment file data should be dropped from the system page cache
+ * The data read from or written to the segment files is then dropped from the cache regularly,
+ * which also keeps the amount of written data waiting to be flushed to storage small
+ * The value must be set before the handle is opened
+ * Returns 1 if successful or -1 on error
+ */
+LIBEWF_EXTERN \
+int libewf_handle_set_drop_cached_data(
+     libewf_handle_t *handle,
+     uint8_t drop_cached_data,
+     libewf_error_t **error );
+
+/* Retrieves the memory mapped data of a specific chunk
+ * The data is only available for uncompressed chunks with a matching checksum
+ * when the segment files are memory mapped, the chunk data excludes the checksum
+ * The data remains valid until the handle is closed
+ * Returns 1 if successful, 0 if the chunk data is not available or -1 on error
+ */
+LIBEWF_EXTERN \
+int libewf_handle_get_memory_mapped_chunk_data(
+     libewf_handle_t *handle,
+     uint64_t chunk_index,
+     const uint8_t **chunk_data,
+     size_t *chunk_data_size,
+     libewf_error_t **error );
+
+/* Reads the data of a batch of consecutive chunks into the chunk cache
+ * Chunks that are stored consecutively in a segment file are read using
+ * a single vectored read, the chunks are decompressed when they are read
+ * The number of chunks is limited by the number of chunks the cache can hold
+ * Returns the number of chunks read if successful or -1 on error
+ */
+LIBEWF_EXTERN \
+int libewf_handle_read_chunks_batch(
+     libewf_handle_t *handle,
+     uint64_t chunk_index,
+     int number_of_chunks,
+     libewf_error_t **error );
+
+/* Sets the index filename
+ * The index file caches the layout of the segment files, when the handle is opened
+ * for reading only a valid index file is used instead of reading the section start
+ * of every section in the segment files, otherwise the index file is (re)created
+ * The index file is not used when the handle is opened using a file IO pool
+ * The index filename must be set before the handle is opened
+ * Returns 1 if successful or -1 on error
+ */
+LIBEWF_EXTERN \
+int libewf_handle_set_index_filename(
+     libewf_handle_t *handle,
+     const char *filename,
+     size_t filename_length,
+     libewf_error_t **error );
+
+#if defined( LIBEWF_HAVE_WIDE_CHARACTER_TYPE )
+/* Sets the index filename
+ * The index filename must be set before the handle is opened
+ * Returns 1 if successful or -1 on error
+ */
+LIBEWF_EXTERN \
+int libewf_handle_set_index_filename_wide(
+     libewf_handle_t *handle,
+     const wchar_t *filename,
+     size_t filename_length,
+     libewf_error_t **error );
+#endif
+
 /* Retrieves the segment filename size
  * The filename size includes the end of string character
  * Returns 1 if successful, 0 if value not present or -1 on error
@@ -944,6 +1074,26 @@ int libewf_handle_set_compression_values(
      uint8_t compression_flags,
      libewf_error_t **error );
 
+/* Retrieves the compression backend
+ * Returns 1 if successful or -1 on error
+ */
+LIBEWF_EXTERN \
+int libewf_handle_get_compression_backend(
+     libewf_handle_t *handle,
+     int *compression_backend,
+     libewf_error_t **error );
+
+/* Sets the compression backend
+ * The compression backend is used to compress and decompress the chunks
+ * and can only be set before the handle is opened
+ * Returns 1 if successful or -1 on error
+ */
+LIBEWF_EXTERN \
+int libewf_handle_set_compression_backend(
+     libewf_handle_t *handle,
+     int compression_backend,
+     libewf_error_t **error );
+
 /* Retrieves the size of the contained (media) data
  * This function will compensate for a media_size that is not a multitude of bytes_per_sector
  * Returns 1 if successful or -1 on error
@@ -1089,6 +1239,19 @@ int libewf_handle_get_number_of_chunks_written(
      uint32_t *number_of_chunks,
      libewf_error_t **error );
 
+/* Retrieves the zero run statistics
+ * A zero run consists of consecutive chunks that were written as empty blocks of zero bytes
+ * Only chunks that were stored compressed and were written since the handle was opened are counted
+ * Returns 1 if successful or -1 on error
+ */
+LIBEWF_EXTERN \
+int libewf_handle_get_zero_run_statistics(
+     libewf_handle_t *handle,
+     size64_t *zero_data_size,
+     uint64_t *number_of_zero_runs,
+     size64_t *largest_zero_run_size,
+     libewf_error_t **error );
+
 /* Sets the read zero chunk on error
  * The chunk is not zeroed if read raw is used
  * Returns 1 if successful or -1 on error
@@ -117,6 +117,16 @@ enum LIBEWF_COMPRESSION_LEVELS
 	LIBEWF_COMPRESSION_BEST					= 2,
 };
 
+/* The compression backend definitions
+ * The default backend is libdeflate if available and zlib otherwise
+ */
+enum LIBEWF_COMPRESSION_BACKENDS
+{
+	LIBEWF_COMPRESSION_BACKEND_DEFAULT			= 0,
+	LIBEWF_COMPRESSION_BACKEND_ZLIB				= 1,
+	LIBEWF_COMPRESSION_BACKEND_LIBDEFLATE			= 2,
+};
+
 /* The compression flags
  * bit 1	set to 1 for emtpy block compression
  *              detects empty blocks and stored them compressed, the compression
@@ -189,6 +189,60 @@ int libbfio_file_initialize(
 
 		goto on_error;
 	}
+	if( libbfio_handle_set_get_memory_mapped_data_function(
+	     *handle,
+	     (int (*)(intptr_t *, off64_t, size_t, const uint8_t **, libcerror_error_t **)) libbfio_file_get_memory_mapped_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set get memory mapped data function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libbfio_handle_set_read_buffer_at_offset_function(
+	     *handle,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) libbfio_file_read_buffer_at_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read buffer at offset function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libbfio_handle_set_read_buffers_at_offset_function(
+	     *handle,
+	     (ssize_t (*)(intptr_t *, uint8_t **, size_t *, int, off64_t, libcerror_error_t **)) libbfio_file_read_buffers_at_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read buffers at offset function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
 	return( 1 );
 
 on_error:
@@ -229,6 +283,11 @@ int libbfio_file_io_handle_free(
 			memory_free(
 			 ( *file_io_handle )->name );
 		}
+		if( ( *file_io_handle )->write_buffer != NULL )
+		{
+			memory_free(
+			 ( *file_io_handle )->write_buffer );
+		}
 		if( libcfile_file_free(
 		     &( ( *file_io_handle )->file ),
 		     error ) != 1 )
@@ -361,6 +420,10 @@ int libbfio_file_io_handle_clone(
 
 		( *destination_file_io_handle )->name_size = source_file_io_handle->name_size;
 	}
+	( *destination_file_io_handle )->use_memory_map    = source_file_io_handle->use_memory_map;
+	( *destination_file_io_handle )->drop_cached_data  = source_file_io_handle->drop_cached_data;
+	( *destination_file_io_handle )->write_buffer_size = source_file_io_handle->write_buffer_size;
+
 	return( 1 );
 
 on_error:
@@ -1877,6 +1940,82 @@ int libbfio_file_open(
 		 function,
 		 file_io_handle->name );
 	}
+	else if( ( file_io_handle->use_memory_map != 0 )
+	      && ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		/* The file is read using the file functions if it cannot be memory mapped
+		 */
+		if( libcfile_file_memory_map(
+		     file_io_handle->file,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to memory map file: %" PRIs_LIBCSTRING_SYSTEM ".",
+			 function,
+			 file_io_handle->name );
+
+			libcfile_file_close(
+			 file_io_handle->file,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( ( result == 1 )
+	 && ( file_io_handle->drop_cached_data != 0 ) )
+	{
+		if( libcfile_file_set_drop_cached_data(
+		     file_io_handle->file,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set drop cached data in file: %" PRIs_LIBCSTRING_SYSTEM ".",
+			 function,
+			 file_io_handle->name );
+
+			libcfile_file_close(
+			 file_io_handle->file,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( ( result == 1 )
+	 && ( file_io_handle->write_buffer_size > 0 )
+	 && ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 ) )
+	{
+		if( file_io_handle->write_buffer == NULL )
+		{
+			file_io_handle->write_buffer = (uint8_t *) memory_allocate(
+			                                            sizeof( uint8_t ) * file_io_handle->write_buffer_size );
+
+			if( file_io_handle->write_buffer == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create write buffer.",
+				 function );
+
+				libcfile_file_close(
+				 file_io_handle->file,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+		file_io_handle->write_buffer_data_size = 0;
+		file_io_handle->write_buffer_offset    = 0;
+		file_io_handle->current_offset         = 0;
+	}
 	file_io_handle->access_flags = access_flags;
 
 	return( 1 );
@@ -1890,6 +2029,7 @@ int libbfio_file_close(
      libcerror_error_t **error )
 {
 	static char *function = "libbfio_file_close";
+	int result            = 0;
 
 	if( file_io_handle == NULL )
 	{
@@ -1913,6 +2053,28 @@ int libbfio_file_close(
 
 		return( -1 );
 	}
+	if( file_io_handle->write_buffer != NULL )
+	{
+		if( libbfio_file_flush_write_buffer(
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer of file: %" PRIs_LIBCSTRING_SYSTEM ".",
+			 function,
+			 file_io_handle->name );
+
+			result = -1;
+		}
+		memory_free(
+		 file_io_handle->write_buffer );
+
+		file_io_handle->write_buffer           = NULL;
+		file_io_handle->write_buffer_data_size = 0;
+	}
 	if( libcfile_file_close(
 	     file_io_handle->file,
 	     error ) != 0 )
@@ -1925,11 +2087,11 @@ int libbfio_file_close(
 		 function,
 		 file_io_handle->name );
 
-		return( -1 );
+		result = -1;
 	}
 	file_io_handle->access_flags = 0;
 
-	return( 0 );
+	return( result );
 }
 
 /* Reads a buffer from the file handle
@@ -1966,6 +2128,40 @@ ssize_t libbfio_file_read(
 
 		return( -1 );
 	}
+	if( file_io_handle->write_buffer != NULL )
+	{
+		if( libbfio_file_flush_write_buffer(
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer of file: %" PRIs_LIBCSTRING_SYSTEM ".",
+			 function,
+			 file_io_handle->name );
+
+			return( -1 );
+		}
+		if( libcfile_file_seek_offset(
+		     file_io_handle->file,
+		     file_io_handle->current_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset: %" PRIi64 " in file: %" PRIs_LIBCSTRING_SYSTEM ".",
+			 function,
+			 file_io_handle->current_offset,
+			 file_io_handle->name );
+
+			return( -1 );
+		}
+	}
 	read_count = libcfile_file_read_buffer(
 	              file_io_handle->file,
 	              buffer,
@@ -1984,6 +2180,10 @@ ssize_t libbfio_file_read(
 
 		return( -1 );
 	}
+	if( file_io_handle->write_buffer != NULL )
+	{
+		file_io_handle->current_offset += (off64_t) read_count;
+	}
 	return( read_count );
 }
 
@@ -1997,7 +2197,9 @@ ssize_t libbfio_file_write(
          libcerror_error_t **error )
 {
 	static char *function = "libbfio_file_write";
+	size_t buffer_offset  = 0;
 	ssize_t write_count   = 0;
+	off64_t buffer_end    = 0;
 
 	if( file_io_handle == NULL )
 	{
@@ -2021,6 +2223,131 @@ ssize_t libbfio_file_write(
 
 		return( -1 );
 	}
+	if( file_io_handle->write_buffer != NULL )
+	{
+		if( buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( size > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( file_io_handle->write_buffer_data_size == 0 )
+		{
+			file_io_handle->write_buffer_offset = file_io_handle->current_offset;
+		}
+		buffer_end = file_io_handle->write_buffer_offset + (off64_t) file_io_handle->write_buffer_data_size;
+
+		/* Data that overlaps or directly follows the buffered data is added to
+		 * the write buffer if it fits, e.g. a section correction of buffered data
+		 */
+		if( ( file_io_handle->current_offset >= file_io_handle->write_buffer_offset )
+		 && ( file_io_handle->current_offset <= buffer_end )
+		 && ( size <= file_io_handle->write_buffer_size )
+		 && ( (size_t) ( file_io_handle->current_offset - file_io_handle->write_buffer_offset ) <= ( file_io_handle->write_buffer_size - size ) ) )
+		{
+			buffer_offset = (size_t) ( file_io_handle->current_offset - file_io_handle->write_buffer_offset );
+
+			if( memory_copy(
+			     &( file_io_handle->write_buffer[ buffer_offset ] ),
+			     buffer,
+			     size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data to write buffer.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_offset += size;
+
+			if( buffer_offset > file_io_handle->write_buffer_data_size )
+			{
+				file_io_handle->write_buffer_data_size = buffer_offset;
+			}
+			file_io_handle->current_offset += (off64_t) size;
+
+			return( (ssize_t) size );
+		}
+		/* Data that does not overlap the buffered data is written directly
+		 * otherwise the buffered data is written first
+		 */
+		if( ( ( file_io_handle->current_offset + (off64_t) size ) > file_io_handle->write_buffer_offset )
+		 && ( file_io_handle->current_offset <= buffer_end ) )
+		{
+			if( libbfio_file_flush_write_buffer(
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush write buffer of file: %" PRIs_LIBCSTRING_SYSTEM ".",
+				 function,
+				 file_io_handle->name );
+
+				return( -1 );
+			}
+			if( size < file_io_handle->write_buffer_size )
+			{
+				if( memory_copy(
+				     file_io_handle->write_buffer,
+				     buffer,
+				     size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy data to write buffer.",
+					 function );
+
+					return( -1 );
+				}
+				file_io_handle->write_buffer_offset    = file_io_handle->current_offset;
+				file_io_handle->write_buffer_data_size = size;
+				file_io_handle->current_offset        += (off64_t) size;
+
+				return( (ssize_t) size );
+			}
+		}
+		if( libcfile_file_seek_offset(
+		     file_io_handle->file,
+		     file_io_handle->current_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset: %" PRIi64 " in file: %" PRIs_LIBCSTRING_SYSTEM ".",
+			 function,
+			 file_io_handle->current_offset,
+			 file_io_handle->name );
+
+			return( -1 );
+		}
+	}
 	write_count = libcfile_file_write_buffer(
 	               file_io_handle->file,
 	               buffer,
@@ -2039,6 +2366,10 @@ ssize_t libbfio_file_write(
 
 		return( -1 );
 	}
+	if( file_io_handle->write_buffer != NULL )
+	{
+		file_io_handle->current_offset += (off64_t) write_count;
+	}
 	return( write_count );
 }
 
@@ -2052,6 +2383,7 @@ off64_t libbfio_file_seek_offset(
          libcerror_error_t **error )
 {
 	static char *function = "libbfio_file_seek_offset";
+	size64_t size         = 0;
 
 	if( file_io_handle == NULL )
 	{
@@ -2075,6 +2407,62 @@ off64_t libbfio_file_seek_offset(
 
 		return( -1 );
 	}
+	/* While writes are buffered the file offset is only changed
+	 * when the buffered data is written or data is read
+	 */
+	if( file_io_handle->write_buffer != NULL )
+	{
+		if( ( whence != SEEK_CUR )
+		 && ( whence != SEEK_END )
+		 && ( whence != SEEK_SET ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported whence.",
+			 function );
+
+			return( -1 );
+		}
+		if( whence == SEEK_CUR )
+		{
+			offset += file_io_handle->current_offset;
+		}
+		else if( whence == SEEK_END )
+		{
+			if( libbfio_file_get_size(
+			     file_io_handle,
+			     &size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve size of file: %" PRIs_LIBCSTRING_SYSTEM ".",
+				 function,
+				 file_io_handle->name );
+
+				return( -1 );
+			}
+			offset += (off64_t) size;
+		}
+		if( offset < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		file_io_handle->current_offset = offset;
+
+		return( offset );
+	}
 	offset = libcfile_file_seek_offset(
 	          file_io_handle->file,
 	          offset,
@@ -2238,6 +2626,447 @@ int libbfio_file_get_size(
 
 		return( -1 );
 	}
+	if( ( file_io_handle->write_buffer != NULL )
+	 && ( file_io_handle->write_buffer_data_size > 0 ) )
+	{
+		if( (size64_t) ( file_io_handle->write_buffer_offset + file_io_handle->write_buffer_data_size ) > *size )
+		{
+			*size = (size64_t) ( file_io_handle->write_buffer_offset + file_io_handle->write_buffer_data_size );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the value to indicate the file should be memory mapped
+ * The file is only memory mapped when it is opened for reading only
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_file_set_use_memory_map(
+     libbfio_handle_t *handle,
+     uint8_t use_memory_map,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	libbfio_file_io_handle_t *file_io_handle   = NULL;
+	static char *function                      = "libbfio_file_set_use_memory_map";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle = (libbfio_file_io_handle_t *) internal_handle->io_handle;
+
+	file_io_handle->use_memory_map = use_memory_map;
+
+	return( 1 );
+}
+
+/* Sets the value to indicate the data read from or written to the file
+ * should be dropped from the system page cache
+ * The value is applied when the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_file_set_drop_cached_data(
+     libbfio_handle_t *handle,
+     uint8_t drop_cached_data,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	libbfio_file_io_handle_t *file_io_handle   = NULL;
+	static char *function                      = "libbfio_file_set_drop_cached_data";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle = (libbfio_file_io_handle_t *) internal_handle->io_handle;
+
+	file_io_handle->drop_cached_data = drop_cached_data;
+
 	return( 1 );
 }
 
+/* Sets the size of the buffer used to combine the data written to the file
+ * The data written to the file is buffered when the file is opened with write access,
+ * the buffered data is written when the buffer is full, before data is read and when
+ * the file is closed, 0 represents that writes are not buffered
+ * The value is applied when the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_file_set_write_buffer_size(
+     libbfio_handle_t *handle,
+     size_t write_buffer_size,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	libbfio_file_io_handle_t *file_io_handle   = NULL;
+	static char *function                      = "libbfio_file_set_write_buffer_size";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle = (libbfio_file_io_handle_t *) internal_handle->io_handle;
+
+	if( file_io_handle->write_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle - write buffer already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid write buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle->write_buffer_size = write_buffer_size;
+
+	return( 1 );
+}
+
+/* Writes the data in the write buffer to the file
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_file_flush_write_buffer(
+     libbfio_file_io_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_file_flush_write_buffer";
+	ssize_t write_count   = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_io_handle->write_buffer == NULL )
+	 || ( file_io_handle->write_buffer_data_size == 0 ) )
+	{
+		return( 1 );
+	}
+	if( libcfile_file_seek_offset(
+	     file_io_handle->file,
+	     file_io_handle->write_buffer_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " in file: %" PRIs_LIBCSTRING_SYSTEM ".",
+		 function,
+		 file_io_handle->write_buffer_offset,
+		 file_io_handle->name );
+
+		return( -1 );
+	}
+	write_count = libcfile_file_write_buffer(
+	               file_io_handle->file,
+	               file_io_handle->write_buffer,
+	               file_io_handle->write_buffer_data_size,
+	               error );
+
+	if( write_count != (ssize_t) file_io_handle->write_buffer_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer to file: %" PRIs_LIBCSTRING_SYSTEM ".",
+		 function,
+		 file_io_handle->name );
+
+		return( -1 );
+	}
+	file_io_handle->write_buffer_data_size = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the memory mapped data of a specific range of the file
+ * Returns 1 if successful, 0 if the range is not memory mapped or -1 on error
+ */
+int libbfio_file_get_memory_mapped_data(
+     libbfio_file_io_handle_t *file_io_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_file_get_memory_mapped_data";
+	int result            = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcfile_file_get_memory_mapped_data(
+	          file_io_handle->file,
+	          offset,
+	          size,
+	          data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve memory mapped data of file: %" PRIs_LIBCSTRING_SYSTEM ".",
+		 function,
+		 file_io_handle->name );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads a buffer from the file at a specific offset
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_file_read_buffer_at_offset(
+         libbfio_file_io_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_file_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->write_buffer_data_size > 0 )
+	{
+		if( libbfio_file_flush_write_buffer(
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer of file: %" PRIs_LIBCSTRING_SYSTEM ".",
+			 function,
+			 file_io_handle->name );
+
+			return( -1 );
+		}
+	}
+	read_count = libcfile_file_read_buffer_at_offset(
+	              file_io_handle->file,
+	              buffer,
+	              size,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file: %" PRIs_LIBCSTRING_SYSTEM " at offset: %" PRIi64 ".",
+		 function,
+		 file_io_handle->name,
+		 offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Reads buffers from the file at a specific offset
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_file_read_buffers_at_offset(
+         libbfio_file_io_handle_t *file_io_handle,
+         uint8_t **buffers,
+         size_t *buffer_sizes,
+         int number_of_buffers,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_file_read_buffers_at_offset";
+	ssize_t read_count    = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->write_buffer_data_size > 0 )
+	{
+		if( libbfio_file_flush_write_buffer(
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write buffer of file: %" PRIs_LIBCSTRING_SYSTEM ".",
+			 function,
+			 file_io_handle->name );
+
+			return( -1 );
+		}
+	}
+	read_count = libcfile_file_read_buffers_at_offset(
+	              file_io_handle->file,
+	              buffers,
+	              buffer_sizes,
+	              number_of_buffers,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffers from file: %" PRIs_LIBCSTRING_SYSTEM " at offset: %" PRIi64 ".",
+		 function,
+		 file_io_handle->name,
+		 offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
@@ -54,6 +54,36 @@ struct libbfio_file_io_handle
 	/* The access flags
 	 */
 	int access_flags;
+
+	/* Value to indicate the file should be memory mapped
+	 */
+	uint8_t use_memory_map;
+
+	/* Value to indicate the data read or written should be dropped
+	 * from the system page cache
+	 */
+	uint8_t drop_cached_data;
+
+	/* The write buffer
+	 */
+	uint8_t *write_buffer;
+
+	/* The size of the write buffer
+	 * 0 represents that writes are not buffered
+	 */
+	size_t write_buffer_size;
+
+	/* The size of the data in the write buffer
+	 */
+	size_t write_buffer_data_size;
+
+	/* The file offset of the data in the write buffer
+	 */
+	off64_t write_buffer_offset;
+
+	/* The current offset, which is maintained while writes are buffered
+	 */
+	off64_t current_offset;
 };
 
 int libbfio_file_io_handle_initialize(
@@ -191,6 +221,50 @@ int libbfio_file_get_size(
      size64_t *size,
      libcerror_error_t **error );
 
+LIBBFIO_EXTERN \
+int libbfio_file_set_use_memory_map(
+     libbfio_handle_t *handle,
+     uint8_t use_memory_map,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_file_set_drop_cached_data(
+     libbfio_handle_t *handle,
+     uint8_t drop_cached_data,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_file_set_write_buffer_size(
+     libbfio_handle_t *handle,
+     size_t write_buffer_size,
+     libcerror_error_t **error );
+
+int libbfio_file_flush_write_buffer(
+     libbfio_file_io_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_file_get_memory_mapped_data(
+     libbfio_file_io_handle_t *file_io_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
+ssize_t libbfio_file_read_buffer_at_offset(
+         libbfio_file_io_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+ssize_t libbfio_file_read_buffers_at_offset(
+         libbfio_file_io_handle_t *file_io_handle,
+         uint8_t **buffers,
+         size_t *buffer_sizes,
+         int number_of_buffers,
+         off64_t offset,
+         libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -382,6 +382,10 @@ int libbfio_handle_clone(
 	}
 	destination_io_handle = NULL;
 
+	( (libbfio_internal_handle_t *) *destination_handle )->get_memory_mapped_data = internal_source_handle->get_memory_mapped_data;
+	( (libbfio_internal_handle_t *) *destination_handle )->read_buffer_at_offset  = internal_source_handle->read_buffer_at_offset;
+	( (libbfio_internal_handle_t *) *destination_handle )->read_buffers_at_offset = internal_source_handle->read_buffers_at_offset;
+
 	if( libbfio_handle_open(
 	     *destination_handle,
 	     internal_source_handle->access_flags,
@@ -1549,6 +1553,527 @@ int libbfio_handle_get_size(
 	return( 1 );
 }
 
+/* Sets the read buffer at offset function
+ * The function is optional and is used to read a buffer without changing the current offset
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_read_buffer_at_offset_function(
+     libbfio_handle_t *handle,
+     ssize_t (*read_buffer_at_offset)(
+                intptr_t *io_handle,
+                uint8_t *buffer,
+                size_t size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_read_buffer_at_offset_function";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	internal_handle->read_buffer_at_offset = read_buffer_at_offset;
+
+	return( 1 );
+}
+
+/* Reads a buffer from the handle at a specific offset
+ * If the IO handle has no read buffer at offset function the buffer is read
+ * using the read buffers at offset function. This function does not change the current offset
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_handle_read_buffer_at_offset(
+         libbfio_handle_t *handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_read_buffer_at_offset";
+	ssize_t read_count                         = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* A handle that is opened on demand is read using the regular read function
+	 * since it is only open for the duration of the read
+	 */
+	if( ( internal_handle->read_buffer_at_offset == NULL )
+	 || ( internal_handle->open_on_demand != 0 ) )
+	{
+		read_count = libbfio_handle_read_buffers_at_offset(
+		              handle,
+		              &buffer,
+		              &size,
+		              1,
+		              offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer from handle.",
+			 function );
+
+			return( -1 );
+		}
+		return( read_count );
+	}
+	read_count = internal_handle->read_buffer_at_offset(
+	              internal_handle->io_handle,
+	              buffer,
+	              size,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->track_offsets_read != 0 )
+	{
+		if( libcdata_range_list_append_range(
+		     internal_handle->offsets_read,
+		     (uint64_t) offset,
+		     (uint64_t) read_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append offset range to offsets read table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( read_count );
+}
+
+/* Sets the read buffers at offset function
+ * The function is optional and is used to read multiple buffers with a single (vectored) read
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_read_buffers_at_offset_function(
+     libbfio_handle_t *handle,
+     ssize_t (*read_buffers_at_offset)(
+                intptr_t *io_handle,
+                uint8_t **buffers,
+                size_t *buffer_sizes,
+                int number_of_buffers,
+                off64_t offset,
+                libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_read_buffers_at_offset_function";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	internal_handle->read_buffers_at_offset = read_buffers_at_offset;
+
+	return( 1 );
+}
+
+/* Reads buffers from the handle at a specific offset
+ * The buffers are filled consecutively with the data that starts at the offset
+ * If the IO handle has no read buffers at offset function the buffers are read
+ * one at a time. This function does not change the current offset
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_handle_read_buffers_at_offset(
+         libbfio_handle_t *handle,
+         uint8_t **buffers,
+         size_t *buffer_sizes,
+         int number_of_buffers,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_read_buffers_at_offset";
+	off64_t current_offset                     = 0;
+	ssize_t read_count                         = 0;
+	ssize_t total_read_count                   = 0;
+	int buffer_index                           = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_buffers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of buffers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* A handle that is opened on demand is read using the regular read function
+	 * since it is only open for the duration of the read
+	 */
+	if( ( internal_handle->read_buffers_at_offset != NULL )
+	 && ( internal_handle->open_on_demand == 0 ) )
+	{
+		total_read_count = internal_handle->read_buffers_at_offset(
+		                    internal_handle->io_handle,
+		                    buffers,
+		                    buffer_sizes,
+		                    number_of_buffers,
+		                    offset,
+		                    error );
+
+		if( total_read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffers from handle.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_handle->track_offsets_read != 0 )
+		{
+			if( libcdata_range_list_append_range(
+			     internal_handle->offsets_read,
+			     (uint64_t) offset,
+			     (uint64_t) total_read_count,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append offset range to offsets read table.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		return( total_read_count );
+	}
+	current_offset = internal_handle->offset;
+
+	if( libbfio_handle_seek_offset(
+	     handle,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 ".",
+		 function,
+		 offset );
+
+		return( -1 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		read_count = libbfio_handle_read_buffer(
+		              handle,
+		              buffers[ buffer_index ],
+		              buffer_sizes[ buffer_index ],
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer: %d.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		if( total_read_count > ( SSIZE_MAX - read_count ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid total read count value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		total_read_count += read_count;
+
+		if( (size_t) read_count != buffer_sizes[ buffer_index ] )
+		{
+			break;
+		}
+	}
+	if( libbfio_handle_seek_offset(
+	     handle,
+	     current_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek current offset: %" PRIi64 ".",
+		 function,
+		 current_offset );
+
+		return( -1 );
+	}
+	return( total_read_count );
+}
+
+/* Sets the get memory mapped data function
+ * The function is optional and is used to retrieve data of the IO handle without copying it
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_get_memory_mapped_data_function(
+     libbfio_handle_t *handle,
+     int (*get_memory_mapped_data)(
+            intptr_t *io_handle,
+            off64_t offset,
+            size_t size,
+            const uint8_t **data,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_get_memory_mapped_data_function";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	internal_handle->get_memory_mapped_data = get_memory_mapped_data;
+
+	return( 1 );
+}
+
+/* Retrieves the memory mapped data of a specific range of the handle
+ * The data is owned by the handle and remains valid until the handle is closed
+ * This function does not use or change the current offset
+ * Returns 1 if successful, 0 if the range is not memory mapped or -1 on error
+ */
+int libbfio_handle_get_memory_mapped_data(
+     libbfio_handle_t *handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_get_memory_mapped_data";
+	int result                                 = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->get_memory_mapped_data == NULL )
+	{
+		return( 0 );
+	}
+	result = internal_handle->get_memory_mapped_data(
+	          internal_handle->io_handle,
+	          offset,
+	          size,
+	          data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve memory mapped data.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the current offset
  * Returns 1 if successful or -1 on error
  */
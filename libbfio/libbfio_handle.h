@@ -79,6 +79,15 @@ struct libbfio_internal_handle
 	 */
 	libcdata_list_element_t *pool_last_used_list_element;
 
+	/* The number of times the handle was accessed by the pool
+	 */
+	uint64_t pool_access_count;
+
+	/* Value to indicate the pool closed the handle
+	 * to limit the number of open handles
+	 */
+	uint8_t pool_closed;
+
 	/* Value to indicate to track offsets read
 	 */
 	uint8_t track_offsets_read;
@@ -160,6 +169,34 @@ struct libbfio_internal_handle
 	       size64_t *size,
 	       libcerror_error_t **error );
 
+	/* The get memory mapped data function
+	 */
+	int (*get_memory_mapped_data)(
+	       intptr_t *io_handle,
+	       off64_t offset,
+	       size_t size,
+	       const uint8_t **data,
+	       libcerror_error_t **error );
+
+	/* The read buffer at offset function
+	 */
+	ssize_t (*read_buffer_at_offset)(
+	           intptr_t *io_handle,
+	           uint8_t *buffer,
+	           size_t size,
+	           off64_t offset,
+	           libcerror_error_t **error );
+
+	/* The read buffers at offset function
+	 */
+	ssize_t (*read_buffers_at_offset)(
+	           intptr_t *io_handle,
+	           uint8_t **buffers,
+	           size_t *buffer_sizes,
+	           int number_of_buffers,
+	           off64_t offset,
+	           libcerror_error_t **error );
+
 };
 
 LIBBFIO_EXTERN \
@@ -291,6 +328,65 @@ int libbfio_handle_get_size(
      size64_t *size,
      libcerror_error_t **error );
 
+LIBBFIO_EXTERN \
+int libbfio_handle_set_read_buffer_at_offset_function(
+     libbfio_handle_t *handle,
+     ssize_t (*read_buffer_at_offset)(
+                intptr_t *io_handle,
+                uint8_t *buffer,
+                size_t size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+ssize_t libbfio_handle_read_buffer_at_offset(
+     libbfio_handle_t *handle,
+     uint8_t *buffer,
+     size_t size,
+     off64_t offset,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_set_read_buffers_at_offset_function(
+     libbfio_handle_t *handle,
+     ssize_t (*read_buffers_at_offset)(
+                intptr_t *io_handle,
+                uint8_t **buffers,
+                size_t *buffer_sizes,
+                int number_of_buffers,
+                off64_t offset,
+                libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+ssize_t libbfio_handle_read_buffers_at_offset(
+     libbfio_handle_t *handle,
+     uint8_t **buffers,
+     size_t *buffer_sizes,
+     int number_of_buffers,
+     off64_t offset,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_set_get_memory_mapped_data_function(
+     libbfio_handle_t *handle,
+     int (*get_memory_mapped_data)(
+            intptr_t *io_handle,
+            off64_t offset,
+            size_t size,
+            const uint8_t **data,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_get_memory_mapped_data(
+     libbfio_handle_t *handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
 LIBBFIO_EXTERN \
 int libbfio_handle_get_offset(
      libbfio_handle_t *handle,
@@ -177,6 +177,7 @@ int libbfio_pool_initialize(
 	}
 	internal_pool->number_of_handles              = number_of_handles;
 	internal_pool->maximum_number_of_open_handles = maximum_number_of_open_handles;
+	internal_pool->last_used_entry                = -1;
 
 	*pool = (libbfio_pool_t *) internal_pool;
 
@@ -575,6 +576,14 @@ int libbfio_pool_open_handle(
 	}
 	internal_handle = (libbfio_internal_handle_t *) handle;
 
+	internal_pool->number_of_opens++;
+
+	if( internal_handle->pool_closed != 0 )
+	{
+		internal_pool->number_of_reopens++;
+
+		internal_handle->pool_closed = 0;
+	}
 	if( libbfio_handle_seek_offset(
 	     handle,
 	     internal_handle->offset,
@@ -707,6 +716,9 @@ int libbfio_pool_append_handle_to_last_used_list(
 				return( -1 );
 			}
 			internal_handle->pool_last_used_list_element = NULL;
+			internal_handle->pool_closed                 = 1;
+
+			internal_pool->number_of_closes++;
 
 			/* Make sure the truncate flag is removed from the handle
 			 */
@@ -750,6 +762,10 @@ int libbfio_pool_append_handle_to_last_used_list(
 	}
 	internal_handle->pool_last_used_list_element = last_used_list_element;
 
+	/* The handle at the front of the last used list is no longer known by entry
+	 */
+	internal_pool->last_used_entry = -1;
+
 	if( libcdata_list_prepend_element(
 	     internal_pool->last_used_list,
 	     last_used_list_element,
@@ -888,6 +904,95 @@ int libbfio_pool_move_handle_to_front_of_last_used_list(
 	return( 1 );
 }
 
+/* Sets the entry of the last used handle
+ * Moves the handle to the front of the last used list if necessary
+ * and updates the access count of the handle
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_set_last_used_entry(
+     libbfio_internal_pool_t *internal_pool,
+     int entry,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_pool_set_last_used_entry";
+
+	if( internal_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pool->handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool - missing handles.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry < 0 )
+	 || ( entry >= internal_pool->number_of_handles ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) internal_pool->handles[ entry ];
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool - missing handle for entry: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	internal_handle->pool_access_count++;
+
+	if( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+	{
+		/* The handle at the front of the last used list does not need to be moved
+		 */
+		if( entry != internal_pool->last_used_entry )
+		{
+			if( libbfio_pool_move_handle_to_front_of_last_used_list(
+			     internal_pool,
+			     (libbfio_handle_t *) internal_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to move handle to front of last used list.",
+				 function );
+
+				return( -1 );
+			}
+			internal_pool->last_used_entry = entry;
+		}
+	}
+	return( 1 );
+}
+
 /* Retrieves the number of handles in the pool
  * Returns 1 if successful or -1 on error
  */
@@ -1544,6 +1649,10 @@ int libbfio_pool_close(
 		}
 		internal_handle->pool_last_used_list_element = NULL;
 
+		if( internal_pool->last_used_entry == entry )
+		{
+			internal_pool->last_used_entry = -1;
+		}
 		if( libcdata_list_element_free(
 		     &last_used_list_element,
 		     NULL,
@@ -1760,22 +1869,19 @@ ssize_t libbfio_pool_read_buffer(
 			return( -1 );
 		}
 	}
-	if( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+	if( libbfio_pool_set_last_used_entry(
+	     internal_pool,
+	     entry,
+	     error ) != 1 )
 	{
-		if( libbfio_pool_move_handle_to_front_of_last_used_list(
-		     internal_pool,
-		     internal_pool->handles[ entry ],
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to move handle to front of last used list.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set last used entry.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
 	read_count = libbfio_handle_read_buffer(
 	              internal_pool->handles[ entry ],
@@ -1798,19 +1904,21 @@ ssize_t libbfio_pool_read_buffer(
 	return( read_count );
 }
 
-/* Writes a buffer to a handle in the pool
- * Returns the number of bytes written or -1 on error
+/* Reads a buffer from a handle in the pool at a specific offset
+ * This function does not change the current offset of the handle
+ * Returns the number of bytes read or -1 on error
  */
-ssize_t libbfio_pool_write_buffer(
+ssize_t libbfio_pool_read_buffer_at_offset(
          libbfio_pool_t *pool,
          int entry,
-         const uint8_t *buffer,
+         uint8_t *buffer,
          size_t size,
+         off64_t offset,
          libcerror_error_t **error )
 {
 	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_write_buffer";
-	ssize_t write_count                    = 0;
+	static char *function                  = "libbfio_pool_read_buffer_at_offset";
+	ssize_t read_count                     = 0;
 	int access_flags                       = 0;
 	int is_open                            = 0;
 
@@ -1901,57 +2009,60 @@ ssize_t libbfio_pool_write_buffer(
 			return( -1 );
 		}
 	}
-	if( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+	if( libbfio_pool_set_last_used_entry(
+	     internal_pool,
+	     entry,
+	     error ) != 1 )
 	{
-		if( libbfio_pool_move_handle_to_front_of_last_used_list(
-		     internal_pool,
-		     internal_pool->handles[ entry ],
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to move handle to front of last used list.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set last used entry.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	write_count = libbfio_handle_write_buffer(
-	               internal_pool->handles[ entry ],
-	               buffer,
-	               size,
-	               error );
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              internal_pool->handles[ entry ],
+	              buffer,
+	              size,
+	              offset,
+	              error );
 
-	if( write_count < 0 )
+	if( read_count < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write to entry: %d.",
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from entry: %d at offset: %" PRIi64 ".",
 		 function,
-		 entry );
+		 entry,
+		 offset );
 
 		return( -1 );
 	}
-	return( write_count );
+	return( read_count );
 }
 
-/* Seeks an offset in a handle in the pool
- * Returns the offset if successful or -1 on error
+/* Reads buffers from a handle in the pool at a specific offset
+ * The buffers are filled consecutively with the data that starts at the offset
+ * This function does not change the current offset of the handle
+ * Returns the number of bytes read or -1 on error
  */
-off64_t libbfio_pool_seek_offset(
+ssize_t libbfio_pool_read_buffers_at_offset(
          libbfio_pool_t *pool,
          int entry,
+         uint8_t **buffers,
+         size_t *buffer_sizes,
+         int number_of_buffers,
          off64_t offset,
-         int whence,
          libcerror_error_t **error )
 {
 	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_seek_offset";
-	off64_t seek_offset                    = 0;
+	static char *function                  = "libbfio_pool_read_buffers_at_offset";
+	ssize_t read_count                     = 0;
 	int access_flags                       = 0;
 	int is_open                            = 0;
 
@@ -2042,57 +2153,61 @@ off64_t libbfio_pool_seek_offset(
 			return( -1 );
 		}
 	}
-	if( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+	if( libbfio_pool_set_last_used_entry(
+	     internal_pool,
+	     entry,
+	     error ) != 1 )
 	{
-		if( libbfio_pool_move_handle_to_front_of_last_used_list(
-		     internal_pool,
-		     internal_pool->handles[ entry ],
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to move handle to front of last used list.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set last used entry.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	seek_offset = libbfio_handle_seek_offset(
-	               internal_pool->handles[ entry ],
-	               offset,
-	               whence,
-	               error );
+	read_count = libbfio_handle_read_buffers_at_offset(
+	              internal_pool->handles[ entry ],
+	              buffers,
+	              buffer_sizes,
+	              number_of_buffers,
+	              offset,
+	              error );
 
-	if( seek_offset == -1 )
+	if( read_count < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset in entry: %d.",
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffers from entry: %d at offset: %" PRIi64 ".",
 		 function,
-		 entry );
+		 entry,
+		 offset );
 
 		return( -1 );
 	}
-	return( seek_offset );
+	return( read_count );
 }
 
-/* Retrieves the size of  a handle in the pool
- * Returns 1 if successful or -1 on error
+/* Retrieves the memory mapped data of a specific range of a handle in the pool
+ * The data remains valid until the handle is closed
+ * Returns 1 if successful, 0 if the range is not memory mapped or -1 on error
  */
-int libbfio_pool_get_size(
+int libbfio_pool_get_memory_mapped_data(
      libbfio_pool_t *pool,
      int entry,
-     size64_t *size,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
      libcerror_error_t **error )
 {
 	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_get_size";
+	static char *function                  = "libbfio_pool_get_memory_mapped_data";
 	int access_flags                       = 0;
 	int is_open                            = 0;
+	int result                             = 0;
 
 	if( pool == NULL )
 	{
@@ -2181,35 +2296,55 @@ int libbfio_pool_get_size(
 			return( -1 );
 		}
 	}
-	if( libbfio_handle_get_size(
-	     internal_pool->handles[ entry ],
-	     size,
+	if( libbfio_pool_set_last_used_entry(
+	     internal_pool,
+	     entry,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set last used entry.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_get_memory_mapped_data(
+	          internal_pool->handles[ entry ],
+	          offset,
+	          size,
+	          data,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve size of entry: %d.",
+		 "%s: unable to retrieve memory mapped data of entry: %d.",
 		 function,
 		 entry );
 
 		return( -1 );
 	}
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the current offset in a handle in the pool
- * Returns 1 if successful or -1 on error
+/* Writes a buffer to a handle in the pool
+ * Returns the number of bytes written or -1 on error
  */
-int libbfio_pool_get_offset(
-     libbfio_pool_t *pool,
-     int entry,
-     off64_t *offset,
-     libcerror_error_t **error )
+ssize_t libbfio_pool_write_buffer(
+         libbfio_pool_t *pool,
+         int entry,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
 {
 	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_get_offset";
+	static char *function                  = "libbfio_pool_write_buffer";
+	ssize_t write_count                    = 0;
 	int access_flags                       = 0;
 	int is_open                            = 0;
 
@@ -2300,33 +2435,426 @@ int libbfio_pool_get_offset(
 			return( -1 );
 		}
 	}
-	if( libbfio_handle_get_offset(
-	     internal_pool->handles[ entry ],
-	     offset,
+	if( libbfio_pool_set_last_used_entry(
+	     internal_pool,
+	     entry,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve offset.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set last used entry.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
+	write_count = libbfio_handle_write_buffer(
+	               internal_pool->handles[ entry ],
+	               buffer,
+	               size,
+	               error );
 
-/* Retrieves the maximum number of open handles in the pool
- * Returns 1 if successful or -1 on error
- */
-int libbfio_pool_get_maximum_number_of_open_handles(
-     libbfio_pool_t *pool,
-     int *maximum_number_of_open_handles,
-     libcerror_error_t **error )
-{
-	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_get_maximum_number_of_open_handles";
+	if( write_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write to entry: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	return( write_count );
+}
+
+/* Seeks an offset in a handle in the pool
+ * Returns the offset if successful or -1 on error
+ */
+off64_t libbfio_pool_seek_offset(
+         libbfio_pool_t *pool,
+         int entry,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_seek_offset";
+	off64_t seek_offset                    = 0;
+	int access_flags                       = 0;
+	int is_open                            = 0;
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+	if( internal_pool->handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool - missing handles.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry < 0 )
+	 || ( entry >= internal_pool->number_of_handles ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the handle is open
+	 */
+	is_open = libbfio_handle_is_open(
+	           internal_pool->handles[ entry ],
+	           error );
+
+	if( is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if entry: %d is open.",
+		 function,
+	         entry );
+
+		return( -1 );
+	}
+	else if( is_open == 0 )
+	{
+		if( libbfio_handle_get_access_flags(
+		     internal_pool->handles[ entry ],
+		     &access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve access flags.",
+			 function );
+
+			return( -1 );
+		}
+		if( libbfio_pool_open_handle(
+		     internal_pool,
+		     internal_pool->handles[ entry ],
+		     access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open entry: %d.",
+			 function,
+			 entry );
+
+			return( -1 );
+		}
+	}
+	if( libbfio_pool_set_last_used_entry(
+	     internal_pool,
+	     entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set last used entry.",
+		 function );
+
+		return( -1 );
+	}
+	seek_offset = libbfio_handle_seek_offset(
+	               internal_pool->handles[ entry ],
+	               offset,
+	               whence,
+	               error );
+
+	if( seek_offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset in entry: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	return( seek_offset );
+}
+
+/* Retrieves the size of  a handle in the pool
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_get_size(
+     libbfio_pool_t *pool,
+     int entry,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_get_size";
+	int access_flags                       = 0;
+	int is_open                            = 0;
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+	if( internal_pool->handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool - missing handles.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry < 0 )
+	 || ( entry >= internal_pool->number_of_handles ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the handle is open
+	 */
+	is_open = libbfio_handle_is_open(
+	           internal_pool->handles[ entry ],
+	           error );
+
+	if( is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if entry: %d is open.",
+		 function,
+	         entry );
+
+		return( -1 );
+	}
+	else if( is_open == 0 )
+	{
+		if( libbfio_handle_get_access_flags(
+		     internal_pool->handles[ entry ],
+		     &access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve access flags.",
+			 function );
+
+			return( -1 );
+		}
+		if( libbfio_pool_open_handle(
+		     internal_pool,
+		     internal_pool->handles[ entry ],
+		     access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open entry: %d.",
+			 function,
+			 entry );
+
+			return( -1 );
+		}
+	}
+	if( libbfio_handle_get_size(
+	     internal_pool->handles[ entry ],
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of entry: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the current offset in a handle in the pool
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_get_offset(
+     libbfio_pool_t *pool,
+     int entry,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_get_offset";
+	int access_flags                       = 0;
+	int is_open                            = 0;
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+	if( internal_pool->handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool - missing handles.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry < 0 )
+	 || ( entry >= internal_pool->number_of_handles ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the handle is open
+	 */
+	is_open = libbfio_handle_is_open(
+	           internal_pool->handles[ entry ],
+	           error );
+
+	if( is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if entry: %d is open.",
+		 function,
+	         entry );
+
+		return( -1 );
+	}
+	else if( is_open == 0 )
+	{
+		if( libbfio_handle_get_access_flags(
+		     internal_pool->handles[ entry ],
+		     &access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve access flags.",
+			 function );
+
+			return( -1 );
+		}
+		if( libbfio_pool_open_handle(
+		     internal_pool,
+		     internal_pool->handles[ entry ],
+		     access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open entry: %d.",
+			 function,
+			 entry );
+
+			return( -1 );
+		}
+	}
+	if( libbfio_handle_get_offset(
+	     internal_pool->handles[ entry ],
+	     offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve offset.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the maximum number of open handles in the pool
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_get_maximum_number_of_open_handles(
+     libbfio_pool_t *pool,
+     int *maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_get_maximum_number_of_open_handles";
 
 	if( pool == NULL )
 	{
@@ -2455,8 +2983,10 @@ int libbfio_pool_set_maximum_number_of_open_handles(
 			goto on_error;
 		}
 		internal_pool->number_of_open_handles--;
+		internal_pool->number_of_closes++;
 
 		internal_handle->pool_last_used_list_element = NULL;
+		internal_handle->pool_closed                 = 1;
 
 		/* Make sure the truncate flag is removed from the handle
 		 */
@@ -2490,3 +3020,147 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the number of times the handle of a specific entry was accessed
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_get_access_count(
+     libbfio_pool_t *pool,
+     int entry,
+     uint64_t *access_count,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_get_access_count";
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+	if( internal_pool->handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool - missing handles.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry < 0 )
+	 || ( entry >= internal_pool->number_of_handles ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pool->handles[ entry ] == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool - missing handle for entry: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	if( access_count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access count.",
+		 function );
+
+		return( -1 );
+	}
+	*access_count = ( (libbfio_internal_handle_t *) internal_pool->handles[ entry ] )->pool_access_count;
+
+	return( 1 );
+}
+
+/* Retrieves the open and close statistics of the pool
+ * The number of closes and reopens only contain the handles
+ * that were closed to limit the number of open handles
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_get_statistics(
+     libbfio_pool_t *pool,
+     uint64_t *number_of_opens,
+     uint64_t *number_of_closes,
+     uint64_t *number_of_reopens,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_get_statistics";
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+	if( number_of_opens == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of opens.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_closes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of closes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_reopens == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of reopens.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_opens   = internal_pool->number_of_opens;
+	*number_of_closes  = internal_pool->number_of_closes;
+	*number_of_reopens = internal_pool->number_of_reopens;
+
+	return( 1 );
+}
+
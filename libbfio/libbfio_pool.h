@@ -63,6 +63,25 @@ struct libbfio_internal_pool
 	 * the value of the list element refers to the corresponding file IO handle
 	 */
 	libcdata_list_t *last_used_list;
+
+	/* The entry of the handle at the front of the last used list
+	 * or -1 if not known
+	 */
+	int last_used_entry;
+
+	/* The number of handles opened by the pool
+	 */
+	uint64_t number_of_opens;
+
+	/* The number of handles closed by the pool
+	 * to limit the number of open handles
+	 */
+	uint64_t number_of_closes;
+
+	/* The number of handles reopened by the pool
+	 * after they were closed to limit the number of open handles
+	 */
+	uint64_t number_of_reopens;
 };
 
 LIBBFIO_EXTERN \
@@ -105,6 +124,11 @@ int libbfio_pool_move_handle_to_front_of_last_used_list(
      libbfio_handle_t *handle,
      libcerror_error_t **error );
 
+int libbfio_pool_set_last_used_entry(
+     libbfio_internal_pool_t *internal_pool,
+     int entry,
+     libcerror_error_t **error );
+
 LIBBFIO_EXTERN \
 int libbfio_pool_get_number_of_handles(
      libbfio_pool_t *pool,
@@ -167,6 +191,34 @@ ssize_t libbfio_pool_read_buffer(
          size_t size,
          libcerror_error_t **error );
 
+LIBBFIO_EXTERN \
+ssize_t libbfio_pool_read_buffer_at_offset(
+         libbfio_pool_t *pool,
+         int entry,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+ssize_t libbfio_pool_read_buffers_at_offset(
+         libbfio_pool_t *pool,
+         int entry,
+         uint8_t **buffers,
+         size_t *buffer_sizes,
+         int number_of_buffers,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_get_memory_mapped_data(
+     libbfio_pool_t *pool,
+     int entry,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
 LIBBFIO_EXTERN \
 ssize_t libbfio_pool_write_buffer(
          libbfio_pool_t *pool,
@@ -209,6 +261,21 @@ int libbfio_pool_set_maximum_number_of_open_handles(
      int maximum_number_of_open_handles,
      libcerror_error_t **error );
 
+LIBBFIO_EXTERN \
+int libbfio_pool_get_access_count(
+     libbfio_pool_t *pool,
+     int entry,
+     uint64_t *access_count,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_get_statistics(
+     libbfio_pool_t *pool,
+     uint64_t *number_of_opens,
+     uint64_t *number_of_closes,
+     uint64_t *number_of_reopens,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -73,6 +73,15 @@ enum LIBCFILE_ACCESS_BEHAVIOR
 
 #endif /* !defined( HAVE_LOCAL_LIBCFILE ) */
 
+/* The maximum number of buffers passed to a single vectored read
+ */
+#define LIBCFILE_MAXIMUM_NUMBER_OF_IO_VECTORS		64
+
+/* The number of bytes read or written after which the cached data is dropped
+ * from the system page cache, if requested
+ */
+#define LIBCFILE_MAXIMUM_CACHED_DATA_SIZE		( 8 * 1024 * 1024 )
+
 /* Platform specific macros
  */
 #if defined( WINAPI )
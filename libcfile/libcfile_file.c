@@ -19,6 +19,12 @@
  * along with this software.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+/* Required for sync_file_range on Linux
+ */
+#if defined( __linux__ ) && !defined( _GNU_SOURCE )
+#define _GNU_SOURCE
+#endif
+
 #include <common.h>
 #include <memory.h>
 #include <types.h>
@@ -79,6 +85,14 @@ typedef size_t u64;
 #include <unistd.h>
 #endif
 
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_UIO_H )
+#include <sys/uio.h>
+#endif
+
 #if defined( HAVE_GLIB_H )
 #include <glib.h>
 #include <glib/gstdio.h>
@@ -92,6 +106,7 @@ typedef size_t u64;
 #include "libcfile_libcstring.h"
 #include "libcfile_libuna.h"
 #include "libcfile_types.h"
+#include "libcfile_unused.h"
 
 /* Initializes the file
  * Returns 1 if successful or -1 on error
@@ -1552,8 +1567,51 @@ int libcfile_file_close(
 	}
 	internal_file = (libcfile_internal_file_t *) file;
 
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+	if( internal_file->mapped_data != NULL )
+	{
+		if( munmap(
+		     internal_file->mapped_data,
+		     (size_t) internal_file->mapped_data_size ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to unmap file.",
+			 function );
+
+			return( -1 );
+		}
+		internal_file->mapped_data      = NULL;
+		internal_file->mapped_data_size = 0;
+	}
+#endif
 	if( internal_file->descriptor != -1 )
 	{
+		/* The second drop waits for the flush started by the first drop
+		 * and drops the remaining cached data
+		 */
+		if( internal_file->drop_cached_data != 0 )
+		{
+			if( ( libcfile_internal_file_drop_cached_data(
+			       internal_file,
+			       error ) != 1 )
+			 || ( libcfile_internal_file_drop_cached_data(
+			       internal_file,
+			       error ) != 1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_GENERIC,
+				 "%s: unable to drop cached data.",
+				 function );
+
+				return( -1 );
+			}
+		}
 #if defined( WINAPI )
 		if( _close(
 		     internal_file->descriptor ) != 0 )
@@ -1842,6 +1900,23 @@ ssize_t libcfile_file_read_buffer_with_error_code(
 
 		return( -1 );
 	}
+	if( internal_file->drop_cached_data != 0 )
+	{
+		if( libcfile_internal_file_add_cached_data_at_current_offset(
+		     file,
+		     (size_t) read_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to drop cached data.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( read_count );
 }
 
@@ -1849,56 +1924,23 @@ ssize_t libcfile_file_read_buffer_with_error_code(
 #error Missing file read function
 #endif
 
-/* Writes a buffer to the file
- * Returns the number of bytes written if successful, or -1 on error
- */
-ssize_t libcfile_file_write_buffer(
-         libcfile_file_t *file,
-         const uint8_t *buffer,
-         size_t size,
-         libcerror_error_t **error )
-{
-	static char *function = "libcfile_file_write_buffer";
-	ssize_t write_count   = 0;
-	uint32_t error_code   = 0;
-
-	write_count = libcfile_file_write_buffer_with_error_code(
-	               file,
-	               buffer,
-	               size,
-	               &error_code,
-	               error );
-
-	if( write_count == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write to file.",
-		 function );
-
-		return( -1 );
-	}
-	return( write_count );
-}
-
-#if defined( WINAPI ) && ( WINVER > 0x0500 ) && !defined( USE_CRT_FUNCTIONS )
+#if defined( HAVE_PREAD )
 
-/* Writes a buffer to the file
- * This function uses the WINAPI function for Windows XP (0x0501) or later
- * Returns the number of bytes written if successful, or -1 on error
+/* Reads a buffer from the file at a specific offset
+ * This function uses the POSIX pread function and does not change the current offset
+ * Returns the number of bytes read if successful, or -1 on error
  */
-ssize_t libcfile_file_write_buffer_with_error_code(
+ssize_t libcfile_file_read_buffer_at_offset(
          libcfile_file_t *file,
-         const uint8_t *buffer,
+         uint8_t *buffer,
          size_t size,
-         uint32_t *error_code,
+         off64_t offset,
          libcerror_error_t **error )
 {
 	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_write_buffer_with_error_code";
-	ssize_t write_count                     = 0;
+	static char *function                   = "libcfile_file_read_buffer_at_offset";
+	ssize_t read_count                      = 0;
+	ssize_t total_read_count                = 0;
 
 	if( file == NULL )
 	{
@@ -1913,13 +1955,13 @@ ssize_t libcfile_file_write_buffer_with_error_code(
 	}
 	internal_file = (libcfile_internal_file_t *) file;
 
-	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	if( internal_file->descriptor == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing handle.",
+		 "%s: invalid file - missing descriptor.",
 		 function );
 
 		return( -1 );
@@ -1935,11 +1977,7 @@ ssize_t libcfile_file_write_buffer_with_error_code(
 
 		return( -1 );
 	}
-#if UINT32_MAX < SSIZE_MAX
-	if( size > (size_t) UINT32_MAX )
-#else
 	if( size > (size_t) SSIZE_MAX )
-#endif
 	{
 		libcerror_error_set(
 		 error,
@@ -1950,72 +1988,140 @@ ssize_t libcfile_file_write_buffer_with_error_code(
 
 		return( -1 );
 	}
-	if( error_code == NULL )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid error code.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	if( WriteFile(
-	     internal_file->handle,
-	     buffer,
-	     (DWORD) size,
-	     (LPDWORD) &write_count,
-	     NULL ) == 0 )
+	/* pread can return less data than requested or be interrupted by a signal
+	 * hence read until the buffer is filled or the end of the file is reached
+	 */
+	while( (size_t) total_read_count < size )
 	{
-		*error_code = (uint32_t) GetLastError();
+		read_count = pread(
+		              internal_file->descriptor,
+		              (void *) &( buffer[ total_read_count ] ),
+		              size - (size_t) total_read_count,
+		              (off_t) ( offset + total_read_count ) );
 
-		libcerror_system_set_error(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 *error_code,
-		 "%s: unable to write to file.",
-		 function );
+		if( read_count < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to read from file at offset: %" PRIi64 ".",
+			 function,
+			 offset + total_read_count );
 
-		return( -1 );
+			return( -1 );
+		}
+		else if( read_count == 0 )
+		{
+			break;
+		}
+		total_read_count += read_count;
 	}
-	if( write_count < 0 )
+	if( internal_file->drop_cached_data != 0 )
+	{
+		if( libcfile_internal_file_add_cached_data(
+		     internal_file,
+		     offset,
+		     (size_t) total_read_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to drop cached data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( total_read_count );
+}
+
+#else
+
+/* Reads a buffer from the file at a specific offset
+ * This function seeks the offset, reads the buffer and restores the current offset
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libcfile_file_read_buffer_at_offset(
+         libcfile_file_t *file,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libcfile_file_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	read_count = libcfile_file_read_buffers_at_offset(
+	              file,
+	              &buffer,
+	              &size,
+	              1,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: invalid write count: %" PRIzd " returned.",
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 ".",
 		 function,
-		 write_count );
+		 offset );
 
 		return( -1 );
 	}
-	return( write_count );
+	return( read_count );
 }
 
-#elif defined( WINAPI ) && !defined( USE_CRT_FUNCTIONS )
-
-/* TODO */
-#error WINAPI file write function for Windows 2000 or earlier NOT implemented yet
+#endif /* defined( HAVE_PREAD ) */
 
-#elif defined( HAVE_WRITE ) || defined( WINAPI )
+#if defined( HAVE_PREADV )
 
-/* Writes a buffer to the file
- * This function uses the POSIX write function or equivalent
- * Returns the number of bytes written if successful, or -1 on error
+/* Reads buffers from the file at a specific offset
+ * The buffers are filled consecutively with the data that starts at the offset
+ * This function uses the POSIX preadv function and does not change the current offset
+ * Returns the number of bytes read if successful, or -1 on error
  */
-ssize_t libcfile_file_write_buffer_with_error_code(
+ssize_t libcfile_file_read_buffers_at_offset(
          libcfile_file_t *file,
-         const uint8_t *buffer,
-         size_t size,
-         uint32_t *error_code,
+         uint8_t **buffers,
+         size_t *buffer_sizes,
+         int number_of_buffers,
+         off64_t offset,
          libcerror_error_t **error )
 {
+	struct iovec io_vectors[ LIBCFILE_MAXIMUM_NUMBER_OF_IO_VECTORS ];
+
 	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_write_buffer_with_error_code";
-	ssize_t write_count                     = 0;
+	static char *function                   = "libcfile_file_read_buffers_at_offset";
+	size_t buffer_offset                    = 0;
+	size_t remaining_buffer_size            = 0;
+	size_t total_size                       = 0;
+	ssize_t read_count                      = 0;
+	ssize_t total_read_count                = 0;
+	int buffer_index                        = 0;
+	int io_vector_index                     = 0;
+	int number_of_io_vectors                = 0;
 
 	if( file == NULL )
 	{
@@ -2041,462 +2147,393 @@ ssize_t libcfile_file_write_buffer_with_error_code(
 
 		return( -1 );
 	}
-	if( buffer == NULL )
+	if( buffers == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 "%s: invalid buffers.",
 		 function );
 
 		return( -1 );
 	}
-#if UINT_MAX < SSIZE_MAX
-	if( size > (size_t) UINT_MAX )
-#else
-	if( size > (size_t) SSIZE_MAX )
-#endif
+	if( buffer_sizes == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer sizes.",
 		 function );
 
 		return( -1 );
 	}
-	if( error_code == NULL )
+	if( number_of_buffers < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid error code.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of buffers value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( WINAPI )
-	write_count = _write(
-	               internal_file->descriptor,
-	               (void *) buffer,
-	               (unsigned int) size );
-#else
-	write_count = write(
-	               internal_file->descriptor,
-	               (void *) buffer,
-	               size );
-#endif
-	if( write_count < 0 )
+	if( offset < 0 )
 	{
-		*error_code = (uint32_t) errno;
-
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 *error_code,
-		 "%s: unable to write to file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	return( write_count );
-}
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		if( buffers[ buffer_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid buffer: %d.",
+			 function,
+			 buffer_index );
 
-#else
-#error Missing file write function
-#endif
+			return( -1 );
+		}
+		if( buffer_sizes[ buffer_index ] > ( (size_t) SSIZE_MAX - total_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid buffer sizes value exceeds maximum.",
+			 function );
 
-#if defined( WINAPI ) && ( WINVER <= 0x0500 ) && !defined( USE_CRT_FUNCTIONS )
+			return( -1 );
+		}
+		total_size += buffer_sizes[ buffer_index ];
+	}
+	buffer_index = 0;
 
-#if !defined( INVALID_SET_FILE_POINTER )
-#define INVALID_SET_FILE_POINTER	((LONG) -1)
-#endif
+	while( buffer_index < number_of_buffers )
+	{
+		number_of_io_vectors = 0;
 
-/* Cross Windows safe version of SetFilePointerEx
- * Returns TRUE if successful or FALSE on error
- */
-BOOL libcfile_SetFilePointerEx(
-      HANDLE file_handle,
-      LARGE_INTEGER distance_to_move_large_integer,
-      LARGE_INTEGER *new_file_pointer_large_integer,
-      DWORD move_method )
-{
-	FARPROC function                 = NULL;
-	HMODULE library_handle           = NULL;
-	LONG distance_to_move_lower_long = 0;
-	LONG distance_to_move_upper_long = 0;
-	DWORD error_number               = 0;
-	BOOL result                      = FALSE;
-
-	if( file_handle == NULL )
-	{
-		return( FALSE );
-	}
-	if( new_file_pointer_large_integer == NULL )
-	{
-		return( FALSE );
-	}
-	library_handle = LoadLibrary(
-	                  _LIBCSTRING_SYSTEM_STRING( "kernel32.dll" ) );
-
-	if( library_handle == NULL )
-	{
-		return( FALSE );
-	}
-	function = GetProcAddress(
-		    library_handle,
-		    (LPCSTR) "SetFilePointerEx" );
-
-	if( function != NULL )
-	{
-		result = function(
-			  file_handle,
-			  distance_to_move_large_integer,
-			  new_file_pointer_large_integer,
-			  move_method );
-	}
-	else
-	{
-#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x520
-		distance_to_move_lower_long = distance_to_move_large_integer.QuadPart & 0xffffffffUL;
-		distance_to_move_upper_long = distance_to_move_large_integer.QuadPart >> 32;
-#else
-		distance_to_move_lower_long = distance_to_move_large_integer.LowPart;
-		distance_to_move_upper_long = distance_to_move_large_integer.HighPart;
-#endif
-
-/* TODO make sure SetFilePointer is WINAPI version safe ? Officially first supported in Windows XP */
-		distance_to_move_lower_long = SetFilePointer(
-					       file_handle,
-					       distance_to_move_lower_long,
-					       &distance_to_move_upper_long,
-					       move_method );
+		for( io_vector_index = buffer_index;
+		     io_vector_index < number_of_buffers;
+		     io_vector_index++ )
+		{
+			if( number_of_io_vectors >= LIBCFILE_MAXIMUM_NUMBER_OF_IO_VECTORS )
+			{
+				break;
+			}
+			if( io_vector_index == buffer_index )
+			{
+				io_vectors[ number_of_io_vectors ].iov_base = (void *) &( ( buffers[ io_vector_index ] )[ buffer_offset ] );
+				io_vectors[ number_of_io_vectors ].iov_len  = buffer_sizes[ io_vector_index ] - buffer_offset;
+			}
+			else
+			{
+				io_vectors[ number_of_io_vectors ].iov_base = (void *) buffers[ io_vector_index ];
+				io_vectors[ number_of_io_vectors ].iov_len  = buffer_sizes[ io_vector_index ];
+			}
+			number_of_io_vectors++;
+		}
+		read_count = preadv(
+		              internal_file->descriptor,
+		              io_vectors,
+		              number_of_io_vectors,
+		              (off_t) offset );
 
-		error_number = GetLastError();
+		if( read_count < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to read from file at offset: %" PRIi64 ".",
+			 function,
+			 offset );
 
-		if( ( distance_to_move_lower_long == (LONG) INVALID_SET_FILE_POINTER )
-		 && ( error_number != NO_ERROR ) )
+			return( -1 );
+		}
+		else if( read_count == 0 )
 		{
+			break;
 		}
-		else
+		offset           += (off64_t) read_count;
+		total_read_count += read_count;
+
+		/* Skip the buffers that have been filled, a short read continues
+		 * in the buffer that was partially filled
+		 */
+		while( ( read_count > 0 )
+		    && ( buffer_index < number_of_buffers ) )
 		{
-#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x520
-			new_file_pointer_large_integer->QuadPart   = distance_to_move_upper_long;
-			new_file_pointer_large_integer->QuadPart <<= 32;
-			new_file_pointer_large_integer->QuadPart  += distance_to_move_lower_long;
-#else
-			new_file_pointer_large_integer->HighPart = distance_to_move_upper_long;
-			new_file_pointer_large_integer->LowPart  = distance_to_move_lower_long;
-#endif
+			remaining_buffer_size = buffer_sizes[ buffer_index ] - buffer_offset;
 
-			result = TRUE;
+			if( (size_t) read_count < remaining_buffer_size )
+			{
+				buffer_offset += (size_t) read_count;
+				read_count     = 0;
+			}
+			else
+			{
+				read_count   -= (ssize_t) remaining_buffer_size;
+				buffer_offset = 0;
+
+				buffer_index++;
+			}
 		}
 	}
-	/* This call should be after using the function
-	 * in most cases kernel32.dll will still be available after free
-	 */
-	if( FreeLibrary(
-	     library_handle ) != TRUE )
+	if( internal_file->drop_cached_data != 0 )
 	{
-		result = FALSE;
+		if( libcfile_internal_file_add_cached_data(
+		     internal_file,
+		     offset - (off64_t) total_read_count,
+		     (size_t) total_read_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to drop cached data.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	return( result );
+	return( total_read_count );
 }
 
-#endif
-
-#if defined( WINAPI ) && !defined( USE_CRT_FUNCTIONS )
+#else
 
-/* Seeks a certain offset within the file
- * This function uses the WINAPI function for Windows XP (0x0501) or later
- * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
- * Returns the offset if the seek is successful or -1 on error
+/* Reads buffers from the file at a specific offset
+ * The buffers are filled consecutively with the data that starts at the offset
+ * This function seeks the offset, reads the buffers and restores the current offset
+ * Returns the number of bytes read if successful, or -1 on error
  */
-off64_t libcfile_file_seek_offset(
+ssize_t libcfile_file_read_buffers_at_offset(
          libcfile_file_t *file,
+         uint8_t **buffers,
+         size_t *buffer_sizes,
+         int number_of_buffers,
          off64_t offset,
-         int whence,
          libcerror_error_t **error )
 {
-	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_seek_offset";
-	LARGE_INTEGER large_integer_offset      = LIBCFILE_LARGE_INTEGER_ZERO;
-	DWORD error_code                        = 0;
-	DWORD move_method                       = 0;
+	static char *function    = "libcfile_file_read_buffers_at_offset";
+	off64_t current_offset   = 0;
+	ssize_t read_count       = 0;
+	ssize_t total_read_count = 0;
+	int buffer_index         = 0;
 
-	if( file == NULL )
+	if( buffers == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 "%s: invalid buffers.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libcfile_internal_file_t *) file;
-
-	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	if( buffer_sizes == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer sizes.",
 		 function );
 
 		return( -1 );
 	}
-	if( offset > (off64_t) INT64_MAX )
+	if( number_of_buffers < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid offset value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of buffers value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( whence != SEEK_CUR )
-	 && ( whence != SEEK_END )
-	 && ( whence != SEEK_SET ) )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported whence.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	if( whence == SEEK_SET )
-	{
-		move_method = FILE_BEGIN;
-	}
-	else if( whence == SEEK_CUR )
-	{
-		move_method = FILE_CURRENT;
-	}
-	else if( whence == SEEK_END )
+	if( libcfile_file_get_offset(
+	     file,
+	     &current_offset,
+	     error ) != 1 )
 	{
-		move_method = FILE_END;
-	}
-#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x0520
-	large_integer_offset.QuadPart = (LONGLONG) offset;
-#else
-	large_integer_offset.LowPart  = (DWORD) ( 0x0ffffffffUL & offset );
-	large_integer_offset.HighPart = (LONG) ( offset >> 32 );
-#endif
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current offset.",
+		 function );
 
-#if ( WINVER <= 0x0500 )
-	if( libcfile_SetFilePointerEx(
-	     internal_file->handle,
-	     large_integer_offset,
-	     &large_integer_offset,
-	     move_method ) == 0 )
-#else
-	if( SetFilePointerEx(
-	     internal_file->handle,
-	     large_integer_offset,
-	     &large_integer_offset,
-	     move_method ) == 0 )
-#endif
+		return( -1 );
+	}
+	if( libcfile_file_seek_offset(
+	     file,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
 	{
-		error_code = GetLastError();
-
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 error_code,
-		 "%s: unable to seek offset in file.",
-		 function );
+		 "%s: unable to seek offset: %" PRIi64 ".",
+		 function,
+		 offset );
 
 		return( -1 );
 	}
-#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x0520
-	offset = (off64_t) large_integer_offset.QuadPart;
-#else
-	offset = ( (off64_t) large_integer_offset.HighPart << 32 ) + large_integer_offset.LowPart;
-#endif
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		read_count = libcfile_file_read_buffer(
+		              file,
+		              buffers[ buffer_index ],
+		              buffer_sizes[ buffer_index ],
+		              error );
 
-	if( offset < 0 )
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+		if( total_read_count > ( SSIZE_MAX - read_count ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid total read count value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		total_read_count += read_count;
+
+		if( (size_t) read_count != buffer_sizes[ buffer_index ] )
+		{
+			break;
+		}
+	}
+	if( libcfile_file_seek_offset(
+	     file,
+	     current_offset,
+	     SEEK_SET,
+	     error ) == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: invalid offset: %" PRIi64 " returned.",
+		 "%s: unable to seek current offset: %" PRIi64 ".",
 		 function,
-		 offset );
+		 current_offset );
 
 		return( -1 );
 	}
-	return( offset );
+	return( total_read_count );
+
+on_error:
+	libcfile_file_seek_offset(
+	 file,
+	 current_offset,
+	 SEEK_SET,
+	 NULL );
+
+	return( -1 );
 }
 
-#elif defined( HAVE_LSEEK ) || defined( WINAPI )
+#endif /* defined( HAVE_PREADV ) */
 
-/* Seeks a certain offset within the file
- * This function uses the POSIX lseek function or equivalent
- * Returns the offset if the seek is successful or -1 on error
+/* Writes a buffer to the file
+ * Returns the number of bytes written if successful, or -1 on error
  */
-off64_t libcfile_file_seek_offset(
+ssize_t libcfile_file_write_buffer(
          libcfile_file_t *file,
-         off64_t offset,
-         int whence,
+         const uint8_t *buffer,
+         size_t size,
          libcerror_error_t **error )
 {
-	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_seek_offset";
+	static char *function = "libcfile_file_write_buffer";
+	ssize_t write_count   = 0;
+	uint32_t error_code   = 0;
 
-	if( file == NULL )
+	write_count = libcfile_file_write_buffer_with_error_code(
+	               file,
+	               buffer,
+	               size,
+	               &error_code,
+	               error );
+
+	if( write_count == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write to file.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libcfile_internal_file_t *) file;
-
-	if( internal_file->descriptor == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing descriptor.",
-		 function );
-
-		return( -1 );
-	}
-	if( offset > (off64_t) INT64_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid offset value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( whence != SEEK_CUR )
-	 && ( whence != SEEK_END )
-	 && ( whence != SEEK_SET ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported whence.",
-		 function );
-
-		return( -1 );
-	}
-#if defined( WINAPI )
-	offset = _lseeki64(
-	          internal_file->descriptor,
-	          offset,
-	          whence );
-#else
-	offset = lseek(
-	          internal_file->descriptor,
-	          (off_t) offset,
-	          whence );
-#endif
-	if( offset < 0 )
-	{
-		libcerror_system_set_error(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 errno,
-		 "%s: unable to seek offset in file.",
-		 function );
-
-		return( -1 );
-	}
-	return( offset );
-}
-
-#else
-#error Missing file lseek function
-#endif
-
-#if defined( WINAPI ) && ( WINVER <= 0x0500 ) && !defined( USE_CRT_FUNCTIONS )
-
-/* Cross Windows safe version of SetEndOfFile
- * Returns TRUE if successful or FALSE on error
- */
-BOOL libcfile_SetEndOfFile(
-      HANDLE file_handle )
-{
-	FARPROC function       = NULL;
-	HMODULE library_handle = NULL;
-	BOOL result            = FALSE;
-
-	if( file_handle == NULL )
-	{
-		return( FALSE );
-	}
-	library_handle = LoadLibrary(
-	                  _LIBCSTRING_SYSTEM_STRING( "kernel32.dll" ) );
-
-	if( library_handle == NULL )
-	{
-		return( FALSE );
-	}
-	function = GetProcAddress(
-		    library_handle,
-		    (LPCSTR) "SetEndOfFile" );
-
-	if( function != NULL )
-	{
-		result = function(
-			  file_handle );
-	}
-	/* This call should be after using the function
-	 * in most cases kernel32.dll will still be available after free
-	 */
-	if( FreeLibrary(
-	     library_handle ) != TRUE )
-	{
-		result = FALSE;
-	}
-	return( result );
+	return( write_count );
 }
 
-#endif
-
-#if defined( WINAPI ) && !defined( USE_CRT_FUNCTIONS )
+#if defined( WINAPI ) && ( WINVER > 0x0500 ) && !defined( USE_CRT_FUNCTIONS )
 
-/* Resizes the file
+/* Writes a buffer to the file
  * This function uses the WINAPI function for Windows XP (0x0501) or later
- * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
- * Returns 1 if successful or -1 on error
+ * Returns the number of bytes written if successful, or -1 on error
  */
-int libcfile_file_resize(
-     libcfile_file_t *file,
-     size64_t size,
-     libcerror_error_t **error )
+ssize_t libcfile_file_write_buffer_with_error_code(
+         libcfile_file_t *file,
+         const uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error )
 {
 	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_resize";
-	off64_t offset                          = 0;
-	LARGE_INTEGER large_integer_offset      = LIBCFILE_LARGE_INTEGER_ZERO;
-	DWORD error_code                        = 0;
+	static char *function                   = "libcfile_file_write_buffer_with_error_code";
+	ssize_t write_count                     = 0;
 
 	if( file == NULL )
 	{
@@ -2522,104 +2559,98 @@ int libcfile_file_resize(
 
 		return( -1 );
 	}
-	if( size > (size64_t) INT64_MAX )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x0520
-	large_integer_offset.QuadPart = (LONGLONG) size;
-#else
-	large_integer_offset.LowPart  = (DWORD) ( 0x0ffffffffUL & size );
-	large_integer_offset.HighPart = (LONG) ( size >> 32 );
-#endif
-
-#if ( WINVER <= 0x0500 )
-	if( libcfile_SetFilePointerEx(
-	     internal_file->handle,
-	     large_integer_offset,
-	     &large_integer_offset,
-	     FILE_BEGIN ) == 0 )
+#if UINT32_MAX < SSIZE_MAX
+	if( size > (size_t) UINT32_MAX )
 #else
-	if( SetFilePointerEx(
-	     internal_file->handle,
-	     large_integer_offset,
-	     &large_integer_offset,
-	     FILE_BEGIN ) == 0 )
+	if( size > (size_t) SSIZE_MAX )
 #endif
 	{
-		error_code = GetLastError();
-
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 error_code,
-		 "%s: unable to seek offset in file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x0520
-	offset = (off64_t) large_integer_offset.QuadPart;
-#else
-	offset = ( (off64_t) large_integer_offset.HighPart << 32 ) + large_integer_offset.LowPart;
-#endif
-
-	if( offset < 0 )
+	if( error_code == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: invalid offset: %" PRIi64 " returned.",
-		 function,
-		 offset );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
 
 		return( -1 );
 	}
-#if ( WINVER <= 0x0500 )
-	if( libcfile_SetEndOfFile(
-	     internal_file->handle ) == 0 )
-#else
-	if( SetEndOfFile(
-	     internal_file->handle ) == 0 )
-#endif
+	if( WriteFile(
+	     internal_file->handle,
+	     buffer,
+	     (DWORD) size,
+	     (LPDWORD) &write_count,
+	     NULL ) == 0 )
 	{
-		error_code = GetLastError();
+		*error_code = (uint32_t) GetLastError();
 
 		libcerror_system_set_error(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 error_code,
-		 "%s: unable to resize file.",
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 *error_code,
+		 "%s: unable to write to file.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	if( write_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: invalid write count: %" PRIzd " returned.",
+		 function,
+		 write_count );
+
+		return( -1 );
+	}
+	return( write_count );
 }
 
-#elif defined( HAVE_FTRUNCATE ) || defined( WINAPI )
+#elif defined( WINAPI ) && !defined( USE_CRT_FUNCTIONS )
 
-/* Resizes the file
- * This function uses the POSIX truncate function or equivalent
- * Returns 1 if successful or -1 on error
+/* TODO */
+#error WINAPI file write function for Windows 2000 or earlier NOT implemented yet
+
+#elif defined( HAVE_WRITE ) || defined( WINAPI )
+
+/* Writes a buffer to the file
+ * This function uses the POSIX write function or equivalent
+ * Returns the number of bytes written if successful, or -1 on error
  */
-int libcfile_file_resize(
-     libcfile_file_t *file,
-     size64_t size,
-     libcerror_error_t **error )
+ssize_t libcfile_file_write_buffer_with_error_code(
+         libcfile_file_t *file,
+         const uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error )
 {
 	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_resize";
+	static char *function                   = "libcfile_file_write_buffer_with_error_code";
+	ssize_t write_count                     = 0;
 
 	if( file == NULL )
 	{
@@ -2645,105 +2676,119 @@ int libcfile_file_resize(
 
 		return( -1 );
 	}
-#if defined( WINAPI )
-	if( size > (size64_t) LONG_MAX )
-#elif SIZEOF_OFF_T >= 8
-	if( size > (size64_t) INT64_MAX )
-#else
-	if( size > (size64_t) INT32_MAX )
-#endif
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( WINAPI )
-	if( _chsize(
-	     internal_file->descriptor,
-	     (long) size ) != 0 )
+#if UINT_MAX < SSIZE_MAX
+	if( size > (size_t) UINT_MAX )
 #else
-	if( ftruncate(
-	     internal_file->descriptor,
-	     (off_t) size ) != 0 )
+	if( size > (size_t) SSIZE_MAX )
 #endif
 	{
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_GENERIC,
-		 errno,
-		 "%s: unable to resize file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-#else
-#error Missing file truncate function
-#endif
-
-/* Checks if the file is open
- * Returns 1 if open, 0 if not or -1 on error
- */
-int libcfile_file_is_open(
-     libcfile_file_t *file,
-     libcerror_error_t **error )
-{
-	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_is_open";
-
-	if( file == NULL )
+	if( error_code == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 "%s: invalid error code.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libcfile_internal_file_t *) file;
-
-#if defined( WINAPI ) && !defined( USE_CRT_FUNCTIONS )
-	if( internal_file->handle == INVALID_HANDLE_VALUE )
+#if defined( WINAPI )
+	write_count = _write(
+	               internal_file->descriptor,
+	               (void *) buffer,
+	               (unsigned int) size );
 #else
-	if( internal_file->descriptor == -1 )
+	write_count = write(
+	               internal_file->descriptor,
+	               (void *) buffer,
+	               size );
 #endif
+	if( write_count < 0 )
 	{
-		return( 0 );
+		*error_code = (uint32_t) errno;
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 *error_code,
+		 "%s: unable to write to file.",
+		 function );
+
+		return( -1 );
 	}
-	return( 1 );
+	if( internal_file->drop_cached_data != 0 )
+	{
+		if( libcfile_internal_file_add_cached_data_at_current_offset(
+		     file,
+		     (size_t) write_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to drop cached data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( write_count );
 }
 
+#else
+#error Missing file write function
+#endif
+
 #if defined( WINAPI ) && ( WINVER <= 0x0500 ) && !defined( USE_CRT_FUNCTIONS )
 
-/* Cross Windows safe version of GetFileSizeEx
+#if !defined( INVALID_SET_FILE_POINTER )
+#define INVALID_SET_FILE_POINTER	((LONG) -1)
+#endif
+
+/* Cross Windows safe version of SetFilePointerEx
  * Returns TRUE if successful or FALSE on error
  */
-BOOL libcfile_GetFileSizeEx(
+BOOL libcfile_SetFilePointerEx(
       HANDLE file_handle,
-      LARGE_INTEGER *file_size_large_integer )
+      LARGE_INTEGER distance_to_move_large_integer,
+      LARGE_INTEGER *new_file_pointer_large_integer,
+      DWORD move_method )
 {
-	FARPROC function            = NULL;
-	HMODULE library_handle      = NULL;
-	DWORD error_number          = 0;
-	DWORD file_size_upper_dword = 0;
-	DWORD file_size_lower_dword = 0;
-	BOOL result                 = FALSE;
+	FARPROC function                 = NULL;
+	HMODULE library_handle           = NULL;
+	LONG distance_to_move_lower_long = 0;
+	LONG distance_to_move_upper_long = 0;
+	DWORD error_number               = 0;
+	BOOL result                      = FALSE;
 
 	if( file_handle == NULL )
 	{
 		return( FALSE );
 	}
-	if( file_size_large_integer == NULL )
+	if( new_file_pointer_large_integer == NULL )
 	{
 		return( FALSE );
 	}
@@ -2756,36 +2801,48 @@ BOOL libcfile_GetFileSizeEx(
 	}
 	function = GetProcAddress(
 		    library_handle,
-		    (LPCSTR) "GetFileSizeEx" );
+		    (LPCSTR) "SetFilePointerEx" );
 
 	if( function != NULL )
 	{
 		result = function(
 			  file_handle,
-			  file_size_large_integer );
+			  distance_to_move_large_integer,
+			  new_file_pointer_large_integer,
+			  move_method );
 	}
 	else
 	{
-/* TODO make sure GetFileSize is WINAPI version safe ? Officially first supported in Windows XP */
-		file_size_lower_dword = GetFileSize(
-		                         file_handle,
-		                         &file_size_upper_dword );
+#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x520
+		distance_to_move_lower_long = distance_to_move_large_integer.QuadPart & 0xffffffffUL;
+		distance_to_move_upper_long = distance_to_move_large_integer.QuadPart >> 32;
+#else
+		distance_to_move_lower_long = distance_to_move_large_integer.LowPart;
+		distance_to_move_upper_long = distance_to_move_large_integer.HighPart;
+#endif
+
+/* TODO make sure SetFilePointer is WINAPI version safe ? Officially first supported in Windows XP */
+		distance_to_move_lower_long = SetFilePointer(
+					       file_handle,
+					       distance_to_move_lower_long,
+					       &distance_to_move_upper_long,
+					       move_method );
 
 		error_number = GetLastError();
 
-		if( ( file_size_lower_dword == INVALID_FILE_SIZE )
+		if( ( distance_to_move_lower_long == (LONG) INVALID_SET_FILE_POINTER )
 		 && ( error_number != NO_ERROR ) )
 		{
 		}
 		else
 		{
 #if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x520
-			file_size_large_integer->QuadPart   = file_size_upper_dword;
-			file_size_large_integer->QuadPart <<= 32;
-			file_size_large_integer->QuadPart  += file_size_lower_dword;
+			new_file_pointer_large_integer->QuadPart   = distance_to_move_upper_long;
+			new_file_pointer_large_integer->QuadPart <<= 32;
+			new_file_pointer_large_integer->QuadPart  += distance_to_move_lower_long;
 #else
-			file_size_large_integer->HighPart = file_size_upper_dword;
-			file_size_large_integer->LowPart  = file_size_lower_dword;
+			new_file_pointer_large_integer->HighPart = distance_to_move_upper_long;
+			new_file_pointer_large_integer->LowPart  = distance_to_move_lower_long;
 #endif
 
 			result = TRUE;
@@ -2806,20 +2863,22 @@ BOOL libcfile_GetFileSizeEx(
 
 #if defined( WINAPI ) && !defined( USE_CRT_FUNCTIONS )
 
-/* Retrieves the current offset in the file
+/* Seeks a certain offset within the file
  * This function uses the WINAPI function for Windows XP (0x0501) or later
  * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
- * Returns 1 if successful or -1 on error
+ * Returns the offset if the seek is successful or -1 on error
  */
-int libcfile_file_get_offset(
-     libcfile_file_t *file,
-     off64_t *offset,
-     libcerror_error_t **error )
+off64_t libcfile_file_seek_offset(
+         libcfile_file_t *file,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
 {
 	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_get_offset";
+	static char *function                   = "libcfile_file_seek_offset";
 	LARGE_INTEGER large_integer_offset      = LIBCFILE_LARGE_INTEGER_ZERO;
 	DWORD error_code                        = 0;
+	DWORD move_method                       = 0;
 
 	if( file == NULL )
 	{
@@ -2845,29 +2904,61 @@ int libcfile_file_get_offset(
 
 		return( -1 );
 	}
-	if( offset == NULL )
+	if( offset > (off64_t) INT64_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offset.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid offset value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
 		 function );
 
 		return( -1 );
 	}
+	if( whence == SEEK_SET )
+	{
+		move_method = FILE_BEGIN;
+	}
+	else if( whence == SEEK_CUR )
+	{
+		move_method = FILE_CURRENT;
+	}
+	else if( whence == SEEK_END )
+	{
+		move_method = FILE_END;
+	}
+#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x0520
+	large_integer_offset.QuadPart = (LONGLONG) offset;
+#else
+	large_integer_offset.LowPart  = (DWORD) ( 0x0ffffffffUL & offset );
+	large_integer_offset.HighPart = (LONG) ( offset >> 32 );
+#endif
+
 #if ( WINVER <= 0x0500 )
 	if( libcfile_SetFilePointerEx(
 	     internal_file->handle,
 	     large_integer_offset,
 	     &large_integer_offset,
-	     FILE_CURRENT ) == 0 )
+	     move_method ) == 0 )
 #else
 	if( SetFilePointerEx(
 	     internal_file->handle,
 	     large_integer_offset,
 	     &large_integer_offset,
-	     FILE_CURRENT ) == 0 )
+	     move_method ) == 0 )
 #endif
 	{
 		error_code = GetLastError();
@@ -2883,12 +2974,12 @@ int libcfile_file_get_offset(
 		return( -1 );
 	}
 #if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x0520
-	*offset = (off64_t) large_integer_offset.QuadPart;
+	offset = (off64_t) large_integer_offset.QuadPart;
 #else
-	*offset = ( (off64_t) large_integer_offset.HighPart << 32 ) + large_integer_offset.LowPart;
+	offset = ( (off64_t) large_integer_offset.HighPart << 32 ) + large_integer_offset.LowPart;
 #endif
 
-	if( *offset < 0 )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -2896,26 +2987,27 @@ int libcfile_file_get_offset(
 		 LIBCERROR_IO_ERROR_SEEK_FAILED,
 		 "%s: invalid offset: %" PRIi64 " returned.",
 		 function,
-		 *offset );
+		 offset );
 
 		return( -1 );
 	}
-	return( 1 );
+	return( offset );
 }
 
 #elif defined( HAVE_LSEEK ) || defined( WINAPI )
 
-/* Retrieves the current offset in the file
+/* Seeks a certain offset within the file
  * This function uses the POSIX lseek function or equivalent
- * Returns 1 if successful or -1 on error
+ * Returns the offset if the seek is successful or -1 on error
  */
-int libcfile_file_get_offset(
-     libcfile_file_t *file,
-     off64_t *offset,
-     libcerror_error_t **error )
+off64_t libcfile_file_seek_offset(
+         libcfile_file_t *file,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
 {
 	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_get_offset";
+	static char *function                   = "libcfile_file_seek_offset";
 
 	if( file == NULL )
 	{
@@ -2941,33 +3033,46 @@ int libcfile_file_get_offset(
 
 		return( -1 );
 	}
-	if( offset == NULL )
+	if( offset > (off64_t) INT64_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offset.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid offset value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( WINAPI )
-	*offset = _lseeki64(
-	           internal_file->descriptor,
-	           0,
-	           SEEK_CUR );
-#else
-	*offset = lseek(
-	           internal_file->descriptor,
-	           0,
-	           SEEK_CUR );
-#endif
-	if( *offset < 0 )
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
 	{
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	offset = _lseeki64(
+	          internal_file->descriptor,
+	          offset,
+	          whence );
+#else
+	offset = lseek(
+	          internal_file->descriptor,
+	          (off_t) offset,
+	          whence );
+#endif
+	if( offset < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_SEEK_FAILED,
 		 errno,
 		 "%s: unable to seek offset in file.",
@@ -2975,46 +3080,75 @@ int libcfile_file_get_offset(
 
 		return( -1 );
 	}
-	return( 1 );
+	return( offset );
 }
 
 #else
 #error Missing file lseek function
 #endif
 
-#if defined( WINAPI ) && !defined( USE_CRT_FUNCTIONS )
-
-#if !defined( IOCTL_DISK_GET_LENGTH_INFO )
-#define IOCTL_DISK_GET_LENGTH_INFO \
-	CTL_CODE( IOCTL_DISK_BASE, 0x0017, METHOD_BUFFERED, FILE_READ_ACCESS )
+#if defined( WINAPI ) && ( WINVER <= 0x0500 ) && !defined( USE_CRT_FUNCTIONS )
 
-typedef struct
+/* Cross Windows safe version of SetEndOfFile
+ * Returns TRUE if successful or FALSE on error
+ */
+BOOL libcfile_SetEndOfFile(
+      HANDLE file_handle )
 {
-	LARGE_INTEGER Length;
+	FARPROC function       = NULL;
+	HMODULE library_handle = NULL;
+	BOOL result            = FALSE;
+
+	if( file_handle == NULL )
+	{
+		return( FALSE );
+	}
+	library_handle = LoadLibrary(
+	                  _LIBCSTRING_SYSTEM_STRING( "kernel32.dll" ) );
+
+	if( library_handle == NULL )
+	{
+		return( FALSE );
+	}
+	function = GetProcAddress(
+		    library_handle,
+		    (LPCSTR) "SetEndOfFile" );
+
+	if( function != NULL )
+	{
+		result = function(
+			  file_handle );
+	}
+	/* This call should be after using the function
+	 * in most cases kernel32.dll will still be available after free
+	 */
+	if( FreeLibrary(
+	     library_handle ) != TRUE )
+	{
+		result = FALSE;
+	}
+	return( result );
 }
-GET_LENGTH_INFORMATION;
 
-#endif /* !defined( IOCTL_DISK_GET_LENGTH_INFO ) */
+#endif
 
-/* Retrieves the size of the file
+#if defined( WINAPI ) && !defined( USE_CRT_FUNCTIONS )
+
+/* Resizes the file
  * This function uses the WINAPI function for Windows XP (0x0501) or later
  * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
  * Returns 1 if successful or -1 on error
  */
-int libcfile_file_get_size(
+int libcfile_file_resize(
      libcfile_file_t *file,
-     size64_t *size,
+     size64_t size,
      libcerror_error_t **error )
 {
-	DISK_GEOMETRY disk_geometry;
-	GET_LENGTH_INFORMATION length_information;
-
 	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_get_size";
-	size_t read_count                       = 0;
-	LARGE_INTEGER large_integer_size        = LIBCFILE_LARGE_INTEGER_ZERO;
-	uint32_t error_code                     = 0;
-	int result                              = 0;
+	static char *function                   = "libcfile_file_resize";
+	off64_t offset                          = 0;
+	LARGE_INTEGER large_integer_offset      = LIBCFILE_LARGE_INTEGER_ZERO;
+	DWORD error_code                        = 0;
 
 	if( file == NULL )
 	{
@@ -3040,183 +3174,104 @@ int libcfile_file_get_size(
 
 		return( -1 );
 	}
-	if( size == NULL )
+	if( size > (size64_t) INT64_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid size.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	result = libcfile_file_is_device(
-	          file,
-	          error );
+#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x0520
+	large_integer_offset.QuadPart = (LONGLONG) size;
+#else
+	large_integer_offset.LowPart  = (DWORD) ( 0x0ffffffffUL & size );
+	large_integer_offset.HighPart = (LONG) ( size >> 32 );
+#endif
 
-	if( result == -1 )
+#if ( WINVER <= 0x0500 )
+	if( libcfile_SetFilePointerEx(
+	     internal_file->handle,
+	     large_integer_offset,
+	     &large_integer_offset,
+	     FILE_BEGIN ) == 0 )
+#else
+	if( SetFilePointerEx(
+	     internal_file->handle,
+	     large_integer_offset,
+	     &large_integer_offset,
+	     FILE_BEGIN ) == 0 )
+#endif
 	{
-		libcerror_error_set(
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if file is a device.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 error_code,
+		 "%s: unable to seek offset in file.",
 		 function );
 
 		return( -1 );
 	}
-	else if( result != 0 )
-	{
-		read_count = libcfile_file_io_control_read_with_error_code(
-		              file,
-		              IOCTL_DISK_GET_LENGTH_INFO,
-		              NULL,
-		              0,
-		              (uint8_t *) &length_information,
-		              sizeof( GET_LENGTH_INFORMATION ),
-		              &error_code,
-		              error );
-
-		if( read_count == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-			 "%s: unable to query device for: IOCTL_DISK_GET_LENGTH_INFO.",
-			 function );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( ( error != NULL )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
-			}
+#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x0520
+	offset = (off64_t) large_integer_offset.QuadPart;
+#else
+	offset = ( (off64_t) large_integer_offset.HighPart << 32 ) + large_integer_offset.LowPart;
 #endif
-			libcerror_error_free(
-			 error );
-
-			if( error_code == ERROR_NOT_SUPPORTED )
-			{
-				/* A floppy device does not support IOCTL_DISK_GET_LENGTH_INFO
-				 */
-				read_count = libcfile_file_io_control_read(
-				              file,
-				              IOCTL_DISK_GET_DRIVE_GEOMETRY,
-				              NULL,
-				              0,
-				              (uint8_t *) &disk_geometry,
-				              sizeof( DISK_GEOMETRY ),
-				              error );
 
-				if( read_count == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-					 "%s: unable to query device for: IOCTL_DISK_GET_DRIVE_GEOMETRY.",
-					 function );
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: invalid offset: %" PRIi64 " returned.",
+		 function,
+		 offset );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						if( ( error != NULL )
-						 && ( *error != NULL ) )
-						{
-							libcnotify_print_error_backtrace(
-							 *error );
-						}
-					}
-#endif
-					libcerror_error_free(
-					 error );
-				}
-				else
-				{
-					*size  = disk_geometry.Cylinders.QuadPart;
-					*size *= disk_geometry.TracksPerCylinder;
-					*size *= disk_geometry.SectorsPerTrack;
-					*size *= disk_geometry.BytesPerSector;
-				}
-			}
-		}
-		else
-		{
-			*size  = (size64_t) length_information.Length.HighPart << 32;
-			*size += length_information.Length.LowPart;
-		}
+		return( -1 );
 	}
-	else
-	{
 #if ( WINVER <= 0x0500 )
-		if( libcfile_GetFileSizeEx(
-		     internal_file->handle,
-		     &large_integer_size ) == 0 )
+	if( libcfile_SetEndOfFile(
+	     internal_file->handle ) == 0 )
 #else
-		if( GetFileSizeEx(
-		     internal_file->handle,
-		     &large_integer_size ) == 0 )
+	if( SetEndOfFile(
+	     internal_file->handle ) == 0 )
 #endif
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve file size.",
-			 function );
+	{
+		error_code = GetLastError();
 
-			return( -1 );
-		}
-#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x520
-		*size = (size64_t) large_integer_size.QuadPart;
-#else
-		*size = ( (size64_t) large_integer_size.HighPart << 32 ) + large_integer_size.LowPart;
-#endif
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 error_code,
+		 "%s: unable to resize file.",
+		 function );
+
+		return( -1 );
 	}
 	return( 1 );
 }
 
-#elif defined( HAVE_FSTAT ) || defined( WINAPI )
+#elif defined( HAVE_FTRUNCATE ) || defined( WINAPI )
 
-/* Retrieves the size of the file
- * This function uses the POSIX fstat function or equivalent
+/* Resizes the file
+ * This function uses the POSIX truncate function or equivalent
  * Returns 1 if successful or -1 on error
  */
-int libcfile_file_get_size(
+int libcfile_file_resize(
      libcfile_file_t *file,
-     size64_t *size,
+     size64_t size,
      libcerror_error_t **error )
 {
-#if defined( _MSC_VER )
-	struct __stat64 file_statistics;
-#elif defined( __BORLANDC__ )
-	struct stati64 file_statistics;
-#else
-	struct stat file_statistics;
-#endif
-
 	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_get_size";
-	size_t file_statistics_size             = 0;
-
-#if !defined( WINAPI )
-	off64_t current_offset                  = 0;
-	off64_t offset                          = 0;
-	ssize_t read_count                      = 0;
-#endif
-#if !defined( DIOCGMEDIASIZE ) && defined( DIOCGDINFO )
-	struct disklabel disk_label;
-#endif
-#if defined( DKIOCGETBLOCKCOUNT )
-	uint64_t block_count                    = 0;
-	uint32_t bytes_per_sector               = 0;
-#endif
+	static char *function                   = "libcfile_file_resize";
 
 	if( file == NULL )
 	{
@@ -3242,347 +3297,181 @@ int libcfile_file_get_size(
 
 		return( -1 );
 	}
-	if( size == NULL )
+#if defined( WINAPI )
+	if( size > (size64_t) LONG_MAX )
+#elif SIZEOF_OFF_T >= 8
+	if( size > (size64_t) INT64_MAX )
+#else
+	if( size > (size64_t) INT32_MAX )
+#endif
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid size.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( _MSC_VER )
-	file_statistics_size = sizeof( struct __stat64 );
-#elif defined( __BORLANDC__ )
-	file_statistics_size = sizeof( struct stati64 );
+#if defined( WINAPI )
+	if( _chsize(
+	     internal_file->descriptor,
+	     (long) size ) != 0 )
 #else
-	file_statistics_size = sizeof( struct stat );
+	if( ftruncate(
+	     internal_file->descriptor,
+	     (off_t) size ) != 0 )
 #endif
-	if( memory_set(
-	     &file_statistics,
-	     0,
-	     file_statistics_size ) == NULL )
 	{
-		libcerror_error_set(
+		libcerror_system_set_error(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear file statistics.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to resize file.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( _MSC_VER )
-	if( _fstat64(
-	     internal_file->descriptor,
-	     &file_statistics ) != 0 )
-#elif defined( __BORLANDC__ )
-	if( _fstati64(
-	     internal_file->descriptor,
-	     &file_statistics ) != 0 )
+	return( 1 );
+}
+
 #else
-	if( fstat(
-	     internal_file->descriptor,
-	     &file_statistics ) != 0 )
+#error Missing file truncate function
 #endif
+
+/* Checks if the file is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libcfile_file_is_open(
+     libcfile_file_t *file,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_is_open";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file statistics.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( WINAPI )
-	if( ( file_statistics.st_mode & _S_IFCHR ) != 0 )
+	internal_file = (libcfile_internal_file_t *) file;
+
+#if defined( WINAPI ) && !defined( USE_CRT_FUNCTIONS )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
 #else
-	if( S_ISBLK( file_statistics.st_mode )
-	 || S_ISCHR( file_statistics.st_mode ) )
+	if( internal_file->descriptor == -1 )
 #endif
 	{
-#if defined( BLKGETSIZE64 )
-		read_count = libcfile_file_io_control_read(
-		              file,
-		              (uint32_t) BLKGETSIZE64,
-		              NULL,
-		              0,
-		              (uint8_t *) size,
-		              8,
-		              error );
+		return( 0 );
+	}
+	return( 1 );
+}
 
-		if( read_count == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-			 "%s: unable to query device for: BLKGETSIZE64.",
-			 function );
+#if defined( WINAPI ) && ( WINVER <= 0x0500 ) && !defined( USE_CRT_FUNCTIONS )
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( ( error != NULL )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
-			}
-#endif
-			libcerror_error_free(
-			 error );
-		}
-#elif defined( DIOCGMEDIASIZE )
-		read_count = libcfile_file_io_control_read(
-		              file,
-		              (uint32_t) DIOCGMEDIASIZE,
-		              NULL,
-		              0,
-		              (uint8_t *) size,
-		              8,
-		              error );
+/* Cross Windows safe version of GetFileSizeEx
+ * Returns TRUE if successful or FALSE on error
+ */
+BOOL libcfile_GetFileSizeEx(
+      HANDLE file_handle,
+      LARGE_INTEGER *file_size_large_integer )
+{
+	FARPROC function            = NULL;
+	HMODULE library_handle      = NULL;
+	DWORD error_number          = 0;
+	DWORD file_size_upper_dword = 0;
+	DWORD file_size_lower_dword = 0;
+	BOOL result                 = FALSE;
 
-		if( read_count == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-			 "%s: unable to query device for: DIOCGMEDIASIZE.",
-			 function );
+	if( file_handle == NULL )
+	{
+		return( FALSE );
+	}
+	if( file_size_large_integer == NULL )
+	{
+		return( FALSE );
+	}
+	library_handle = LoadLibrary(
+	                  _LIBCSTRING_SYSTEM_STRING( "kernel32.dll" ) );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( ( error != NULL )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
-			}
-#endif
-			libcerror_error_free(
-			 error );
-		}
-#elif defined( DIOCGDINFO )
-		read_count = libcfile_file_io_control_read(
-		              file,
-		              (uint32_t) DIOCGDINFO,
-		              NULL,
-		              0,
-		              (uint8_t *) &disk_label,
-		              sizeof( struct disklabel ),
-		              error );
+	if( library_handle == NULL )
+	{
+		return( FALSE );
+	}
+	function = GetProcAddress(
+		    library_handle,
+		    (LPCSTR) "GetFileSizeEx" );
 
-		if( read_count == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-			 "%s: unable to query device for: DIOCGDINFO.",
-			 function );
+	if( function != NULL )
+	{
+		result = function(
+			  file_handle,
+			  file_size_large_integer );
+	}
+	else
+	{
+/* TODO make sure GetFileSize is WINAPI version safe ? Officially first supported in Windows XP */
+		file_size_lower_dword = GetFileSize(
+		                         file_handle,
+		                         &file_size_upper_dword );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( ( error != NULL )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
-			}
-#endif
-			libcerror_error_free(
-			 error );
-		}
-		else
-		{
-			*size = disk_label.d_secperunit * disk_label.d_secsize;
-		}
-#elif defined( DKIOCGETBLOCKCOUNT )
-		read_count = libcfile_file_io_control_read(
-		              file,
-		              (uint32_t) DKIOCGETBLOCKSIZE,
-		              NULL,
-		              0,
-		              (uint8_t *) &bytes_per_sector,
-		              4,
-		              error );
+		error_number = GetLastError();
 
-		if( read_count == -1 )
+		if( ( file_size_lower_dword == INVALID_FILE_SIZE )
+		 && ( error_number != NO_ERROR ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-			 "%s: unable to query device for: DKIOCGETBLOCKSIZE.",
-			 function );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( ( error != NULL )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
-			}
-#endif
-			libcerror_error_free(
-			 error );
 		}
 		else
 		{
-			read_count = libcfile_file_io_control_read(
-			              file,
-			              (uint32_t) DKIOCGETBLOCKCOUNT,
-			              NULL,
-			              0,
-			              (uint8_t *) &block_count,
-			              4,
-			              error );
-
-			if( read_count == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-				 "%s: unable to query device for: DKIOCGETBLOCKCOUNT.",
-				 function );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					if( ( error != NULL )
-					 && ( *error != NULL ) )
-					{
-						libcnotify_print_error_backtrace(
-						 *error );
-					}
-				}
-#endif
-				libcerror_error_free(
-				 error );
-			}
-			else
-			{
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: block size: %" PRIu32 " block count: %" PRIu64 " ",
-					 function,
-					 bytes_per_sector,
-					 block_count );
-				}
-#endif
-				*size = (size64_t) ( block_count * bytes_per_sector );
-			}
-		}
+#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x520
+			file_size_large_integer->QuadPart   = file_size_upper_dword;
+			file_size_large_integer->QuadPart <<= 32;
+			file_size_large_integer->QuadPart  += file_size_lower_dword;
+#else
+			file_size_large_integer->HighPart = file_size_upper_dword;
+			file_size_large_integer->LowPart  = file_size_lower_dword;
 #endif
-#if !defined( WINAPI )
-		if( read_count <= 0 )
-		{
-			/* Try to seek the end of the file and determine the size based on the offset
-			 */
-			if( libcfile_file_get_offset(
-			     file,
-			     &current_offset,
-			     error ) != 1  )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve current offset.",
-				 function );
-
-				return( -1 );
-			}
-			offset = libcfile_file_seek_offset(
-				  file,
-				  0,
-				  SEEK_END,
-				  error );
-
-			if( offset == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_SEEK_FAILED,
-				 "%s: unable to seek end of file.",
-				 function );
-
-				return( -1 );
-			}
-			*size = (size64_t) offset;
-
-			offset = libcfile_file_seek_offset(
-				  file,
-				  current_offset,
-				  SEEK_SET,
-				  error );
-
-			if( offset == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_SEEK_FAILED,
-				 "%s: unable to seek offset: %" PRIi64 ".",
-				 function,
-				 current_offset );
 
-				return( -1 );
-			}
-		}
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: device media size: %" PRIu64 "\n",
-			 function,
-			 *size );
+			result = TRUE;
 		}
-#endif
 	}
-	else
+	/* This call should be after using the function
+	 * in most cases kernel32.dll will still be available after free
+	 */
+	if( FreeLibrary(
+	     library_handle ) != TRUE )
 	{
-		*size = (size64_t) file_statistics.st_size;
+		result = FALSE;
 	}
-	return( 1 );
+	return( result );
 }
 
-#else
-#error Missing file get size function
 #endif
 
-#if defined( WINAPI ) && ( WINVER > 0x0500 ) && !defined( USE_CRT_FUNCTIONS )
+#if defined( WINAPI ) && !defined( USE_CRT_FUNCTIONS )
 
-/* Determines if a file is a device
+/* Retrieves the current offset in the file
  * This function uses the WINAPI function for Windows XP (0x0501) or later
- * Returns 1 if true, 0 if not or -1 on error
+ * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
+ * Returns 1 if successful or -1 on error
  */
-int libcfile_file_is_device(
+int libcfile_file_get_offset(
      libcfile_file_t *file,
+     off64_t *offset,
      libcerror_error_t **error )
 {
 	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_is_device";
-	DWORD file_type                         = 0;
-	int result                              = 0;
+	static char *function                   = "libcfile_file_get_offset";
+	LARGE_INTEGER large_integer_offset      = LIBCFILE_LARGE_INTEGER_ZERO;
+	DWORD error_code                        = 0;
 
 	if( file == NULL )
 	{
@@ -3608,62 +3497,1193 @@ int libcfile_file_is_device(
 
 		return( -1 );
 	}
-/* TODO what about FILE_ATTRIBUTE_DEVICE using GetFileAttributes() */
-
-	/* Use the GetFileType function to rule out certain file types
-	 * like pipes, sockets, etc.
-	 */
-	file_type = GetFileType(
-	             internal_file->handle );
-
-	if( file_type == FILE_TYPE_UNKNOWN )
+	if( offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine file type.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
 		 function );
 
 		return( -1 );
 	}
-	else if( file_type == FILE_TYPE_DISK )
+#if ( WINVER <= 0x0500 )
+	if( libcfile_SetFilePointerEx(
+	     internal_file->handle,
+	     large_integer_offset,
+	     &large_integer_offset,
+	     FILE_CURRENT ) == 0 )
+#else
+	if( SetFilePointerEx(
+	     internal_file->handle,
+	     large_integer_offset,
+	     &large_integer_offset,
+	     FILE_CURRENT ) == 0 )
+#endif
 	{
-		if( internal_file->is_device_filename )
-		{
-			result = 1;
-		}
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 error_code,
+		 "%s: unable to seek offset in file.",
+		 function );
+
+		return( -1 );
 	}
-	return( result );
+#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x0520
+	*offset = (off64_t) large_integer_offset.QuadPart;
+#else
+	*offset = ( (off64_t) large_integer_offset.HighPart << 32 ) + large_integer_offset.LowPart;
+#endif
+
+	if( *offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: invalid offset: %" PRIi64 " returned.",
+		 function,
+		 *offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#elif defined( HAVE_LSEEK ) || defined( WINAPI )
+
+/* Retrieves the current offset in the file
+ * This function uses the POSIX lseek function or equivalent
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_file_get_offset(
+     libcfile_file_t *file,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_get_offset";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	*offset = _lseeki64(
+	           internal_file->descriptor,
+	           0,
+	           SEEK_CUR );
+#else
+	*offset = lseek(
+	           internal_file->descriptor,
+	           0,
+	           SEEK_CUR );
+#endif
+	if( *offset < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 errno,
+		 "%s: unable to seek offset in file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#else
+#error Missing file lseek function
+#endif
+
+#if defined( WINAPI ) && !defined( USE_CRT_FUNCTIONS )
+
+#if !defined( IOCTL_DISK_GET_LENGTH_INFO )
+#define IOCTL_DISK_GET_LENGTH_INFO \
+	CTL_CODE( IOCTL_DISK_BASE, 0x0017, METHOD_BUFFERED, FILE_READ_ACCESS )
+
+typedef struct
+{
+	LARGE_INTEGER Length;
+}
+GET_LENGTH_INFORMATION;
+
+#endif /* !defined( IOCTL_DISK_GET_LENGTH_INFO ) */
+
+/* Retrieves the size of the file
+ * This function uses the WINAPI function for Windows XP (0x0501) or later
+ * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_file_get_size(
+     libcfile_file_t *file,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	DISK_GEOMETRY disk_geometry;
+	GET_LENGTH_INFORMATION length_information;
+
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_get_size";
+	size_t read_count                       = 0;
+	LARGE_INTEGER large_integer_size        = LIBCFILE_LARGE_INTEGER_ZERO;
+	uint32_t error_code                     = 0;
+	int result                              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcfile_file_is_device(
+	          file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file is a device.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		read_count = libcfile_file_io_control_read_with_error_code(
+		              file,
+		              IOCTL_DISK_GET_LENGTH_INFO,
+		              NULL,
+		              0,
+		              (uint8_t *) &length_information,
+		              sizeof( GET_LENGTH_INFORMATION ),
+		              &error_code,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: unable to query device for: IOCTL_DISK_GET_LENGTH_INFO.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			if( error_code == ERROR_NOT_SUPPORTED )
+			{
+				/* A floppy device does not support IOCTL_DISK_GET_LENGTH_INFO
+				 */
+				read_count = libcfile_file_io_control_read(
+				              file,
+				              IOCTL_DISK_GET_DRIVE_GEOMETRY,
+				              NULL,
+				              0,
+				              (uint8_t *) &disk_geometry,
+				              sizeof( DISK_GEOMETRY ),
+				              error );
+
+				if( read_count == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+					 "%s: unable to query device for: IOCTL_DISK_GET_DRIVE_GEOMETRY.",
+					 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+					if( libcnotify_verbose != 0 )
+					{
+						if( ( error != NULL )
+						 && ( *error != NULL ) )
+						{
+							libcnotify_print_error_backtrace(
+							 *error );
+						}
+					}
+#endif
+					libcerror_error_free(
+					 error );
+				}
+				else
+				{
+					*size  = disk_geometry.Cylinders.QuadPart;
+					*size *= disk_geometry.TracksPerCylinder;
+					*size *= disk_geometry.SectorsPerTrack;
+					*size *= disk_geometry.BytesPerSector;
+				}
+			}
+		}
+		else
+		{
+			*size  = (size64_t) length_information.Length.HighPart << 32;
+			*size += length_information.Length.LowPart;
+		}
+	}
+	else
+	{
+#if ( WINVER <= 0x0500 )
+		if( libcfile_GetFileSizeEx(
+		     internal_file->handle,
+		     &large_integer_size ) == 0 )
+#else
+		if( GetFileSizeEx(
+		     internal_file->handle,
+		     &large_integer_size ) == 0 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file size.",
+			 function );
+
+			return( -1 );
+		}
+#if defined( __BORLANDC__ ) && __BORLANDC__ <= 0x520
+		*size = (size64_t) large_integer_size.QuadPart;
+#else
+		*size = ( (size64_t) large_integer_size.HighPart << 32 ) + large_integer_size.LowPart;
+#endif
+	}
+	return( 1 );
+}
+
+#elif defined( HAVE_FSTAT ) || defined( WINAPI )
+
+/* Retrieves the size of the file
+ * This function uses the POSIX fstat function or equivalent
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_file_get_size(
+     libcfile_file_t *file,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+#if defined( _MSC_VER )
+	struct __stat64 file_statistics;
+#elif defined( __BORLANDC__ )
+	struct stati64 file_statistics;
+#else
+	struct stat file_statistics;
+#endif
+
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_get_size";
+	size_t file_statistics_size             = 0;
+
+#if !defined( WINAPI )
+	off64_t current_offset                  = 0;
+	off64_t offset                          = 0;
+	ssize_t read_count                      = 0;
+#endif
+#if !defined( DIOCGMEDIASIZE ) && defined( DIOCGDINFO )
+	struct disklabel disk_label;
+#endif
+#if defined( DKIOCGETBLOCKCOUNT )
+	uint64_t block_count                    = 0;
+	uint32_t bytes_per_sector               = 0;
+#endif
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( _MSC_VER )
+	file_statistics_size = sizeof( struct __stat64 );
+#elif defined( __BORLANDC__ )
+	file_statistics_size = sizeof( struct stati64 );
+#else
+	file_statistics_size = sizeof( struct stat );
+#endif
+	if( memory_set(
+	     &file_statistics,
+	     0,
+	     file_statistics_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file statistics.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( _MSC_VER )
+	if( _fstat64(
+	     internal_file->descriptor,
+	     &file_statistics ) != 0 )
+#elif defined( __BORLANDC__ )
+	if( _fstati64(
+	     internal_file->descriptor,
+	     &file_statistics ) != 0 )
+#else
+	if( fstat(
+	     internal_file->descriptor,
+	     &file_statistics ) != 0 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( ( file_statistics.st_mode & _S_IFCHR ) != 0 )
+#else
+	if( S_ISBLK( file_statistics.st_mode )
+	 || S_ISCHR( file_statistics.st_mode ) )
+#endif
+	{
+#if defined( BLKGETSIZE64 )
+		read_count = libcfile_file_io_control_read(
+		              file,
+		              (uint32_t) BLKGETSIZE64,
+		              NULL,
+		              0,
+		              (uint8_t *) size,
+		              8,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: unable to query device for: BLKGETSIZE64.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+#elif defined( DIOCGMEDIASIZE )
+		read_count = libcfile_file_io_control_read(
+		              file,
+		              (uint32_t) DIOCGMEDIASIZE,
+		              NULL,
+		              0,
+		              (uint8_t *) size,
+		              8,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: unable to query device for: DIOCGMEDIASIZE.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+#elif defined( DIOCGDINFO )
+		read_count = libcfile_file_io_control_read(
+		              file,
+		              (uint32_t) DIOCGDINFO,
+		              NULL,
+		              0,
+		              (uint8_t *) &disk_label,
+		              sizeof( struct disklabel ),
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: unable to query device for: DIOCGDINFO.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		else
+		{
+			*size = disk_label.d_secperunit * disk_label.d_secsize;
+		}
+#elif defined( DKIOCGETBLOCKCOUNT )
+		read_count = libcfile_file_io_control_read(
+		              file,
+		              (uint32_t) DKIOCGETBLOCKSIZE,
+		              NULL,
+		              0,
+		              (uint8_t *) &bytes_per_sector,
+		              4,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: unable to query device for: DKIOCGETBLOCKSIZE.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		else
+		{
+			read_count = libcfile_file_io_control_read(
+			              file,
+			              (uint32_t) DKIOCGETBLOCKCOUNT,
+			              NULL,
+			              0,
+			              (uint8_t *) &block_count,
+			              4,
+			              error );
+
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+				 "%s: unable to query device for: DKIOCGETBLOCKCOUNT.",
+				 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					if( ( error != NULL )
+					 && ( *error != NULL ) )
+					{
+						libcnotify_print_error_backtrace(
+						 *error );
+					}
+				}
+#endif
+				libcerror_error_free(
+				 error );
+			}
+			else
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: block size: %" PRIu32 " block count: %" PRIu64 " ",
+					 function,
+					 bytes_per_sector,
+					 block_count );
+				}
+#endif
+				*size = (size64_t) ( block_count * bytes_per_sector );
+			}
+		}
+#endif
+#if !defined( WINAPI )
+		if( read_count <= 0 )
+		{
+			/* Try to seek the end of the file and determine the size based on the offset
+			 */
+			if( libcfile_file_get_offset(
+			     file,
+			     &current_offset,
+			     error ) != 1  )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve current offset.",
+				 function );
+
+				return( -1 );
+			}
+			offset = libcfile_file_seek_offset(
+				  file,
+				  0,
+				  SEEK_END,
+				  error );
+
+			if( offset == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek end of file.",
+				 function );
+
+				return( -1 );
+			}
+			*size = (size64_t) offset;
+
+			offset = libcfile_file_seek_offset(
+				  file,
+				  current_offset,
+				  SEEK_SET,
+				  error );
+
+			if( offset == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek offset: %" PRIi64 ".",
+				 function,
+				 current_offset );
+
+				return( -1 );
+			}
+		}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: device media size: %" PRIu64 "\n",
+			 function,
+			 *size );
+		}
+#endif
+	}
+	else
+	{
+		*size = (size64_t) file_statistics.st_size;
+	}
+	return( 1 );
+}
+
+#else
+#error Missing file get size function
+#endif
+
+#if defined( WINAPI ) && ( WINVER > 0x0500 ) && !defined( USE_CRT_FUNCTIONS )
+
+/* Determines if a file is a device
+ * This function uses the WINAPI function for Windows XP (0x0501) or later
+ * Returns 1 if true, 0 if not or -1 on error
+ */
+int libcfile_file_is_device(
+     libcfile_file_t *file,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_is_device";
+	DWORD file_type                         = 0;
+	int result                              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+/* TODO what about FILE_ATTRIBUTE_DEVICE using GetFileAttributes() */
+
+	/* Use the GetFileType function to rule out certain file types
+	 * like pipes, sockets, etc.
+	 */
+	file_type = GetFileType(
+	             internal_file->handle );
+
+	if( file_type == FILE_TYPE_UNKNOWN )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine file type.",
+		 function );
+
+		return( -1 );
+	}
+	else if( file_type == FILE_TYPE_DISK )
+	{
+		if( internal_file->is_device_filename )
+		{
+			result = 1;
+		}
+	}
+	return( result );
+}
+
+#elif defined( WINAPI ) && !defined( USE_CRT_FUNCTIONS )
+
+/* TODO */
+#error WINAPI is device function for Windows 2000 or earlier NOT implemented yet
+
+#elif defined( HAVE_FSTAT ) || defined( WINAPI )
+
+/* Determines if a file is a device
+ * This function uses the POSIX fstat function or equivalent
+ * Returns 1 if true, 0 if not or -1 on error
+ */
+int libcfile_file_is_device(
+     libcfile_file_t *file,
+     libcerror_error_t **error )
+{
+#if defined( _MSC_VER )
+	struct __stat64 file_statistics;
+#elif defined( __BORLANDC__ )
+	struct stati64 file_statistics;
+#else
+	struct stat file_statistics;
+#endif
+
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_is_device";
+	size_t file_statistics_size             = 0;
+	int result                              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( _MSC_VER )
+	file_statistics_size = sizeof( struct __stat64 );
+#elif defined( __BORLANDC__ )
+	file_statistics_size = sizeof( struct stati64 );
+#else
+	file_statistics_size = sizeof( struct stat );
+#endif
+	if( memory_set(
+	     &file_statistics,
+	     0,
+	     file_statistics_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file statistics.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( _MSC_VER )
+	if( _fstat64(
+	     internal_file->descriptor,
+	     &file_statistics ) != 0 )
+#elif defined( __BORLANDC__ )
+	if( _fstati64(
+	     internal_file->descriptor,
+	     &file_statistics ) != 0 )
+#else
+	if( fstat(
+	     internal_file->descriptor,
+	     &file_statistics ) != 0 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( ( file_statistics.st_mode & _S_IFCHR ) != 0 )
+#else
+	if( S_ISBLK( file_statistics.st_mode )
+	 || S_ISCHR( file_statistics.st_mode ) )
+#endif
+	{
+		result = 1;
+	}
+	return( result );
+}
+
+#else
+#error Missing file is device function
+#endif
+
+/* Read data from a device file using IO control
+ * Returns the number of bytes read if successful or -1 on error
+ */
+ssize_t libcfile_file_io_control_read(
+         libcfile_file_t *file,
+         uint32_t control_code,
+         uint8_t *control_data,
+         size_t control_data_size,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libcfile_file_io_control_read";
+	ssize_t read_count    = 0;
+	uint32_t error_code   = 0;
+
+	read_count = libcfile_file_io_control_read_with_error_code(
+	              file,
+	              control_code,
+	              control_data,
+	              control_data_size,
+	              data,
+	              data_size,
+	              &error_code,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+		 "%s: unable to to IO control device.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+#if defined( HAVE_IOCTL ) || defined( WINAPI )
+
+/* Read data from a device file using IO control
+ * This function uses the POSIX ioctl function or WINAPI DeviceIoControl
+ * Returns the number of bytes read if successful or -1 on error
+ */
+ssize_t libcfile_file_io_control_read_with_error_code(
+         libcfile_file_t *file,
+         uint32_t control_code,
+         uint8_t *control_data,
+         size_t control_data_size,
+         uint8_t *data,
+         size_t data_size,
+         uint32_t *error_code,
+         libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_io_control_read_with_error_code";
+
+#if defined( WINAPI ) && !defined( USE_CRT_FUNCTIONS )
+	DWORD response_count                    = 0;
+#endif
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcfile_internal_file_t *) file;
+
+#if defined( WINAPI ) && !defined( USE_CRT_FUNCTIONS )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( control_data == NULL )
+	{
+		if( control_data_size != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid control data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+#if UINT32_MAX < SSIZE_MAX
+		if( control_data_size > (size_t) UINT32_MAX )
+#else
+		if( control_data_size > (size_t) SSIZE_MAX )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid control data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( data == NULL )
+	{
+		if( data_size != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+#if UINT32_MAX < SSIZE_MAX
+		if( data_size > (size_t) UINT32_MAX )
+#else
+		if( data_size > (size_t) SSIZE_MAX )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && !defined( USE_CRT_FUNCTIONS )
+	if( DeviceIoControl(
+	     internal_file->handle,
+	     (DWORD) control_code,
+	     control_data,
+	     (DWORD) control_data_size,
+	     data,
+	     (DWORD) data_size,
+	     &response_count,
+	     NULL ) == 0 )
+	{
+		*error_code = (uint32_t) GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+		 *error_code,
+		 "%s: unable to IO control device.",
+		 function );
+
+		return( -1 );
+	}
+#if SSIZE_MAX < UINT32_MAX
+	if( response_count > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid response count value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( (ssize_t) response_count );
+
+#elif defined( HAVE_IOCTL )
+	if( control_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported control data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ioctl(
+	     internal_file->descriptor,
+	     (int) control_code,
+	     data ) == -1 )
+	{
+		*error_code = (uint32_t) errno;
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+		 *error_code,
+		 "%s: unable to IO control device.",
+		 function );
+
+		return( -1 );
+	}
+	return( (size_t) data_size );
+#endif
 }
 
-#elif defined( WINAPI ) && !defined( USE_CRT_FUNCTIONS )
+#else
+#error Missing file IO control with data function
+#endif
 
-/* TODO */
-#error WINAPI is device function for Windows 2000 or earlier NOT implemented yet
+/* On some versions of Linux the FADVISE definions seem to be missing from fcntl.h
+ */
+#if defined( HAVE_POSIX_FADVISE )
 
-#elif defined( HAVE_FSTAT ) || defined( WINAPI )
+#if !defined( POSIX_FADV_NORMAL )
+#define POSIX_FADV_NORMAL		0
+#endif
 
-/* Determines if a file is a device
- * This function uses the POSIX fstat function or equivalent
- * Returns 1 if true, 0 if not or -1 on error
+#if !defined( POSIX_FADV_RANDOM )
+#define POSIX_FADV_RANDOM		1
+#endif
+
+#if !defined( POSIX_FADV_SEQUENTIAL )
+#define POSIX_FADV_SEQUENTIAL		2
+#endif
+
+#endif /* #if defined( HAVE_POSIX_FADVISE ) */
+
+/* Sets the expected access behavior so the system can optimize the access
+ * Returns 1 if successful or -1 on error
  */
-int libcfile_file_is_device(
+int libcfile_file_set_access_behavior(
      libcfile_file_t *file,
+     int access_behavior,
      libcerror_error_t **error )
 {
-#if defined( _MSC_VER )
-	struct __stat64 file_statistics;
-#elif defined( __BORLANDC__ )
-	struct stati64 file_statistics;
-#else
-	struct stat file_statistics;
-#endif
-
 	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_is_device";
-	size_t file_statistics_size             = 0;
-	int result                              = 0;
+	static char *function                   = "libcfile_file_set_access_behavior";
+
+#if defined( HAVE_POSIX_FADVISE )
+	int advice                              = POSIX_FADV_NORMAL;
+#endif
 
 	if( file == NULL )
 	{
@@ -3678,139 +4698,92 @@ int libcfile_file_is_device(
 	}
 	internal_file = (libcfile_internal_file_t *) file;
 
-	if( internal_file->descriptor == -1 )
+#if defined( WINAPI ) && !defined( USE_CRT_FUNCTIONS )
+	if( internal_file->handle == INVALID_HANDLE_VALUE )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing descriptor.",
+		 "%s: invalid file - missing handle.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( _MSC_VER )
-	file_statistics_size = sizeof( struct __stat64 );
-#elif defined( __BORLANDC__ )
-	file_statistics_size = sizeof( struct stati64 );
 #else
-	file_statistics_size = sizeof( struct stat );
-#endif
-	if( memory_set(
-	     &file_statistics,
-	     0,
-	     file_statistics_size ) == NULL )
+	if( internal_file->descriptor == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear file statistics.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( _MSC_VER )
-	if( _fstat64(
-	     internal_file->descriptor,
-	     &file_statistics ) != 0 )
-#elif defined( __BORLANDC__ )
-	if( _fstati64(
-	     internal_file->descriptor,
-	     &file_statistics ) != 0 )
-#else
-	if( fstat(
-	     internal_file->descriptor,
-	     &file_statistics ) != 0 )
 #endif
+	if( ( access_behavior != LIBCFILE_ACCESS_BEHAVIOR_NORMAL )
+	 && ( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_RANDOM )
+	 && ( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_SEQUENTIAL ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file statistics.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access behavior: %d.",
+		 function,
+		 access_behavior );
 
 		return( -1 );
 	}
-#if defined( WINAPI )
-	if( ( file_statistics.st_mode & _S_IFCHR ) != 0 )
-#else
-	if( S_ISBLK( file_statistics.st_mode )
-	 || S_ISCHR( file_statistics.st_mode ) )
-#endif
+#if defined( HAVE_POSIX_FADVISE )
+	if( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_NORMAL )
 	{
-		result = 1;
+		advice = POSIX_FADV_NORMAL;
 	}
-	return( result );
-}
-
-#else
-#error Missing file is device function
-#endif
-
-/* Read data from a device file using IO control
- * Returns the number of bytes read if successful or -1 on error
- */
-ssize_t libcfile_file_io_control_read(
-         libcfile_file_t *file,
-         uint32_t control_code,
-         uint8_t *control_data,
-         size_t control_data_size,
-         uint8_t *data,
-         size_t data_size,
-         libcerror_error_t **error )
-{
-	static char *function = "libcfile_file_io_control_read";
-	ssize_t read_count    = 0;
-	uint32_t error_code   = 0;
-
-	read_count = libcfile_file_io_control_read_with_error_code(
-	              file,
-	              control_code,
-	              control_data,
-	              control_data_size,
-	              data,
-	              data_size,
-	              &error_code,
-	              error );
-
-	if( read_count == -1 )
+	else if( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_RANDOM )
+	{
+		advice = POSIX_FADV_RANDOM;
+	}
+	else if( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_SEQUENTIAL )
+	{
+		advice = POSIX_FADV_SEQUENTIAL;
+	}
+	if( posix_fadvise(
+	     internal_file->descriptor,
+	     0,
+	     0,
+	     advice ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-		 "%s: unable to to IO control device.",
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to advice file descriptor on access behavior.",
 		 function );
 
 		return( -1 );
 	}
-	return( read_count );
+#endif
+	return( 1 );
 }
 
-#if defined( HAVE_IOCTL ) || defined( WINAPI )
-
-/* Read data from a device file using IO control
- * This function uses the POSIX ioctl function or WINAPI DeviceIoControl
- * Returns the number of bytes read if successful or -1 on error
+/* Sets the value to indicate the data read or written should be dropped from the system page cache
+ * The cached data is dropped every LIBCFILE_MAXIMUM_CACHED_DATA_SIZE bytes, when the data read
+ * or written does not directly follow the previous data and when the file is closed
+ * Only the ranges of the data read or written are dropped, the written data is flushed to storage
+ * before it is dropped, this limits the amount of written data that remains to be flushed,
+ * this has no effect on platforms without posix_fadvise
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libcfile_file_io_control_read_with_error_code(
-         libcfile_file_t *file,
-         uint32_t control_code,
-         uint8_t *control_data,
-         size_t control_data_size,
-         uint8_t *data,
-         size_t data_size,
-         uint32_t *error_code,
-         libcerror_error_t **error )
+int libcfile_file_set_drop_cached_data(
+     libcfile_file_t *file,
+     uint8_t drop_cached_data,
+     libcerror_error_t **error )
 {
 	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_io_control_read_with_error_code";
-
-#if defined( WINAPI ) && !defined( USE_CRT_FUNCTIONS )
-	DWORD response_count                    = 0;
-#endif
+	static char *function                   = "libcfile_file_set_drop_cached_data";
 
 	if( file == NULL )
 	{
@@ -3825,19 +4798,40 @@ ssize_t libcfile_file_io_control_read_with_error_code(
 	}
 	internal_file = (libcfile_internal_file_t *) file;
 
-#if defined( WINAPI ) && !defined( USE_CRT_FUNCTIONS )
-	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	internal_file->drop_cached_data    = drop_cached_data;
+	internal_file->cached_data_offset  = 0;
+	internal_file->cached_data_size    = 0;
+	internal_file->flushed_data_offset = 0;
+	internal_file->flushed_data_size   = 0;
+
+	return( 1 );
+}
+
+#if !defined( WINAPI ) || defined( USE_CRT_FUNCTIONS )
+
+/* Drops the cached data of the file from the system page cache
+ * The flush of the data written since the previous call is started and the cached data is dropped
+ * The flush started by the previous call is waited for, after which that data is dropped
+ * Only the ranges of the data read or written are flushed and dropped
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_internal_file_drop_cached_data(
+     libcfile_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_internal_file_drop_cached_data";
+
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-#else
 	if( internal_file->descriptor == -1 )
 	{
 		libcerror_error_set(
@@ -3849,189 +4843,318 @@ ssize_t libcfile_file_io_control_read_with_error_code(
 
 		return( -1 );
 	}
+	if( internal_file->flushed_data_size > 0 )
+	{
+#if defined( HAVE_SYNC_FILE_RANGE )
+		if( sync_file_range(
+		     internal_file->descriptor,
+		     (off64_t) internal_file->flushed_data_offset,
+		     (off64_t) internal_file->flushed_data_size,
+		     SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER ) != 0 )
+		{
+			/* Only an error writing the data is reported
+			 * the flush is advisory on files that do not support it
+			 */
+			if( ( errno == EIO )
+			 || ( errno == ENOSPC ) )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_GENERIC,
+				 errno,
+				 "%s: unable to flush written data.",
+				 function );
+
+				return( -1 );
+			}
+		}
 #endif
-	if( control_data == NULL )
+#if defined( HAVE_POSIX_FADVISE )
+		/* The advice can fail, for example with ESPIPE on a pipe,
+		 * which does not affect the data read or written
+		 */
+		posix_fadvise(
+		 internal_file->descriptor,
+		 (off_t) internal_file->flushed_data_offset,
+		 (off_t) internal_file->flushed_data_size,
+		 POSIX_FADV_DONTNEED );
+#endif
+		internal_file->flushed_data_offset = 0;
+		internal_file->flushed_data_size   = 0;
+	}
+	if( internal_file->cached_data_size > 0 )
 	{
-		if( control_data_size != 0 )
+#if defined( HAVE_SYNC_FILE_RANGE )
+		if( sync_file_range(
+		     internal_file->descriptor,
+		     (off64_t) internal_file->cached_data_offset,
+		     (off64_t) internal_file->cached_data_size,
+		     SYNC_FILE_RANGE_WRITE ) != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid control data size value exceeds maximum.",
-			 function );
+			if( ( errno == EIO )
+			 || ( errno == ENOSPC ) )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_GENERIC,
+				 errno,
+				 "%s: unable to flush written data.",
+				 function );
 
-			return( -1 );
+				return( -1 );
+			}
 		}
+#endif
+#if defined( HAVE_POSIX_FADVISE )
+		/* Data that was read is dropped directly, written data
+		 * is dropped after its flush has completed
+		 */
+		posix_fadvise(
+		 internal_file->descriptor,
+		 (off_t) internal_file->cached_data_offset,
+		 (off_t) internal_file->cached_data_size,
+		 POSIX_FADV_DONTNEED );
+#endif
+		internal_file->flushed_data_offset = internal_file->cached_data_offset;
+		internal_file->flushed_data_size   = internal_file->cached_data_size;
+		internal_file->cached_data_offset  = 0;
+		internal_file->cached_data_size    = 0;
+	}
+	return( 1 );
+}
+
+/* Adds the range of data read or written to the cached data
+ * Drops the cached data when the range does not directly follow the cached data
+ * or when the maximum cached data size is reached
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_internal_file_add_cached_data(
+     libcfile_internal_file_t *internal_file,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_internal_file_add_cached_data";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( size == 0 ) )
+	{
+		return( 1 );
 	}
-	else
+	if( ( internal_file->cached_data_size > 0 )
+	 && ( offset != (off64_t) ( internal_file->cached_data_offset + internal_file->cached_data_size ) ) )
 	{
-#if UINT32_MAX < SSIZE_MAX
-		if( control_data_size > (size_t) UINT32_MAX )
-#else
-		if( control_data_size > (size_t) SSIZE_MAX )
-#endif
+		if( libcfile_internal_file_drop_cached_data(
+		     internal_file,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid control data size value exceeds maximum.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to drop cached data.",
 			 function );
 
 			return( -1 );
 		}
 	}
-	if( data == NULL )
+	if( internal_file->cached_data_size == 0 )
 	{
-		if( data_size != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid data size value exceeds maximum.",
-			 function );
-
-			return( -1 );
-		}
+		internal_file->cached_data_offset = offset;
 	}
-	else
+	internal_file->cached_data_size += size;
+
+	if( internal_file->cached_data_size >= LIBCFILE_MAXIMUM_CACHED_DATA_SIZE )
 	{
-#if UINT32_MAX < SSIZE_MAX
-		if( data_size > (size_t) UINT32_MAX )
-#else
-		if( data_size > (size_t) SSIZE_MAX )
-#endif
+		if( libcfile_internal_file_drop_cached_data(
+		     internal_file,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid data size value exceeds maximum.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to drop cached data.",
 			 function );
 
 			return( -1 );
 		}
 	}
-	if( error_code == NULL )
+	return( 1 );
+}
+
+/* Adds the data read or written that ends at the current offset to the cached data
+ * The data is not added when the current offset cannot be determined
+ * Returns 1 if successful or -1 on error
+ */
+int libcfile_internal_file_add_cached_data_at_current_offset(
+     libcfile_file_t *file,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libcfile_internal_file_add_cached_data_at_current_offset";
+	off64_t current_offset = 0;
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid error code.",
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( WINAPI ) && !defined( USE_CRT_FUNCTIONS )
-	if( DeviceIoControl(
-	     internal_file->handle,
-	     (DWORD) control_code,
-	     control_data,
-	     (DWORD) control_data_size,
-	     data,
-	     (DWORD) data_size,
-	     &response_count,
-	     NULL ) == 0 )
-	{
-		*error_code = (uint32_t) GetLastError();
+	current_offset = libcfile_file_seek_offset(
+	                  file,
+	                  0,
+	                  SEEK_CUR,
+	                  NULL );
 
-		libcerror_system_set_error(
+	if( current_offset < (off64_t) size )
+	{
+		return( 1 );
+	}
+	if( libcfile_internal_file_add_cached_data(
+	     (libcfile_internal_file_t *) file,
+	     current_offset - (off64_t) size,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-		 *error_code,
-		 "%s: unable to IO control device.",
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to add cached data.",
 		 function );
 
 		return( -1 );
 	}
-#if SSIZE_MAX < UINT32_MAX
-	if( response_count > (size_t) SSIZE_MAX )
+	return( 1 );
+}
+
+#endif /* !defined( WINAPI ) || defined( USE_CRT_FUNCTIONS ) */
+
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+
+/* Maps the file into memory for reading
+ * The memory map is removed when the file is closed
+ * Returns 1 if successful, 0 if the file could not be memory mapped or -1 on error
+ */
+int libcfile_file_memory_map(
+     libcfile_file_t *file,
+     libcerror_error_t **error )
+{
+	libcfile_internal_file_t *internal_file = NULL;
+	static char *function                   = "libcfile_file_memory_map";
+	void *mapped_data                       = NULL;
+	size64_t file_size                      = 0;
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid response count value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( (ssize_t) response_count );
+	internal_file = (libcfile_internal_file_t *) file;
 
-#elif defined( HAVE_IOCTL )
-	if( control_data != NULL )
+	if( internal_file->descriptor == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported control data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing descriptor.",
 		 function );
 
 		return( -1 );
 	}
-	if( ioctl(
-	     internal_file->descriptor,
-	     (int) control_code,
-	     data ) == -1 )
+	if( internal_file->mapped_data != NULL )
 	{
-		*error_code = (uint32_t) errno;
-
-		libcerror_system_set_error(
+		return( 1 );
+	}
+	if( libcfile_file_get_size(
+	     file,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-		 *error_code,
-		 "%s: unable to IO control device.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
 		 function );
 
 		return( -1 );
 	}
-	return( (size_t) data_size );
-#endif
-}
-
-#else
-#error Missing file IO control with data function
-#endif
-
-/* On some versions of Linux the FADVISE definions seem to be missing from fcntl.h
- */
-#if defined( HAVE_POSIX_FADVISE )
-
-#if !defined( POSIX_FADV_NORMAL )
-#define POSIX_FADV_NORMAL		0
-#endif
-
-#if !defined( POSIX_FADV_RANDOM )
-#define POSIX_FADV_RANDOM		1
-#endif
+	/* Empty files and files that do not fit in the address space are not mapped
+	 */
+	if( ( file_size == 0 )
+	 || ( file_size > (size64_t) SSIZE_MAX ) )
+	{
+		return( 0 );
+	}
+	mapped_data = mmap(
+	               NULL,
+	               (size_t) file_size,
+	               PROT_READ,
+	               MAP_SHARED,
+	               internal_file->descriptor,
+	               0 );
 
-#if !defined( POSIX_FADV_SEQUENTIAL )
-#define POSIX_FADV_SEQUENTIAL		2
+	/* Not every type of file supports memory mapping e.g. devices and pipes
+	 */
+	if( mapped_data == MAP_FAILED )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to memory map file with error: %d.\n",
+			 function,
+			 errno );
+		}
 #endif
+		return( 0 );
+	}
+	internal_file->mapped_data      = (uint8_t *) mapped_data;
+	internal_file->mapped_data_size = file_size;
 
-#endif /* #if defined( HAVE_POSIX_FADVISE ) */
+	return( 1 );
+}
 
-/* Sets the expected access behavior so the system can optimize the access
- * Returns 1 if successful or -1 on error
+/* Retrieves the memory mapped data of a specific range of the file
+ * The data remains valid until the file is closed
+ * Returns 1 if successful, 0 if the range is not memory mapped or -1 on error
  */
-int libcfile_file_set_access_behavior(
+int libcfile_file_get_memory_mapped_data(
      libcfile_file_t *file,
-     int access_behavior,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
      libcerror_error_t **error )
 {
 	libcfile_internal_file_t *internal_file = NULL;
-	static char *function                   = "libcfile_file_set_access_behavior";
-
-#if defined( HAVE_POSIX_FADVISE )
-	int advice                              = POSIX_FADV_NORMAL;
-#endif
+	static char *function                   = "libcfile_file_get_memory_mapped_data";
 
 	if( file == NULL )
 	{
@@ -4046,74 +5169,117 @@ int libcfile_file_set_access_behavior(
 	}
 	internal_file = (libcfile_internal_file_t *) file;
 
-#if defined( WINAPI ) && !defined( USE_CRT_FUNCTIONS )
-	if( internal_file->handle == INVALID_HANDLE_VALUE )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#else
-	if( internal_file->descriptor == -1 )
+	if( size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing descriptor.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( ( access_behavior != LIBCFILE_ACCESS_BEHAVIOR_NORMAL )
-	 && ( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_RANDOM )
-	 && ( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_SEQUENTIAL ) )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access behavior: %d.",
-		 function,
-		 access_behavior );
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_POSIX_FADVISE )
-	if( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_NORMAL )
+	if( internal_file->mapped_data == NULL )
 	{
-		advice = POSIX_FADV_NORMAL;
+		return( 0 );
 	}
-	else if( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_RANDOM )
+	if( ( (size64_t) offset > internal_file->mapped_data_size )
+	 || ( (size64_t) size > ( internal_file->mapped_data_size - offset ) ) )
 	{
-		advice = POSIX_FADV_RANDOM;
+		return( 0 );
 	}
-	else if( access_behavior == LIBCFILE_ACCESS_BEHAVIOR_SEQUENTIAL )
+	*data = &( internal_file->mapped_data[ offset ] );
+
+	return( 1 );
+}
+
+#else
+
+/* Maps the file into memory for reading
+ * Returns 1 if successful, 0 if the file could not be memory mapped or -1 on error
+ */
+int libcfile_file_memory_map(
+     libcfile_file_t *file,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_file_memory_map";
+
+	if( file == NULL )
 	{
-		advice = POSIX_FADV_SEQUENTIAL;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
 	}
-	if( posix_fadvise(
-	     internal_file->descriptor,
-	     0,
-	     0,
-	     advice ) != 0 )
+	return( 0 );
+}
+
+/* Retrieves the memory mapped data of a specific range of the file
+ * Returns 1 if successful, 0 if the range is not memory mapped or -1 on error
+ */
+int libcfile_file_get_memory_mapped_data(
+     libcfile_file_t *file,
+     off64_t offset LIBCFILE_ATTRIBUTE_UNUSED,
+     size_t size LIBCFILE_ATTRIBUTE_UNUSED,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "libcfile_file_get_memory_mapped_data";
+
+	LIBCFILE_UNREFERENCED_PARAMETER( offset )
+	LIBCFILE_UNREFERENCED_PARAMETER( size )
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_GENERIC,
-		 "%s: unable to advice file descriptor on access behavior.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( 1 );
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
 }
 
+#endif /* defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) */
+
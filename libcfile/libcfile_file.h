@@ -49,7 +49,37 @@ struct libcfile_internal_file
 	/* The (file) descriptor
 	 */
 	int descriptor;
+
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+	/* The memory mapped data
+	 */
+	uint8_t *mapped_data;
+
+	/* The size of the memory mapped data
+	 */
+	size64_t mapped_data_size;
+#endif
 #endif
+	/* Value to indicate the data read or written should be dropped
+	 * from the system page cache
+	 */
+	uint8_t drop_cached_data;
+
+	/* The offset of the data read or written since the cached data was last dropped
+	 */
+	off64_t cached_data_offset;
+
+	/* The number of bytes read or written since the cached data was last dropped
+	 */
+	size64_t cached_data_size;
+
+	/* The offset of the data of which the flush was started when the cached data was last dropped
+	 */
+	off64_t flushed_data_offset;
+
+	/* The number of bytes of which the flush was started when the cached data was last dropped
+	 */
+	size64_t flushed_data_size;
 };
 
 LIBCFILE_EXTERN \
@@ -126,6 +156,23 @@ ssize_t libcfile_file_read_buffer_with_error_code(
          uint32_t *error_code,
          libcerror_error_t **error );
 
+LIBCFILE_EXTERN \
+ssize_t libcfile_file_read_buffer_at_offset(
+         libcfile_file_t *file,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+ssize_t libcfile_file_read_buffers_at_offset(
+         libcfile_file_t *file,
+         uint8_t **buffers,
+         size_t *buffer_sizes,
+         int number_of_buffers,
+         off64_t offset,
+         libcerror_error_t **error );
+
 #if defined( WINAPI ) && ( WINVER <= 0x0500 ) && !defined( USE_CRT_FUNCTIONS )
 /* TODO implement */
 BOOL libcfile_WriteFile(
@@ -232,6 +279,44 @@ int libcfile_file_set_access_behavior(
      int access_behavior,
      libcerror_error_t **error );
 
+LIBCFILE_EXTERN \
+int libcfile_file_set_drop_cached_data(
+     libcfile_file_t *file,
+     uint8_t drop_cached_data,
+     libcerror_error_t **error );
+
+#if !defined( WINAPI ) || defined( USE_CRT_FUNCTIONS )
+
+int libcfile_internal_file_drop_cached_data(
+     libcfile_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libcfile_internal_file_add_cached_data(
+     libcfile_internal_file_t *internal_file,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error );
+
+int libcfile_internal_file_add_cached_data_at_current_offset(
+     libcfile_file_t *file,
+     size_t size,
+     libcerror_error_t **error );
+
+#endif
+
+LIBCFILE_EXTERN \
+int libcfile_file_memory_map(
+     libcfile_file_t *file,
+     libcerror_error_t **error );
+
+LIBCFILE_EXTERN \
+int libcfile_file_get_memory_mapped_data(
+     libcfile_file_t *file,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
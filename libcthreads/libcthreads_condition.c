@@ -0,0 +1,383 @@
+/*
+ * Condition functions
+ *
+ * Copyright (c) 2012-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "libcthreads_condition.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_mutex.h"
+#include "libcthreads_types.h"
+
+/* Creates a condition
+ * Make sure the value condition is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_condition_initialize(
+     libcthreads_condition_t **condition,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_condition_t *internal_condition = NULL;
+	static char *function                                = "libcthreads_condition_initialize";
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	int pthread_result                                   = 0;
+#endif
+
+	if( condition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid condition.",
+		 function );
+
+		return( -1 );
+	}
+	if( *condition != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid condition value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_condition = memory_allocate_structure(
+	                      libcthreads_internal_condition_t );
+
+	if( internal_condition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_condition,
+	     0,
+	     sizeof( libcthreads_internal_condition_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear condition.",
+		 function );
+
+		memory_free(
+		 internal_condition );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	InitializeConditionVariable(
+	 &( internal_condition->condition_variable ) );
+
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	pthread_result = pthread_cond_init(
+	                  &( internal_condition->condition ),
+	                  NULL );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 (uint32_t) pthread_result,
+		 "%s: unable to initialize condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*condition = (libcthreads_condition_t *) internal_condition;
+
+	return( 1 );
+
+on_error:
+	if( internal_condition != NULL )
+	{
+		memory_free(
+		 internal_condition );
+	}
+	return( -1 );
+}
+
+/* Frees a condition
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_condition_free(
+     libcthreads_condition_t **condition,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_condition_t *internal_condition = NULL;
+	static char *function                                = "libcthreads_condition_free";
+	int result                                           = 1;
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	int pthread_result                                   = 0;
+#endif
+
+	if( condition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid condition.",
+		 function );
+
+		return( -1 );
+	}
+	if( *condition != NULL )
+	{
+		internal_condition = (libcthreads_internal_condition_t *) *condition;
+		*condition         = NULL;
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+		pthread_result = pthread_cond_destroy(
+		                  &( internal_condition->condition ) );
+
+		if( pthread_result != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 (uint32_t) pthread_result,
+			 "%s: unable to destroy condition.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_condition );
+	}
+	return( result );
+}
+
+/* Broadcasts a condition
+ * This is used to signal that a condition has changed
+ * to all threads waiting on the condition
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_condition_broadcast(
+     libcthreads_condition_t *condition,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_condition_t *internal_condition = NULL;
+	static char *function                                = "libcthreads_condition_broadcast";
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	int pthread_result                                   = 0;
+#endif
+
+	if( condition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid condition.",
+		 function );
+
+		return( -1 );
+	}
+	internal_condition = (libcthreads_internal_condition_t *) condition;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	WakeAllConditionVariable(
+	 &( internal_condition->condition_variable ) );
+
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	pthread_result = pthread_cond_broadcast(
+	                  &( internal_condition->condition ) );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 (uint32_t) pthread_result,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Signals a condition
+ * This is used to signal that a condition has changed
+ * to a single thread waiting on the condition
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_condition_signal(
+     libcthreads_condition_t *condition,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_condition_t *internal_condition = NULL;
+	static char *function                                = "libcthreads_condition_signal";
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	int pthread_result                                   = 0;
+#endif
+
+	if( condition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid condition.",
+		 function );
+
+		return( -1 );
+	}
+	internal_condition = (libcthreads_internal_condition_t *) condition;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	WakeConditionVariable(
+	 &( internal_condition->condition_variable ) );
+
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	pthread_result = pthread_cond_signal(
+	                  &( internal_condition->condition ) );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 (uint32_t) pthread_result,
+		 "%s: unable to signal condition.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Waits for a condition
+ * The mutex must be grabbed before calling this function
+ * and is grabbed again when the function returns
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_condition_wait(
+     libcthreads_condition_t *condition,
+     libcthreads_mutex_t *mutex,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_condition_t *internal_condition = NULL;
+	libcthreads_internal_mutex_t *internal_mutex         = NULL;
+	static char *function                                = "libcthreads_condition_wait";
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	DWORD error_code                                     = 0;
+
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	int pthread_result                                   = 0;
+#endif
+
+	if( condition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid condition.",
+		 function );
+
+		return( -1 );
+	}
+	internal_condition = (libcthreads_internal_condition_t *) condition;
+
+	if( mutex == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mutex.",
+		 function );
+
+		return( -1 );
+	}
+	internal_mutex = (libcthreads_internal_mutex_t *) mutex;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	if( SleepConditionVariableCS(
+	     &( internal_condition->condition_variable ),
+	     &( internal_mutex->critical_section ),
+	     INFINITE ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 error_code,
+		 "%s: unable to wait for condition.",
+		 function );
+
+		return( -1 );
+	}
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	pthread_result = pthread_cond_wait(
+	                  &( internal_condition->condition ),
+	                  &( internal_mutex->mutex ) );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 (uint32_t) pthread_result,
+		 "%s: unable to wait for condition.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
@@ -0,0 +1,396 @@
+/*
+ * Read/Write lock functions
+ *
+ * Copyright (c) 2012-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "libcthreads_libcerror.h"
+#include "libcthreads_read_write_lock.h"
+#include "libcthreads_types.h"
+
+/* Creates a read/write lock
+ * Make sure the value read_write_lock is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_read_write_lock_initialize(
+     libcthreads_read_write_lock_t **read_write_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_read_write_lock_t *internal_read_write_lock = NULL;
+	static char *function                                            = "libcthreads_read_write_lock_initialize";
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	int pthread_result                                               = 0;
+#endif
+
+	if( read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_write_lock != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read/write lock value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_write_lock = memory_allocate_structure(
+	                            libcthreads_internal_read_write_lock_t );
+
+	if( internal_read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_read_write_lock,
+	     0,
+	     sizeof( libcthreads_internal_read_write_lock_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read/write lock.",
+		 function );
+
+		memory_free(
+		 internal_read_write_lock );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	InitializeSRWLock(
+	 &( internal_read_write_lock->slim_read_write_lock ) );
+
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	pthread_result = pthread_rwlock_init(
+	                  &( internal_read_write_lock->read_write_lock ),
+	                  NULL );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 (uint32_t) pthread_result,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*read_write_lock = (libcthreads_read_write_lock_t *) internal_read_write_lock;
+
+	return( 1 );
+
+on_error:
+	if( internal_read_write_lock != NULL )
+	{
+		memory_free(
+		 internal_read_write_lock );
+	}
+	return( -1 );
+}
+
+/* Frees a read/write lock
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_read_write_lock_free(
+     libcthreads_read_write_lock_t **read_write_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_read_write_lock_t *internal_read_write_lock = NULL;
+	static char *function                                            = "libcthreads_read_write_lock_free";
+	int result                                                       = 1;
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	int pthread_result                                               = 0;
+#endif
+
+	if( read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_write_lock != NULL )
+	{
+		internal_read_write_lock = (libcthreads_internal_read_write_lock_t *) *read_write_lock;
+		*read_write_lock         = NULL;
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+		pthread_result = pthread_rwlock_destroy(
+		                  &( internal_read_write_lock->read_write_lock ) );
+
+		if( pthread_result != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 (uint32_t) pthread_result,
+			 "%s: unable to destroy read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_read_write_lock );
+	}
+	return( result );
+}
+
+/* Grabs a read/write lock for reading
+ * Multiple readers can hold the lock at the same time
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_read_write_lock_grab_for_read(
+     libcthreads_read_write_lock_t *read_write_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_read_write_lock_t *internal_read_write_lock = NULL;
+	static char *function                                            = "libcthreads_read_write_lock_grab_for_read";
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	int pthread_result                                               = 0;
+#endif
+
+	if( read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_write_lock = (libcthreads_internal_read_write_lock_t *) read_write_lock;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	AcquireSRWLockShared(
+	 &( internal_read_write_lock->slim_read_write_lock ) );
+
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	pthread_result = pthread_rwlock_rdlock(
+	                  &( internal_read_write_lock->read_write_lock ) );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 (uint32_t) pthread_result,
+		 "%s: unable to lock read/write lock for read.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Grabs a read/write lock for writing
+ * Only a single writer can hold the lock and no readers
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_read_write_lock_grab_for_write(
+     libcthreads_read_write_lock_t *read_write_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_read_write_lock_t *internal_read_write_lock = NULL;
+	static char *function                                            = "libcthreads_read_write_lock_grab_for_write";
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	int pthread_result                                               = 0;
+#endif
+
+	if( read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_write_lock = (libcthreads_internal_read_write_lock_t *) read_write_lock;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	AcquireSRWLockExclusive(
+	 &( internal_read_write_lock->slim_read_write_lock ) );
+
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	pthread_result = pthread_rwlock_wrlock(
+	                  &( internal_read_write_lock->read_write_lock ) );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 (uint32_t) pthread_result,
+		 "%s: unable to lock read/write lock for write.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Releases a read/write lock for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_read_write_lock_release_for_read(
+     libcthreads_read_write_lock_t *read_write_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_read_write_lock_t *internal_read_write_lock = NULL;
+	static char *function                                            = "libcthreads_read_write_lock_release_for_read";
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	int pthread_result                                               = 0;
+#endif
+
+	if( read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_write_lock = (libcthreads_internal_read_write_lock_t *) read_write_lock;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	ReleaseSRWLockShared(
+	 &( internal_read_write_lock->slim_read_write_lock ) );
+
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	pthread_result = pthread_rwlock_unlock(
+	                  &( internal_read_write_lock->read_write_lock ) );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 (uint32_t) pthread_result,
+		 "%s: unable to unlock read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Releases a read/write lock for writing
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_read_write_lock_release_for_write(
+     libcthreads_read_write_lock_t *read_write_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_read_write_lock_t *internal_read_write_lock = NULL;
+	static char *function                                            = "libcthreads_read_write_lock_release_for_write";
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	int pthread_result                                               = 0;
+#endif
+
+	if( read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_write_lock = (libcthreads_internal_read_write_lock_t *) read_write_lock;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	ReleaseSRWLockExclusive(
+	 &( internal_read_write_lock->slim_read_write_lock ) );
+
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	pthread_result = pthread_rwlock_unlock(
+	                  &( internal_read_write_lock->read_write_lock ) );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 (uint32_t) pthread_result,
+		 "%s: unable to unlock read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
@@ -0,0 +1,353 @@
+/*
+ * Thread functions
+ *
+ * Copyright (c) 2012-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "libcthreads_libcerror.h"
+#include "libcthreads_thread.h"
+#include "libcthreads_types.h"
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+
+/* Start function helper function for WINAPI
+ * Returns 0 if successful or 1 on error
+ */
+DWORD WINAPI libcthreads_thread_start_function_helper(
+              LPVOID arguments )
+{
+	libcthreads_internal_thread_t *internal_thread = NULL;
+
+	if( arguments == NULL )
+	{
+		return( 1 );
+	}
+	internal_thread = (libcthreads_internal_thread_t *) arguments;
+
+	internal_thread->callback_function_result = internal_thread->callback_function(
+	                                             internal_thread->callback_function_arguments );
+
+	if( internal_thread->callback_function_result != 1 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+
+/* Start function helper function for pthread
+ * Returns a pointer to the internal thread
+ */
+void *libcthreads_thread_start_function_helper(
+       void *arguments )
+{
+	libcthreads_internal_thread_t *internal_thread = NULL;
+
+	if( arguments != NULL )
+	{
+		internal_thread = (libcthreads_internal_thread_t *) arguments;
+
+		internal_thread->callback_function_result = internal_thread->callback_function(
+		                                             internal_thread->callback_function_arguments );
+	}
+	return( arguments );
+}
+
+#endif
+
+/* Creates a thread
+ * Make sure the value thread is referencing, is set to NULL
+ * The callback function is called from the new thread with the callback function arguments
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_thread_create(
+     libcthreads_thread_t **thread,
+     int (*callback_function)(
+            void *arguments ),
+     void *callback_function_arguments,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_thread_t *internal_thread = NULL;
+	static char *function                          = "libcthreads_thread_create";
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	DWORD error_code                               = 0;
+
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	int pthread_result                             = 0;
+#endif
+
+	if( thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread.",
+		 function );
+
+		return( -1 );
+	}
+	if( *thread != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid thread value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread = memory_allocate_structure(
+	                   libcthreads_internal_thread_t );
+
+	if( internal_thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create thread.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_thread,
+	     0,
+	     sizeof( libcthreads_internal_thread_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear thread.",
+		 function );
+
+		memory_free(
+		 internal_thread );
+
+		return( -1 );
+	}
+	internal_thread->callback_function           = callback_function;
+	internal_thread->callback_function_arguments = callback_function_arguments;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	internal_thread->thread_handle = CreateThread(
+	                                  NULL,
+	                                  0,
+	                                  &libcthreads_thread_start_function_helper,
+	                                  (LPVOID) internal_thread,
+	                                  0,
+	                                  &( internal_thread->thread_identifier ) );
+
+	if( internal_thread->thread_handle == NULL )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 error_code,
+		 "%s: unable to create thread handle.",
+		 function );
+
+		goto on_error;
+	}
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	pthread_result = pthread_create(
+	                  &( internal_thread->thread ),
+	                  NULL,
+	                  &libcthreads_thread_start_function_helper,
+	                  (void *) internal_thread );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 (uint32_t) pthread_result,
+		 "%s: unable to create thread.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*thread = (libcthreads_thread_t *) internal_thread;
+
+	return( 1 );
+
+on_error:
+	if( internal_thread != NULL )
+	{
+		memory_free(
+		 internal_thread );
+	}
+	return( -1 );
+}
+
+/* Joins the current with a specified thread
+ * The the thread is freed after join
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_thread_join(
+     libcthreads_thread_t **thread,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_thread_t *internal_thread = NULL;
+	static char *function                          = "libcthreads_thread_join";
+	int result                                     = 1;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	DWORD error_code                               = 0;
+	DWORD wait_status                              = 0;
+
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	void *thread_return_value                      = NULL;
+	int pthread_result                             = 0;
+#endif
+
+	if( thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread.",
+		 function );
+
+		return( -1 );
+	}
+	if( *thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread = (libcthreads_internal_thread_t *) *thread;
+	*thread         = NULL;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	wait_status = WaitForSingleObject(
+	               internal_thread->thread_handle,
+	               INFINITE );
+
+	if( wait_status == WAIT_FAILED )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 error_code,
+		 "%s: wait for thread failed.",
+		 function );
+
+		result = -1;
+	}
+	if( CloseHandle(
+	     internal_thread->thread_handle ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 error_code,
+		 "%s: unable to close thread handle.",
+		 function );
+
+		result = -1;
+	}
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	pthread_result = pthread_join(
+	                  internal_thread->thread,
+	                  &thread_return_value );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 (uint32_t) pthread_result,
+		 "%s: unable to join thread.",
+		 function );
+
+		result = -1;
+	}
+	else if( thread_return_value != (void *) internal_thread )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: invalid thread return value.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( ( result == 1 )
+	 && ( internal_thread->callback_function_result != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: thread callback function failed.",
+		 function );
+
+		result = -1;
+	}
+	memory_free(
+	 internal_thread );
+
+	return( result );
+}
+
@@ -0,0 +1,101 @@
+/*
+ * Thread functions
+ *
+ * Copyright (c) 2012-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_THREAD_H )
+#define _LIBCTHREADS_INTERNAL_THREAD_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "libcthreads_extern.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcthreads_internal_thread libcthreads_internal_thread_t;
+
+struct libcthreads_internal_thread
+{
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	/* The thread handle
+	 */
+	HANDLE thread_handle;
+
+	/* The thread identifier
+	 */
+	DWORD thread_identifier;
+
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	/* The thread
+	 */
+	pthread_t thread;
+#endif
+
+	/* The callback function
+	 */
+	int (*callback_function)(
+	       void *arguments );
+
+	/* The callback function arguments
+	 */
+	void *callback_function_arguments;
+
+	/* The callback function return value
+	 */
+	int callback_function_result;
+};
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+DWORD WINAPI libcthreads_thread_start_function_helper(
+              LPVOID arguments );
+
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+void *libcthreads_thread_start_function_helper(
+       void *arguments );
+
+#endif
+
+LIBCTHREADS_EXTERN \
+int libcthreads_thread_create(
+     libcthreads_thread_t **thread,
+     int (*callback_function)(
+            void *arguments ),
+     void *callback_function_arguments,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_thread_join(
+     libcthreads_thread_t **thread,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -0,0 +1,495 @@
+/*
+ * Thread pool functions
+ *
+ * Copyright (c) 2012-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcthreads_libcerror.h"
+#include "libcthreads_mutex.h"
+#include "libcthreads_queue.h"
+#include "libcthreads_thread.h"
+#include "libcthreads_thread_pool.h"
+#include "libcthreads_types.h"
+
+/* The thread pool worker function
+ * Pops values off the values queue and passes them to the callback function
+ * until a NULL value is popped
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_thread_pool_callback_function_helper(
+     void *arguments )
+{
+	libcthreads_internal_thread_pool_t *internal_thread_pool = NULL;
+	intptr_t *value                                          = NULL;
+	int result                                               = 1;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	internal_thread_pool = (libcthreads_internal_thread_pool_t *) arguments;
+
+	do
+	{
+		value = NULL;
+
+		if( libcthreads_queue_pop(
+		     internal_thread_pool->values_queue,
+		     &value,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		if( value == NULL )
+		{
+			break;
+		}
+		/* Keep popping values after a failure so that the producer does not block
+		 */
+		if( internal_thread_pool->callback_function(
+		     value,
+		     internal_thread_pool->callback_function_arguments ) != 1 )
+		{
+			if( libcthreads_mutex_grab(
+			     internal_thread_pool->result_mutex,
+			     NULL ) == 1 )
+			{
+				internal_thread_pool->number_of_failures++;
+
+				libcthreads_mutex_release(
+				 internal_thread_pool->result_mutex,
+				 NULL );
+			}
+			result = -1;
+		}
+	}
+	while( value != NULL );
+
+	return( result );
+}
+
+/* Creates and starts a thread pool
+ * Make sure the value thread_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_thread_pool_create(
+     libcthreads_thread_pool_t **thread_pool,
+     int number_of_threads,
+     int maximum_number_of_values,
+     int (*callback_function)(
+            intptr_t *value,
+            void *arguments ),
+     void *callback_function_arguments,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_thread_pool_t *internal_thread_pool = NULL;
+	static char *function                                    = "libcthreads_thread_pool_create";
+	int thread_index                                         = 0;
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *thread_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid thread pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_threads > (size_t) ( SSIZE_MAX / sizeof( libcthreads_thread_t * ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of threads value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread_pool = memory_allocate_structure(
+	                        libcthreads_internal_thread_pool_t );
+
+	if( internal_thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_thread_pool,
+	     0,
+	     sizeof( libcthreads_internal_thread_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear thread pool.",
+		 function );
+
+		memory_free(
+		 internal_thread_pool );
+
+		return( -1 );
+	}
+	internal_thread_pool->threads_array = (libcthreads_thread_t **) memory_allocate(
+	                                                                 sizeof( libcthreads_thread_t * ) * number_of_threads );
+
+	if( internal_thread_pool->threads_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create threads array.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_thread_pool->threads_array,
+	     0,
+	     sizeof( libcthreads_thread_t * ) * number_of_threads ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear threads array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_initialize(
+	     &( internal_thread_pool->values_queue ),
+	     maximum_number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create values queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_thread_pool->result_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create result mutex.",
+		 function );
+
+		goto on_error;
+	}
+	internal_thread_pool->callback_function           = callback_function;
+	internal_thread_pool->callback_function_arguments = callback_function_arguments;
+
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( internal_thread_pool->threads_array[ thread_index ] ),
+		     &libcthreads_thread_pool_callback_function_helper,
+		     (void *) internal_thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+		internal_thread_pool->number_of_threads++;
+	}
+	*thread_pool = (libcthreads_thread_pool_t *) internal_thread_pool;
+
+	return( 1 );
+
+on_error:
+	if( internal_thread_pool != NULL )
+	{
+		/* Stop the threads that were already started
+		 */
+		for( thread_index = 0;
+		     thread_index < internal_thread_pool->number_of_threads;
+		     thread_index++ )
+		{
+			libcthreads_queue_push(
+			 internal_thread_pool->values_queue,
+			 NULL,
+			 NULL );
+		}
+		for( thread_index = 0;
+		     thread_index < internal_thread_pool->number_of_threads;
+		     thread_index++ )
+		{
+			libcthreads_thread_join(
+			 &( internal_thread_pool->threads_array[ thread_index ] ),
+			 NULL );
+		}
+		if( internal_thread_pool->result_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_thread_pool->result_mutex ),
+			 NULL );
+		}
+		if( internal_thread_pool->values_queue != NULL )
+		{
+			libcthreads_queue_free(
+			 &( internal_thread_pool->values_queue ),
+			 NULL,
+			 NULL );
+		}
+		if( internal_thread_pool->threads_array != NULL )
+		{
+			memory_free(
+			 internal_thread_pool->threads_array );
+		}
+		memory_free(
+		 internal_thread_pool );
+	}
+	return( -1 );
+}
+
+/* Pushes a value onto the thread pool
+ * Blocks until there is room in the values queue
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_thread_pool_push(
+     libcthreads_thread_pool_t *thread_pool,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_thread_pool_t *internal_thread_pool = NULL;
+	static char *function                                    = "libcthreads_thread_pool_push";
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread_pool = (libcthreads_internal_thread_pool_t *) thread_pool;
+
+	/* A NULL value is used internally to signal the threads to stop
+	 */
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_queue_push(
+	     internal_thread_pool->values_queue,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push value onto queue.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Waits for the threads in the thread pool to process the remaining values and
+ * joins them. Frees the thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_thread_pool_join(
+     libcthreads_thread_pool_t **thread_pool,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_thread_pool_t *internal_thread_pool = NULL;
+	static char *function                                    = "libcthreads_thread_pool_join";
+	int result                                               = 1;
+	int thread_index                                         = 0;
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *thread_pool == NULL )
+	{
+		return( 1 );
+	}
+	internal_thread_pool = (libcthreads_internal_thread_pool_t *) *thread_pool;
+	*thread_pool         = NULL;
+
+	for( thread_index = 0;
+	     thread_index < internal_thread_pool->number_of_threads;
+	     thread_index++ )
+	{
+		if( libcthreads_queue_push(
+		     internal_thread_pool->values_queue,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push stop value onto queue.",
+			 function );
+
+			result = -1;
+		}
+	}
+	for( thread_index = 0;
+	     thread_index < internal_thread_pool->number_of_threads;
+	     thread_index++ )
+	{
+		if( libcthreads_thread_join(
+		     &( internal_thread_pool->threads_array[ thread_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread: %d.",
+			 function,
+			 thread_index );
+
+			result = -1;
+		}
+	}
+	if( internal_thread_pool->number_of_failures > 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: %d callback function calls failed.",
+		 function,
+		 internal_thread_pool->number_of_failures );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_free(
+	     &( internal_thread_pool->result_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free result mutex.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_queue_free(
+	     &( internal_thread_pool->values_queue ),
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free values queue.",
+		 function );
+
+		result = -1;
+	}
+	memory_free(
+	 internal_thread_pool->threads_array );
+
+	memory_free(
+	 internal_thread_pool );
+
+	return( result );
+}
+
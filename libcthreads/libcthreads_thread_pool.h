@@ -0,0 +1,104 @@
+/*
+ * Thread pool functions
+ *
+ * Copyright (c) 2012-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_THREAD_POOL_H )
+#define _LIBCTHREADS_INTERNAL_THREAD_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcthreads_extern.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_mutex.h"
+#include "libcthreads_queue.h"
+#include "libcthreads_thread.h"
+#include "libcthreads_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcthreads_internal_thread_pool libcthreads_internal_thread_pool_t;
+
+struct libcthreads_internal_thread_pool
+{
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The threads array
+	 */
+	libcthreads_thread_t **threads_array;
+
+	/* The values queue
+	 */
+	libcthreads_queue_t *values_queue;
+
+	/* The callback function
+	 */
+	int (*callback_function)(
+	       intptr_t *value,
+	       void *arguments );
+
+	/* The callback function arguments
+	 */
+	void *callback_function_arguments;
+
+	/* The result mutex
+	 */
+	libcthreads_mutex_t *result_mutex;
+
+	/* The number of failed callback function calls
+	 */
+	int number_of_failures;
+};
+
+int libcthreads_thread_pool_callback_function_helper(
+     void *arguments );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_thread_pool_create(
+     libcthreads_thread_pool_t **thread_pool,
+     int number_of_threads,
+     int maximum_number_of_values,
+     int (*callback_function)(
+            intptr_t *value,
+            void *arguments ),
+     void *callback_function_arguments,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_thread_pool_push(
+     libcthreads_thread_pool_t *thread_pool,
+     intptr_t *value,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_thread_pool_join(
+     libcthreads_thread_pool_t **thread_pool,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
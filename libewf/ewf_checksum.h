@@ -25,17 +25,26 @@
 #include <common.h>
 #include <types.h>
 
-#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+#if defined( HAVE_ADLER32 ) && ( defined( HAVE_ZLIB ) || defined( ZLIB_DLL ) )
 #include <zlib.h>
+#else
+#include "libewf_checksum.h"
 #endif
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+#if defined( HAVE_ADLER32 ) && ( defined( HAVE_ZLIB ) || defined( ZLIB_DLL ) )
 #define ewf_checksum_calculate( buffer, size, previous_key ) \
 	(uint32_t) adler32( (uLong) previous_key, (const Bytef *) buffer, (uInt) size );
 
+#else
+#define ewf_checksum_calculate( buffer, size, previous_key ) \
+	libewf_checksum_calculate_adler32( (const uint8_t *) buffer, (size_t) size, (uint32_t) previous_key );
+
+#endif
+
 #if defined( __cplusplus )
 }
 #endif
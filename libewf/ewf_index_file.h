@@ -0,0 +1,157 @@
+/*
+ * EWF index file
+ *
+ * Copyright (c) 2006-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EWF_INDEX_FILE_H )
+#define _EWF_INDEX_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The index file is not part of the EWF format, it is created by libewf
+ * to cache the layout of the segment files
+ */
+typedef struct ewf_index_file_header ewf_index_file_header_t;
+
+struct ewf_index_file_header
+{
+	/* The signature
+	 * consists of 8 bytes containing
+	 * "EWFINDEX"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * consists of 4 bytes (32 bits)
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The number of segment files
+	 * consists of 4 bytes (32 bits)
+	 */
+	uint8_t number_of_segment_files[ 4 ];
+
+	/* The size of the data following the header
+	 * consists of 8 bytes (64 bits)
+	 */
+	uint8_t data_size[ 8 ];
+
+	/* The Adler-32 checksum of the data following the header
+	 * consists of 4 bytes (32 bits)
+	 */
+	uint8_t data_checksum[ 4 ];
+
+	/* The Adler-32 checksum of the previous header values
+	 * consists of 4 bytes (32 bits)
+	 */
+	uint8_t checksum[ 4 ];
+};
+
+typedef struct ewf_index_file_segment ewf_index_file_segment_t;
+
+struct ewf_index_file_segment
+{
+	/* The size of the segment file
+	 * consists of 8 bytes (64 bits)
+	 */
+	uint8_t file_size[ 8 ];
+
+	/* The modification time of the segment file
+	 * consists of 8 bytes (64 bits)
+	 * contains a POSIX timestamp or 0 if not available
+	 */
+	uint8_t modification_time[ 8 ];
+
+	/* The offset of the last section
+	 * consists of 8 bytes (64 bits)
+	 */
+	uint8_t last_section_offset[ 8 ];
+
+	/* The number of sections
+	 * consists of 4 bytes (32 bits)
+	 */
+	uint8_t number_of_sections[ 4 ];
+
+	/* The number of chunks
+	 * consists of 4 bytes (32 bits)
+	 */
+	uint8_t number_of_chunks[ 4 ];
+
+	/* The segment number
+	 * consists of 2 bytes (16 bits)
+	 */
+	uint8_t segment_number[ 2 ];
+
+	/* The segment file type
+	 * consists of 1 byte
+	 */
+	uint8_t type;
+
+	/* Padding
+	 * consists of 5 bytes
+	 */
+	uint8_t padding[ 5 ];
+};
+
+typedef struct ewf_index_file_section ewf_index_file_section_t;
+
+struct ewf_index_file_section
+{
+	/* The section type string
+	 * consists of 16 bytes
+	 */
+	uint8_t type[ 16 ];
+
+	/* The start offset of the section
+	 * consists of 8 bytes (64 bits)
+	 */
+	uint8_t start_offset[ 8 ];
+
+	/* The end offset of the section
+	 * consists of 8 bytes (64 bits)
+	 */
+	uint8_t end_offset[ 8 ];
+
+	/* The size of the section
+	 * consists of 8 bytes (64 bits)
+	 */
+	uint8_t size[ 8 ];
+
+	/* The number of offsets of a table or table2 section
+	 * consists of 4 bytes (32 bits)
+	 */
+	uint8_t number_of_offsets[ 4 ];
+
+	/* Padding
+	 * consists of 4 bytes
+	 */
+	uint8_t padding[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -0,0 +1,480 @@
+/*
+ * Adler-32 checksum functions
+ *
+ * Copyright (c) 2006-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_checksum.h"
+
+#if defined( LIBEWF_CHECKSUM_HAVE_SSE2 )
+#include <emmintrin.h>
+#endif
+
+#if defined( LIBEWF_CHECKSUM_HAVE_AVX2 )
+#include <immintrin.h>
+#endif
+
+#if defined( LIBEWF_CHECKSUM_HAVE_NEON )
+#include <arm_neon.h>
+#endif
+
+/* The largest prime smaller than 65536
+ */
+#define LIBEWF_CHECKSUM_ADLER32_BASE		65521
+
+/* The largest number of bytes n for which 255 * n * ( n + 1 ) / 2 + ( n + 1 ) * ( BASE - 1 )
+ * fits in 32-bit, hence the number of bytes that can be processed before the sums
+ * need to be reduced modulo BASE
+ */
+#define LIBEWF_CHECKSUM_ADLER32_NMAX		5552
+
+/* The number of bytes processed per vector iteration
+ */
+#define LIBEWF_CHECKSUM_ADLER32_BLOCK_SIZE	32
+
+/* Calculates the Adler-32 of a buffer
+ * Uses the fastest implementation supported by the CPU
+ * Returns the Adler-32 value
+ */
+uint32_t libewf_checksum_calculate_adler32(
+          const uint8_t *buffer,
+          size_t size,
+          uint32_t initial_value )
+{
+	if( size < LIBEWF_CHECKSUM_ADLER32_BLOCK_SIZE )
+	{
+		return( libewf_checksum_calculate_adler32_generic(
+		         buffer,
+		         size,
+		         initial_value ) );
+	}
+#if defined( LIBEWF_CHECKSUM_HAVE_AVX2 )
+	if( libewf_checksum_cpu_supports_avx2() != 0 )
+	{
+		return( libewf_checksum_calculate_adler32_avx2(
+		         buffer,
+		         size,
+		         initial_value ) );
+	}
+#endif
+#if defined( LIBEWF_CHECKSUM_HAVE_SSE2 )
+	return( libewf_checksum_calculate_adler32_sse2(
+	         buffer,
+	         size,
+	         initial_value ) );
+
+#elif defined( LIBEWF_CHECKSUM_HAVE_NEON )
+	return( libewf_checksum_calculate_adler32_neon(
+	         buffer,
+	         size,
+	         initial_value ) );
+
+#else
+	return( libewf_checksum_calculate_adler32_generic(
+	         buffer,
+	         size,
+	         initial_value ) );
+#endif
+}
+
+/* Calculates the Adler-32 of a buffer one byte at a time
+ * Returns the Adler-32 value
+ */
+uint32_t libewf_checksum_calculate_adler32_generic(
+          const uint8_t *buffer,
+          size_t size,
+          uint32_t initial_value )
+{
+	size_t block_size = 0;
+	uint32_t lower    = 0;
+	uint32_t upper    = 0;
+
+	if( buffer == NULL )
+	{
+		return( 1 );
+	}
+	lower = initial_value & 0x0000ffffUL;
+	upper = ( initial_value >> 16 ) & 0x0000ffffUL;
+
+	while( size > 0 )
+	{
+		block_size = size;
+
+		if( block_size > LIBEWF_CHECKSUM_ADLER32_NMAX )
+		{
+			block_size = LIBEWF_CHECKSUM_ADLER32_NMAX;
+		}
+		size -= block_size;
+
+		while( block_size >= 8 )
+		{
+			lower += buffer[ 0 ];
+			upper += lower;
+			lower += buffer[ 1 ];
+			upper += lower;
+			lower += buffer[ 2 ];
+			upper += lower;
+			lower += buffer[ 3 ];
+			upper += lower;
+			lower += buffer[ 4 ];
+			upper += lower;
+			lower += buffer[ 5 ];
+			upper += lower;
+			lower += buffer[ 6 ];
+			upper += lower;
+			lower += buffer[ 7 ];
+			upper += lower;
+
+			buffer     += 8;
+			block_size -= 8;
+		}
+		while( block_size > 0 )
+		{
+			lower += *buffer;
+			upper += lower;
+
+			buffer     += 1;
+			block_size -= 1;
+		}
+		lower %= LIBEWF_CHECKSUM_ADLER32_BASE;
+		upper %= LIBEWF_CHECKSUM_ADLER32_BASE;
+	}
+	return( ( upper << 16 ) | lower );
+}
+
+#if defined( LIBEWF_CHECKSUM_HAVE_SSE2 )
+
+/* Calculates the Adler-32 of a buffer using SSE2
+ * Per 32-byte block the lower sum is the sum of the bytes and the upper sum
+ * is the sum of the bytes multiplied by their distance to the end of the block
+ * plus 32 times the lower sum of the preceding blocks
+ * Returns the Adler-32 value
+ */
+uint32_t libewf_checksum_calculate_adler32_sse2(
+          const uint8_t *buffer,
+          size_t size,
+          uint32_t initial_value )
+{
+	__m128i bytes1            = { 0 };
+	__m128i bytes2            = { 0 };
+	__m128i sum               = { 0 };
+	__m128i vector_lower      = { 0 };
+	__m128i vector_previous   = { 0 };
+	__m128i vector_upper      = { 0 };
+	__m128i weights1_low      = { 0 };
+	__m128i weights1_high     = { 0 };
+	__m128i weights2_low      = { 0 };
+	__m128i weights2_high     = { 0 };
+	__m128i zero              = { 0 };
+	size_t number_of_blocks   = 0;
+	size_t run_size           = 0;
+	uint32_t lower            = 0;
+	uint32_t upper            = 0;
+
+	if( buffer == NULL )
+	{
+		return( 1 );
+	}
+	lower = initial_value & 0x0000ffffUL;
+	upper = ( initial_value >> 16 ) & 0x0000ffffUL;
+
+	weights1_low  = _mm_set_epi16( 25, 26, 27, 28, 29, 30, 31, 32 );
+	weights1_high = _mm_set_epi16( 17, 18, 19, 20, 21, 22, 23, 24 );
+	weights2_low  = _mm_set_epi16( 9, 10, 11, 12, 13, 14, 15, 16 );
+	weights2_high = _mm_set_epi16( 1, 2, 3, 4, 5, 6, 7, 8 );
+	zero          = _mm_setzero_si128();
+
+	number_of_blocks = size / LIBEWF_CHECKSUM_ADLER32_BLOCK_SIZE;
+	size            %= LIBEWF_CHECKSUM_ADLER32_BLOCK_SIZE;
+
+	while( number_of_blocks > 0 )
+	{
+		run_size = number_of_blocks;
+
+		if( run_size > ( LIBEWF_CHECKSUM_ADLER32_NMAX / LIBEWF_CHECKSUM_ADLER32_BLOCK_SIZE ) )
+		{
+			run_size = LIBEWF_CHECKSUM_ADLER32_NMAX / LIBEWF_CHECKSUM_ADLER32_BLOCK_SIZE;
+		}
+		number_of_blocks -= run_size;
+
+		vector_previous = _mm_set_epi32( 0, 0, 0, (int) ( lower * run_size ) );
+		vector_upper    = _mm_set_epi32( 0, 0, 0, (int) upper );
+		vector_lower    = _mm_setzero_si128();
+
+		while( run_size > 0 )
+		{
+			bytes1 = _mm_loadu_si128( (const __m128i *) buffer );
+			bytes2 = _mm_loadu_si128( (const __m128i *) &( buffer[ 16 ] ) );
+
+			vector_previous = _mm_add_epi32( vector_previous, vector_lower );
+
+			vector_lower = _mm_add_epi32( vector_lower, _mm_sad_epu8( bytes1, zero ) );
+			vector_lower = _mm_add_epi32( vector_lower, _mm_sad_epu8( bytes2, zero ) );
+
+			vector_upper = _mm_add_epi32( vector_upper, _mm_madd_epi16( _mm_unpacklo_epi8( bytes1, zero ), weights1_low ) );
+			vector_upper = _mm_add_epi32( vector_upper, _mm_madd_epi16( _mm_unpackhi_epi8( bytes1, zero ), weights1_high ) );
+			vector_upper = _mm_add_epi32( vector_upper, _mm_madd_epi16( _mm_unpacklo_epi8( bytes2, zero ), weights2_low ) );
+			vector_upper = _mm_add_epi32( vector_upper, _mm_madd_epi16( _mm_unpackhi_epi8( bytes2, zero ), weights2_high ) );
+
+			buffer   += LIBEWF_CHECKSUM_ADLER32_BLOCK_SIZE;
+			run_size -= 1;
+		}
+		vector_upper = _mm_add_epi32( vector_upper, _mm_slli_epi32( vector_previous, 5 ) );
+
+		/* The 32-bit sums can wrap since the total of the upper sum fits in 32-bit
+		 */
+		sum    = _mm_add_epi32( vector_lower, _mm_shuffle_epi32( vector_lower, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+		sum    = _mm_add_epi32( sum, _mm_shuffle_epi32( sum, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+		lower += (uint32_t) _mm_cvtsi128_si32( sum );
+
+		sum   = _mm_add_epi32( vector_upper, _mm_shuffle_epi32( vector_upper, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+		sum   = _mm_add_epi32( sum, _mm_shuffle_epi32( sum, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+		upper = (uint32_t) _mm_cvtsi128_si32( sum );
+
+		lower %= LIBEWF_CHECKSUM_ADLER32_BASE;
+		upper %= LIBEWF_CHECKSUM_ADLER32_BASE;
+	}
+	return( libewf_checksum_calculate_adler32_generic(
+	         buffer,
+	         size,
+	         ( upper << 16 ) | lower ) );
+}
+
+#endif /* defined( LIBEWF_CHECKSUM_HAVE_SSE2 ) */
+
+#if defined( LIBEWF_CHECKSUM_HAVE_AVX2 )
+
+/* Determines if the CPU and operating system support AVX2
+ * The result is determined once and cached, concurrent first calls store the same value
+ * Returns 1 if supported or 0 if not
+ */
+int libewf_checksum_cpu_supports_avx2(
+     void )
+{
+	static int supports_avx2 = -1;
+
+	if( supports_avx2 == -1 )
+	{
+		__builtin_cpu_init();
+
+		if( __builtin_cpu_supports( "avx2" ) )
+		{
+			supports_avx2 = 1;
+		}
+		else
+		{
+			supports_avx2 = 0;
+		}
+	}
+	return( supports_avx2 );
+}
+
+/* Calculates the Adler-32 of a buffer using AVX2
+ * This function should only be called if libewf_checksum_cpu_supports_avx2 returns 1
+ * Returns the Adler-32 value
+ */
+__attribute__((target("avx2")))
+uint32_t libewf_checksum_calculate_adler32_avx2(
+          const uint8_t *buffer,
+          size_t size,
+          uint32_t initial_value )
+{
+	__m256i bytes             = { 0 };
+	__m256i ones              = { 0 };
+	__m256i vector_lower      = { 0 };
+	__m256i vector_previous   = { 0 };
+	__m256i vector_upper      = { 0 };
+	__m256i weights           = { 0 };
+	__m256i zero              = { 0 };
+	__m128i sum               = { 0 };
+	size_t number_of_blocks   = 0;
+	size_t run_size           = 0;
+	uint32_t lower            = 0;
+	uint32_t upper            = 0;
+
+	if( buffer == NULL )
+	{
+		return( 1 );
+	}
+	lower = initial_value & 0x0000ffffUL;
+	upper = ( initial_value >> 16 ) & 0x0000ffffUL;
+
+	weights = _mm256_set_epi8(
+	           1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+	           17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 );
+	ones    = _mm256_set1_epi16( 1 );
+	zero    = _mm256_setzero_si256();
+
+	number_of_blocks = size / LIBEWF_CHECKSUM_ADLER32_BLOCK_SIZE;
+	size            %= LIBEWF_CHECKSUM_ADLER32_BLOCK_SIZE;
+
+	while( number_of_blocks > 0 )
+	{
+		run_size = number_of_blocks;
+
+		if( run_size > ( LIBEWF_CHECKSUM_ADLER32_NMAX / LIBEWF_CHECKSUM_ADLER32_BLOCK_SIZE ) )
+		{
+			run_size = LIBEWF_CHECKSUM_ADLER32_NMAX / LIBEWF_CHECKSUM_ADLER32_BLOCK_SIZE;
+		}
+		number_of_blocks -= run_size;
+
+		vector_previous = _mm256_set_epi32( 0, 0, 0, 0, 0, 0, 0, (int) ( lower * run_size ) );
+		vector_upper    = _mm256_set_epi32( 0, 0, 0, 0, 0, 0, 0, (int) upper );
+		vector_lower    = _mm256_setzero_si256();
+
+		while( run_size > 0 )
+		{
+			bytes = _mm256_loadu_si256( (const __m256i *) buffer );
+
+			vector_previous = _mm256_add_epi32( vector_previous, vector_lower );
+
+			vector_lower = _mm256_add_epi32( vector_lower, _mm256_sad_epu8( bytes, zero ) );
+			vector_upper = _mm256_add_epi32( vector_upper, _mm256_madd_epi16( _mm256_maddubs_epi16( bytes, weights ), ones ) );
+
+			buffer   += LIBEWF_CHECKSUM_ADLER32_BLOCK_SIZE;
+			run_size -= 1;
+		}
+		vector_upper = _mm256_add_epi32( vector_upper, _mm256_slli_epi32( vector_previous, 5 ) );
+
+		sum    = _mm_add_epi32( _mm256_castsi256_si128( vector_lower ), _mm256_extracti128_si256( vector_lower, 1 ) );
+		sum    = _mm_add_epi32( sum, _mm_shuffle_epi32( sum, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+		sum    = _mm_add_epi32( sum, _mm_shuffle_epi32( sum, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+		lower += (uint32_t) _mm_cvtsi128_si32( sum );
+
+		sum   = _mm_add_epi32( _mm256_castsi256_si128( vector_upper ), _mm256_extracti128_si256( vector_upper, 1 ) );
+		sum   = _mm_add_epi32( sum, _mm_shuffle_epi32( sum, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+		sum   = _mm_add_epi32( sum, _mm_shuffle_epi32( sum, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+		upper = (uint32_t) _mm_cvtsi128_si32( sum );
+
+		lower %= LIBEWF_CHECKSUM_ADLER32_BASE;
+		upper %= LIBEWF_CHECKSUM_ADLER32_BASE;
+	}
+	return( libewf_checksum_calculate_adler32_generic(
+	         buffer,
+	         size,
+	         ( upper << 16 ) | lower ) );
+}
+
+#endif /* defined( LIBEWF_CHECKSUM_HAVE_AVX2 ) */
+
+#if defined( LIBEWF_CHECKSUM_HAVE_NEON )
+
+/* Calculates the Adler-32 of a buffer using NEON
+ * The upper sum is calculated from per byte position column sums
+ * Returns the Adler-32 value
+ */
+uint32_t libewf_checksum_calculate_adler32_neon(
+          const uint8_t *buffer,
+          size_t size,
+          uint32_t initial_value )
+{
+	static const uint16_t weights[ 32 ] = {
+		32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+		16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 };
+
+	uint8x16_t bytes1;
+	uint8x16_t bytes2;
+	uint16x8_t column_sum1;
+	uint16x8_t column_sum2;
+	uint16x8_t column_sum3;
+	uint16x8_t column_sum4;
+	uint32x4_t vector_lower;
+	uint32x4_t vector_upper;
+	uint32x2_t sum;
+	size_t number_of_blocks = 0;
+	size_t run_size         = 0;
+	uint32_t lower          = 0;
+	uint32_t upper          = 0;
+
+	if( buffer == NULL )
+	{
+		return( 1 );
+	}
+	lower = initial_value & 0x0000ffffUL;
+	upper = ( initial_value >> 16 ) & 0x0000ffffUL;
+
+	number_of_blocks = size / LIBEWF_CHECKSUM_ADLER32_BLOCK_SIZE;
+	size            %= LIBEWF_CHECKSUM_ADLER32_BLOCK_SIZE;
+
+	while( number_of_blocks > 0 )
+	{
+		run_size = number_of_blocks;
+
+		if( run_size > ( LIBEWF_CHECKSUM_ADLER32_NMAX / LIBEWF_CHECKSUM_ADLER32_BLOCK_SIZE ) )
+		{
+			run_size = LIBEWF_CHECKSUM_ADLER32_NMAX / LIBEWF_CHECKSUM_ADLER32_BLOCK_SIZE;
+		}
+		number_of_blocks -= run_size;
+
+		/* The upper sum of the vector is used to hold the sum of the preceding lower sums
+		 */
+		vector_upper = vsetq_lane_u32( lower * (uint32_t) run_size, vdupq_n_u32( 0 ), 0 );
+		vector_lower = vdupq_n_u32( 0 );
+		column_sum1  = vdupq_n_u16( 0 );
+		column_sum2  = vdupq_n_u16( 0 );
+		column_sum3  = vdupq_n_u16( 0 );
+		column_sum4  = vdupq_n_u16( 0 );
+
+		while( run_size > 0 )
+		{
+			bytes1 = vld1q_u8( buffer );
+			bytes2 = vld1q_u8( &( buffer[ 16 ] ) );
+
+			vector_upper = vaddq_u32( vector_upper, vector_lower );
+			vector_lower = vpadalq_u16( vector_lower, vpadalq_u8( vpaddlq_u8( bytes1 ), bytes2 ) );
+
+			column_sum1 = vaddw_u8( column_sum1, vget_low_u8( bytes1 ) );
+			column_sum2 = vaddw_u8( column_sum2, vget_high_u8( bytes1 ) );
+			column_sum3 = vaddw_u8( column_sum3, vget_low_u8( bytes2 ) );
+			column_sum4 = vaddw_u8( column_sum4, vget_high_u8( bytes2 ) );
+
+			buffer   += LIBEWF_CHECKSUM_ADLER32_BLOCK_SIZE;
+			run_size -= 1;
+		}
+		vector_upper = vshlq_n_u32( vector_upper, 5 );
+
+		vector_upper = vmlal_u16( vector_upper, vget_low_u16( column_sum1 ), vld1_u16( &( weights[ 0 ] ) ) );
+		vector_upper = vmlal_u16( vector_upper, vget_high_u16( column_sum1 ), vld1_u16( &( weights[ 4 ] ) ) );
+		vector_upper = vmlal_u16( vector_upper, vget_low_u16( column_sum2 ), vld1_u16( &( weights[ 8 ] ) ) );
+		vector_upper = vmlal_u16( vector_upper, vget_high_u16( column_sum2 ), vld1_u16( &( weights[ 12 ] ) ) );
+		vector_upper = vmlal_u16( vector_upper, vget_low_u16( column_sum3 ), vld1_u16( &( weights[ 16 ] ) ) );
+		vector_upper = vmlal_u16( vector_upper, vget_high_u16( column_sum3 ), vld1_u16( &( weights[ 20 ] ) ) );
+		vector_upper = vmlal_u16( vector_upper, vget_low_u16( column_sum4 ), vld1_u16( &( weights[ 24 ] ) ) );
+		vector_upper = vmlal_u16( vector_upper, vget_high_u16( column_sum4 ), vld1_u16( &( weights[ 28 ] ) ) );
+
+		sum = vpadd_u32(
+		       vpadd_u32( vget_low_u32( vector_lower ), vget_high_u32( vector_lower ) ),
+		       vpadd_u32( vget_low_u32( vector_upper ), vget_high_u32( vector_upper ) ) );
+
+		lower += vget_lane_u32( sum, 0 );
+		upper += vget_lane_u32( sum, 1 );
+
+		lower %= LIBEWF_CHECKSUM_ADLER32_BASE;
+		upper %= LIBEWF_CHECKSUM_ADLER32_BASE;
+	}
+	return( libewf_checksum_calculate_adler32_generic(
+	         buffer,
+	         size,
+	         ( upper << 16 ) | lower ) );
+}
+
+#endif /* defined( LIBEWF_CHECKSUM_HAVE_NEON ) */
+
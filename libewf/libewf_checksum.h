@@ -0,0 +1,94 @@
+/*
+ * Adler-32 checksum functions
+ *
+ * Copyright (c) 2006-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_CHECKSUM_H )
+#define _LIBEWF_CHECKSUM_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* SSE2 is part of the x86-64 instruction set
+ */
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define LIBEWF_CHECKSUM_HAVE_SSE2
+#endif
+
+/* AVX2 is selected at runtime which requires function specific target support of the compiler
+ */
+#if ( defined( __x86_64__ ) || defined( __i386__ ) ) \
+ && ( defined( __clang__ ) || ( defined( __GNUC__ ) && ( __GNUC__ >= 5 ) ) )
+#define LIBEWF_CHECKSUM_HAVE_AVX2
+#endif
+
+#if defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#define LIBEWF_CHECKSUM_HAVE_NEON
+#endif
+
+uint32_t libewf_checksum_calculate_adler32(
+          const uint8_t *buffer,
+          size_t size,
+          uint32_t initial_value );
+
+uint32_t libewf_checksum_calculate_adler32_generic(
+          const uint8_t *buffer,
+          size_t size,
+          uint32_t initial_value );
+
+#if defined( LIBEWF_CHECKSUM_HAVE_SSE2 )
+
+uint32_t libewf_checksum_calculate_adler32_sse2(
+          const uint8_t *buffer,
+          size_t size,
+          uint32_t initial_value );
+
+#endif /* defined( LIBEWF_CHECKSUM_HAVE_SSE2 ) */
+
+#if defined( LIBEWF_CHECKSUM_HAVE_AVX2 )
+
+int libewf_checksum_cpu_supports_avx2(
+     void );
+
+uint32_t libewf_checksum_calculate_adler32_avx2(
+          const uint8_t *buffer,
+          size_t size,
+          uint32_t initial_value );
+
+#endif /* defined( LIBEWF_CHECKSUM_HAVE_AVX2 ) */
+
+#if defined( LIBEWF_CHECKSUM_HAVE_NEON )
+
+uint32_t libewf_checksum_calculate_adler32_neon(
+          const uint8_t *buffer,
+          size_t size,
+          uint32_t initial_value );
+
+#endif /* defined( LIBEWF_CHECKSUM_HAVE_NEON ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -181,6 +181,7 @@ int libewf_chunk_data_free(
  */
 int libewf_chunk_data_pack(
      libewf_chunk_data_t *chunk_data,
+     libewf_compression_context_t *compression_context,
      int8_t compression_level,
      uint8_t compression_flags,
      uint8_t ewf_format,
@@ -300,6 +301,7 @@ int libewf_chunk_data_pack(
 		else
 		{
 			result = libewf_compress(
+				  compression_context,
 				  chunk_data->compressed_data,
 				  &( chunk_data->compressed_data_size ),
 				  chunk_data->data,
@@ -334,6 +336,7 @@ int libewf_chunk_data_pack(
 				chunk_data->compressed_data = (uint8_t *) reallocation;
 
 				result = libewf_compress(
+					  compression_context,
 					  chunk_data->compressed_data,
 					  &( chunk_data->compressed_data_size ),
 					  chunk_data->data,
@@ -403,6 +406,7 @@ int libewf_chunk_data_pack(
  */
 int libewf_chunk_data_unpack(
      libewf_chunk_data_t *chunk_data,
+     libewf_compression_context_t *compression_context,
      size_t chunk_size,
      libcerror_error_t **error )
 {
@@ -526,6 +530,7 @@ int libewf_chunk_data_unpack(
 		chunk_data->data_size = chunk_size;
 
 		result = libewf_decompress(
+			  compression_context,
 			  chunk_data->data,
 			  &( chunk_data->data_size ),
 			  chunk_data->compressed_data,
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libewf_compression.h"
 #include "libewf_libcerror.h"
 
 #if defined( __cplusplus )
@@ -79,6 +80,7 @@ int libewf_chunk_data_free(
 
 int libewf_chunk_data_pack(
      libewf_chunk_data_t *chunk_data,
+     libewf_compression_context_t *compression_context,
      int8_t compression_level,
      uint8_t compression_flags,
      uint8_t ewf_format,
@@ -89,6 +91,7 @@ int libewf_chunk_data_pack(
 
 int libewf_chunk_data_unpack(
      libewf_chunk_data_t *chunk_data,
+     libewf_compression_context_t *compression_context,
      size_t chunk_size,
      libcerror_error_t **error );
 
@@ -0,0 +1,515 @@
+/*
+ * Chunk group functions
+ *
+ * Copyright (c) 2006-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_chunk_group.h"
+#include "libewf_definitions.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcnotify.h"
+#include "libewf_libmfdata.h"
+#include "libewf_section.h"
+
+#include "ewf_definitions.h"
+#include "ewf_table.h"
+
+/* Initialize a chunk group
+ * Make sure the value is pointing to is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_group_initialize(
+     libewf_chunk_group_t **chunk_group,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_group_initialize";
+
+	if( chunk_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk group.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_group != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk group value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_group = memory_allocate_structure(
+	                libewf_chunk_group_t );
+
+	if( *chunk_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk group.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *chunk_group,
+	     0,
+	     sizeof( libewf_chunk_group_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk group.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *chunk_group != NULL )
+	{
+		memory_free(
+		 *chunk_group );
+
+		*chunk_group = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a chunk group
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_group_free(
+     libewf_chunk_group_t **chunk_group,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_group_free";
+
+	if( chunk_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk group.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_group != NULL )
+	{
+		if( ( *chunk_group )->offsets != NULL )
+		{
+			memory_free(
+			 ( *chunk_group )->offsets );
+		}
+		memory_free(
+		 *chunk_group );
+
+		*chunk_group = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the chunk group offsets from the table section offsets
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_group_set_offsets(
+     libewf_chunk_group_t *chunk_group,
+     int first_chunk_index,
+     int file_io_pool_entry,
+     libewf_section_t *table_section,
+     off64_t base_offset,
+     ewf_table_offset_t *table_offsets,
+     uint32_t number_of_offsets,
+     uint8_t tainted,
+     libcerror_error_t **error )
+{
+	static char *function       = "libewf_chunk_group_set_offsets";
+	uint32_t chunk_size         = 0;
+	uint32_t current_offset     = 0;
+	uint32_t next_offset        = 0;
+	uint32_t stored_offset      = 0;
+	uint32_t table_offset_index = 0;
+
+	if( chunk_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk group.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_group->offsets != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk group - offsets value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_chunk_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first chunk index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_section == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table section.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid base offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_offsets == 0 )
+	 || ( (int64_t) first_chunk_index + number_of_offsets > (int64_t) INT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of offsets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if SIZEOF_SIZE_T <= 4
+	if( (size_t) number_of_offsets > ( (size_t) SSIZE_MAX / sizeof( uint32_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of offsets value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	chunk_group->offsets = (uint32_t *) memory_allocate(
+	                                     sizeof( uint32_t ) * number_of_offsets );
+
+	if( chunk_group->offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create offsets.",
+		 function );
+
+		return( -1 );
+	}
+	for( table_offset_index = 0;
+	     table_offset_index < number_of_offsets;
+	     table_offset_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 table_offsets[ table_offset_index ].offset,
+		 chunk_group->offsets[ table_offset_index ] );
+	}
+	chunk_group->first_chunk_index          = first_chunk_index;
+	chunk_group->file_io_pool_entry         = file_io_pool_entry;
+	chunk_group->base_offset                = base_offset;
+	chunk_group->table_section_start_offset = table_section->start_offset;
+	chunk_group->table_section_end_offset   = table_section->end_offset;
+	chunk_group->number_of_offsets          = number_of_offsets;
+	chunk_group->overflow_index             = number_of_offsets;
+	chunk_group->is_tainted                 = tainted;
+
+	/* This is to compensate for the crappy > 2 GiB segment file solution in EnCase 6.7
+	 * once a chunk ends beyond 2 GiB the offsets of the chunks that follow no longer
+	 * contain a compressed flag
+	 */
+	for( table_offset_index = 0;
+	     table_offset_index < ( number_of_offsets - 1 );
+	     table_offset_index++ )
+	{
+		current_offset = chunk_group->offsets[ table_offset_index ] & EWF_OFFSET_COMPRESSED_READ_MASK;
+		stored_offset  = chunk_group->offsets[ table_offset_index + 1 ];
+		next_offset    = stored_offset & EWF_OFFSET_COMPRESSED_READ_MASK;
+
+		if( next_offset < current_offset )
+		{
+			chunk_size = stored_offset - current_offset;
+		}
+		else
+		{
+			chunk_size = next_offset - current_offset;
+		}
+		if( ( current_offset + chunk_size ) > (uint32_t) INT32_MAX )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: chunk offset overflow at: %" PRIu32 ".\n",
+				 function,
+				 current_offset );
+			}
+#endif
+			chunk_group->overflow_index = table_offset_index + 1;
+
+			break;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the data range of a specific chunk in the chunk group
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_group_get_chunk_range(
+     libewf_chunk_group_t *chunk_group,
+     int chunk_index,
+     int *file_io_pool_entry,
+     off64_t *chunk_offset,
+     size64_t *chunk_size,
+     uint32_t *chunk_flags,
+     libcerror_error_t **error )
+{
+	static char *function      = "libewf_chunk_group_get_chunk_range";
+	off64_t last_chunk_offset  = 0;
+	off64_t last_chunk_size    = 0;
+	uint32_t current_offset    = 0;
+	uint32_t next_offset       = 0;
+	uint32_t offset_index      = 0;
+	uint32_t range_size        = 0;
+	uint32_t stored_offset     = 0;
+	uint8_t corrupted          = 0;
+	uint8_t is_compressed      = 0;
+
+	if( chunk_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk group.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_group->offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunk group - missing offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_index < chunk_group->first_chunk_index )
+	 || ( (uint32_t) ( chunk_index - chunk_group->first_chunk_index ) >= chunk_group->number_of_offsets ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_pool_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk flags.",
+		 function );
+
+		return( -1 );
+	}
+	offset_index  = (uint32_t) ( chunk_index - chunk_group->first_chunk_index );
+	stored_offset = chunk_group->offsets[ offset_index ];
+
+	if( offset_index < chunk_group->overflow_index )
+	{
+		is_compressed  = (uint8_t) ( stored_offset >> 31 );
+		current_offset = stored_offset & EWF_OFFSET_COMPRESSED_READ_MASK;
+	}
+	else
+	{
+		current_offset = stored_offset;
+	}
+	if( offset_index < ( chunk_group->number_of_offsets - 1 ) )
+	{
+		stored_offset = chunk_group->offsets[ offset_index + 1 ];
+
+		if( offset_index < chunk_group->overflow_index )
+		{
+			next_offset = stored_offset & EWF_OFFSET_COMPRESSED_READ_MASK;
+		}
+		else
+		{
+			next_offset = stored_offset;
+		}
+		/* This is to compensate for the crappy > 2 GiB segment file solution in EnCase 6.7
+		 */
+		if( next_offset < current_offset )
+		{
+			if( stored_offset < current_offset )
+			{
+				corrupted = 1;
+			}
+			range_size = stored_offset - current_offset;
+		}
+		else
+		{
+			range_size = next_offset - current_offset;
+		}
+		if( ( range_size == 0 )
+		 || ( range_size > (uint32_t) INT32_MAX ) )
+		{
+			corrupted = 1;
+		}
+		*chunk_offset = chunk_group->base_offset + current_offset;
+		*chunk_size   = (size64_t) range_size;
+	}
+	else
+	{
+		/* There is no indication how large the last chunk is.
+		 * The size is determined using the offset of the next section
+		 * which is either the start or the end of the table section
+		 */
+		last_chunk_offset = chunk_group->base_offset + current_offset;
+
+		if( last_chunk_offset < chunk_group->table_section_start_offset )
+		{
+			last_chunk_size = chunk_group->table_section_start_offset - last_chunk_offset;
+		}
+		else if( last_chunk_offset < chunk_group->table_section_end_offset )
+		{
+			last_chunk_size = chunk_group->table_section_end_offset - last_chunk_offset;
+		}
+		if( ( last_chunk_size <= 0 )
+		 || ( last_chunk_size > (off64_t) INT32_MAX ) )
+		{
+			corrupted = 1;
+		}
+		*chunk_offset = last_chunk_offset;
+		*chunk_size   = (size64_t) last_chunk_size;
+	}
+	*file_io_pool_entry = chunk_group->file_io_pool_entry;
+	*chunk_flags        = 0;
+
+	if( is_compressed != 0 )
+	{
+		*chunk_flags |= LIBMFDATA_RANGE_FLAG_IS_COMPRESSED;
+	}
+	if( corrupted != 0 )
+	{
+		*chunk_flags |= LIBEWF_RANGE_FLAG_IS_CORRUPTED;
+	}
+	if( chunk_group->is_tainted != 0 )
+	{
+		*chunk_flags |= LIBEWF_RANGE_FLAG_IS_TAINTED;
+	}
+	return( 1 );
+}
+
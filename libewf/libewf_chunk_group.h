@@ -0,0 +1,117 @@
+/*
+ * Chunk group functions
+ *
+ * Copyright (c) 2006-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_CHUNK_GROUP_H )
+#define _LIBEWF_CHUNK_GROUP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_libcerror.h"
+#include "libewf_section.h"
+
+#include "ewf_table.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libewf_chunk_group libewf_chunk_group_t;
+
+/* The chunk group contains the offsets of the chunks of a single table section
+ * The offsets are stored as in the table section, relative to the base offset
+ * and including the compressed flag, the data range of a chunk is determined
+ * when it is needed
+ */
+struct libewf_chunk_group
+{
+	/* The index of the first chunk
+	 */
+	int first_chunk_index;
+
+	/* The file IO pool entry
+	 */
+	int file_io_pool_entry;
+
+	/* The base offset
+	 */
+	off64_t base_offset;
+
+	/* The start offset of the table section
+	 */
+	off64_t table_section_start_offset;
+
+	/* The end offset of the table section
+	 */
+	off64_t table_section_end_offset;
+
+	/* The (table) offsets
+	 */
+	uint32_t *offsets;
+
+	/* The number of offsets
+	 */
+	uint32_t number_of_offsets;
+
+	/* The index of the first offset that overflows
+	 * the offsets from this index onwards do not contain a compressed flag
+	 */
+	uint32_t overflow_index;
+
+	/* Value to indicate the offsets are tainted
+	 */
+	uint8_t is_tainted;
+};
+
+int libewf_chunk_group_initialize(
+     libewf_chunk_group_t **chunk_group,
+     libcerror_error_t **error );
+
+int libewf_chunk_group_free(
+     libewf_chunk_group_t **chunk_group,
+     libcerror_error_t **error );
+
+int libewf_chunk_group_set_offsets(
+     libewf_chunk_group_t *chunk_group,
+     int first_chunk_index,
+     int file_io_pool_entry,
+     libewf_section_t *table_section,
+     off64_t base_offset,
+     ewf_table_offset_t *table_offsets,
+     uint32_t number_of_offsets,
+     uint8_t tainted,
+     libcerror_error_t **error );
+
+int libewf_chunk_group_get_chunk_range(
+     libewf_chunk_group_t *chunk_group,
+     int chunk_index,
+     int *file_io_pool_entry,
+     off64_t *chunk_offset,
+     size64_t *chunk_size,
+     uint32_t *chunk_flags,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
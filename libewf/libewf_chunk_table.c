@@ -28,6 +28,7 @@
 #include "libewf_libcnotify.h"
 
 #include "libewf_chunk_data.h"
+#include "libewf_chunk_group.h"
 #include "libewf_chunk_table.h"
 #include "libewf_definitions.h"
 #include "libewf_io_handle.h"
@@ -112,6 +113,20 @@ int libewf_chunk_table_initialize(
 
 		goto on_error;
 	}
+	if( libfcache_cache_initialize(
+	     &( ( *chunk_table )->chunk_groups_cache ),
+	     LIBEWF_MAXIMUM_CACHE_ENTRIES_CHUNK_GROUPS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk groups cache.",
+		 function );
+
+		goto on_error;
+	}
 	( *chunk_table )->io_handle = io_handle;
 
 	return( 1 );
@@ -135,6 +150,7 @@ int libewf_chunk_table_free(
      libcerror_error_t **error )
 {
 	static char *function = "libewf_chunk_table_free";
+	int result            = 1;
 
 	if( chunk_table == NULL )
 	{
@@ -149,12 +165,25 @@ int libewf_chunk_table_free(
 	}
 	if( *chunk_table != NULL )
 	{
+		if( libfcache_cache_free(
+		     &( ( *chunk_table )->chunk_groups_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk groups cache.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *chunk_table );
 
 		*chunk_table = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Clones the chunk table
@@ -223,6 +252,24 @@ int libewf_chunk_table_clone(
 
 		goto on_error;
 	}
+	( (libewf_chunk_table_t *) *destination_chunk_table )->chunk_groups_cache = NULL;
+
+	/* The chunk groups are read again when needed
+	 */
+	if( libfcache_cache_clone(
+	     &( ( (libewf_chunk_table_t *) *destination_chunk_table )->chunk_groups_cache ),
+	     ( (libewf_chunk_table_t *) source_chunk_table )->chunk_groups_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination chunk groups cache.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -254,7 +301,6 @@ int libewf_chunk_table_read_chunk(
 {
 	libewf_chunk_data_t *chunk_data = NULL;
 	static char *function           = "libewf_chunk_table_read_chunk";
-	ssize_t read_count              = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	int element_index               = 0;
@@ -334,27 +380,93 @@ int libewf_chunk_table_read_chunk(
 		}
 	}
 #endif
-	if( libbfio_pool_seek_offset(
+	if( libewf_chunk_table_read_chunk_data(
 	     file_io_pool,
 	     file_io_pool_entry,
 	     element_data_offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	     element_data_size,
+	     element_data_flags,
+	     &chunk_data,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek chunk offset: %" PRIi64 " in file IO pool entry: %d.",
-		 function,
-		 element_data_offset,
-		 file_io_pool_entry );
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmfdata_list_element_set_element_value(
+	     list_element,
+	     cache,
+	     (intptr_t *) chunk_data,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_chunk_data_free,
+	     LIBMFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set chunk data as element value.",
+		 function );
 
 		goto on_error;
 	}
+	return( 1 );
+
+on_error:
+	if( chunk_data != NULL )
+	{
+		libewf_chunk_data_free(
+		 &chunk_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the data of a chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_table_read_chunk_data(
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     off64_t chunk_offset,
+     size64_t chunk_size,
+     uint32_t chunk_flags,
+     libewf_chunk_data_t **chunk_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_table_read_chunk_data";
+	ssize_t read_count    = 0;
+
+	if( chunk_size > (size64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
 	if( libewf_chunk_data_initialize(
-	     &chunk_data,
-	     (size_t) element_data_size,
+	     chunk_data,
+	     (size_t) chunk_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -366,7 +478,7 @@ int libewf_chunk_table_read_chunk(
 
 		goto on_error;
 	}
-	if( chunk_data == NULL )
+	if( *chunk_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -377,56 +489,42 @@ int libewf_chunk_table_read_chunk(
 
 		goto on_error;
 	}
-	read_count = libbfio_pool_read_buffer(
+	read_count = libbfio_pool_read_buffer_at_offset(
 		      file_io_pool,
 		      file_io_pool_entry,
-		      chunk_data->data,
-		      (size_t) element_data_size,
+		      ( *chunk_data )->data,
+		      (size_t) chunk_size,
+		      chunk_offset,
 		      error );
 
-	if( read_count != (ssize_t) element_data_size )
+	if( read_count != (ssize_t) chunk_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read chunk data.",
-		 function );
+		 "%s: unable to read chunk data at offset: %" PRIi64 " in file IO pool entry: %d.",
+		 function,
+		 chunk_offset,
+		 file_io_pool_entry );
 
 		goto on_error;
 	}
-	chunk_data->data_size = (size_t) read_count;
+	( *chunk_data )->data_size = (size_t) read_count;
 
-	if( ( element_data_flags & LIBMFDATA_RANGE_FLAG_IS_COMPRESSED ) != 0 )
+	if( ( chunk_flags & LIBMFDATA_RANGE_FLAG_IS_COMPRESSED ) != 0 )
 	{
-		chunk_data->is_compressed = 1;
+		( *chunk_data )->is_compressed = 1;
 	}
-	chunk_data->is_packed = 1;
-
-	if( libmfdata_list_element_set_element_value(
-	     list_element,
-	     cache,
-	     (intptr_t *) chunk_data,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_chunk_data_free,
-	     LIBMFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set chunk data as element value.",
-		 function );
+	( *chunk_data )->is_packed = 1;
 
-		goto on_error;
-	}
 	return( 1 );
 
 on_error:
-	if( chunk_data != NULL )
+	if( *chunk_data != NULL )
 	{
 		libewf_chunk_data_free(
-		 &chunk_data,
+		 chunk_data,
 		 NULL );
 	}
 	return( -1 );
@@ -450,13 +548,13 @@ int libewf_chunk_table_read_offsets(
      uint8_t read_flags,
      libcerror_error_t **error )
 {
-	uint8_t table_offsets_checksum[ 4 ];
-
 	libewf_chunk_table_t *chunk_table = NULL;
 	libewf_section_t *section         = NULL;
 	uint8_t *table_offsets_data       = NULL;
 	static char *function             = "libewf_chunk_table_read_offsets";
+	off64_t file_offset               = 0;
 	size_t table_offsets_data_size    = 0;
+	size_t table_offsets_read_size    = 0;
 	ssize_t read_count                = 0;
 	uint64_t base_offset              = 0;
 	uint32_t calculated_checksum      = 0;
@@ -538,6 +636,7 @@ int libewf_chunk_table_read_offsets(
 
 		goto on_error;
 	}
+	file_offset         = element_group_offset + read_count;
 	element_group_size -= read_count;
 
 	read_count = libewf_section_table_header_read(
@@ -560,6 +659,7 @@ int libewf_chunk_table_read_offsets(
 
 		goto on_error;
 	}
+	file_offset        += read_count;
 	element_group_size -= read_count;
 
 	if( number_of_offsets == 0 )
@@ -586,49 +686,62 @@ int libewf_chunk_table_read_offsets(
 
 		goto on_error;
 	}
-	table_offsets_data = (uint8_t *) memory_allocate(
-	                                  table_offsets_data_size );
+	/* The EWF-S01 format does not contain a checksum after the table offsets
+	 */
+	table_offsets_read_size = table_offsets_data_size;
 
-	if( table_offsets_data == NULL )
+	if( chunk_table->io_handle->ewf_format != EWF_FORMAT_S01 )
+	{
+		table_offsets_read_size += sizeof( uint32_t );
+	}
+	if( element_group_size < (size64_t) table_offsets_read_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create table offsets data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid element group size value too small.",
 		 function );
 
 		goto on_error;
 	}
-	if( element_group_size < (size64_t) table_offsets_data_size )
+	table_offsets_data = (uint8_t *) memory_allocate(
+	                                  table_offsets_read_size );
+
+	if( table_offsets_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid element group size value too small.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create table offsets data.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	read_count = libbfio_pool_read_buffer(
+	/* The table offsets and their checksum are read with a single read
+	 */
+	read_count = libbfio_pool_read_buffer_at_offset(
 		      file_io_pool,
 		      file_io_pool_entry,
 		      table_offsets_data,
-		      table_offsets_data_size,
+		      table_offsets_read_size,
+		      file_offset,
 		      error );
 
-	if( read_count != (ssize_t) table_offsets_data_size )
+	if( read_count != (ssize_t) table_offsets_read_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read table offsets data.",
-		 function );
+		 "%s: unable to read table offsets data at offset: %" PRIi64 ".",
+		 function,
+		 file_offset );
 
 		goto on_error;
 	}
+	file_offset        += read_count;
 	element_group_size -= read_count;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -643,43 +756,10 @@ int libewf_chunk_table_read_offsets(
 		 0 );
 	}
 #endif
-	/* The EWF-S01 format does not contain a checksum after the table offsets
-	 */
 	if( chunk_table->io_handle->ewf_format != EWF_FORMAT_S01 )
 	{
-		if( element_group_size < (size64_t) sizeof( uint32_t ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: invalid element group size value too small.",
-			 function );
-
-			return( -1 );
-		}
-		read_count = libbfio_pool_read_buffer(
-			      file_io_pool,
-			      file_io_pool_entry,
-			      table_offsets_checksum,
-			      sizeof( uint32_t ),
-			      error );
-
-		if( read_count != (ssize_t) sizeof( uint32_t ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read checksum from file descriptor.",
-			 function );
-
-			goto on_error;
-		}
-		element_group_size -= read_count;
-
 		byte_stream_copy_to_uint32_little_endian(
-		 table_offsets_checksum,
+		 &( table_offsets_data[ table_offsets_data_size ] ),
 		 stored_checksum );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -688,7 +768,7 @@ int libewf_chunk_table_read_offsets(
 			libcnotify_printf(
 	 		 "%s: table offsets checksum\t\t\t: 0x%" PRIx32 "\n",
 			 function,
-			 table_offsets_checksum );
+			 stored_checksum );
 
 			libcnotify_printf(
 	 		 "\n" );
@@ -821,11 +901,12 @@ int libewf_chunk_table_read_offsets(
 
 				goto on_error;
 			}
-			read_count = libbfio_pool_read_buffer(
+			read_count = libbfio_pool_read_buffer_at_offset(
 				      file_io_pool,
 				      file_io_pool_entry,
 				      trailing_data,
 				      (size_t) element_group_size,
+				      file_offset,
 				      error );
 
 			if( read_count != (ssize_t) element_group_size )
@@ -888,43 +969,26 @@ on_error:
 	return( -1 );
 }
 
-/* Fills the chunk table from the offsets
- * Returns 1 if successful or -1 on error
+/* Retrieves the chunk group that contains a specific chunk
+ * The chunk groups are cached by the file IO pool entry and offset of their table section
+ * Returns 1 if successful, 0 if no such chunk group is cached or -1 on error
  */
-int libewf_chunk_table_fill(
+int libewf_chunk_table_get_chunk_group(
      libewf_chunk_table_t *chunk_table,
      libmfdata_list_t *chunk_table_list,
      int chunk_index,
-     int file_io_pool_entry,
-     libewf_section_t *table_section,
-     off64_t base_offset,
-     ewf_table_offset_t *table_offsets,
-     uint32_t number_of_offsets,
-     uint8_t tainted,
+     libewf_chunk_group_t **chunk_group,
      libcerror_error_t **error )
 {
-	static char *function           = "libewf_chunk_table_fill";
-	off64_t last_chunk_offset       = 0;
-	off64_t last_chunk_size         = 0;
-	off64_t previous_chunk_offset   = 0;
-	size64_t previous_chunk_size    = 0;
-	uint32_t chunk_flags            = 0;
-	uint32_t chunk_size             = 0;
-	uint32_t current_offset         = 0;
-	uint32_t next_offset            = 0;
-	uint32_t previous_chunk_flags   = 0;
-	uint32_t stored_offset          = 0;
-	uint32_t table_offset_index     = 0;
-	uint8_t corrupted               = 0;
-	uint8_t is_compressed           = 0;
-	uint8_t overflow                = 0;
-	int previous_file_io_pool_entry = 0;
-	int result                      = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	char *chunk_type                = NULL;
-	char *remarks                   = NULL;
-#endif
+	libewf_chunk_group_t *cached_chunk_group     = NULL;
+	libfcache_cache_value_t *cache_value         = NULL;
+	libmfdata_list_element_t *group_list_element = NULL;
+	static char *function                        = "libewf_chunk_table_get_chunk_group";
+	off64_t group_offset                         = 0;
+	size64_t group_size                          = 0;
+	uint32_t group_flags                         = 0;
+	int group_file_io_pool_entry                 = 0;
+	int result                                   = 0;
 
 	if( chunk_table == NULL )
 	{
@@ -937,168 +1001,1478 @@ int libewf_chunk_table_fill(
 
 		return( -1 );
 	}
-	if( table_section == NULL )
+	if( chunk_group == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid table section.",
+		 "%s: invalid chunk group.",
 		 function );
 
 		return( -1 );
 	}
-	if( base_offset < 0 )
+	if( libmfdata_list_get_element_by_index(
+	     chunk_table_list,
+	     chunk_index,
+	     &group_list_element,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
-		 "%s: invalid base offset.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve list element of chunk: %d.",
+		 function,
+		 chunk_index );
 
 		return( -1 );
 	}
-	if( table_offsets == NULL )
+	if( libmfdata_list_element_get_data_range(
+	     group_list_element,
+	     &group_file_io_pool_entry,
+	     &group_offset,
+	     &group_size,
+	     &group_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid table offsets.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data range of group of chunk: %d.",
+		 function,
+		 chunk_index );
 
 		return( -1 );
 	}
-	byte_stream_copy_to_uint32_little_endian(
-	 table_offsets[ table_offset_index ].offset,
-	 stored_offset );
+	result = libfcache_cache_get_value_by_identifier(
+	          chunk_table->chunk_groups_cache,
+	          group_file_io_pool_entry,
+	          group_offset,
+	          0,
+	          &cache_value,
+	          error );
 
-	while( table_offset_index < ( number_of_offsets - 1 ) )
+	if( result == -1 )
 	{
-		if( overflow == 0 )
-		{
-			is_compressed  = (uint8_t) ( stored_offset >> 31 );
-			current_offset = stored_offset & EWF_OFFSET_COMPRESSED_READ_MASK;
-		}
-		else
-		{
-			current_offset = stored_offset;
-		}
-		byte_stream_copy_to_uint32_little_endian(
-		 table_offsets[ table_offset_index + 1 ].offset,
-		 stored_offset );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk group of chunk: %d from cache.",
+		 function,
+		 chunk_index );
 
-		if( overflow == 0 )
-		{
-			next_offset = stored_offset & EWF_OFFSET_COMPRESSED_READ_MASK;
-		}
-		else
-		{
-			next_offset = stored_offset;
-		}
-		corrupted = 0;
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfcache_cache_value_get_value(
+	     cache_value,
+	     (intptr_t **) &cached_chunk_group,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk group from cache value.",
+		 function );
 
-		/* This is to compensate for the crappy > 2 GiB segment file solution in EnCase 6.7
-		 */
-		if( next_offset < current_offset )
-		{
-			if( stored_offset < current_offset )
-			{
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: chunk offset: %" PRIu32 " larger than stored chunk offset: %" PRIu32 ".\n",
-					 function,
-					 current_offset,
-					 stored_offset );
-				}
-#endif
-				corrupted = 1;
-			}
+		return( -1 );
+	}
+	if( cached_chunk_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing chunk group of chunk: %d.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	if( ( chunk_index < cached_chunk_group->first_chunk_index )
+	 || ( (uint32_t) ( chunk_index - cached_chunk_group->first_chunk_index ) >= cached_chunk_group->number_of_offsets ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: chunk: %d out of bounds of chunk group.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	*chunk_group = cached_chunk_group;
+
+	return( 1 );
+}
+
+/* Reads the chunk group that contains a specific chunk
+ * This function replaces the expansion of the element group of the chunk table list
+ * Returns 1 if successful, 0 if the chunk is no longer part of a chunk group or -1 on error
+ */
+int libewf_chunk_table_read_chunk_group(
+     libewf_chunk_table_t *chunk_table,
+     libbfio_pool_t *file_io_pool,
+     libmfdata_list_t *chunk_table_list,
+     int chunk_index,
+     libewf_chunk_group_t **chunk_group,
+     libcerror_error_t **error )
+{
+	libmfdata_list_element_t *group_list_element = NULL;
+	static char *function                        = "libewf_chunk_table_read_chunk_group";
+	off64_t backup_group_offset                  = 0;
+	off64_t group_offset                         = 0;
+	size64_t backup_group_size                   = 0;
+	size64_t group_size                          = 0;
+	uint32_t backup_group_flags                  = 0;
+	uint32_t group_flags                         = 0;
+	int backup_group_file_io_pool_entry          = 0;
+	int group_file_io_pool_entry                 = 0;
+	int group_element_index                      = 0;
+	int has_backup_data_range                    = 0;
+	int number_of_elements                       = 0;
+	int result                                   = 0;
+
+	if( chunk_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmfdata_list_get_element_by_index(
+	     chunk_table_list,
+	     chunk_index,
+	     &group_list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve list element of chunk: %d.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	if( libmfdata_list_element_get_element_index(
+	     group_list_element,
+	     &group_element_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve group element index of chunk: %d.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	if( libmfdata_list_element_get_group_values(
+	     group_list_element,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve group values of chunk: %d.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	if( libmfdata_list_element_get_data_range(
+	     group_list_element,
+	     &group_file_io_pool_entry,
+	     &group_offset,
+	     &group_size,
+	     &group_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data range of group of chunk: %d.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	result = libmfdata_list_element_get_backup_data_range(
+	          group_list_element,
+	          &backup_group_file_io_pool_entry,
+	          &backup_group_offset,
+	          &backup_group_size,
+	          &backup_group_flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve backup data range of group of chunk: %d.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		has_backup_data_range = 1;
+	}
+	result = libewf_chunk_table_read_offsets(
+	          (intptr_t *) chunk_table,
+	          file_io_pool,
+	          chunk_table_list,
+	          group_element_index,
+	          number_of_elements,
+	          NULL,
+	          group_file_io_pool_entry,
+	          group_offset,
+	          group_size,
+	          group_flags,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk group: %d.",
+		 function,
+		 group_element_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( has_backup_data_range == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: error reading chunk group: %d and no backup data range to compensate.",
+			 function,
+			 group_element_index );
+
+			return( -1 );
+		}
+		if( libewf_chunk_table_read_offsets(
+		     (intptr_t *) chunk_table,
+		     file_io_pool,
+		     chunk_table_list,
+		     group_element_index,
+		     number_of_elements,
+		     NULL,
+		     backup_group_file_io_pool_entry,
+		     backup_group_offset,
+		     backup_group_size,
+		     backup_group_flags,
+		     LIBMFDATA_READ_FLAG_IS_BACKUP_RANGE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk group: %d using backup range.",
+			 function,
+			 group_element_index );
+
+			return( -1 );
+		}
+	}
+	/* Reading the chunk group can change the chunk table list
+	 * e.g. the chunks of a chunk group with corrupted offsets are corrected individually
+	 */
+	result = libmfdata_list_is_group(
+	          chunk_table_list,
+	          chunk_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if chunk: %d is a group.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = libewf_chunk_table_get_chunk_group(
+	          chunk_table,
+	          chunk_table_list,
+	          chunk_index,
+	          chunk_group,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk group of chunk: %d.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing chunk group of chunk: %d.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the chunk data of a specific chunk
+ * Chunks in a chunk group are read using the offsets of the chunk group
+ * other chunks are read using the chunk table list
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_table_get_chunk_data(
+     libmfdata_list_t *chunk_table_list,
+     libbfio_pool_t *file_io_pool,
+     libfcache_cache_t *chunk_table_cache,
+     int chunk_index,
+     libewf_chunk_data_t **chunk_data,
+     uint8_t read_flags,
+     libcerror_error_t **error )
+{
+	libewf_chunk_data_t *read_chunk_data = NULL;
+	libewf_chunk_group_t *chunk_group    = NULL;
+	libewf_chunk_table_t *chunk_table    = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libewf_chunk_table_get_chunk_data";
+	off64_t chunk_offset                 = 0;
+	size64_t chunk_size                  = 0;
+	uint32_t chunk_flags                 = 0;
+	int file_io_pool_entry               = 0;
+	int result                           = 0;
+
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	result = libmfdata_list_is_group(
+	          chunk_table_list,
+	          chunk_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if chunk: %d is a group.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( libmfdata_list_get_element_value_by_index(
+		     chunk_table_list,
+		     file_io_pool,
+		     chunk_table_cache,
+		     chunk_index,
+		     (intptr_t **) chunk_data,
+		     read_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk: %d data.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libmfdata_list_get_io_handle(
+	     chunk_table_list,
+	     (intptr_t **) &chunk_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk table from chunk table list.",
+		 function );
+
+		return( -1 );
+	}
+	result = libewf_chunk_table_get_chunk_group(
+	          chunk_table,
+	          chunk_table_list,
+	          chunk_index,
+	          &chunk_group,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk group of chunk: %d.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		result = libewf_chunk_table_read_chunk_group(
+		          chunk_table,
+		          file_io_pool,
+		          chunk_table_list,
+		          chunk_index,
+		          &chunk_group,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk group of chunk: %d.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( libewf_chunk_table_get_chunk_data(
+			         chunk_table_list,
+			         file_io_pool,
+			         chunk_table_cache,
+			         chunk_index,
+			         chunk_data,
+			         read_flags,
+			         error ) );
+		}
+	}
+	if( libewf_chunk_group_get_chunk_range(
+	     chunk_group,
+	     chunk_index,
+	     &file_io_pool_entry,
+	     &chunk_offset,
+	     &chunk_size,
+	     &chunk_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data range of chunk: %d.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	/* The chunk group values are not modified once read
+	 * therefore the cache values are identified without a timestamp
+	 */
+	result = 0;
+
+	if( ( read_flags & LIBMFDATA_READ_FLAG_IGNORE_CACHE ) == 0 )
+	{
+		result = libfcache_cache_get_value_by_identifier(
+		          chunk_table_cache,
+		          file_io_pool_entry,
+		          chunk_offset,
+		          0,
+		          &cache_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value of chunk: %d.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+	}
+	if( result == 0 )
+	{
 #if defined( HAVE_DEBUG_OUTPUT )
-			else if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: chunk offset: %" PRIu32 " larger than next chunk offset: %" PRIu32 ".\n",
-				 function,
-				 current_offset,
-				 next_offset );
-			}
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading %s chunk: %d from file IO pool entry: %d at offset: %" PRIi64 " of size: %" PRIu64 "\n",
+			 function,
+			 ( ( chunk_flags & LIBMFDATA_RANGE_FLAG_IS_COMPRESSED ) != 0 ) ? "compressed" : "uncompressed",
+			 chunk_index,
+			 file_io_pool_entry,
+			 chunk_offset,
+			 chunk_size );
+		}
 #endif
-			chunk_size = stored_offset - current_offset;
+		if( libewf_chunk_table_read_chunk_data(
+		     file_io_pool,
+		     file_io_pool_entry,
+		     chunk_offset,
+		     chunk_size,
+		     chunk_flags,
+		     &read_chunk_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk: %d data.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		if( libfcache_cache_set_value_by_identifier(
+		     chunk_table_cache,
+		     file_io_pool_entry,
+		     chunk_offset,
+		     0,
+		     (intptr_t *) read_chunk_data,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_chunk_data_free,
+		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set chunk: %d data in cache.",
+			 function,
+			 chunk_index );
+
+			libewf_chunk_data_free(
+			 &read_chunk_data,
+			 NULL );
+
+			return( -1 );
+		}
+		*chunk_data = read_chunk_data;
+
+		return( 1 );
+	}
+	if( libfcache_cache_value_get_value(
+	     cache_value,
+	     (intptr_t **) chunk_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %d data from cache value.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the data range of a specific chunk
+ * Chunks in a chunk group are determined using the offsets of the chunk group
+ * other chunks are determined using the chunk table list
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_table_get_chunk_range(
+     libmfdata_list_t *chunk_table_list,
+     libbfio_pool_t *file_io_pool,
+     int chunk_index,
+     int *file_io_pool_entry,
+     off64_t *chunk_offset,
+     size64_t *chunk_size,
+     uint32_t *chunk_flags,
+     libcerror_error_t **error )
+{
+	libewf_chunk_group_t *chunk_group = NULL;
+	libewf_chunk_table_t *chunk_table = NULL;
+	static char *function             = "libewf_chunk_table_get_chunk_range";
+	int result                        = 0;
+
+	result = libmfdata_list_is_group(
+	          chunk_table_list,
+	          chunk_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if chunk: %d is a group.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( libmfdata_list_get_data_range_by_index(
+		     chunk_table_list,
+		     chunk_index,
+		     file_io_pool_entry,
+		     chunk_offset,
+		     chunk_size,
+		     chunk_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data range of chunk: %d.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libmfdata_list_get_io_handle(
+	     chunk_table_list,
+	     (intptr_t **) &chunk_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk table from chunk table list.",
+		 function );
+
+		return( -1 );
+	}
+	result = libewf_chunk_table_get_chunk_group(
+	          chunk_table,
+	          chunk_table_list,
+	          chunk_index,
+	          &chunk_group,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk group of chunk: %d.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		result = libewf_chunk_table_read_chunk_group(
+		          chunk_table,
+		          file_io_pool,
+		          chunk_table_list,
+		          chunk_index,
+		          &chunk_group,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk group of chunk: %d.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( libewf_chunk_table_get_chunk_range(
+			         chunk_table_list,
+			         file_io_pool,
+			         chunk_index,
+			         file_io_pool_entry,
+			         chunk_offset,
+			         chunk_size,
+			         chunk_flags,
+			         error ) );
+		}
+	}
+	if( libewf_chunk_group_get_chunk_range(
+	     chunk_group,
+	     chunk_index,
+	     file_io_pool_entry,
+	     chunk_offset,
+	     chunk_size,
+	     chunk_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data range of chunk: %d.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the data range of a specific chunk of a chunk group that is not cached
+ * Returns 1 if successful, 0 if the chunk is not part of a chunk group,
+ * has no stored data or its data is cached or -1 on error
+ */
+int libewf_chunk_table_get_uncached_chunk_range(
+     libmfdata_list_t *chunk_table_list,
+     libbfio_pool_t *file_io_pool,
+     libfcache_cache_t *chunk_table_cache,
+     int chunk_index,
+     int *file_io_pool_entry,
+     off64_t *chunk_offset,
+     size64_t *chunk_size,
+     uint32_t *chunk_flags,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libewf_chunk_table_get_uncached_chunk_range";
+	int result                           = 0;
+
+	if( file_io_pool_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk flags.",
+		 function );
+
+		return( -1 );
+	}
+	result = libmfdata_list_is_group(
+	          chunk_table_list,
+	          chunk_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if chunk: %d is a group.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libewf_chunk_table_get_chunk_range(
+	     chunk_table_list,
+	     file_io_pool,
+	     chunk_index,
+	     file_io_pool_entry,
+	     chunk_offset,
+	     chunk_size,
+	     chunk_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data range of chunk: %d.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	if( ( *file_io_pool_entry < 0 )
+	 || ( ( *chunk_flags & LIBMFDATA_RANGE_FLAG_IS_SPARSE ) != 0 ) )
+	{
+		return( 0 );
+	}
+	/* The chunk group values are not modified once read
+	 * therefore the cache values are identified without a timestamp
+	 */
+	result = libfcache_cache_get_value_by_identifier(
+	          chunk_table_cache,
+	          *file_io_pool_entry,
+	          *chunk_offset,
+	          0,
+	          &cache_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value of chunk: %d.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Sets the data of a chunk of a chunk group in the chunk table cache
+ * The cache takes over management of the chunk data
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_table_set_cached_chunk_data(
+     libfcache_cache_t *chunk_table_cache,
+     int file_io_pool_entry,
+     off64_t chunk_offset,
+     libewf_chunk_data_t *chunk_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_table_set_cached_chunk_data";
+
+	if( libfcache_cache_set_value_by_identifier(
+	     chunk_table_cache,
+	     file_io_pool_entry,
+	     chunk_offset,
+	     0,
+	     (intptr_t *) chunk_data,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_chunk_data_free,
+	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set chunk data in cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the data of a run of chunks that are stored consecutively in a segment file
+ * The data is read using a single vectored read and stored in the chunk table cache
+ * Chunks for which not all data could be read are not stored
+ * Returns the number of chunks stored in the cache or -1 on error
+ */
+int libewf_chunk_table_read_chunk_run(
+     libbfio_pool_t *file_io_pool,
+     libfcache_cache_t *chunk_table_cache,
+     int file_io_pool_entry,
+     off64_t *chunk_offsets,
+     uint32_t *chunk_flags,
+     libewf_chunk_data_t **chunk_data,
+     int number_of_chunks,
+     libcerror_error_t **error )
+{
+	uint8_t *buffers[ LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS ];
+	size_t buffer_sizes[ LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS ];
+
+	static char *function       = "libewf_chunk_table_read_chunk_run";
+	ssize_t read_count          = 0;
+	int chunk_run_index         = 0;
+	int number_of_cached_chunks = 0;
+
+	if( chunk_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_chunks <= 0 )
+	 || ( number_of_chunks > LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of chunks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( chunk_run_index = 0;
+	     chunk_run_index < number_of_chunks;
+	     chunk_run_index++ )
+	{
+		if( chunk_data[ chunk_run_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing chunk data: %d.",
+			 function,
+			 chunk_run_index );
+
+			goto on_error;
 		}
-		else
+		buffers[ chunk_run_index ]      = chunk_data[ chunk_run_index ]->data;
+		buffer_sizes[ chunk_run_index ] = chunk_data[ chunk_run_index ]->data_size;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading %d chunks from file IO pool entry: %d at offset: %" PRIi64 "\n",
+		 function,
+		 number_of_chunks,
+		 file_io_pool_entry,
+		 chunk_offsets[ 0 ] );
+	}
+#endif
+	read_count = libbfio_pool_read_buffers_at_offset(
+		      file_io_pool,
+		      file_io_pool_entry,
+		      buffers,
+		      buffer_sizes,
+		      number_of_chunks,
+		      chunk_offsets[ 0 ],
+		      error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunks data at offset: %" PRIi64 " in file IO pool entry: %d.",
+		 function,
+		 chunk_offsets[ 0 ],
+		 file_io_pool_entry );
+
+		goto on_error;
+	}
+	for( chunk_run_index = 0;
+	     chunk_run_index < number_of_chunks;
+	     chunk_run_index++ )
+	{
+		/* A short read leaves the remaining chunks to the regular read path
+		 */
+		if( (size_t) read_count < buffer_sizes[ chunk_run_index ] )
 		{
-			chunk_size = next_offset - current_offset;
+			break;
 		}
-		if( chunk_size == 0 )
+		read_count -= (ssize_t) buffer_sizes[ chunk_run_index ];
+
+		if( ( chunk_flags[ chunk_run_index ] & LIBMFDATA_RANGE_FLAG_IS_COMPRESSED ) != 0 )
 		{
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: invalid chunk size value is zero.\n",
-				 function );
-			}
-			corrupted = 1;
+			chunk_data[ chunk_run_index ]->is_compressed = 1;
 		}
-		if( chunk_size > (uint32_t) INT32_MAX )
+		chunk_data[ chunk_run_index ]->is_packed = 1;
+
+		if( libfcache_cache_set_value_by_identifier(
+		     chunk_table_cache,
+		     file_io_pool_entry,
+		     chunk_offsets[ chunk_run_index ],
+		     0,
+		     (intptr_t *) chunk_data[ chunk_run_index ],
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_chunk_data_free,
+		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		     error ) != 1 )
 		{
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: invalid chunk size value exceeds maximum.\n",
-				 function );
-			}
-			corrupted = 1;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set chunk data at offset: %" PRIi64 " in cache.",
+			 function,
+			 chunk_offsets[ chunk_run_index ] );
+
+			goto on_error;
 		}
-		chunk_flags = 0;
+		chunk_data[ chunk_run_index ] = NULL;
+	}
+	number_of_cached_chunks = chunk_run_index;
 
-		if( is_compressed != 0 )
+	for( ;
+	     chunk_run_index < number_of_chunks;
+	     chunk_run_index++ )
+	{
+		if( libewf_chunk_data_free(
+		     &( chunk_data[ chunk_run_index ] ),
+		     error ) != 1 )
 		{
-			chunk_flags |= LIBMFDATA_RANGE_FLAG_IS_COMPRESSED;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk data: %d.",
+			 function,
+			 chunk_run_index );
+
+			goto on_error;
 		}
-		if( corrupted != 0 )
+	}
+	return( number_of_cached_chunks );
+
+on_error:
+	for( chunk_run_index = 0;
+	     chunk_run_index < number_of_chunks;
+	     chunk_run_index++ )
+	{
+		if( chunk_data[ chunk_run_index ] != NULL )
 		{
-			chunk_flags |= LIBEWF_RANGE_FLAG_IS_CORRUPTED;
+			libewf_chunk_data_free(
+			 &( chunk_data[ chunk_run_index ] ),
+			 NULL );
 		}
-		if( tainted != 0 )
+	}
+	return( -1 );
+}
+
+/* Reads the data of a batch of chunks into the chunk table cache
+ * Chunks in a chunk group that are stored consecutively in a segment file
+ * are read using a single vectored read. Chunks that are not part of a chunk group,
+ * are sparse, corrupted or already cached are skipped and left to the regular read path
+ * The batch ends at the first chunk of which the data range cannot be determined
+ * Returns the number of chunks read if successful or -1 on error
+ */
+int libewf_chunk_table_read_chunks(
+     libmfdata_list_t *chunk_table_list,
+     libbfio_pool_t *file_io_pool,
+     libfcache_cache_t *chunk_table_cache,
+     int chunk_index,
+     int number_of_chunks,
+     libcerror_error_t **error )
+{
+	libewf_chunk_data_t *chunk_data[ LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS ];
+	off64_t chunk_offsets[ LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS ];
+	uint32_t chunk_flags[ LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS ];
+
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libewf_chunk_table_read_chunks";
+	off64_t chunk_offset                 = 0;
+	off64_t run_end_offset               = 0;
+	size64_t chunk_size                  = 0;
+	uint32_t range_flags                 = 0;
+	int file_io_pool_entry               = 0;
+	int number_of_cached_chunks          = 0;
+	int number_of_chunks_read            = 0;
+	int number_of_run_chunks             = 0;
+	int result                           = 0;
+	int run_file_io_pool_entry           = -1;
+
+	if( chunk_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid chunk index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of chunks value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	while( number_of_chunks > 0 )
+	{
+		result = libewf_chunk_table_get_chunk_range(
+		          chunk_table_list,
+		          file_io_pool,
+		          chunk_index,
+		          &file_io_pool_entry,
+		          &chunk_offset,
+		          &chunk_size,
+		          &range_flags,
+		          error );
+
+		if( result != 1 )
 		{
-			chunk_flags |= LIBEWF_RANGE_FLAG_IS_TAINTED;
+			/* The regular read path handles missing chunks
+			 */
+			libcerror_error_free(
+			 error );
+
+			break;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( is_compressed == 0 )
+		result = libmfdata_list_is_group(
+		          chunk_table_list,
+		          chunk_index,
+		          error );
+
+		if( result == 1 )
 		{
-			chunk_type = "uncompressed";
+			if( ( file_io_pool_entry < 0 )
+			 || ( chunk_size == 0 )
+			 || ( chunk_size > (size64_t) SSIZE_MAX )
+			 || ( ( range_flags & ( LIBMFDATA_RANGE_FLAG_IS_SPARSE | LIBEWF_RANGE_FLAG_IS_CORRUPTED ) ) != 0 ) )
+			{
+				result = 0;
+			}
 		}
-		else
+		if( result == 1 )
 		{
-			chunk_type = "compressed";
+			result = libfcache_cache_get_value_by_identifier(
+			          chunk_table_cache,
+			          file_io_pool_entry,
+			          chunk_offset,
+			          0,
+			          &cache_value,
+			          error );
+
+			if( result != -1 )
+			{
+				result = ( result == 0 ) ? 1 : 0;
+			}
 		}
-		if( corrupted != 0 )
+		if( result == -1 )
 		{
-			remarks = " corrupted";
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if chunk: %d can be batched.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
 		}
-		else if( tainted != 0 )
+		if( ( number_of_run_chunks > 0 )
+		 && ( ( result == 0 )
+		  ||  ( file_io_pool_entry != run_file_io_pool_entry )
+		  ||  ( chunk_offset != run_end_offset )
+		  ||  ( number_of_run_chunks >= LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS ) ) )
+		{
+			number_of_cached_chunks = libewf_chunk_table_read_chunk_run(
+			                           file_io_pool,
+			                           chunk_table_cache,
+			                           run_file_io_pool_entry,
+			                           chunk_offsets,
+			                           chunk_flags,
+			                           chunk_data,
+			                           number_of_run_chunks,
+			                           error );
+
+			if( number_of_cached_chunks == -1 )
+			{
+				number_of_run_chunks = 0;
+
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read run of chunks.",
+				 function );
+
+				goto on_error;
+			}
+			number_of_chunks_read += number_of_cached_chunks;
+			number_of_run_chunks   = 0;
+		}
+		if( result == 1 )
 		{
-			remarks = " tainted";
+			chunk_data[ number_of_run_chunks ] = NULL;
+
+			if( libewf_chunk_data_initialize(
+			     &( chunk_data[ number_of_run_chunks ] ),
+			     (size_t) chunk_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create chunk: %d data.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			chunk_data[ number_of_run_chunks ]->data_size = (size_t) chunk_size;
+			chunk_offsets[ number_of_run_chunks ]         = chunk_offset;
+			chunk_flags[ number_of_run_chunks ]           = range_flags;
+
+			run_file_io_pool_entry = file_io_pool_entry;
+			run_end_offset         = chunk_offset + (off64_t) chunk_size;
+
+			number_of_run_chunks++;
 		}
-		else
+		chunk_index++;
+		number_of_chunks--;
+	}
+	if( number_of_run_chunks > 0 )
+	{
+		number_of_cached_chunks = libewf_chunk_table_read_chunk_run(
+		                           file_io_pool,
+		                           chunk_table_cache,
+		                           run_file_io_pool_entry,
+		                           chunk_offsets,
+		                           chunk_flags,
+		                           chunk_data,
+		                           number_of_run_chunks,
+		                           error );
+
+		if( number_of_cached_chunks == -1 )
 		{
-			remarks = "";
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read run of chunks.",
+			 function );
+
+			return( -1 );
 		}
+		number_of_chunks_read += number_of_cached_chunks;
+	}
+	return( number_of_chunks_read );
+
+on_error:
+	while( number_of_run_chunks > 0 )
+	{
+		number_of_run_chunks--;
+
+		libewf_chunk_data_free(
+		 &( chunk_data[ number_of_run_chunks ] ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Fills the chunk table from the offsets
+ * The offsets are stored in a chunk group, the data ranges of the individual
+ * chunks are determined when the chunks are read
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_table_fill(
+     libewf_chunk_table_t *chunk_table,
+     libmfdata_list_t *chunk_table_list,
+     int chunk_index,
+     int file_io_pool_entry,
+     libewf_section_t *table_section,
+     off64_t base_offset,
+     ewf_table_offset_t *table_offsets,
+     uint32_t number_of_offsets,
+     uint8_t tainted,
+     libcerror_error_t **error )
+{
+	libewf_chunk_group_t *chunk_group = NULL;
+	static char *function             = "libewf_chunk_table_fill";
+	off64_t previous_chunk_offset     = 0;
+	size64_t previous_chunk_size      = 0;
+	uint32_t previous_chunk_flags     = 0;
+	uint32_t table_offset_index       = 0;
+	int previous_file_io_pool_entry   = 0;
+	int result                        = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	off64_t chunk_offset              = 0;
+	size64_t chunk_size               = 0;
+	uint32_t chunk_flags              = 0;
+#endif
+
+	if( chunk_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_chunk_group_initialize(
+	     &chunk_group,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk group.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_chunk_group_set_offsets(
+	     chunk_group,
+	     chunk_index,
+	     file_io_pool_entry,
+	     table_section,
+	     base_offset,
+	     table_offsets,
+	     number_of_offsets,
+	     tainted,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set chunk group offsets.",
+		 function );
+
+		goto on_error;
+	}
+	for( table_offset_index = 0;
+	     table_offset_index < number_of_offsets;
+	     table_offset_index++ )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
+			if( libewf_chunk_group_get_chunk_range(
+			     chunk_group,
+			     chunk_index,
+			     &previous_file_io_pool_entry,
+			     &chunk_offset,
+			     &chunk_size,
+			     &chunk_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data range of chunk: %d.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
 			libcnotify_printf(
-			 "%s: %s chunk %d read with: base %" PRIi64 ", offset %" PRIu32 " and size %" PRIu32 "%s.\n",
+			 "%s: %s chunk %d read with: offset %" PRIi64 " and size %" PRIu64 "%s.\n",
 			 function,
-			 chunk_type,
+			 ( ( chunk_flags & LIBMFDATA_RANGE_FLAG_IS_COMPRESSED ) != 0 ) ? "compressed" : "uncompressed",
 			 chunk_index,
-			 base_offset,
-			 current_offset,
+			 chunk_offset,
 			 chunk_size,
-			 remarks );
+			 ( ( chunk_flags & LIBEWF_RANGE_FLAG_IS_CORRUPTED ) != 0 ) ? " corrupted" : ( ( tainted != 0 ) ? " tainted" : "" ) );
 		}
 #endif
 		result = libmfdata_list_is_group(
@@ -1116,31 +2490,9 @@ int libewf_chunk_table_fill(
 			 function,
 			 chunk_index );
 
-			return( -1 );
-		}
-		else if( result != 0 )
-		{
-			if( libmfdata_list_set_element_by_index(
-			     chunk_table_list,
-			     chunk_index,
-			     file_io_pool_entry,
-			     base_offset + current_offset,
-			     (size64_t) chunk_size,
-			     chunk_flags,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set chunk: %d.",
-				 function,
-				 chunk_index );
-
-				return( -1 );
-			}
+			goto on_error;
 		}
-		else
+		else if( result == 0 )
 		{
 			if( libmfdata_list_get_data_range_by_index(
 			     chunk_table_list,
@@ -1159,7 +2511,7 @@ int libewf_chunk_table_fill(
 				 function,
 				 chunk_index );
 
-				return( -1 );
+				goto on_error;
 			}
 			if( ( previous_chunk_flags & LIBEWF_RANGE_FLAG_IS_DELTA ) == 0 )
 			{
@@ -1171,237 +2523,50 @@ int libewf_chunk_table_fill(
 				 function,
 				 chunk_index );
 
-				return( -1 );
+				goto on_error;
 			}
 			/* No need to overwrite the data range of a delta chunk */
 		}
-		/* This is to compensate for the crappy > 2 GiB segment file solution in EnCase 6.7
-		 */
-		if( ( overflow == 0 )
-		 && ( ( current_offset + chunk_size ) > (uint32_t) INT32_MAX ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: chunk offset overflow at: %" PRIu32 ".\n",
-				 function,
-				 current_offset );
-			}
-#endif
-			overflow      = 1;
-			is_compressed = 0;
-		}
 		chunk_index++;
-
-		table_offset_index++;
-	}
-	byte_stream_copy_to_uint32_little_endian(
-	 table_offsets[ table_offset_index ].offset,
-	 stored_offset );
-
-	if( overflow == 0 )
-	{
-		is_compressed  = (uint8_t) ( stored_offset >> 31 );
-		current_offset = stored_offset & EWF_OFFSET_COMPRESSED_READ_MASK;
-	}
-	else
-	{
-		current_offset = stored_offset;
-	}
-	corrupted = 0;
-
-	/* There is no indication how large the last chunk is.
-	 * The only thing known is where it starts.
-	 * However it can be determined using the offset of the next section.
-	 * The size of the last chunk is determined by subtracting the last offset from the offset of the next section.
-	 *
-	 * The offset of the next section is either table_section->end_offset for original EWF and EWF-S01
-	 * or table_section->start_offset for other types of EWF
-	 */
-	last_chunk_offset = (off64_t) base_offset + current_offset;
-
-	if( last_chunk_offset > (off64_t) INT64_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid last chunk offset value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( last_chunk_offset < table_section->start_offset )
-	{
-		last_chunk_size = table_section->start_offset - last_chunk_offset;
-	}
-	else if( last_chunk_offset < table_section->end_offset )
-	{
-		last_chunk_size = table_section->end_offset - last_chunk_offset;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	else if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: invalid last chunk offset value exceeds table section end offset.\n",
-		 function );
-	}
-#endif
-	if( last_chunk_size <= 0 )
-	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: invalid last chunk size value is zero or less.\n",
-			 function );
-		}
-#endif
-		corrupted = 1;
-	}
-	if( last_chunk_size > (off64_t) INT32_MAX )
-	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: invalid last chunk size value exceeds maximum.\n",
-			 function );
-		}
-#endif
-		corrupted = 1;
-	}
-	chunk_flags = 0;
-
-	if( is_compressed != 0 )
-	{
-		chunk_flags |= LIBMFDATA_RANGE_FLAG_IS_COMPRESSED;
-	}
-	if( corrupted != 0 )
-	{
-		chunk_flags |= LIBEWF_RANGE_FLAG_IS_CORRUPTED;
-	}
-	if( tainted != 0 )
-	{
-		chunk_flags |= LIBEWF_RANGE_FLAG_IS_TAINTED;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
-	if( is_compressed == 0 )
-	{
-		chunk_type = "uncompressed";
-	}
-	else
-	{
-		chunk_type = "compressed";
-	}
-	if( corrupted != 0 )
-	{
-		remarks = " corrupted";
-	}
-	else if( tainted != 0 )
-	{
-		remarks = " tainted";
-	}
-	else
-	{
-		remarks = "";
-	}
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: %s last chunk %d read with: base %" PRIi64 ", offset %" PRIu32 " and calculated size %" PRIi64 "%s.\n",
-		 function,
-		 chunk_type,
-		 chunk_index,
-		 base_offset,
-		 current_offset,
-		 last_chunk_size,
-		 remarks );
+		 "\n" );
 	}
 #endif
-	result = libmfdata_list_is_group(
-		  chunk_table_list,
-		  chunk_index,
-		  error );
-
-	if( result == -1 )
+	/* The chunk group replaces a previously read chunk group of the same table section
+	 */
+	if( libfcache_cache_set_value_by_identifier(
+	     chunk_table->chunk_groups_cache,
+	     file_io_pool_entry,
+	     table_section->start_offset,
+	     0,
+	     (intptr_t *) chunk_group,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_chunk_group_free,
+	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if chunk: %d is a group.",
-		 function,
-		 chunk_index );
-
-		return( -1 );
-	}
-	else if( result != 0 )
-	{
-		if( libmfdata_list_set_element_by_index(
-		     chunk_table_list,
-		     chunk_index,
-		     file_io_pool_entry,
-		     last_chunk_offset,
-		     (size64_t) last_chunk_size,
-		     chunk_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set chunk: %d.",
-			 function,
-			 chunk_index );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set chunk group in cache.",
+		 function );
 
-			return( -1 );
-		}
+		goto on_error;
 	}
-	else
-	{
-		if( libmfdata_list_get_data_range_by_index(
-		     chunk_table_list,
-		     chunk_index,
-		     &previous_file_io_pool_entry,
-		     &previous_chunk_offset,
-		     &previous_chunk_size,
-		     &previous_chunk_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data range of chunk: %d.",
-			 function,
-			 chunk_index );
-
-			return( -1 );
-		}
-		if( ( previous_chunk_flags & LIBEWF_RANGE_FLAG_IS_DELTA ) == 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-			 "%s: unable to set data range of chunk: %d value already set.",
-			 function,
-			 chunk_index );
+	return( 1 );
 
-			return( -1 );
-		}
-		/* No need to overwrite the data range of a delta chunk */
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+on_error:
+	if( chunk_group != NULL )
 	{
-		libcnotify_printf(
-		 "\n" );
+		libewf_chunk_group_free(
+		 &chunk_group,
+		 NULL );
 	}
-#endif
-	return( 1 );
+	return( -1 );
 }
 
 /* Corrects the chunk table from the offsets
@@ -1419,29 +2584,31 @@ int libewf_chunk_table_correct(
      uint8_t tainted,
      libcerror_error_t **error )
 {
-	static char *function           = "libewf_chunk_table_correct";
-	off64_t last_chunk_offset       = 0;
-	off64_t last_chunk_size         = 0;
-	off64_t previous_chunk_offset   = 0;
-	size64_t previous_chunk_size    = 0;
-	uint32_t chunk_flags            = 0;
-	uint32_t chunk_size             = 0;
-	uint32_t current_offset         = 0;
-	uint32_t next_offset            = 0;
-	uint32_t previous_chunk_flags   = 0;
-	uint32_t stored_offset          = 0;
-	uint32_t table_offset_index     = 0;
-	uint8_t corrupted               = 0;
-	uint8_t is_compressed           = 0;
-	uint8_t mismatch                = 0;
-	uint8_t overflow                = 0;
-	uint8_t update_data_range       = 0;
-	int previous_file_io_pool_entry = 0;
-	int result                      = 0;
+	libewf_chunk_group_t *chunk_group = NULL;
+	static char *function             = "libewf_chunk_table_correct";
+	off64_t last_chunk_offset         = 0;
+	off64_t last_chunk_size           = 0;
+	off64_t previous_chunk_offset     = 0;
+	size64_t previous_chunk_size      = 0;
+	uint32_t chunk_flags              = 0;
+	uint32_t chunk_size               = 0;
+	uint32_t current_offset           = 0;
+	uint32_t next_offset              = 0;
+	uint32_t previous_chunk_flags     = 0;
+	uint32_t stored_offset            = 0;
+	uint32_t table_offset_index       = 0;
+	uint8_t corrupted                 = 0;
+	uint8_t is_chunk_group            = 0;
+	uint8_t is_compressed             = 0;
+	uint8_t mismatch                  = 0;
+	uint8_t overflow                  = 0;
+	uint8_t update_data_range         = 0;
+	int previous_file_io_pool_entry   = 0;
+	int result                        = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	char *chunk_type                = NULL;
-	char *remarks                   = NULL;
+	char *chunk_type                  = NULL;
+	char *remarks                     = NULL;
 #endif
 
 	if( chunk_table == NULL )
@@ -1634,29 +2801,73 @@ int libewf_chunk_table_correct(
 			 function,
 			 chunk_index );
 
-			return( -1 );
-		}
-		else if( result != 0 )
-		{
-			if( libmfdata_list_set_element_by_index(
-			     chunk_table_list,
-			     chunk_index,
-			     file_io_pool_entry,
-			     base_offset + current_offset,
-			     (size64_t) chunk_size,
-			     chunk_flags,
-			     error ) != 1 )
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			/* The chunk group contains the data ranges read from the table section
+			 */
+			result = libewf_chunk_table_get_chunk_group(
+			          chunk_table,
+			          chunk_table_list,
+			          chunk_index,
+			          &chunk_group,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk group of chunk: %d.",
+				 function,
+				 chunk_index );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				if( libmfdata_list_set_element_by_index(
+				     chunk_table_list,
+				     chunk_index,
+				     file_io_pool_entry,
+				     base_offset + current_offset,
+				     (size64_t) chunk_size,
+				     chunk_flags,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set chunk: %d.",
+					 function,
+					 chunk_index );
+
+					return( -1 );
+				}
+			}
+			else if( libewf_chunk_group_get_chunk_range(
+			          chunk_group,
+			          chunk_index,
+			          &previous_file_io_pool_entry,
+			          &previous_chunk_offset,
+			          &previous_chunk_size,
+			          &previous_chunk_flags,
+			          error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set chunk: %d.",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data range of chunk: %d from chunk group.",
 				 function,
 				 chunk_index );
 
 				return( -1 );
 			}
+			is_chunk_group = 1;
 		}
 		else
 		{
@@ -1679,92 +2890,112 @@ int libewf_chunk_table_correct(
 
 				return( -1 );
 			}
-			if( ( previous_chunk_flags & LIBEWF_RANGE_FLAG_IS_DELTA ) == 0 )
+			is_chunk_group = 0;
+			result         = 1;
+		}
+		if( ( result != 0 )
+		 && ( ( previous_chunk_flags & LIBEWF_RANGE_FLAG_IS_DELTA ) == 0 ) )
+		{
+			if( (off64_t) ( base_offset + current_offset ) != previous_chunk_offset )
 			{
-				if( (off64_t) ( base_offset + current_offset ) != previous_chunk_offset )
-				{
 #if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						libcnotify_printf(
-						 "%s: chunk: %d offset mismatch.\n",
-						 function,
-						 chunk_index );
-					}
-#endif
-					mismatch = 1;
-				}
-				else if( (size64_t) chunk_size != previous_chunk_size )
+				if( libcnotify_verbose != 0 )
 				{
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						libcnotify_printf(
-						 "%s: chunk: %d size mismatch.\n",
-						 function,
-						 chunk_index );
-					}
-#endif
-					mismatch = 1;
+					libcnotify_printf(
+					 "%s: chunk: %d offset mismatch.\n",
+					 function,
+					 chunk_index );
 				}
-				else if( ( chunk_flags & LIBMFDATA_RANGE_FLAG_IS_COMPRESSED )
-				      != ( previous_chunk_flags & LIBMFDATA_RANGE_FLAG_IS_COMPRESSED ) )
-				{
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						libcnotify_printf(
-						 "%s: chunk: %d compression flag mismatch.\n",
-						 function,
-						 chunk_index );
-					}
 #endif
-					mismatch = 1;
+				mismatch = 1;
+			}
+			else if( (size64_t) chunk_size != previous_chunk_size )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: chunk: %d size mismatch.\n",
+					 function,
+					 chunk_index );
 				}
-				else
+#endif
+				mismatch = 1;
+			}
+			else if( ( chunk_flags & LIBMFDATA_RANGE_FLAG_IS_COMPRESSED )
+			      != ( previous_chunk_flags & LIBMFDATA_RANGE_FLAG_IS_COMPRESSED ) )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
 				{
-					mismatch = 0;
+					libcnotify_printf(
+					 "%s: chunk: %d compression flag mismatch.\n",
+					 function,
+					 chunk_index );
 				}
-				update_data_range = 0;
+#endif
+				mismatch = 1;
+			}
+			else
+			{
+				mismatch = 0;
+			}
+			update_data_range = 0;
 
-				if( mismatch != 0 )
+			if( mismatch != 0 )
+			{
+				if( ( corrupted == 0 )
+				 && ( tainted == 0 ) )
 				{
-					if( ( corrupted == 0 )
-					 && ( tainted == 0 ) )
-					{
-						update_data_range = 1;
-					}
-					else if( ( ( previous_chunk_flags & LIBEWF_RANGE_FLAG_IS_CORRUPTED ) != 0 )
-					      && ( corrupted == 0 ) )
-					{
-						update_data_range = 1;
-					}
+					update_data_range = 1;
 				}
-				else if( ( previous_chunk_flags & LIBEWF_RANGE_FLAG_IS_TAINTED ) != 0 )
+				else if( ( ( previous_chunk_flags & LIBEWF_RANGE_FLAG_IS_CORRUPTED ) != 0 )
+				      && ( corrupted == 0 ) )
 				{
 					update_data_range = 1;
 				}
-				if( update_data_range != 0 )
+			}
+			else if( ( previous_chunk_flags & LIBEWF_RANGE_FLAG_IS_TAINTED ) != 0 )
+			{
+				update_data_range = 1;
+			}
+			if( update_data_range != 0 )
+			{
+				/* A chunk in a chunk group is corrected by setting it as an individual element
+				 */
+				if( is_chunk_group != 0 )
+				{
+					result = libmfdata_list_set_element_by_index(
+					          chunk_table_list,
+					          chunk_index,
+					          file_io_pool_entry,
+					          base_offset + current_offset,
+					          (size64_t) chunk_size,
+					          chunk_flags,
+					          error );
+				}
+				else
+				{
+					result = libmfdata_list_set_data_range_by_index(
+					          chunk_table_list,
+					          chunk_index,
+					          file_io_pool_entry,
+					          base_offset + current_offset,
+					          (size64_t) chunk_size,
+					          chunk_flags,
+					          error );
+				}
+				if( result != 1 )
 				{
-					if( libmfdata_list_set_data_range_by_index(
-					     chunk_table_list,
-					     chunk_index,
-					     file_io_pool_entry,
-					     base_offset + current_offset,
-					     (size64_t) chunk_size,
-					     chunk_flags,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-						 "%s: unable to set data range of chunk: %d.",
-						 function,
-						 chunk_index );
-
-						return( -1 );
-					}
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set data range of chunk: %d.",
+					 function,
+					 chunk_index );
+
+					return( -1 );
 				}
 			}
 		}
@@ -1916,9 +3147,9 @@ int libewf_chunk_table_correct(
 	}
 #endif
 	result = libmfdata_list_is_group(
-		  chunk_table_list,
-		  chunk_index,
-		  error );
+	          chunk_table_list,
+	          chunk_index,
+	          error );
 
 	if( result == -1 )
 	{
@@ -1934,25 +3165,69 @@ int libewf_chunk_table_correct(
 	}
 	else if( result != 0 )
 	{
-		if( libmfdata_list_set_element_by_index(
-		     chunk_table_list,
-		     chunk_index,
-		     file_io_pool_entry,
-		     last_chunk_offset,
-		     (size64_t) last_chunk_size,
-		     chunk_flags,
-		     error ) != 1 )
+		/* The chunk group contains the data ranges read from the table section
+		 */
+		result = libewf_chunk_table_get_chunk_group(
+		          chunk_table,
+		          chunk_table_list,
+		          chunk_index,
+		          &chunk_group,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set chunk: %d.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk group of chunk: %d.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			if( libmfdata_list_set_element_by_index(
+			     chunk_table_list,
+			     chunk_index,
+			     file_io_pool_entry,
+			     last_chunk_offset,
+			     (size64_t) last_chunk_size,
+			     chunk_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set chunk: %d.",
+				 function,
+				 chunk_index );
+
+				return( -1 );
+			}
+		}
+		else if( libewf_chunk_group_get_chunk_range(
+		          chunk_group,
+		          chunk_index,
+		          &previous_file_io_pool_entry,
+		          &previous_chunk_offset,
+		          &previous_chunk_size,
+		          &previous_chunk_flags,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data range of chunk: %d from chunk group.",
 			 function,
 			 chunk_index );
 
 			return( -1 );
 		}
+		is_chunk_group = 1;
 	}
 	else
 	{
@@ -1975,92 +3250,112 @@ int libewf_chunk_table_correct(
 
 			return( -1 );
 		}
-		if( ( previous_chunk_flags & LIBEWF_RANGE_FLAG_IS_DELTA ) == 0 )
+		is_chunk_group = 0;
+		result         = 1;
+	}
+	if( ( result != 0 )
+	 && ( ( previous_chunk_flags & LIBEWF_RANGE_FLAG_IS_DELTA ) == 0 ) )
+	{
+		if( (off64_t) ( base_offset + current_offset ) != previous_chunk_offset )
 		{
-				if( (off64_t) ( base_offset + current_offset ) != previous_chunk_offset )
-				{
 #if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						libcnotify_printf(
-						 "%s: chunk: %d offset mismatch.\n",
-						 function,
-						 chunk_index );
-					}
-#endif
-					mismatch = 1;
-			}
-			else if( (size64_t) chunk_size != previous_chunk_size )
+			if( libcnotify_verbose != 0 )
 			{
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: chunk: %d size mismatch.\n",
-					 function,
-					 chunk_index );
-				}
-#endif
-				mismatch = 1;
+				libcnotify_printf(
+				 "%s: chunk: %d offset mismatch.\n",
+				 function,
+				 chunk_index );
 			}
-			else if( ( chunk_flags & LIBMFDATA_RANGE_FLAG_IS_COMPRESSED )
-			      != ( previous_chunk_flags & LIBMFDATA_RANGE_FLAG_IS_COMPRESSED ) )
-			{
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: chunk: %d compression flag mismatch.\n",
-					 function,
-					 chunk_index );
-				}
 #endif
-				mismatch = 1;
+			mismatch = 1;
+		}
+		else if( (size64_t) chunk_size != previous_chunk_size )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: chunk: %d size mismatch.\n",
+				 function,
+				 chunk_index );
 			}
-			else
+#endif
+			mismatch = 1;
+		}
+		else if( ( chunk_flags & LIBMFDATA_RANGE_FLAG_IS_COMPRESSED )
+		      != ( previous_chunk_flags & LIBMFDATA_RANGE_FLAG_IS_COMPRESSED ) )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
 			{
-				mismatch = 0;
+				libcnotify_printf(
+				 "%s: chunk: %d compression flag mismatch.\n",
+				 function,
+				 chunk_index );
 			}
-			update_data_range = 0;
+#endif
+			mismatch = 1;
+		}
+		else
+		{
+			mismatch = 0;
+		}
+		update_data_range = 0;
 
-			if( mismatch != 0 )
+		if( mismatch != 0 )
+		{
+			if( ( corrupted == 0 )
+			 && ( tainted == 0 ) )
 			{
-				if( ( corrupted == 0 )
-				 && ( tainted == 0 ) )
-				{
-					update_data_range = 1;
-				}
-				else if( ( ( previous_chunk_flags & LIBEWF_RANGE_FLAG_IS_CORRUPTED ) != 0 )
-				      && ( corrupted == 0 ) )
-				{
-					update_data_range = 1;
-				}
+				update_data_range = 1;
 			}
-			else if( ( previous_chunk_flags & LIBEWF_RANGE_FLAG_IS_TAINTED ) != 0 )
+			else if( ( ( previous_chunk_flags & LIBEWF_RANGE_FLAG_IS_CORRUPTED ) != 0 )
+			      && ( corrupted == 0 ) )
 			{
 				update_data_range = 1;
 			}
-			if( update_data_range != 0 )
+		}
+		else if( ( previous_chunk_flags & LIBEWF_RANGE_FLAG_IS_TAINTED ) != 0 )
+		{
+			update_data_range = 1;
+		}
+		if( update_data_range != 0 )
+		{
+			/* A chunk in a chunk group is corrected by setting it as an individual element
+			 */
+			if( is_chunk_group != 0 )
 			{
-				if( libmfdata_list_set_data_range_by_index(
-				     chunk_table_list,
-				     chunk_index,
-				     file_io_pool_entry,
-				     base_offset + current_offset,
-				     (size64_t) chunk_size,
-				     chunk_flags,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set data range of chunk: %d.",
-					 function,
-					 chunk_index );
+				result = libmfdata_list_set_element_by_index(
+				          chunk_table_list,
+				          chunk_index,
+				          file_io_pool_entry,
+				          base_offset + current_offset,
+				          (size64_t) chunk_size,
+				          chunk_flags,
+				          error );
+			}
+			else
+			{
+				result = libmfdata_list_set_data_range_by_index(
+				          chunk_table_list,
+				          chunk_index,
+				          file_io_pool_entry,
+				          base_offset + current_offset,
+				          (size64_t) chunk_size,
+				          chunk_flags,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set data range of chunk: %d.",
+				 function,
+				 chunk_index );
 
-					return( -1 );
-				}
+				return( -1 );
 			}
 		}
 	}
@@ -27,6 +27,8 @@
 
 #include "libewf_libcerror.h"
 
+#include "libewf_chunk_data.h"
+#include "libewf_chunk_group.h"
 #include "libewf_io_handle.h"
 #include "libewf_libbfio.h"
 #include "libewf_libfcache.h"
@@ -62,6 +64,11 @@ struct libewf_chunk_table
 	/* The last chunk that was compared
 	 */
 	int last_chunk_compared;
+
+	/* The chunk groups cache
+	 * contains the offsets of the most recently used table sections
+	 */
+	libfcache_cache_t *chunk_groups_cache;
 };
 
 int libewf_chunk_table_initialize(
@@ -90,6 +97,15 @@ int libewf_chunk_table_read_chunk(
      uint8_t read_flags,
      libcerror_error_t **error );
 
+int libewf_chunk_table_read_chunk_data(
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     off64_t chunk_offset,
+     size64_t chunk_size,
+     uint32_t chunk_flags,
+     libewf_chunk_data_t **chunk_data,
+     libcerror_error_t **error );
+
 int libewf_chunk_table_read_offsets(
      intptr_t *io_handle,
      libbfio_pool_t *file_io_pool,
@@ -104,6 +120,76 @@ int libewf_chunk_table_read_offsets(
      uint8_t read_flags,
      libcerror_error_t **error );
 
+int libewf_chunk_table_get_chunk_group(
+     libewf_chunk_table_t *chunk_table,
+     libmfdata_list_t *chunk_table_list,
+     int chunk_index,
+     libewf_chunk_group_t **chunk_group,
+     libcerror_error_t **error );
+
+int libewf_chunk_table_read_chunk_group(
+     libewf_chunk_table_t *chunk_table,
+     libbfio_pool_t *file_io_pool,
+     libmfdata_list_t *chunk_table_list,
+     int chunk_index,
+     libewf_chunk_group_t **chunk_group,
+     libcerror_error_t **error );
+
+int libewf_chunk_table_get_chunk_data(
+     libmfdata_list_t *chunk_table_list,
+     libbfio_pool_t *file_io_pool,
+     libfcache_cache_t *chunk_table_cache,
+     int chunk_index,
+     libewf_chunk_data_t **chunk_data,
+     uint8_t read_flags,
+     libcerror_error_t **error );
+
+int libewf_chunk_table_get_chunk_range(
+     libmfdata_list_t *chunk_table_list,
+     libbfio_pool_t *file_io_pool,
+     int chunk_index,
+     int *file_io_pool_entry,
+     off64_t *chunk_offset,
+     size64_t *chunk_size,
+     uint32_t *chunk_flags,
+     libcerror_error_t **error );
+
+int libewf_chunk_table_get_uncached_chunk_range(
+     libmfdata_list_t *chunk_table_list,
+     libbfio_pool_t *file_io_pool,
+     libfcache_cache_t *chunk_table_cache,
+     int chunk_index,
+     int *file_io_pool_entry,
+     off64_t *chunk_offset,
+     size64_t *chunk_size,
+     uint32_t *chunk_flags,
+     libcerror_error_t **error );
+
+int libewf_chunk_table_set_cached_chunk_data(
+     libfcache_cache_t *chunk_table_cache,
+     int file_io_pool_entry,
+     off64_t chunk_offset,
+     libewf_chunk_data_t *chunk_data,
+     libcerror_error_t **error );
+
+int libewf_chunk_table_read_chunk_run(
+     libbfio_pool_t *file_io_pool,
+     libfcache_cache_t *chunk_table_cache,
+     int file_io_pool_entry,
+     off64_t *chunk_offsets,
+     uint32_t *chunk_flags,
+     libewf_chunk_data_t **chunk_data,
+     int number_of_chunks,
+     libcerror_error_t **error );
+
+int libewf_chunk_table_read_chunks(
+     libmfdata_list_t *chunk_table_list,
+     libbfio_pool_t *file_io_pool,
+     libfcache_cache_t *chunk_table_cache,
+     int chunk_index,
+     int number_of_chunks,
+     libcerror_error_t **error );
+
 int libewf_chunk_table_fill(
      libewf_chunk_table_t *chunk_table,
      libmfdata_list_t *chunk_table_list,
@@ -20,10 +20,12 @@
  */
 
 #include <common.h>
+#include <memory.h>
 #include <types.h>
 
 #include "libewf_libcerror.h"
 #include "libewf_libcnotify.h"
+#include "libewf_libcthreads.h"
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
@@ -33,14 +35,288 @@
 #include <zlib.h>
 #endif
 
+#if defined( HAVE_LIBDEFLATE )
+#include <libdeflate.h>
+#endif
+
 #include "libewf_compression.h"
+#include "libewf_definitions.h"
 
 #include "ewf_definitions.h"
 
-/* Compresses data, wraps zlib uncompress function
+/* Initialize the compression context
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_compression_context_initialize(
+     libewf_compression_context_t **compression_context,
+     int compression_backend,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_compression_context_initialize";
+
+	if( compression_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compression context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compression_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compression context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*compression_context = memory_allocate_structure(
+	                        libewf_compression_context_t );
+
+	if( *compression_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compression context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *compression_context,
+	     0,
+	     sizeof( libewf_compression_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear compression context.",
+		 function );
+
+		memory_free(
+		 *compression_context );
+
+		*compression_context = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBDEFLATE ) && defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *compression_context )->compressors_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressors mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *compression_context )->decompressors_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decompressors mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *compression_context )->compression_backend = compression_backend;
+
+	return( 1 );
+
+on_error:
+	if( *compression_context != NULL )
+	{
+#if defined( HAVE_LIBDEFLATE ) && defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *compression_context )->compressors_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *compression_context )->compressors_mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 *compression_context );
+
+		*compression_context = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees the compression context including the compressors and decompressors
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_compression_context_free(
+     libewf_compression_context_t **compression_context,
+     libcerror_error_t **error )
+{
+	static char *function  = "libewf_compression_context_free";
+	int result             = 1;
+
+#if defined( HAVE_LIBDEFLATE )
+	int compressor_index   = 0;
+	int decompressor_index = 0;
+#endif
+
+	if( compression_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compression context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compression_context != NULL )
+	{
+#if defined( HAVE_LIBDEFLATE )
+		for( compressor_index = 0;
+		     compressor_index < ( *compression_context )->number_of_compressors;
+		     compressor_index++ )
+		{
+			libdeflate_free_compressor(
+			 ( *compression_context )->compressors[ compressor_index ] );
+		}
+		for( decompressor_index = 0;
+		     decompressor_index < ( *compression_context )->number_of_decompressors;
+		     decompressor_index++ )
+		{
+			libdeflate_free_decompressor(
+			 ( *compression_context )->decompressors[ decompressor_index ] );
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *compression_context )->compressors_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressors mutex.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *compression_context )->decompressors_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decompressors mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+#endif /* defined( HAVE_LIBDEFLATE ) */
+
+		memory_free(
+		 *compression_context );
+
+		*compression_context = NULL;
+	}
+	return( result );
+}
+
+/* Compresses data
+ * Uses libdeflate if available and selected by the compression context and zlib otherwise
  * Returns 1 on success or -1 on error
  */
 int libewf_compress(
+     libewf_compression_context_t *compression_context,
+     uint8_t *compressed_data,
+     size_t *compressed_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_size,
+     int8_t compression_level,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBDEFLATE )
+	/* No compression is left to zlib since it produces stored blocks
+	 */
+	if( ( compression_context != NULL )
+	 && ( compression_context->compression_backend != LIBEWF_COMPRESSION_BACKEND_ZLIB )
+	 && ( compression_level != EWF_COMPRESSION_NONE ) )
+	{
+		return( libewf_compress_libdeflate(
+		         compression_context,
+		         compressed_data,
+		         compressed_size,
+		         uncompressed_data,
+		         uncompressed_size,
+		         compression_level,
+		         error ) );
+	}
+#endif
+	return( libewf_compress_zlib(
+	         compressed_data,
+	         compressed_size,
+	         uncompressed_data,
+	         uncompressed_size,
+	         compression_level,
+	         error ) );
+}
+
+/* Decompresses data
+ * Uses libdeflate if available and selected by the compression context and zlib otherwise
+ * Returns 1 on success, 0 on failure or -1 on error
+ */
+int libewf_decompress(
+     libewf_compression_context_t *compression_context,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_size,
+     uint8_t *compressed_data,
+     size_t compressed_size,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBDEFLATE )
+	if( ( compression_context != NULL )
+	 && ( compression_context->compression_backend != LIBEWF_COMPRESSION_BACKEND_ZLIB ) )
+	{
+		return( libewf_decompress_libdeflate(
+		         compression_context,
+		         uncompressed_data,
+		         uncompressed_size,
+		         compressed_data,
+		         compressed_size,
+		         error ) );
+	}
+#endif
+	return( libewf_decompress_zlib(
+	         uncompressed_data,
+	         uncompressed_size,
+	         compressed_data,
+	         compressed_size,
+	         error ) );
+}
+
+/* Compresses data, wraps zlib compress2 function
+ * Returns 1 on success or -1 on error
+ */
+int libewf_compress_zlib(
      uint8_t *compressed_data,
      size_t *compressed_size,
      uint8_t *uncompressed_data,
@@ -48,7 +324,7 @@ int libewf_compress(
      int8_t compression_level,
      libcerror_error_t **error )
 {
-	static char *function       = "libewf_compress";
+	static char *function       = "libewf_compress_zlib";
 	uLongf safe_compressed_size = 0;
 	int zlib_compression_level  = 0;
 	int result                  = 0;
@@ -189,14 +465,14 @@ int libewf_compress(
 /* Decompresses data, wraps zlib uncompress function
  * Returns 1 on success, 0 on failure or -1 on error
  */
-int libewf_decompress(
+int libewf_decompress_zlib(
      uint8_t *uncompressed_data,
      size_t *uncompressed_size,
      uint8_t *compressed_data,
      size_t compressed_size,
      libcerror_error_t **error )
 {
-	static char *function         = "libewf_decompress";
+	static char *function         = "libewf_decompress_zlib";
 	uLongf safe_uncompressed_size = 0;
 	int result                    = 0;
 
@@ -312,3 +588,671 @@ int libewf_decompress(
 	return( -1 );
 }
 
+#if defined( HAVE_LIBDEFLATE )
+
+/* Retrieves a libdeflate compressor for the compression level
+ * A compressor is not safe to share between threads, hence the compressor
+ * is removed from the compression context until it is released
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_compression_context_get_compressor(
+     libewf_compression_context_t *compression_context,
+     int libdeflate_compression_level,
+     struct libdeflate_compressor **compressor,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_compression_context_get_compressor";
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	*compressor = NULL;
+
+	if( compression_context != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     compression_context->compressors_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab compressors mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( ( compression_context->number_of_compressors > 0 )
+		 && ( compression_context->compressors_level == libdeflate_compression_level ) )
+		{
+			compression_context->number_of_compressors -= 1;
+
+			*compressor = compression_context->compressors[ compression_context->number_of_compressors ];
+
+			compression_context->compressors[ compression_context->number_of_compressors ] = NULL;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     compression_context->compressors_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release compressors mutex.",
+			 function );
+
+			if( *compressor != NULL )
+			{
+				libdeflate_free_compressor(
+				 *compressor );
+
+				*compressor = NULL;
+			}
+			return( -1 );
+		}
+#endif
+	}
+	if( *compressor == NULL )
+	{
+		*compressor = libdeflate_alloc_compressor(
+		               libdeflate_compression_level );
+
+		if( *compressor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create compressor.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Releases a libdeflate compressor retrieved by libewf_compression_context_get_compressor
+ * The compressor is kept in the compression context for reuse if possible and freed otherwise
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_compression_context_release_compressor(
+     libewf_compression_context_t *compression_context,
+     int libdeflate_compression_level,
+     struct libdeflate_compressor **compressor,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_compression_context_release_compressor";
+	int result            = 1;
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressor == NULL )
+	{
+		return( 1 );
+	}
+	if( compression_context != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     compression_context->compressors_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab compressors mutex.",
+			 function );
+
+			result = -1;
+		}
+		else
+#endif
+		{
+			/* The compression level of the handle normally does not change
+			 * hence only compressors of a single level are kept
+			 */
+			if( compression_context->number_of_compressors == 0 )
+			{
+				compression_context->compressors_level = libdeflate_compression_level;
+			}
+			if( ( compression_context->compressors_level == libdeflate_compression_level )
+			 && ( compression_context->number_of_compressors < LIBEWF_COMPRESSION_CONTEXT_MAXIMUM_NUMBER_OF_COMPRESSORS ) )
+			{
+				compression_context->compressors[ compression_context->number_of_compressors ] = *compressor;
+
+				compression_context->number_of_compressors += 1;
+
+				*compressor = NULL;
+			}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			if( libcthreads_mutex_release(
+			     compression_context->compressors_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release compressors mutex.",
+				 function );
+
+				result = -1;
+			}
+#endif
+		}
+	}
+	if( *compressor != NULL )
+	{
+		libdeflate_free_compressor(
+		 *compressor );
+
+		*compressor = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves a libdeflate decompressor
+ * A decompressor is not safe to share between threads, hence the decompressor
+ * is removed from the compression context until it is released
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_compression_context_get_decompressor(
+     libewf_compression_context_t *compression_context,
+     struct libdeflate_decompressor **decompressor,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_compression_context_get_decompressor";
+
+	if( decompressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompressor.",
+		 function );
+
+		return( -1 );
+	}
+	*decompressor = NULL;
+
+	if( compression_context != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     compression_context->decompressors_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab decompressors mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( compression_context->number_of_decompressors > 0 )
+		{
+			compression_context->number_of_decompressors -= 1;
+
+			*decompressor = compression_context->decompressors[ compression_context->number_of_decompressors ];
+
+			compression_context->decompressors[ compression_context->number_of_decompressors ] = NULL;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     compression_context->decompressors_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release decompressors mutex.",
+			 function );
+
+			if( *decompressor != NULL )
+			{
+				libdeflate_free_decompressor(
+				 *decompressor );
+
+				*decompressor = NULL;
+			}
+			return( -1 );
+		}
+#endif
+	}
+	if( *decompressor == NULL )
+	{
+		*decompressor = libdeflate_alloc_decompressor();
+
+		if( *decompressor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create decompressor.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Releases a libdeflate decompressor retrieved by libewf_compression_context_get_decompressor
+ * The decompressor is kept in the compression context for reuse if possible and freed otherwise
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_compression_context_release_decompressor(
+     libewf_compression_context_t *compression_context,
+     struct libdeflate_decompressor **decompressor,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_compression_context_release_decompressor";
+	int result            = 1;
+
+	if( decompressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decompressor == NULL )
+	{
+		return( 1 );
+	}
+	if( compression_context != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     compression_context->decompressors_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab decompressors mutex.",
+			 function );
+
+			result = -1;
+		}
+		else
+#endif
+		{
+			if( compression_context->number_of_decompressors < LIBEWF_COMPRESSION_CONTEXT_MAXIMUM_NUMBER_OF_DECOMPRESSORS )
+			{
+				compression_context->decompressors[ compression_context->number_of_decompressors ] = *decompressor;
+
+				compression_context->number_of_decompressors += 1;
+
+				*decompressor = NULL;
+			}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			if( libcthreads_mutex_release(
+			     compression_context->decompressors_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release decompressors mutex.",
+				 function );
+
+				result = -1;
+			}
+#endif
+		}
+	}
+	if( *decompressor != NULL )
+	{
+		libdeflate_free_decompressor(
+		 *decompressor );
+
+		*decompressor = NULL;
+	}
+	return( result );
+}
+
+/* Compresses data, wraps libdeflate zlib compress function
+ * The compressor is reused from the compression context if available
+ * Returns 1 on success or -1 on error
+ */
+int libewf_compress_libdeflate(
+     libewf_compression_context_t *compression_context,
+     uint8_t *compressed_data,
+     size_t *compressed_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_size,
+     int8_t compression_level,
+     libcerror_error_t **error )
+{
+	struct libdeflate_compressor *compressor = NULL;
+	static char *function                    = "libewf_compress_libdeflate";
+	size_t safe_compressed_size              = 0;
+	int libdeflate_compression_level         = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == uncompressed_data )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data buffer equals compressed data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Level 9 compresses about as well as the best compression of zlib
+	 * the higher libdeflate levels are considerably slower
+	 */
+	if( compression_level == EWF_COMPRESSION_DEFAULT )
+	{
+		libdeflate_compression_level = 1;
+	}
+	else if( compression_level == EWF_COMPRESSION_FAST )
+	{
+		libdeflate_compression_level = 1;
+	}
+	else if( compression_level == EWF_COMPRESSION_BEST )
+	{
+		libdeflate_compression_level = 9;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression level.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_compression_context_get_compressor(
+	     compression_context,
+	     libdeflate_compression_level,
+	     &compressor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressor.",
+		 function );
+
+		*compressed_size = 0;
+
+		return( -1 );
+	}
+	safe_compressed_size = libdeflate_zlib_compress(
+	                        compressor,
+	                        uncompressed_data,
+	                        uncompressed_size,
+	                        compressed_data,
+	                        *compressed_size );
+
+	if( safe_compressed_size == 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+		 	"%s: unable to write compressed data: target buffer too small.\n",
+			 function );
+		}
+#endif
+		/* Use the compress bound to determine the size of the compressed buffer
+		 */
+		*compressed_size = libdeflate_zlib_compress_bound(
+		                    compressor,
+		                    uncompressed_size );
+	}
+	if( libewf_compression_context_release_compressor(
+	     compression_context,
+	     libdeflate_compression_level,
+	     &compressor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release compressor.",
+		 function );
+
+		*compressed_size = 0;
+
+		return( -1 );
+	}
+	if( safe_compressed_size == 0 )
+	{
+		return( -1 );
+	}
+	*compressed_size = safe_compressed_size;
+
+	return( 1 );
+}
+
+/* Decompresses data, wraps libdeflate zlib decompress function
+ * The decompressor is reused from the compression context if available
+ * Returns 1 on success, 0 on failure or -1 on error
+ */
+int libewf_decompress_libdeflate(
+     libewf_compression_context_t *compression_context,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_size,
+     uint8_t *compressed_data,
+     size_t compressed_size,
+     libcerror_error_t **error )
+{
+	struct libdeflate_decompressor *decompressor = NULL;
+	static char *function                        = "libewf_decompress_libdeflate";
+	size_t safe_uncompressed_size                = 0;
+	enum libdeflate_result result                = LIBDEFLATE_SUCCESS;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == compressed_data )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data buffer equals uncompressed data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_compression_context_get_decompressor(
+	     compression_context,
+	     &decompressor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve decompressor.",
+		 function );
+
+		*uncompressed_size = 0;
+
+		return( -1 );
+	}
+	/* The zlib decompress function validates the Adler-32 checksum of the stream
+	 */
+	result = libdeflate_zlib_decompress(
+	          decompressor,
+	          compressed_data,
+	          compressed_size,
+	          uncompressed_data,
+	          *uncompressed_size,
+	          &safe_uncompressed_size );
+
+	if( libewf_compression_context_release_decompressor(
+	     compression_context,
+	     &decompressor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release decompressor.",
+		 function );
+
+		*uncompressed_size = 0;
+
+		return( -1 );
+	}
+	if( result == LIBDEFLATE_SUCCESS )
+	{
+		*uncompressed_size = safe_uncompressed_size;
+
+		return( 1 );
+	}
+	else if( result == LIBDEFLATE_BAD_DATA )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to read compressed data: data error.\n",
+			 function );
+		}
+#endif
+		*uncompressed_size = 0;
+
+		return( 0 );
+	}
+	else if( result == LIBDEFLATE_INSUFFICIENT_SPACE )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+		 	"%s: unable to read compressed data: target buffer too small.\n",
+			 function );
+		}
+#endif
+		/* Estimate that a factor 2 enlargement should suffice
+		 */
+		*uncompressed_size *= 2;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: libdeflate returned undefined error: %d.",
+		 function,
+		 result );
+
+		*uncompressed_size = 0;
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBDEFLATE ) */
+
@@ -25,13 +25,79 @@
 #include <common.h>
 #include <types.h>
 
+#if defined( HAVE_LIBDEFLATE )
+#include <libdeflate.h>
+#endif
+
 #include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The maximum number of libdeflate compressors kept for reuse
+ */
+#define LIBEWF_COMPRESSION_CONTEXT_MAXIMUM_NUMBER_OF_COMPRESSORS	128
+
+/* The maximum number of libdeflate decompressors kept for reuse
+ */
+#define LIBEWF_COMPRESSION_CONTEXT_MAXIMUM_NUMBER_OF_DECOMPRESSORS	128
+
+typedef struct libewf_compression_context libewf_compression_context_t;
+
+struct libewf_compression_context
+{
+	/* The compression backend
+	 */
+	int compression_backend;
+
+#if defined( HAVE_LIBDEFLATE )
+	/* The libdeflate compressors that are not in use
+	 */
+	struct libdeflate_compressor *compressors[ LIBEWF_COMPRESSION_CONTEXT_MAXIMUM_NUMBER_OF_COMPRESSORS ];
+
+	/* The number of libdeflate compressors that are not in use
+	 */
+	int number_of_compressors;
+
+	/* The libdeflate compression level of the compressors
+	 */
+	int compressors_level;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the compressors
+	 */
+	libcthreads_mutex_t *compressors_mutex;
+#endif
+
+	/* The libdeflate decompressors that are not in use
+	 */
+	struct libdeflate_decompressor *decompressors[ LIBEWF_COMPRESSION_CONTEXT_MAXIMUM_NUMBER_OF_DECOMPRESSORS ];
+
+	/* The number of libdeflate decompressors that are not in use
+	 */
+	int number_of_decompressors;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the decompressors
+	 */
+	libcthreads_mutex_t *decompressors_mutex;
+#endif
+#endif /* defined( HAVE_LIBDEFLATE ) */
+};
+
+int libewf_compression_context_initialize(
+     libewf_compression_context_t **compression_context,
+     int compression_backend,
+     libcerror_error_t **error );
+
+int libewf_compression_context_free(
+     libewf_compression_context_t **compression_context,
+     libcerror_error_t **error );
+
 int libewf_compress(
+     libewf_compression_context_t *compression_context,
      uint8_t *compressed_data,
      size_t *compressed_size,
      uint8_t *uncompressed_data,
@@ -40,12 +106,71 @@ int libewf_compress(
      libcerror_error_t **error );
 
 int libewf_decompress(
+     libewf_compression_context_t *compression_context,
      uint8_t *uncompressed_data,
      size_t *uncompressed_size,
      uint8_t *compressed_data,
      size_t compressed_size,
      libcerror_error_t **error );
 
+int libewf_compress_zlib(
+     uint8_t *compressed_data,
+     size_t *compressed_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_size,
+     int8_t compression_level,
+     libcerror_error_t **error );
+
+int libewf_decompress_zlib(
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_size,
+     uint8_t *compressed_data,
+     size_t compressed_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBDEFLATE )
+
+int libewf_compression_context_get_compressor(
+     libewf_compression_context_t *compression_context,
+     int libdeflate_compression_level,
+     struct libdeflate_compressor **compressor,
+     libcerror_error_t **error );
+
+int libewf_compression_context_release_compressor(
+     libewf_compression_context_t *compression_context,
+     int libdeflate_compression_level,
+     struct libdeflate_compressor **compressor,
+     libcerror_error_t **error );
+
+int libewf_compression_context_get_decompressor(
+     libewf_compression_context_t *compression_context,
+     struct libdeflate_decompressor **decompressor,
+     libcerror_error_t **error );
+
+int libewf_compression_context_release_decompressor(
+     libewf_compression_context_t *compression_context,
+     struct libdeflate_decompressor **decompressor,
+     libcerror_error_t **error );
+
+int libewf_compress_libdeflate(
+     libewf_compression_context_t *compression_context,
+     uint8_t *compressed_data,
+     size_t *compressed_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_size,
+     int8_t compression_level,
+     libcerror_error_t **error );
+
+int libewf_decompress_libdeflate(
+     libewf_compression_context_t *compression_context,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_size,
+     uint8_t *compressed_data,
+     size_t compressed_size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBDEFLATE ) */
+
 #if defined( __cplusplus )
 }
 #endif
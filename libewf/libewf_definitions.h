@@ -121,6 +121,16 @@ enum LIBEWF_COMPRESSION_LEVELS
 	LIBEWF_COMPRESSION_BEST					= 2,
 };
 
+/* The compression backend definitions
+ * The default backend is libdeflate if available and zlib otherwise
+ */
+enum LIBEWF_COMPRESSION_BACKENDS
+{
+	LIBEWF_COMPRESSION_BACKEND_DEFAULT			= 0,
+	LIBEWF_COMPRESSION_BACKEND_ZLIB				= 1,
+	LIBEWF_COMPRESSION_BACKEND_LIBDEFLATE			= 2,
+};
+
 /* The compression flags
  * bit 1	set to 1 for emtpy block compression
  *              detects empty blocks and stored them compressed, the compression
@@ -282,5 +292,25 @@ enum LIBEWF_SEGMENT_FILE_FLAGS
 #define LIBEWF_2_TIB						0x20000000000ULL
 #endif
 
+/* The minimum number of chunks the chunk table cache can hold
+ */
+#define LIBEWF_MINIMUM_NUMBER_OF_CACHED_CHUNKS			8
+
+/* The maximum number of chunk groups (read table sections) the chunk groups cache can hold
+ */
+#define LIBEWF_MAXIMUM_CACHE_ENTRIES_CHUNK_GROUPS		64
+
+/* The maximum number of chunks read in a single batch
+ */
+#define LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS			64
+
+/* The maximum number of threads used to scan the segment files
+ */
+#define LIBEWF_MAXIMUM_NUMBER_OF_SCAN_THREADS			8
+
+/* The size of the buffer used to combine the data written to a segment file
+ */
+#define LIBEWF_SEGMENT_FILE_WRITE_BUFFER_SIZE			( 4 * 1024 * 1024 )
+
 #endif
 
@@ -26,6 +26,14 @@
 
 #include "libewf_empty_block.h"
 
+#if defined( LIBEWF_EMPTY_BLOCK_HAVE_SSE2 )
+#include <emmintrin.h>
+#endif
+
+#if defined( LIBEWF_EMPTY_BLOCK_HAVE_AVX2 )
+#include <immintrin.h>
+#endif
+
 /* The largest primary (or scalar) available
  * supported by a single load and store instruction
  */
@@ -33,6 +41,8 @@ typedef unsigned long int libewf_aligned_t;
 
 /* Check for empty block
  * An emtpy block is a block that contains the same value for every byte
+ * The start and the end of the block are tested first since a block
+ * that is not empty most likely differs there
  * Returns 1 if block is empty, 0 if not or -1 on error
  */
 int libewf_empty_block_test(
@@ -40,11 +50,8 @@ int libewf_empty_block_test(
      size_t block_size,
      libcerror_error_t **error )
 {
-	libewf_aligned_t *aligned_block_iterator = NULL;
-	libewf_aligned_t *aligned_block_start    = NULL;
-	uint8_t *block_iterator                  = NULL;
-	uint8_t *block_start                     = NULL;
-	static char *function                    = "libewf_empty_block_test";
+	static char *function = "libewf_empty_block_test";
+	uint8_t byte_value    = 0;
 
 	if( block_buffer == NULL )
 	{
@@ -68,60 +75,296 @@ int libewf_empty_block_test(
 
 		return( -1 );
 	}
-	block_start    = (uint8_t *) block_buffer;
-	block_iterator = (uint8_t *) block_buffer + 1;
-	block_size    -= 1;
+	if( block_size <= 1 )
+	{
+		return( 1 );
+	}
+	byte_value = block_buffer[ 0 ];
 
+	if( block_size > ( 2 * LIBEWF_EMPTY_BLOCK_SAMPLE_SIZE ) )
+	{
+		if( libewf_empty_block_test_generic(
+		     block_buffer,
+		     LIBEWF_EMPTY_BLOCK_SAMPLE_SIZE,
+		     byte_value ) == 0 )
+		{
+			return( 0 );
+		}
+		if( libewf_empty_block_test_generic(
+		     &( block_buffer[ block_size - LIBEWF_EMPTY_BLOCK_SAMPLE_SIZE ] ),
+		     LIBEWF_EMPTY_BLOCK_SAMPLE_SIZE,
+		     byte_value ) == 0 )
+		{
+			return( 0 );
+		}
+		block_buffer += LIBEWF_EMPTY_BLOCK_SAMPLE_SIZE;
+		block_size   -= 2 * LIBEWF_EMPTY_BLOCK_SAMPLE_SIZE;
+	}
+#if defined( LIBEWF_EMPTY_BLOCK_HAVE_AVX2 )
+	if( libewf_empty_block_cpu_supports_avx2() != 0 )
+	{
+		return( libewf_empty_block_test_avx2(
+		         block_buffer,
+		         block_size,
+		         byte_value ) );
+	}
+#endif
+#if defined( LIBEWF_EMPTY_BLOCK_HAVE_SSE2 )
+	return( libewf_empty_block_test_sse2(
+	         block_buffer,
+	         block_size,
+	         byte_value ) );
+#else
+	return( libewf_empty_block_test_generic(
+	         block_buffer,
+	         block_size,
+	         byte_value ) );
+#endif
+}
+
+/* Determines if every byte of a block contains the byte value
+ * Compares 4 aligned words at a time
+ * Returns 1 if the block only contains the byte value or 0 if not
+ */
+int libewf_empty_block_test_generic(
+     const uint8_t *block_buffer,
+     size_t block_size,
+     uint8_t byte_value )
+{
+	const libewf_aligned_t *aligned_block_iterator = NULL;
+	libewf_aligned_t aligned_value                 = 0;
+	libewf_aligned_t difference                    = 0;
+
+	if( block_buffer == NULL )
+	{
+		return( 0 );
+	}
 	/* Only optimize for blocks larger than the alignment
 	 */
 	if( block_size > ( 2 * sizeof( libewf_aligned_t ) ) )
 	{
-		/* Align the block start
+		/* Align the block iterator
 		 */
-		while( ( (intptr_t) block_start % sizeof( libewf_aligned_t ) ) != 0 )
+		while( ( (intptr_t) block_buffer % sizeof( libewf_aligned_t ) ) != 0 )
 		{
-			if( *block_start != *block_iterator )
+			if( *block_buffer != byte_value )
 			{
 				return( 0 );
 			}
-			block_start    += 1;
-			block_iterator += 1;
-			block_size     -= 1;
+			block_buffer += 1;
+			block_size   -= 1;
 		}
-		/* Align the block iterator
+		/* Repeat the byte value in every byte of the aligned value
 		 */
-		while( ( (intptr_t) block_iterator % sizeof( libewf_aligned_t ) ) != 0 )
+		aligned_value = ( (libewf_aligned_t) -1 / 0xff ) * byte_value;
+
+		aligned_block_iterator = (const libewf_aligned_t *) block_buffer;
+
+		while( block_size >= ( 4 * sizeof( libewf_aligned_t ) ) )
 		{
-			if( *block_start != *block_iterator )
+			difference = ( aligned_block_iterator[ 0 ] ^ aligned_value )
+			           | ( aligned_block_iterator[ 1 ] ^ aligned_value )
+			           | ( aligned_block_iterator[ 2 ] ^ aligned_value )
+			           | ( aligned_block_iterator[ 3 ] ^ aligned_value );
+
+			if( difference != 0 )
 			{
 				return( 0 );
 			}
-			block_iterator += 1;
-			block_size     -= 1;
+			aligned_block_iterator += 4;
+			block_size             -= 4 * sizeof( libewf_aligned_t );
 		}
-		aligned_block_start    = (libewf_aligned_t *) block_start;
-		aligned_block_iterator = (libewf_aligned_t *) block_iterator;
-
-		while( block_size > sizeof( libewf_aligned_t ) )
+		while( block_size >= sizeof( libewf_aligned_t ) )
 		{
-			if( *aligned_block_start != *aligned_block_iterator )
+			if( *aligned_block_iterator != aligned_value )
 			{
 				return( 0 );
 			}
 			aligned_block_iterator += 1;
 			block_size             -= sizeof( libewf_aligned_t );
 		}
-		block_iterator = (uint8_t *) aligned_block_iterator;
+		block_buffer = (const uint8_t *) aligned_block_iterator;
 	}
 	while( block_size != 0 )
 	{
-		if( *block_start != *block_iterator )
+		if( *block_buffer != byte_value )
 		{
 			return( 0 );
 		}
-		block_iterator += 1;
-		block_size     -= 1;
+		block_buffer += 1;
+		block_size   -= 1;
 	}
 	return( 1 );
 }
 
+#if defined( LIBEWF_EMPTY_BLOCK_HAVE_SSE2 )
+
+/* Determines if every byte of a block contains the byte value using SSE2
+ * Compares 64 bytes at a time
+ * Returns 1 if the block only contains the byte value or 0 if not
+ */
+int libewf_empty_block_test_sse2(
+     const uint8_t *block_buffer,
+     size_t block_size,
+     uint8_t byte_value )
+{
+	__m128i difference = { 0 };
+	__m128i value      = { 0 };
+
+	if( block_buffer == NULL )
+	{
+		return( 0 );
+	}
+	value = _mm_set1_epi8(
+	         (char) byte_value );
+
+	while( block_size >= 64 )
+	{
+		difference = _mm_or_si128(
+		              _mm_or_si128(
+		               _mm_xor_si128(
+		                _mm_loadu_si128( (const __m128i *) block_buffer ),
+		                value ),
+		               _mm_xor_si128(
+		                _mm_loadu_si128( (const __m128i *) &( block_buffer[ 16 ] ) ),
+		                value ) ),
+		              _mm_or_si128(
+		               _mm_xor_si128(
+		                _mm_loadu_si128( (const __m128i *) &( block_buffer[ 32 ] ) ),
+		                value ),
+		               _mm_xor_si128(
+		                _mm_loadu_si128( (const __m128i *) &( block_buffer[ 48 ] ) ),
+		                value ) ) );
+
+		if( _mm_movemask_epi8(
+		     _mm_cmpeq_epi8(
+		      difference,
+		      _mm_setzero_si128() ) ) != 0xffff )
+		{
+			return( 0 );
+		}
+		block_buffer += 64;
+		block_size   -= 64;
+	}
+	while( block_size >= 16 )
+	{
+		difference = _mm_xor_si128(
+		              _mm_loadu_si128( (const __m128i *) block_buffer ),
+		              value );
+
+		if( _mm_movemask_epi8(
+		     _mm_cmpeq_epi8(
+		      difference,
+		      _mm_setzero_si128() ) ) != 0xffff )
+		{
+			return( 0 );
+		}
+		block_buffer += 16;
+		block_size   -= 16;
+	}
+	return( libewf_empty_block_test_generic(
+	         block_buffer,
+	         block_size,
+	         byte_value ) );
+}
+
+#endif /* defined( LIBEWF_EMPTY_BLOCK_HAVE_SSE2 ) */
+
+#if defined( LIBEWF_EMPTY_BLOCK_HAVE_AVX2 )
+
+/* Determines if the CPU and operating system support AVX2
+ * The result is determined once and cached, concurrent first calls store the same value
+ * Returns 1 if supported or 0 if not
+ */
+int libewf_empty_block_cpu_supports_avx2(
+     void )
+{
+	static int supports_avx2 = -1;
+
+	if( supports_avx2 == -1 )
+	{
+		__builtin_cpu_init();
+
+		if( __builtin_cpu_supports( "avx2" ) )
+		{
+			supports_avx2 = 1;
+		}
+		else
+		{
+			supports_avx2 = 0;
+		}
+	}
+	return( supports_avx2 );
+}
+
+/* Determines if every byte of a block contains the byte value using AVX2
+ * Compares 128 bytes at a time
+ * This function should only be called if libewf_empty_block_cpu_supports_avx2 returns 1
+ * Returns 1 if the block only contains the byte value or 0 if not
+ */
+__attribute__((target("avx2")))
+int libewf_empty_block_test_avx2(
+     const uint8_t *block_buffer,
+     size_t block_size,
+     uint8_t byte_value )
+{
+	__m256i difference = { 0 };
+	__m256i value      = { 0 };
+
+	if( block_buffer == NULL )
+	{
+		return( 0 );
+	}
+	value = _mm256_set1_epi8(
+	         (char) byte_value );
+
+	while( block_size >= 128 )
+	{
+		difference = _mm256_or_si256(
+		              _mm256_or_si256(
+		               _mm256_xor_si256(
+		                _mm256_loadu_si256( (const __m256i *) block_buffer ),
+		                value ),
+		               _mm256_xor_si256(
+		                _mm256_loadu_si256( (const __m256i *) &( block_buffer[ 32 ] ) ),
+		                value ) ),
+		              _mm256_or_si256(
+		               _mm256_xor_si256(
+		                _mm256_loadu_si256( (const __m256i *) &( block_buffer[ 64 ] ) ),
+		                value ),
+		               _mm256_xor_si256(
+		                _mm256_loadu_si256( (const __m256i *) &( block_buffer[ 96 ] ) ),
+		                value ) ) );
+
+		if( _mm256_testz_si256(
+		     difference,
+		     difference ) == 0 )
+		{
+			return( 0 );
+		}
+		block_buffer += 128;
+		block_size   -= 128;
+	}
+	while( block_size >= 32 )
+	{
+		difference = _mm256_xor_si256(
+		              _mm256_loadu_si256( (const __m256i *) block_buffer ),
+		              value );
+
+		if( _mm256_testz_si256(
+		     difference,
+		     difference ) == 0 )
+		{
+			return( 0 );
+		}
+		block_buffer += 32;
+		block_size   -= 32;
+	}
+	return( libewf_empty_block_test_generic(
+	         block_buffer,
+	         block_size,
+	         byte_value ) );
+}
+
+#endif /* defined( LIBEWF_EMPTY_BLOCK_HAVE_AVX2 ) */
+
@@ -31,11 +31,55 @@
 extern "C" {
 #endif
 
+/* SSE2 is part of the x86-64 instruction set
+ */
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define LIBEWF_EMPTY_BLOCK_HAVE_SSE2
+#endif
+
+/* AVX2 is selected at runtime which requires function specific target support of the compiler
+ */
+#if ( defined( __x86_64__ ) || defined( __i386__ ) ) \
+ && ( defined( __clang__ ) || ( defined( __GNUC__ ) && ( __GNUC__ >= 5 ) ) )
+#define LIBEWF_EMPTY_BLOCK_HAVE_AVX2
+#endif
+
+/* The number of bytes at the start and at the end of a block
+ * that are tested before the rest of the block
+ */
+#define LIBEWF_EMPTY_BLOCK_SAMPLE_SIZE		64
+
 int libewf_empty_block_test(
      const uint8_t *block_buffer,
      size_t block_size,
      libcerror_error_t **error );
 
+int libewf_empty_block_test_generic(
+     const uint8_t *block_buffer,
+     size_t block_size,
+     uint8_t byte_value );
+
+#if defined( LIBEWF_EMPTY_BLOCK_HAVE_SSE2 )
+
+int libewf_empty_block_test_sse2(
+     const uint8_t *block_buffer,
+     size_t block_size,
+     uint8_t byte_value );
+
+#endif /* defined( LIBEWF_EMPTY_BLOCK_HAVE_SSE2 ) */
+
+#if defined( LIBEWF_EMPTY_BLOCK_HAVE_AVX2 )
+
+int libewf_empty_block_cpu_supports_avx2(
+     void );
+
+int libewf_empty_block_test_avx2(
+     const uint8_t *block_buffer,
+     size_t block_size,
+     uint8_t byte_value );
+
+#endif /* defined( LIBEWF_EMPTY_BLOCK_HAVE_AVX2 ) */
+
 #if defined( __cplusplus )
 }
 #endif
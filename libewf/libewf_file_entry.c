@@ -1242,27 +1242,28 @@ int libewf_file_entry_get_utf16_hash_value_sha1(
 	return( result );
 }
 
-/* Reads data at the current offset
+/* Reads data at a specific offset
+ * The offset of the file entry is not changed
  * Returns the number of bytes read or -1 on error
  */
-ssize_t libewf_file_entry_read_buffer(
-         libewf_file_entry_t *file_entry,
+ssize_t libewf_internal_file_entry_read_buffer_at_offset(
+         libewf_internal_file_entry_t *internal_file_entry,
          void *buffer,
          size_t buffer_size,
+         off64_t offset,
          libcerror_error_t **error )
 {
-	libewf_internal_file_entry_t *internal_file_entry = NULL;
-	libewf_single_file_entry_t *single_file_entry     = NULL;
-	static char *function                             = "libewf_file_entry_read_buffer";
-	off64_t data_offset                               = 0;
-	off64_t duplicate_data_offset                     = 0;
-	size64_t data_size                                = 0;
-	size64_t size                                     = 0;
-	size_t read_size                                  = 0;
-	ssize_t read_count                                = 0;
-	uint32_t flags                                    = 0;
+	libewf_single_file_entry_t *single_file_entry = NULL;
+	static char *function                         = "libewf_internal_file_entry_read_buffer_at_offset";
+	off64_t data_offset                           = 0;
+	off64_t duplicate_data_offset                 = 0;
+	size64_t data_size                            = 0;
+	size64_t size                                 = 0;
+	size_t read_size                              = 0;
+	ssize_t read_count                            = 0;
+	uint32_t flags                                = 0;
 
-	if( file_entry == NULL )
+	if( internal_file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1273,8 +1274,6 @@ ssize_t libewf_file_entry_read_buffer(
 
 		return( -1 );
 	}
-	internal_file_entry = (libewf_internal_file_entry_t *) file_entry;
-
 	if( buffer == NULL )
 	{
 		libcerror_error_set(
@@ -1297,13 +1296,13 @@ ssize_t libewf_file_entry_read_buffer(
 
 		return( -1 );
 	}
-	if( internal_file_entry->offset < 0 )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid file entry - offset value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
 		 function );
 
 		return( -1 );
@@ -1424,48 +1423,36 @@ ssize_t libewf_file_entry_read_buffer(
 			return( -1 );
 		}
 	}
-	if( internal_file_entry->offset >= (off64_t) size )
+	if( offset >= (off64_t) size )
 	{
 		return( 0 );
 	}
-	if( (off64_t) ( internal_file_entry->offset + buffer_size ) > (off64_t) size )
+	if( (off64_t) ( offset + buffer_size ) > (off64_t) size )
 	{
-		buffer_size = (size_t) ( size - internal_file_entry->offset );
+		buffer_size = (size_t) ( size - offset );
 	}
 	if( ( flags & LIBEWF_FILE_ENTRY_FLAG_SPARSE_DATA ) == 0 )
 	{
-		data_offset += internal_file_entry->offset;
+		data_offset += offset;
 		read_size    = buffer_size;
 	}
 	else if( duplicate_data_offset >= 0 )
 	{
-		data_offset = duplicate_data_offset + internal_file_entry->offset;
+		data_offset = duplicate_data_offset + offset;
 		read_size   = buffer_size;
 	}
 	else
 	{
 		read_size = 1;
 	}
-	if( libewf_handle_seek_offset(
-	     (libewf_handle_t *) internal_file_entry->internal_handle,
-	     data_offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset: %" PRIi64 ".",
-		 function,
-		 data_offset );
-
-		return( -1 );
-	}
-	read_count = libewf_handle_read_buffer(
+	/* Read at the data offset without changing the offset of the handle
+	 * so that file entries can be read concurrently
+	 */
+	read_count = libewf_handle_read_random(
 		      (libewf_handle_t *) internal_file_entry->internal_handle,
 		      buffer,
 		      read_size,
+		      data_offset,
 		      error );
 
 	if( read_count <= -1 )
@@ -1474,13 +1461,12 @@ ssize_t libewf_file_entry_read_buffer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer.",
-		 function );
+		 "%s: unable to read buffer at offset: %" PRIi64 ".",
+		 function,
+		 data_offset );
 
 		return( -1 );
 	}
-	internal_file_entry->offset += read_count;
-
 	if( ( flags & LIBEWF_FILE_ENTRY_FLAG_SPARSE_DATA ) != 0 )
 	{
 		if( read_count == 1 )
@@ -1505,7 +1491,58 @@ ssize_t libewf_file_entry_read_buffer(
 	return( read_count );
 }
 
+/* Reads data at the current offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libewf_file_entry_read_buffer(
+         libewf_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libewf_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                             = "libewf_file_entry_read_buffer";
+	ssize_t read_count                                = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libewf_internal_file_entry_t *) file_entry;
+
+	read_count = libewf_internal_file_entry_read_buffer_at_offset(
+	              internal_file_entry,
+	              buffer,
+	              buffer_size,
+	              internal_file_entry->offset,
+	              error );
+
+	if( read_count <= -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry->offset += read_count;
+
+	return( read_count );
+}
+
 /* Reads data at a specific offset
+ * The data is read without using the current offset, which allows
+ * concurrent reads of the same file entry at different offsets
  * Returns the number of bytes read or -1 on error
  */
 ssize_t libewf_file_entry_read_random(
@@ -1515,28 +1552,28 @@ ssize_t libewf_file_entry_read_random(
          off64_t offset,
          libcerror_error_t **error )
 {
-	static char *function = "libewf_file_entry_read_random";
-	ssize_t read_count    = 0;
+	libewf_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                             = "libewf_file_entry_read_random";
+	ssize_t read_count                                = 0;
 
-	if( libewf_file_entry_seek_offset(
-	     file_entry,
-	     offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
 		 function );
 
 		return( -1 );
 	}
-	read_count = libewf_file_entry_read_buffer(
-	              file_entry,
+	internal_file_entry = (libewf_internal_file_entry_t *) file_entry;
+
+	read_count = libewf_internal_file_entry_read_buffer_at_offset(
+	              internal_file_entry,
 	              buffer,
 	              buffer_size,
+	              offset,
 	              error );
 
 	if( read_count <= -1 )
@@ -1545,11 +1582,14 @@ ssize_t libewf_file_entry_read_random(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer.",
-		 function );
+		 "%s: unable to read buffer at offset: %" PRIi64 ".",
+		 function,
+		 offset );
 
 		return( -1 );
 	}
+	internal_file_entry->offset = offset + read_count;
+
 	return( read_count );
 }
 
@@ -1860,11 +1900,12 @@ int libewf_file_entry_get_sub_file_entry_by_utf8_name(
      libewf_file_entry_t **sub_file_entry,
      libcerror_error_t **error )
 {
-	libewf_internal_file_entry_t *internal_file_entry = NULL;
-	libewf_single_file_entry_t *sub_single_file_entry = NULL;
-	libcdata_tree_node_t *sub_node                    = NULL;
-	static char *function                             = "libewf_file_entry_get_sub_file_entry_by_utf8_name";
-	int result                                        = 0;
+	libewf_single_file_tree_index_t *single_file_tree_index = NULL;
+	libewf_internal_file_entry_t *internal_file_entry       = NULL;
+	libewf_single_file_entry_t *sub_single_file_entry       = NULL;
+	libcdata_tree_node_t *sub_node                          = NULL;
+	static char *function                                   = "libewf_file_entry_get_sub_file_entry_by_utf8_name";
+	int result                                              = 0;
 
 	if( file_entry == NULL )
 	{
@@ -1912,7 +1953,22 @@ int libewf_file_entry_get_sub_file_entry_by_utf8_name(
 
 		return( -1 );
 	}
+	if( libewf_internal_handle_get_single_file_tree_index(
+	     internal_file_entry->internal_handle,
+	     &single_file_tree_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve single file tree index.",
+		 function );
+
+		return( -1 );
+	}
 	result = libewf_single_file_tree_get_sub_node_by_utf8_name(
+	          single_file_tree_index,
 	          internal_file_entry->file_entry_tree_node,
 	          utf8_string,
 	          utf8_string_length,
@@ -1964,16 +2020,17 @@ int libewf_file_entry_get_sub_file_entry_by_utf8_path(
      libewf_file_entry_t **sub_file_entry,
      libcerror_error_t **error )
 {
-	libewf_internal_file_entry_t *internal_file_entry = NULL;
-	libewf_single_file_entry_t *single_file_entry     = NULL;
-	libewf_single_file_entry_t *sub_single_file_entry = NULL;
-	libcdata_tree_node_t *node                        = NULL;
-	libcdata_tree_node_t *sub_node                    = NULL;
-	uint8_t *utf8_string_segment                      = NULL;
-	static char *function                             = "libewf_file_entry_get_sub_file_entry_by_utf8_path";
-	size_t utf8_string_index                          = 0;
-	size_t utf8_string_segment_length                 = 0;
-	int result                                        = 0;
+	libewf_single_file_tree_index_t *single_file_tree_index = NULL;
+	libewf_internal_file_entry_t *internal_file_entry       = NULL;
+	libewf_single_file_entry_t *single_file_entry           = NULL;
+	libewf_single_file_entry_t *sub_single_file_entry       = NULL;
+	libcdata_tree_node_t *node                              = NULL;
+	libcdata_tree_node_t *sub_node                          = NULL;
+	uint8_t *utf8_string_segment                            = NULL;
+	static char *function                                   = "libewf_file_entry_get_sub_file_entry_by_utf8_path";
+	size_t utf8_string_index                                = 0;
+	size_t utf8_string_segment_length                       = 0;
+	int result                                              = 0;
 
 	if( file_entry == NULL )
 	{
@@ -2057,6 +2114,20 @@ int libewf_file_entry_get_sub_file_entry_by_utf8_path(
 
 		return( -1 );
 	}
+	if( libewf_internal_handle_get_single_file_tree_index(
+	     internal_file_entry->internal_handle,
+	     &single_file_tree_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve single file tree index.",
+		 function );
+
+		return( -1 );
+	}
 	node = internal_file_entry->file_entry_tree_node;
 
 	if( utf8_string_length > 0 )
@@ -2103,6 +2174,7 @@ int libewf_file_entry_get_sub_file_entry_by_utf8_path(
 			return( -1 );
 		}
 		result = libewf_single_file_tree_get_sub_node_by_utf8_name(
+			  single_file_tree_index,
 			  node,
 			  utf8_string_segment,
 			  utf8_string_segment_length,
@@ -2159,11 +2231,12 @@ int libewf_file_entry_get_sub_file_entry_by_utf16_name(
      libewf_file_entry_t **sub_file_entry,
      libcerror_error_t **error )
 {
-	libewf_internal_file_entry_t *internal_file_entry = NULL;
-	libewf_single_file_entry_t *sub_single_file_entry = NULL;
-	libcdata_tree_node_t *sub_node                    = NULL;
-	static char *function                             = "libewf_file_entry_get_sub_file_entry_by_utf16_name";
-	int result                                        = 0;
+	libewf_single_file_tree_index_t *single_file_tree_index = NULL;
+	libewf_internal_file_entry_t *internal_file_entry       = NULL;
+	libewf_single_file_entry_t *sub_single_file_entry       = NULL;
+	libcdata_tree_node_t *sub_node                          = NULL;
+	static char *function                                   = "libewf_file_entry_get_sub_file_entry_by_utf16_name";
+	int result                                              = 0;
 
 	if( file_entry == NULL )
 	{
@@ -2211,7 +2284,22 @@ int libewf_file_entry_get_sub_file_entry_by_utf16_name(
 
 		return( -1 );
 	}
+	if( libewf_internal_handle_get_single_file_tree_index(
+	     internal_file_entry->internal_handle,
+	     &single_file_tree_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve single file tree index.",
+		 function );
+
+		return( -1 );
+	}
 	result = libewf_single_file_tree_get_sub_node_by_utf16_name(
+	          single_file_tree_index,
 	          internal_file_entry->file_entry_tree_node,
 	          utf16_string,
 	          utf16_string_length,
@@ -2263,16 +2351,17 @@ int libewf_file_entry_get_sub_file_entry_by_utf16_path(
      libewf_file_entry_t **sub_file_entry,
      libcerror_error_t **error )
 {
-	libewf_internal_file_entry_t *internal_file_entry = NULL;
-	libewf_single_file_entry_t *single_file_entry     = NULL;
-	libewf_single_file_entry_t *sub_single_file_entry = NULL;
-	libcdata_tree_node_t *node                        = NULL;
-	libcdata_tree_node_t *sub_node                    = NULL;
-	uint16_t *utf16_string_segment                    = NULL;
-	static char *function                             = "libewf_file_entry_get_sub_file_entry_by_utf16_path";
-	size_t utf16_string_index                         = 0;
-	size_t utf16_string_segment_length                = 0;
-	int result                                        = 0;
+	libewf_single_file_tree_index_t *single_file_tree_index = NULL;
+	libewf_internal_file_entry_t *internal_file_entry       = NULL;
+	libewf_single_file_entry_t *single_file_entry           = NULL;
+	libewf_single_file_entry_t *sub_single_file_entry       = NULL;
+	libcdata_tree_node_t *node                              = NULL;
+	libcdata_tree_node_t *sub_node                          = NULL;
+	uint16_t *utf16_string_segment                          = NULL;
+	static char *function                                   = "libewf_file_entry_get_sub_file_entry_by_utf16_path";
+	size_t utf16_string_index                               = 0;
+	size_t utf16_string_segment_length                      = 0;
+	int result                                              = 0;
 
 	if( file_entry == NULL )
 	{
@@ -2356,6 +2445,20 @@ int libewf_file_entry_get_sub_file_entry_by_utf16_path(
 
 		return( -1 );
 	}
+	if( libewf_internal_handle_get_single_file_tree_index(
+	     internal_file_entry->internal_handle,
+	     &single_file_tree_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve single file tree index.",
+		 function );
+
+		return( -1 );
+	}
 	node = internal_file_entry->file_entry_tree_node;
 
 	if( utf16_string_length > 0 )
@@ -2402,6 +2505,7 @@ int libewf_file_entry_get_sub_file_entry_by_utf16_path(
 			return( -1 );
 		}
 		result = libewf_single_file_tree_get_sub_node_by_utf16_name(
+			  single_file_tree_index,
 			  node,
 			  utf16_string_segment,
 			  utf16_string_segment_length,
@@ -183,6 +183,13 @@ int libewf_file_entry_get_utf16_hash_value_sha1(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+ssize_t libewf_internal_file_entry_read_buffer_at_offset(
+         libewf_internal_file_entry_t *internal_file_entry,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 LIBEWF_EXTERN \
 ssize_t libewf_file_entry_read_buffer(
          libewf_file_entry_t *file_entry,
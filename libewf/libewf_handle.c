@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
@@ -46,6 +47,7 @@
 #include "libewf_libcerror.h"
 #include "libewf_libcnotify.h"
 #include "libewf_libcstring.h"
+#include "libewf_libcthreads.h"
 #include "libewf_libfvalue.h"
 #include "libewf_libfcache.h"
 #include "libewf_libmfdata.h"
@@ -195,6 +197,47 @@ int libewf_handle_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_handle->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_handle->chunk_table_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize chunk table mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_handle->file_io_pool_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file IO pool mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	internal_handle->date_format                    = LIBEWF_DATE_FORMAT_CTIME;
 	internal_handle->maximum_number_of_open_handles = LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES;
 
@@ -205,6 +248,12 @@ int libewf_handle_initialize(
 on_error:
 	if( internal_handle != NULL )
 	{
+		if( internal_handle->acquiry_errors != NULL )
+		{
+			libcdata_range_list_free(
+			 &( internal_handle->acquiry_errors ),
+			 NULL );
+		}
 		if( internal_handle->tracks != NULL )
 		{
 			libcdata_array_free(
@@ -231,6 +280,20 @@ on_error:
 			 &( internal_handle->io_handle ),
 			 NULL );
 		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( internal_handle->chunk_table_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_handle->chunk_table_mutex ),
+			 NULL );
+		}
+		if( internal_handle->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( internal_handle->read_write_lock ),
+			 NULL );
+		}
+#endif
 		memory_free(
 		 internal_handle );
 	}
@@ -348,6 +411,59 @@ int libewf_handle_free(
 
 			result = -1;
 		}
+		if( internal_handle->index_filename != NULL )
+		{
+			memory_free(
+			 internal_handle->index_filename );
+		}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+		if( internal_handle->index_filename_wide != NULL )
+		{
+			memory_free(
+			 internal_handle->index_filename_wide );
+		}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_handle->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_handle->chunk_table_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk table mutex.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_handle->file_io_pool_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO pool mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 internal_handle );
 	}
@@ -446,6 +562,47 @@ int libewf_handle_clone(
 
 		goto on_error;
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_destination_handle->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize destination read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_destination_handle->chunk_table_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize destination chunk table mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_destination_handle->file_io_pool_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize destination file IO pool mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	if( libewf_io_handle_clone(
 	     &( internal_destination_handle->io_handle ),
 	     internal_source_handle->io_handle,
@@ -762,6 +919,9 @@ int libewf_handle_clone(
 		internal_destination_handle->hash_values_parsed = internal_source_handle->hash_values_parsed;
 	}
 	internal_destination_handle->maximum_number_of_open_handles = internal_source_handle->maximum_number_of_open_handles;
+	internal_destination_handle->maximum_cache_size             = internal_source_handle->maximum_cache_size;
+	internal_destination_handle->number_of_read_ahead_chunks    = internal_source_handle->number_of_read_ahead_chunks;
+	internal_destination_handle->use_memory_map                 = internal_source_handle->use_memory_map;
 	internal_destination_handle->date_format                    = internal_source_handle->date_format;
 
 	return( 1 );
@@ -885,6 +1045,26 @@ on_error:
 			 &( internal_destination_handle->io_handle ),
 			 NULL );
 		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( internal_destination_handle->file_io_pool_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_destination_handle->file_io_pool_mutex ),
+			 NULL );
+		}
+		if( internal_destination_handle->chunk_table_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_destination_handle->chunk_table_mutex ),
+			 NULL );
+		}
+		if( internal_destination_handle->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( internal_destination_handle->read_write_lock ),
+			 NULL );
+		}
+#endif
 		memory_free(
 		 internal_destination_handle );
 	}
@@ -950,6 +1130,7 @@ int libewf_handle_open(
 	static char *function                     = "libewf_handle_open";
 	size_t filename_length                    = 0;
 	int file_io_pool_entry                    = 0;
+	int maximum_number_of_open_handles        = 0;
 	int filename_iterator                     = 0;
 
 	if( handle == NULL )
@@ -1009,10 +1190,20 @@ int libewf_handle_open(
 
 		return( -1 );
 	}
+	maximum_number_of_open_handles = internal_handle->maximum_number_of_open_handles;
+
+	/* Memory mapped segment files are kept open, closing a file removes its mapping
+	 * while data returned by libewf_handle_get_memory_mapped_chunk_data can still be in use
+	 */
+	if( ( internal_handle->use_memory_map != 0 )
+	 && ( ( access_flags & LIBEWF_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		maximum_number_of_open_handles = LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES;
+	}
 	if( libbfio_pool_initialize(
 	     &file_io_pool,
 	     0,
-	     internal_handle->maximum_number_of_open_handles,
+	     maximum_number_of_open_handles,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1077,6 +1268,57 @@ int libewf_handle_open(
 				goto on_error;
 			}
 #endif
+			if( ( access_flags & LIBEWF_ACCESS_FLAG_WRITE ) != 0 )
+			{
+				if( libbfio_file_set_write_buffer_size(
+				     file_io_handle,
+				     LIBEWF_SEGMENT_FILE_WRITE_BUFFER_SIZE,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set write buffer size in file IO handle.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( internal_handle->io_handle->drop_cached_data != 0 )
+			{
+				if( libbfio_file_set_drop_cached_data(
+				     file_io_handle,
+				     1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set drop cached data in file IO handle.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( internal_handle->use_memory_map != 0 )
+			{
+				if( libbfio_file_set_use_memory_map(
+				     file_io_handle,
+				     1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set use memory map in file IO handle.",
+					 function );
+
+					goto on_error;
+				}
+			}
 			if( libbfio_file_set_name(
 			     file_io_handle,
 			     filenames[ filename_iterator ],
@@ -1283,6 +1525,11 @@ int libewf_handle_open(
 			goto on_error;
 		}
 	}
+	/* The file IO pool is marked as created in the library before opening
+	 * so that its file IO handles can be scanned concurrently
+	 */
+	internal_handle->file_io_pool_created_in_library = 1;
+
 	if( libewf_handle_open_file_io_pool(
 	     handle,
 	     file_io_pool,
@@ -1298,11 +1545,11 @@ int libewf_handle_open(
 
 		goto on_error;
 	}
-	internal_handle->file_io_pool_created_in_library = 1;
-
 	return( 1 );
 
 on_error:
+	internal_handle->file_io_pool_created_in_library = 0;
+
 	if( internal_handle->delta_segment_table != NULL )
 	{
 		libewf_segment_table_free(
@@ -1352,6 +1599,7 @@ int libewf_handle_open_wide(
 	static char *function                     = "libewf_handle_open_wide";
 	size_t filename_length                    = 0;
 	int file_io_pool_entry                    = 0;
+	int maximum_number_of_open_handles        = 0;
 	int filename_iterator                     = 0;
 
 	if( handle == NULL )
@@ -1411,10 +1659,20 @@ int libewf_handle_open_wide(
 
 		return( -1 );
 	}
+	maximum_number_of_open_handles = internal_handle->maximum_number_of_open_handles;
+
+	/* Memory mapped segment files are kept open, closing a file removes its mapping
+	 * while data returned by libewf_handle_get_memory_mapped_chunk_data can still be in use
+	 */
+	if( ( internal_handle->use_memory_map != 0 )
+	 && ( ( access_flags & LIBEWF_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		maximum_number_of_open_handles = LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES;
+	}
 	if( libbfio_pool_initialize(
 	     &file_io_pool,
 	     0,
-	     internal_handle->maximum_number_of_open_handles,
+	     maximum_number_of_open_handles,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1479,6 +1737,57 @@ int libewf_handle_open_wide(
 				goto on_error;
 			}
 #endif
+			if( ( access_flags & LIBEWF_ACCESS_FLAG_WRITE ) != 0 )
+			{
+				if( libbfio_file_set_write_buffer_size(
+				     file_io_handle,
+				     LIBEWF_SEGMENT_FILE_WRITE_BUFFER_SIZE,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set write buffer size in file IO handle.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( internal_handle->io_handle->drop_cached_data != 0 )
+			{
+				if( libbfio_file_set_drop_cached_data(
+				     file_io_handle,
+				     1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set drop cached data in file IO handle.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( internal_handle->use_memory_map != 0 )
+			{
+				if( libbfio_file_set_use_memory_map(
+				     file_io_handle,
+				     1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set use memory map in file IO handle.",
+					 function );
+
+					goto on_error;
+				}
+			}
 			if( libbfio_file_set_name_wide(
 			     file_io_handle,
 			     filenames[ filename_iterator ],
@@ -1685,6 +1994,11 @@ int libewf_handle_open_wide(
 			goto on_error;
 		}
 	}
+	/* The file IO pool is marked as created in the library before opening
+	 * so that its file IO handles can be scanned concurrently
+	 */
+	internal_handle->file_io_pool_created_in_library = 1;
+
 	if( libewf_handle_open_file_io_pool(
 	     handle,
 	     file_io_pool,
@@ -1700,11 +2014,11 @@ int libewf_handle_open_wide(
 
 		goto on_error;
 	}
-	internal_handle->file_io_pool_created_in_library = 1;
-
 	return( 1 );
 
 on_error:
+	internal_handle->file_io_pool_created_in_library = 0;
+
 	if( internal_handle->delta_segment_table != NULL )
 	{
 		libewf_segment_table_free(
@@ -2363,6 +2677,7 @@ int libewf_handle_open_file_io_pool(
 		if( libewf_handle_open_read_segment_files(
 		     internal_handle,
 		     file_io_pool,
+		     access_flags,
 		     chunk_table,
 		     error ) != 1 )
 		{
@@ -2540,9 +2855,47 @@ int libewf_handle_open_file_io_pool(
 			goto on_error;
 		}
 	}
+	if( libewf_internal_handle_resize_chunk_table_cache(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize chunk table cache.",
+		 function );
+
+		goto on_error;
+	}
 	internal_handle->io_handle->access_flags = access_flags;
 	internal_handle->file_io_pool            = file_io_pool;
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Read-ahead is only used when the handle is opened for reading only
+	 * the read-ahead thread is started after the file IO pool has been set
+	 */
+	if( ( internal_handle->number_of_read_ahead_chunks > 0 )
+	 && ( ( access_flags & LIBEWF_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		if( libewf_internal_handle_read_ahead_start(
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to start read-ahead.",
+			 function );
+
+			internal_handle->io_handle->access_flags = 0;
+			internal_handle->file_io_pool            = NULL;
+
+			goto on_error;
+		}
+	}
+#endif
 	return( 1 );
 
 on_error:
@@ -2621,22 +2974,33 @@ on_error:
 int libewf_handle_open_read_segment_files(
      libewf_internal_handle_t *internal_handle,
      libbfio_pool_t *file_io_pool,
+     int access_flags,
      libewf_chunk_table_t *chunk_table,
      libcerror_error_t **error )
 {
-	libewf_section_t *section           = NULL;
-	libewf_segment_file_t *segment_file = NULL;
-	static char *function               = "libewf_handle_open_read_segment_files";
-	off64_t section_offset              = 0;
-	size64_t maximum_segment_size       = 0;
-	size64_t segment_file_size          = 0;
-	ssize_t read_count                  = 0;
-	int file_io_pool_entry              = 0;
-	int number_of_segment_files         = 0;
-	int known_section                   = 0;
-	int last_section                    = 0;
-	int last_segment_file               = 0;
-	int segment_files_list_index        = 0;
+	libcdata_array_t *segment_file_scans_array      = NULL;
+	libewf_index_file_t *index_file                 = NULL;
+	libewf_index_file_segment_t *index_file_segment = NULL;
+	libewf_section_t *section                       = NULL;
+	libewf_segment_file_t *segment_file             = NULL;
+	libewf_segment_file_scan_t *segment_file_scan   = NULL;
+	static char *function                           = "libewf_handle_open_read_segment_files";
+	off64_t section_offset                          = 0;
+	size64_t maximum_segment_size                   = 0;
+	size64_t segment_file_size                      = 0;
+	ssize_t read_count                              = 0;
+	int64_t modification_time                       = 0;
+	uint32_t number_of_offsets                      = 0;
+	int file_io_pool_entry                          = 0;
+	int number_of_segment_files                     = 0;
+	int known_section                               = 0;
+	int last_chunk                                  = 0;
+	int last_section                                = 0;
+	int last_segment_file                           = 0;
+	int result                                      = 0;
+	int section_index                               = 0;
+	int segment_files_list_index                    = 0;
+	int use_index_file                              = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -2718,9 +3082,78 @@ int libewf_handle_open_read_segment_files(
 
 		goto on_error;
 	}
-	for( segment_files_list_index = 0;
-	     segment_files_list_index < number_of_segment_files;
-	     segment_files_list_index++ )
+	/* The index file is only used when the segment files are opened for reading only
+	 * and the file IO pool was created by the library, since the modification time
+	 * of the segment files can only be determined for file IO handles
+	 */
+	if( ( ( internal_handle->index_filename != NULL )
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	  || ( internal_handle->index_filename_wide != NULL )
+#endif
+	  )
+	 && ( ( access_flags & LIBEWF_ACCESS_FLAG_WRITE ) == 0 )
+	 && ( internal_handle->file_io_pool_created_in_library != 0 ) )
+	{
+		if( libewf_index_file_initialize(
+		     &index_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create index file.",
+			 function );
+
+			goto on_error;
+		}
+		use_index_file = libewf_internal_handle_read_index_file(
+		                  internal_handle,
+		                  file_io_pool,
+		                  index_file,
+		                  error );
+
+		if( use_index_file == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read index file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Only the file IO handles created by the library are known to be safe
+	 * to clone and read from other threads
+	 */
+	if( ( use_index_file == 0 )
+	 && ( internal_handle->file_io_pool_created_in_library != 0 )
+	 && ( number_of_segment_files > 1 ) )
+	{
+		if( libewf_internal_handle_scan_segment_files(
+		     internal_handle,
+		     file_io_pool,
+		     number_of_segment_files,
+		     &segment_file_scans_array,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to scan segment files.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	for( segment_files_list_index = 0;
+	     segment_files_list_index < number_of_segment_files;
+	     segment_files_list_index++ )
 	{
 		if( libmfdata_file_list_get_file_by_index(
 		     internal_handle->segment_files_list,
@@ -2776,6 +3209,32 @@ int libewf_handle_open_read_segment_files(
 				goto on_error;
 			}
 		}
+		if( segment_file_scans_array != NULL )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     segment_file_scans_array,
+			     segment_files_list_index,
+			     (intptr_t **) &segment_file_scan,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve segment file scan: %d from array.",
+				 function,
+				 segment_files_list_index );
+
+				goto on_error;
+			}
+			/* A segment file that could not be scanned is read without the scan
+			 */
+			if( ( segment_file_scan != NULL )
+			 && ( segment_file_scan->result != 1 ) )
+			{
+				segment_file_scan = NULL;
+			}
+		}
 		if( libewf_segment_file_initialize(
 		     &segment_file,
 		     error ) != 1 )
@@ -2789,12 +3248,48 @@ int libewf_handle_open_read_segment_files(
 
 			goto on_error;
 		}
-		read_count = libewf_segment_file_read_file_header(
-			      segment_file,
-			      file_io_pool,
-			      file_io_pool_entry,
-			      error );
+		if( use_index_file != 0 )
+		{
+			if( libewf_index_file_get_segment(
+			     index_file,
+			     segment_files_list_index,
+			     &index_file_segment,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve segment: %d from index file.",
+				 function,
+				 segment_files_list_index );
+
+				libewf_segment_file_free(
+				 &segment_file,
+				 NULL );
+
+				goto on_error;
+			}
+			segment_file->type           = index_file_segment->type;
+			segment_file->segment_number = index_file_segment->segment_number;
+
+			read_count = (ssize_t) sizeof( ewf_file_header_t );
+		}
+		else if( segment_file_scan != NULL )
+		{
+			segment_file->type           = segment_file_scan->type;
+			segment_file->segment_number = segment_file_scan->segment_number;
 
+			read_count = (ssize_t) sizeof( ewf_file_header_t );
+		}
+		else
+		{
+			read_count = libewf_segment_file_read_file_header(
+				      segment_file,
+				      file_io_pool,
+				      file_io_pool_entry,
+				      error );
+		}
 		if( read_count < 0 )
 		{
 			libcerror_error_set(
@@ -2868,7 +3363,44 @@ int libewf_handle_open_read_segment_files(
 		}
 		/* The segment file is now handled by the segment files list
 		 */
+		if( ( index_file != NULL )
+		 && ( use_index_file == 0 ) )
+		{
+			if( libewf_index_file_get_modification_time(
+			     file_io_pool,
+			     file_io_pool_entry,
+			     &modification_time,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve modification time of file IO pool entry: %d.",
+				 function,
+				 file_io_pool_entry );
+
+				goto on_error;
+			}
+			if( libewf_index_file_append_segment(
+			     index_file,
+			     segment_file,
+			     segment_file_size,
+			     modification_time,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append segment to index file.",
+				 function );
+
+				goto on_error;
+			}
+		}
 		section_offset = (off64_t) read_count;
+		section_index  = 0;
 		last_section   = 0;
 
 		while( (size64_t) section_offset < segment_file_size )
@@ -2886,12 +3418,144 @@ int libewf_handle_open_read_segment_files(
 
 				goto on_error;
 			}
-			read_count = libewf_section_start_read(
-			              section,
-			              file_io_pool,
-			              file_io_pool_entry,
-			              section_offset,
-			              error );
+			number_of_offsets = 0;
+
+			if( index_file_segment != NULL )
+			{
+				result = libewf_index_file_segment_get_section(
+				          index_file_segment,
+				          section_index,
+				          section,
+				          &number_of_offsets,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve section: %d from index file.",
+					 function,
+					 section_index );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					libewf_section_free(
+					 &section,
+					 NULL );
+
+					break;
+				}
+				/* The section data is read from the current offset
+				 */
+				if( libbfio_pool_seek_offset(
+				     file_io_pool,
+				     file_io_pool_entry,
+				     section->start_offset + sizeof( ewf_section_start_t ),
+				     SEEK_SET,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_SEEK_FAILED,
+					 "%s: unable to seek section data offset.",
+					 function );
+
+					goto on_error;
+				}
+				read_count = (ssize_t) sizeof( ewf_section_start_t );
+			}
+			else
+			{
+				if( segment_file_scan != NULL )
+				{
+					result = libewf_segment_file_scan_get_section(
+					          segment_file_scan,
+					          section_index,
+					          section,
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve section: %d from segment file scan.",
+						 function,
+						 section_index );
+
+						goto on_error;
+					}
+					/* The remainder of the segment file is read without the scan
+					 * when the scanned sections are exhausted or no longer match
+					 * so that corruption is detected and reported as before
+					 */
+					else if( ( result == 0 )
+					      || ( section->start_offset != section_offset ) )
+					{
+						segment_file_scan = NULL;
+					}
+					else
+					{
+						/* The section data is read from the current offset
+						 */
+						if( libbfio_pool_seek_offset(
+						     file_io_pool,
+						     file_io_pool_entry,
+						     section->start_offset + sizeof( ewf_section_start_t ),
+						     SEEK_SET,
+						     error ) == -1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_IO,
+							 LIBCERROR_IO_ERROR_SEEK_FAILED,
+							 "%s: unable to seek section data offset.",
+							 function );
+
+							goto on_error;
+						}
+						read_count = (ssize_t) sizeof( ewf_section_start_t );
+					}
+				}
+				if( segment_file_scan == NULL )
+				{
+					read_count = libewf_section_start_read(
+					              section,
+					              file_io_pool,
+					              file_io_pool_entry,
+					              section_offset,
+					              error );
+
+					/* The section data is read from the current offset
+					 */
+					if( read_count != -1 )
+					{
+						if( libbfio_pool_seek_offset(
+						     file_io_pool,
+						     file_io_pool_entry,
+						     section->start_offset + sizeof( ewf_section_start_t ),
+						     SEEK_SET,
+						     error ) == -1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_IO,
+							 LIBCERROR_IO_ERROR_SEEK_FAILED,
+							 "%s: unable to seek section data offset.",
+							 function );
+
+							goto on_error;
+						}
+					}
+				}
+			}
+			section_index++;
 
 			if( read_count == -1 )
 			{
@@ -3070,17 +3734,38 @@ int libewf_handle_open_read_segment_files(
 					  (void *) "table",
 					  5 ) == 0 )
 				{
-					read_count = libewf_segment_file_read_table_section(
-						      segment_file,
-						      section,
-						      internal_handle->io_handle,
-						      file_io_pool,
-						      file_io_pool_entry,
-						      internal_handle->media_values,
-						      chunk_table,
-						      internal_handle->chunk_table_list,
-						      error );
-
+					if( index_file_segment != NULL )
+					{
+						if( libewf_segment_file_append_chunk_group(
+						     segment_file,
+						     section,
+						     file_io_pool_entry,
+						     internal_handle->media_values,
+						     chunk_table,
+						     internal_handle->chunk_table_list,
+						     number_of_offsets,
+						     error ) != 1 )
+						{
+							read_count = -1;
+						}
+					}
+					else
+					{
+						last_chunk = chunk_table->last_chunk_filled;
+
+						read_count = libewf_segment_file_read_table_section(
+							      segment_file,
+							      section,
+							      internal_handle->io_handle,
+							      file_io_pool,
+							      file_io_pool_entry,
+							      internal_handle->media_values,
+							      chunk_table,
+							      internal_handle->chunk_table_list,
+							      error );
+
+						number_of_offsets = (uint32_t) ( chunk_table->last_chunk_filled - last_chunk );
+					}
 					known_section = 1;
 				}
 				else if( memory_compare(
@@ -3180,16 +3865,35 @@ int libewf_handle_open_read_segment_files(
 					  (void *) "table2",
 					  6 ) == 0 )
 				{
-					read_count = libewf_segment_file_read_table2_section(
-						      segment_file,
-						      section,
-						      internal_handle->io_handle,
-						      file_io_pool,
-						      file_io_pool_entry,
-						      chunk_table,
-						      internal_handle->chunk_table_list,
-						      error );
-
+					if( index_file_segment != NULL )
+					{
+						if( libewf_segment_file_set_backup_chunk_group(
+						     section,
+						     file_io_pool_entry,
+						     chunk_table,
+						     internal_handle->chunk_table_list,
+						     number_of_offsets,
+						     error ) != 1 )
+						{
+							read_count = -1;
+						}
+					}
+					else
+					{
+						last_chunk = chunk_table->last_chunk_compared;
+
+						read_count = libewf_segment_file_read_table2_section(
+							      segment_file,
+							      section,
+							      internal_handle->io_handle,
+							      file_io_pool,
+							      file_io_pool_entry,
+							      chunk_table,
+							      internal_handle->chunk_table_list,
+							      error );
+
+						number_of_offsets = (uint32_t) ( chunk_table->last_chunk_compared - last_chunk );
+					}
 					known_section = 1;
 				}
 				else if( memory_compare(
@@ -3348,6 +4052,27 @@ int libewf_handle_open_read_segment_files(
 
 				goto on_error;
 			}
+			if( ( index_file != NULL )
+			 && ( use_index_file == 0 ) )
+			{
+				if( libewf_index_file_append_section(
+				     index_file,
+				     section,
+				     number_of_offsets,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append section to index file.",
+					 function );
+
+					section = NULL;
+
+					goto on_error;
+				}
+			}
 			section = NULL;
 
 			segment_file->last_section_offset = section_offset;
@@ -3401,7 +4126,44 @@ int libewf_handle_open_read_segment_files(
 			}
 #endif
 		}
-		segment_file = NULL;
+		if( ( index_file != NULL )
+		 && ( use_index_file == 0 ) )
+		{
+			if( libewf_index_file_set_segment_values(
+			     index_file,
+			     segment_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set segment values in index file.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		index_file_segment = NULL;
+		segment_file_scan  = NULL;
+		segment_file       = NULL;
+	}
+	if( segment_file_scans_array != NULL )
+	{
+		if( libcdata_array_free(
+		     &segment_file_scans_array,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_segment_file_scan_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free segment file scans array.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( last_segment_file == 0 )
 	{
@@ -3428,26 +4190,82 @@ int libewf_handle_open_read_segment_files(
 
 		internal_handle->segment_table->flags |= LIBEWF_SEGMENT_TABLE_FLAG_CORRUPTED;
 	}
-	return( 1 );
-
-on_error:
-	if( section != NULL )
+	if( index_file != NULL )
 	{
-		libewf_section_free(
-		 &section,
-		 NULL );
-	}
-	return( -1 );
-}
-
-/* Opens the delta segment files for reading
- * Returns 1 if successful or -1 on error
- */
-int libewf_handle_open_read_delta_segment_files(
-     libewf_internal_handle_t *internal_handle,
-     libbfio_pool_t *file_io_pool,
-     libcerror_error_t **error )
-{
+		/* The index file is not written when the segment files are corrupted
+		 */
+		if( ( use_index_file == 0 )
+		 && ( ( internal_handle->segment_table->flags & LIBEWF_SEGMENT_TABLE_FLAG_CORRUPTED ) == 0 ) )
+		{
+			if( libewf_internal_handle_write_index_file(
+			     internal_handle,
+			     index_file,
+			     error ) == -1 )
+			{
+				/* Failing to write the index file does not prevent the segment files from being read
+				 */
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					if( ( error != NULL )
+					 && ( *error != NULL ) )
+					{
+						libcnotify_print_error_backtrace(
+						 *error );
+					}
+				}
+#endif
+				libcerror_error_free(
+				 error );
+			}
+		}
+		if( libewf_index_file_free(
+		     &index_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( section != NULL )
+	{
+		libewf_section_free(
+		 &section,
+		 NULL );
+	}
+	if( index_file != NULL )
+	{
+		libewf_index_file_free(
+		 &index_file,
+		 NULL );
+	}
+	if( segment_file_scans_array != NULL )
+	{
+		libcdata_array_free(
+		 &segment_file_scans_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libewf_segment_file_scan_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens the delta segment files for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_open_read_delta_segment_files(
+     libewf_internal_handle_t *internal_handle,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error )
+{
 	libewf_section_t *section           = NULL;
 	libewf_segment_file_t *segment_file = NULL;
 	static char *function               = "libewf_handle_open_read_delta_segment_files";
@@ -3679,6 +4497,24 @@ int libewf_handle_open_read_delta_segment_files(
 
 				goto on_error;
 			}
+			/* The section data is read from the current offset
+			 */
+			if( libbfio_pool_seek_offset(
+			     file_io_pool,
+			     file_io_pool_entry,
+			     section->start_offset + sizeof( ewf_section_start_t ),
+			     SEEK_SET,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek section data offset.",
+				 function );
+
+				goto on_error;
+			}
 			if( section->type_length == 4 )
 			{
 				if( memory_compare(
@@ -3863,6 +4699,21 @@ int libewf_handle_close(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libewf_internal_handle_read_ahead_stop(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to stop read-ahead.",
+		 function );
+
+		result = -1;
+	}
+#endif
 	if( ( internal_handle->write_io_handle != NULL )
 	 && ( internal_handle->write_io_handle->write_finalized == 0 ) )
 	{
@@ -3913,6 +4764,7 @@ int libewf_handle_close(
 	}
 	internal_handle->file_io_pool                    = NULL;
 	internal_handle->file_io_pool_created_in_library = 0;
+	internal_handle->memory_mapped_chunk_data        = NULL;
 
 	if( internal_handle->read_io_handle != NULL )
 	{
@@ -4215,9 +5067,10 @@ ssize_t libewf_handle_prepare_read_chunk(
          int8_t read_checksum,
          libcerror_error_t **error )
 {
-	uint8_t *checksum_buffer     = NULL;
-	static char *function        = "libewf_handle_prepare_read_chunk";
-	uint32_t calculated_checksum = 0;
+	libewf_internal_handle_t *internal_handle = NULL;
+	uint8_t *checksum_buffer                  = NULL;
+	static char *function                     = "libewf_handle_prepare_read_chunk";
+	uint32_t calculated_checksum              = 0;
 
 	if( handle == NULL )
 	{
@@ -4230,6 +5083,19 @@ ssize_t libewf_handle_prepare_read_chunk(
 
 		return( -1 );
 	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( chunk_buffer == NULL )
 	{
 		libcerror_error_set(
@@ -4343,6 +5209,7 @@ ssize_t libewf_handle_prepare_read_chunk(
 			return( -1 );
 		}
 		if( libewf_decompress(
+		     internal_handle->io_handle->compression_context,
 		     uncompressed_chunk_buffer,
 		     uncompressed_chunk_buffer_size,
 		     chunk_buffer,
@@ -4540,14 +5407,64 @@ ssize_t libewf_handle_read_chunk(
 
 		return( -1 );
 	}
-	/* This function will expand element groups
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libewf_internal_handle_read_ahead_update(
+	     internal_handle,
+	     chunk_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	/* The chunk data is stored in the chunk table cache, which is shared
+	 * with the read-ahead thread, hence it must be copied before
+	 * the mutexes are released
+	 */
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_internal_handle_grab_chunk_table_mutexes(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab chunk table mutexes.",
+		 function );
+
+		libcthreads_read_write_lock_release_for_read(
+		 internal_handle->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	/* This function will read chunk groups
 	 */
-	if( libmfdata_list_get_element_value_by_index(
+	if( libewf_chunk_table_get_chunk_data(
 	     internal_handle->chunk_table_list,
 	     internal_handle->file_io_pool,
 	     internal_handle->chunk_table_cache,
 	     (int) chunk_index,
-	     (intptr_t **) &chunk_data,
+	     &chunk_data,
 	     0,
 	     error ) != 1 )
 	{
@@ -4559,7 +5476,7 @@ ssize_t libewf_handle_read_chunk(
 		 function,
 		 chunk_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( chunk_data == NULL )
 	{
@@ -4571,7 +5488,7 @@ ssize_t libewf_handle_read_chunk(
 		 function,
 		 chunk_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	chunk_data_buffer = chunk_data->data;
 	read_size         = chunk_data->data_size;
@@ -4592,7 +5509,7 @@ ssize_t libewf_handle_read_chunk(
 				 "%s: invalid chunk data size value out of bounds.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
 			read_size -= sizeof( uint32_t );
 		}
@@ -4605,7 +5522,7 @@ ssize_t libewf_handle_read_chunk(
 			 "%s: invalid chunk buffer size value too small.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		/* If the chunk and checksum buffers are not aligned
 		 * read the chunk and checksum separately
@@ -4636,7 +5553,7 @@ ssize_t libewf_handle_read_chunk(
 		 "%s: unable to copy chunk data to chunk buffer.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( *read_checksum != 0 )
 	{
@@ -4652,7 +5569,7 @@ ssize_t libewf_handle_read_chunk(
 			 "%s: unable to copy chunk checksum data in chunk buffer.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		read_size += sizeof( uint32_t );
 
@@ -4675,7 +5592,51 @@ ssize_t libewf_handle_read_chunk(
 	}
 	internal_handle->io_handle->current_offset += (off64_t) data_size;
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libewf_internal_handle_release_chunk_table_mutexes(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release chunk table mutexes.",
+		 function );
+
+		libcthreads_read_write_lock_release_for_read(
+		 internal_handle->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	return( (ssize_t) read_size );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libewf_internal_handle_release_chunk_table_mutexes(
+	 internal_handle,
+	 NULL );
+
+	libcthreads_read_write_lock_release_for_read(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
 /* Reads (media) data at the current offset into a buffer
@@ -4687,15 +5648,9 @@ ssize_t libewf_handle_read_buffer(
          size_t buffer_size,
          libcerror_error_t **error )
 {
-	libewf_chunk_data_t *chunk_data           = NULL;
 	libewf_internal_handle_t *internal_handle = NULL;
 	static char *function                     = "libewf_handle_read_buffer";
-	off64_t chunk_offset                      = 0;
-	size_t buffer_offset                      = 0;
-	size_t read_size                          = 0;
-	ssize_t total_read_count                  = 0;
-	uint64_t chunk_index                      = 0;
-	uint64_t chunk_data_offset                = 0;
+	ssize_t read_count                        = 0;
 
 	if( handle == NULL )
 	{
@@ -4721,241 +5676,74 @@ ssize_t libewf_handle_read_buffer(
 
 		return( -1 );
 	}
-	if( internal_handle->chunk_data != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid handle - chunk data set.",
-		 function );
+	read_count = libewf_internal_handle_read_buffer_at_offset(
+	              internal_handle,
+	              buffer,
+	              buffer_size,
+	              internal_handle->io_handle->current_offset,
+	              error );
 
-		return( -1 );
-	}
-	if( internal_handle->io_handle->current_offset < 0 )
+	if( read_count < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid internal handle - invalid IO handle - current offset value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->media_values == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing media values.",
-		 function );
+	internal_handle->io_handle->current_offset += (off64_t) read_count;
 
-		return( -1 );
-	}
-	if( internal_handle->media_values->chunk_size == 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - invalid media values - missing chunk size.",
-		 function );
+	return( read_count );
+}
 
-		return( -1 );
-	}
-	if( buffer == NULL )
+/* Reads (media) data at a specific offset
+ * This function does not change the current offset and can be called
+ * concurrently by multiple threads on a handle that is opened for reading
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libewf_handle_read_random(
+         libewf_handle_t *handle,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_read_random";
+	ssize_t read_count                        = 0;
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( buffer_size > (size_t) SSIZE_MAX )
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	read_count = libewf_internal_handle_read_buffer_at_offset(
+	              internal_handle,
+	              buffer,
+	              buffer_size,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid buffer size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( (size64_t) internal_handle->io_handle->current_offset >= internal_handle->media_values->media_size )
-	{
-		return( 0 );
-	}
-	if( (size64_t) ( internal_handle->io_handle->current_offset + buffer_size ) >= internal_handle->media_values->media_size )
-	{
-		buffer_size = (size_t) ( internal_handle->media_values->media_size - internal_handle->io_handle->current_offset );
-	}
-	chunk_index = internal_handle->io_handle->current_offset / internal_handle->media_values->chunk_size;
-
-	if( chunk_index >= (uint64_t) INT_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid chunk index value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	chunk_offset = chunk_index * internal_handle->media_values->chunk_size;
-
-	chunk_data_offset = internal_handle->io_handle->current_offset - chunk_offset;
-
-	if( chunk_data_offset >= (uint64_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid chunk data offset value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	while( buffer_size > 0 )
-	{
-		if( libewf_read_io_handle_read_chunk_data(
-		     internal_handle->read_io_handle,
-		     internal_handle->file_io_pool,
-		     internal_handle->media_values,
-		     internal_handle->chunk_table_list,
-		     internal_handle->chunk_table_cache,
-		     (int) chunk_index,
-		     chunk_offset,
-		     &chunk_data,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read chunk data: %" PRIu64 ".",
-			 function,
-			 chunk_index );
-
-			return( -1 );
-		}
-		if( chunk_data == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing chunk data: %" PRIu64 ".",
-			 function,
-			 chunk_index );
-
-			return( -1 );
-		}
-		if( chunk_data_offset > chunk_data->data_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: chunk offset exceeds chunk data size.",
-			 function );
-
-			return( -1 );
-		}
-		read_size = (size_t) ( chunk_data->data_size - chunk_data_offset );
-
-		if( read_size > buffer_size )
-		{
-			read_size = buffer_size;
-		}
-		if( read_size == 0 )
-		{
-			break;
-		}
-		if( memory_copy(
-		     &( ( (uint8_t *) buffer )[ buffer_offset ] ),
-		     &( ( chunk_data->data )[ chunk_data_offset ] ),
-		     read_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy chunk data to buffer.",
-			 function );
-
-			return( -1 );
-		}
-		buffer_offset    += read_size;
-		buffer_size      -= read_size;
-		total_read_count += (ssize_t) read_size;
-		chunk_index      += 1;
-		chunk_offset     += internal_handle->media_values->chunk_size;
-		chunk_data_offset = 0;
-
-		internal_handle->io_handle->current_offset += (off64_t) read_size;
-
-		if( (size64_t) internal_handle->io_handle->current_offset >= internal_handle->media_values->media_size )
-		{
-			break;
-		}
-		if( internal_handle->io_handle->abort != 0 )
-		{
-			break;
-		}
-	}
-	return( total_read_count );
-}
-
-/* Reads (media) data at a specific offset
- * Returns the number of bytes read or -1 on error
- */
-ssize_t libewf_handle_read_random(
-         libewf_handle_t *handle,
-         void *buffer,
-         size_t buffer_size,
-         off64_t offset,
-         libcerror_error_t **error )
-{
-	static char *function = "libewf_handle_read_random";
-	ssize_t read_count    = 0;
-
-	if( libewf_handle_seek_offset(
-	     handle,
-	     offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
-		 function );
-
-		return( -1 );
-	}
-	read_count = libewf_handle_read_buffer(
-	              handle,
-	              buffer,
-	              buffer_size,
-	              error );
-
-	if( read_count < 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 ".",
+		 function,
+		 offset );
 
 		return( -1 );
 	}
@@ -5012,17 +5800,6 @@ ssize_t libewf_handle_prepare_write_chunk(
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle->current_offset < 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid internal handle - invalid IO handle - current offset value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
 	if( internal_handle->media_values == NULL )
 	{
 		libcerror_error_set(
@@ -5117,8 +5894,22 @@ ssize_t libewf_handle_prepare_write_chunk(
 	{
 		return( 0 );
 	}
+	/* The current offset is only needed when the chunk table is available,
+	 * so that a pure write does not read the offset updated by write chunk
+	 */
 	if( internal_handle->read_io_handle != NULL )
 	{
+		if( internal_handle->io_handle->current_offset < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid internal handle - invalid IO handle - current offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
 		chunk_index = internal_handle->io_handle->current_offset / internal_handle->media_values->chunk_size;
 
 		if( chunk_index >= (uint64_t) INT_MAX )
@@ -5280,6 +6071,7 @@ ssize_t libewf_handle_prepare_write_chunk(
 			else
 			{
 				result = libewf_compress(
+					  internal_handle->io_handle->compression_context,
 					  (uint8_t *) compressed_chunk_buffer,
 					  compressed_chunk_buffer_size,
 					  (uint8_t *) chunk_buffer,
@@ -5879,6 +6671,7 @@ ssize_t libewf_handle_write_buffer(
 			{
 				if( libewf_read_io_handle_read_chunk_data(
 				     internal_handle->read_io_handle,
+				     internal_handle->io_handle->compression_context,
 				     internal_handle->file_io_pool,
 				     internal_handle->media_values,
 				     internal_handle->chunk_table_list,
@@ -6022,6 +6815,7 @@ ssize_t libewf_handle_write_buffer(
 
 			if( libewf_chunk_data_pack(
 			     chunk_data,
+			     internal_handle->io_handle->compression_context,
 			     EWF_COMPRESSION_NONE,
 			     0,
 			     EWF_FORMAT_D01,
@@ -6193,6 +6987,7 @@ ssize_t libewf_handle_write_buffer(
 
 				if( libewf_chunk_data_pack(
 				     internal_handle->chunk_data,
+				     internal_handle->io_handle->compression_context,
 				     internal_handle->io_handle->compression_level,
 				     internal_handle->io_handle->compression_flags,
 				     internal_handle->io_handle->ewf_format,
@@ -6472,6 +7267,7 @@ ssize_t libewf_handle_write_finalize(
 
 		if( libewf_chunk_data_pack(
 		     internal_handle->chunk_data,
+		     internal_handle->io_handle->compression_context,
 		     internal_handle->io_handle->compression_level,
 		     internal_handle->io_handle->compression_flags,
 		     internal_handle->io_handle->ewf_format,
@@ -7111,7 +7907,14 @@ int libewf_handle_set_maximum_number_of_open_handles(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->file_io_pool != NULL )
+	/* A file IO pool that contains memory mapped segment files is kept
+	 * with an unlimited number of open handles, see libewf_handle_open
+	 */
+	if( ( internal_handle->file_io_pool != NULL )
+	 && ( ( internal_handle->use_memory_map == 0 )
+	  || ( internal_handle->file_io_pool_created_in_library == 0 )
+	  || ( internal_handle->io_handle == NULL )
+	  || ( ( internal_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_WRITE ) != 0 ) ) )
 	{
 		if( libbfio_pool_set_maximum_number_of_open_handles(
 		     internal_handle->file_io_pool,
@@ -7133,15 +7936,21 @@ int libewf_handle_set_maximum_number_of_open_handles(
 	return( 1 );
 }
 
-/* Determine if the segment files are corrupted
- * Returns 1 if corrupted, 0 if not or -1 on error
+/* Retrieves the segment file open and close statistics
+ * The number of closes and reopens only contain the segment files that were closed
+ * to limit the number of (concurrent) open file handles
+ * Returns 1 if successful or -1 on error
  */
-int libewf_handle_segment_files_corrupted(
+int libewf_handle_get_segment_file_statistics(
      libewf_handle_t *handle,
+     uint64_t *number_of_opens,
+     uint64_t *number_of_closes,
+     uint64_t *number_of_reopens,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_segment_files_corrupted";
+	static char *function                     = "libewf_handle_get_segment_file_statistics";
+	int result                                = 1;
 
 	if( handle == NULL )
 	{
@@ -7156,92 +7965,79 @@ int libewf_handle_segment_files_corrupted(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->segment_table == NULL )
+	if( internal_handle->file_io_pool == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing segment table.",
+		 "%s: invalid handle - missing file IO pool.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( internal_handle->segment_table->flags & LIBEWF_SEGMENT_TABLE_FLAG_CORRUPTED ) != 0 )
-	{
-		return( 1 );
-	}
-	return( 0 );
-}
-
-/* Retrieves the segment filename size
- * The filename size should include the end of string character
- * Returns 1 if successful, 0 if value not present or -1 on error
- */
-int libewf_handle_get_segment_filename_size(
-     libewf_handle_t *handle,
-     size_t *filename_size,
-     libcerror_error_t **error )
-{
-	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_segment_filename_size";
-	int result                                = 0;
-
-	if( handle == NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libewf_internal_handle_t *) handle;
-
-	if( internal_handle->segment_table == NULL )
+#endif
+	if( libbfio_pool_get_statistics(
+	     internal_handle->file_io_pool,
+	     number_of_opens,
+	     number_of_closes,
+	     number_of_reopens,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing segment table.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO pool statistics.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	result = libewf_segment_table_get_basename_size(
-	          internal_handle->segment_table,
-	          filename_size,
-	          error );
-
-	if( result == -1 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve segment table basename size.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
+#endif
 	return( result );
 }
 
-/* Retrieves the segment filename
- * The filename size should include the end of string character
- * Returns 1 if successful, 0 if value not present or -1 on error
+/* Retrieves the number of times a specific segment file was accessed
+ * Returns 1 if successful, 0 if no such segment file or -1 on error
  */
-int libewf_handle_get_segment_filename(
+int libewf_handle_get_segment_file_access_count(
      libewf_handle_t *handle,
-     char *filename,
-     size_t filename_size,
+     uint32_t segment_number,
+     uint64_t *access_count,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_segment_filename";
+	static char *function                     = "libewf_handle_get_segment_file_access_count";
+	int file_io_pool_entry                    = -1;
+	int number_of_segment_files               = 0;
 	int result                                = 0;
 
 	if( handle == NULL )
@@ -7257,116 +8053,140 @@ int libewf_handle_get_segment_filename(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->segment_table == NULL )
+	if( internal_handle->file_io_pool == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing segment table.",
+		 "%s: invalid handle - missing file IO pool.",
 		 function );
 
 		return( -1 );
 	}
-	result = libewf_segment_table_get_basename(
-	          internal_handle->segment_table,
-	          filename,
-	          filename_size,
-	          error );
-
-	if( result == -1 )
+	if( internal_handle->segment_files_list == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve segment table basename.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing segment files list.",
 		 function );
 
 		return( -1 );
 	}
-	return( result );
-}
-
-/* Sets the segment file
- * Returns 1 if successful or -1 on error
- */
-int libewf_handle_set_segment_filename(
-     libewf_handle_t *handle,
-     const char *filename,
-     size_t filename_length,
-     libcerror_error_t **error )
-{
-	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_segment_filename";
-
-	if( handle == NULL )
+	if( access_count == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 "%s: invalid access count.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libewf_internal_handle_t *) handle;
-
-	if( internal_handle->write_io_handle == NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: segment filename cannot be changed.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->segment_table == NULL )
+#endif
+	if( libmfdata_file_list_get_number_of_files(
+	     internal_handle->segment_files_list,
+	     &number_of_segment_files,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing segment table.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segment files.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	if( libewf_segment_table_set_basename(
-	     internal_handle->segment_table,
-	     filename,
-	     filename_length,
+	else if( ( segment_number > 0 )
+	      && ( segment_number <= (uint32_t) number_of_segment_files ) )
+	{
+		if( libmfdata_file_list_get_file_by_index(
+		     internal_handle->segment_files_list,
+		     (int) ( segment_number - 1 ),
+		     &file_io_pool_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment file: %" PRIu32 " from list.",
+			 function,
+			 segment_number );
+
+			result = -1;
+		}
+		else if( file_io_pool_entry >= 0 )
+		{
+			result = libbfio_pool_get_access_count(
+			          internal_handle->file_io_pool,
+			          file_io_pool_entry,
+			          access_count,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve access count of file IO pool entry: %d.",
+				 function,
+				 file_io_pool_entry );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set segment table basename.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Retrieves the segment filename size
- * The filename size includes the end of string character
- * Returns 1 if successful, 0 if value not present or -1 on error
+/* Sets the maximum size of the chunk data cache
+ * The size is expressed in bytes of decompressed chunk data,
+ * 0 represents the default (minimal) cache size
+ * Returns 1 if successful or -1 on error
  */
-int libewf_handle_get_segment_filename_size_wide(
+int libewf_handle_set_maximum_cache_size(
      libewf_handle_t *handle,
-     size_t *filename_size,
+     size64_t maximum_cache_size,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_segment_filename_size_wide";
-	int result                                = 0;
+	static char *function                     = "libewf_handle_set_maximum_cache_size";
+	int result                                = 1;
 
 	if( handle == NULL )
 	{
@@ -7381,49 +8201,69 @@ int libewf_handle_get_segment_filename_size_wide(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->segment_table == NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing segment table.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	result = libewf_segment_table_get_basename_size_wide(
-	          internal_handle->segment_table,
-	          filename_size,
-	          error );
+#endif
+	internal_handle->maximum_cache_size = maximum_cache_size;
 
-	if( result == -1 )
+	if( libewf_internal_handle_resize_chunk_table_cache(
+	     internal_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve segment table basename size.",
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize chunk table cache.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
+#endif
 	return( result );
 }
 
-/* Retrieves the segment filename
- * The filename size should include the end of string character
- * Returns 1 if successful, 0 if value not present or -1 on error
+/* Sets the number of chunks to read ahead
+ * When the chunks are read sequentially a background thread reads
+ * and decompresses the next chunks into the chunk table cache,
+ * 0 disables read-ahead
+ * Read-ahead requires multi-threading support
+ * Returns 1 if successful or -1 on error
  */
-int libewf_handle_get_segment_filename_wide(
+int libewf_handle_set_read_ahead(
      libewf_handle_t *handle,
-     wchar_t *filename,
-     size_t filename_size,
+     int number_of_chunks,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_segment_filename_wide";
-	int result                                = 0;
+	static char *function                     = "libewf_handle_set_read_ahead";
+	int result                                = 1;
 
 	if( handle == NULL )
 	{
@@ -7438,114 +8278,134 @@ int libewf_handle_get_segment_filename_wide(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->segment_table == NULL )
+	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing segment table.",
+		 "%s: invalid handle - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	result = libewf_segment_table_get_basename_wide(
-	          internal_handle->segment_table,
-	          filename,
-	          filename_size,
-	          error );
-
-	if( result == -1 )
+	if( number_of_chunks < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve segment table basename.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of chunks value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	return( result );
-}
-
-/* Sets the segment file
- * Returns 1 if successful or -1 on error
- */
-int libewf_handle_set_segment_filename_wide(
-     libewf_handle_t *handle,
-     const wchar_t *filename,
-     size_t filename_length,
-     libcerror_error_t **error )
-{
-	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_segment_filename_wide";
-
-	if( handle == NULL )
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_chunks != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: read-ahead requires multi-threading support.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libewf_internal_handle_t *) handle;
+#else
+	if( libewf_internal_handle_read_ahead_stop(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to stop read-ahead.",
+		 function );
 
-	if( internal_handle->write_io_handle == NULL )
+		return( -1 );
+	}
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: segment filename cannot be changed.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->segment_table == NULL )
+	internal_handle->number_of_read_ahead_chunks = number_of_chunks;
+
+	if( libewf_internal_handle_resize_chunk_table_cache(
+	     internal_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing segment table.",
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize chunk table cache.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	if( libewf_segment_table_set_basename_wide(
-	     internal_handle->segment_table,
-	     filename,
-	     filename_length,
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set segment table basename.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
+	/* Read-ahead is only used when the handle is opened for reading only
+	 */
+	if( ( result == 1 )
+	 && ( number_of_chunks > 0 )
+	 && ( internal_handle->file_io_pool != NULL )
+	 && ( ( internal_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		if( libewf_internal_handle_read_ahead_start(
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to start read-ahead.",
+			 function );
 
+			result = -1;
+		}
+	}
 #endif
+	return( result );
+}
 
-/* Retrieves the maximum segment file size
+/* Sets the value to indicate the segment files should be memory mapped
+ * When the handle is opened for reading only, uncompressed chunks with a matching
+ * checksum are then read directly from the memory mapped segment files
+ * Memory mapped segment files are kept open until the handle is closed
+ * The value must be set before the handle is opened
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_get_maximum_segment_size(
+int libewf_handle_set_use_memory_map(
      libewf_handle_t *handle,
-     size64_t *maximum_segment_size,
+     uint8_t use_memory_map,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_maximum_segment_size";
+	static char *function                     = "libewf_handle_set_use_memory_map";
 
 	if( handle == NULL )
 	{
@@ -7560,46 +8420,41 @@ int libewf_handle_get_maximum_segment_size(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->segment_table == NULL )
+	if( internal_handle->file_io_pool != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing segment table.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - file IO pool already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( maximum_segment_size == NULL )
+	if( use_memory_map != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid maximum segment size.",
-		 function );
-
-		return( -1 );
+		internal_handle->use_memory_map = 1;
+	}
+	else
+	{
+		internal_handle->use_memory_map = 0;
 	}
-	*maximum_segment_size = internal_handle->segment_table->maximum_segment_size;
-
 	return( 1 );
 }
 
-/* Sets the maximum segment file size
- * A maximum segment file size of 0 represents the maximum possible size for the format
- * If the maximum segment file size is smaller than the size needed to store a single chunk
- * the size off the latter is enforced and not the maximum segment file size
+/* Sets the value to indicate the segment file data should be dropped from the system page cache
+ * The data read from or written to the segment files is then dropped from the cache regularly,
+ * which also keeps the amount of written data waiting to be flushed to storage small
+ * The value must be set before the handle is opened
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_set_maximum_segment_size(
+int libewf_handle_set_drop_cached_data(
      libewf_handle_t *handle,
-     size64_t maximum_segment_size,
+     uint8_t drop_cached_data,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_maximum_segment_size";
+	static char *function                     = "libewf_handle_set_drop_cached_data";
 
 	if( handle == NULL )
 	{
@@ -7614,79 +8469,54 @@ int libewf_handle_set_maximum_segment_size(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->media_values == NULL )
+	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing media values.",
+		 "%s: invalid handle - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->segment_table == NULL )
+	if( internal_handle->file_io_pool != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing segment table.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - file IO pool already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( internal_handle->read_io_handle != NULL )
-	 || ( internal_handle->write_io_handle == NULL )
-	 || ( internal_handle->write_io_handle->values_initialized != 0 ) )
+	if( drop_cached_data != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: maximum segment size cannot be changed.",
-		 function );
-
-		return( -1 );
+		internal_handle->io_handle->drop_cached_data = 1;
 	}
-	if( maximum_segment_size > (size64_t) INT64_MAX )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid maximum segment size value exceeds maximum.",
-		 function );
-
-		return( -1 );
+		internal_handle->io_handle->drop_cached_data = 0;
 	}
-	if( maximum_segment_size > internal_handle->write_io_handle->maximum_segment_file_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid segment file size value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
-	internal_handle->segment_table->maximum_segment_size = maximum_segment_size;
-
 	return( 1 );
 }
 
-/* Retrieves the delta segment filename size
- * The filename size includes the end of string character
- * Returns 1 if successful, 0 if value not present or -1 on error
+/* Retrieves the memory mapped data of a specific chunk
+ * The data is only available for uncompressed chunks with a matching checksum
+ * when the segment files are memory mapped, the chunk data excludes the checksum
+ * The data remains valid until the handle is closed
+ * Returns 1 if successful, 0 if the chunk data is not available or -1 on error
  */
-int libewf_handle_get_delta_segment_filename_size(
+int libewf_handle_get_memory_mapped_chunk_data(
      libewf_handle_t *handle,
-     size_t *filename_size,
+     uint64_t chunk_index,
+     const uint8_t **chunk_data,
+     size_t *chunk_data_size,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_delta_segment_filename_size";
+	static char *function                     = "libewf_handle_get_memory_mapped_chunk_data";
 	int result                                = 0;
 
 	if( handle == NULL )
@@ -7702,20 +8532,26 @@ int libewf_handle_get_delta_segment_filename_size(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->delta_segment_table == NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing delta segment table.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	result = libewf_segment_table_get_basename_size(
-	          internal_handle->delta_segment_table,
-	          filename_size,
+#endif
+	result = libewf_internal_handle_get_memory_mapped_chunk_data(
+	          internal_handle,
+	          chunk_index,
+	          chunk_data,
+	          chunk_data_size,
 	          error );
 
 	if( result == -1 )
@@ -7724,27 +8560,43 @@ int libewf_handle_get_delta_segment_filename_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve segment table basename size.",
+		 "%s: unable to retrieve memory mapped data of chunk: %" PRIu64 ".",
+		 function,
+		 chunk_index );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
+#endif
 	return( result );
 }
 
-/* Retrieves the delta segment filename
- * The filename size should include the end of string character
- * Returns 1 if successful, 0 if value not present or -1 on error
+/* Reads the data of a batch of consecutive chunks into the chunk cache
+ * Chunks that are stored consecutively in a segment file are read using
+ * a single vectored read, the chunks are decompressed when they are read
+ * The number of chunks is limited by the number of chunks the cache can hold
+ * Returns the number of chunks read if successful or -1 on error
  */
-int libewf_handle_get_delta_segment_filename(
+int libewf_handle_read_chunks_batch(
      libewf_handle_t *handle,
-     char *filename,
-     size_t filename_size,
+     uint64_t chunk_index,
+     int number_of_chunks,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_delta_segment_filename";
-	int result                                = 0;
+	static char *function                     = "libewf_handle_read_chunks_batch";
+	int number_of_chunks_read                 = 0;
 
 	if( handle == NULL )
 	{
@@ -7759,48 +8611,70 @@ int libewf_handle_get_delta_segment_filename(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->delta_segment_table == NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing delta segment table.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	result = libewf_segment_table_get_basename(
-	          internal_handle->delta_segment_table,
-	          filename,
-	          filename_size,
-	          error );
+#endif
+	number_of_chunks_read = libewf_internal_handle_read_chunks_batch(
+	                         internal_handle,
+	                         chunk_index,
+	                         number_of_chunks,
+	                         error );
 
-	if( result == -1 )
+	if( number_of_chunks_read == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read batch of chunks starting at chunk: %" PRIu64 ".",
+		 function,
+		 chunk_index );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve segment table basename.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	return( result );
+#endif
+	return( number_of_chunks_read );
 }
 
-/* Sets the delta segment file
+/* Sets the index filename
+ * The index file caches the layout of the segment files, when the handle is opened
+ * for reading only a valid index file is used instead of reading the section start
+ * of every section in the segment files, otherwise the index file is (re)created
+ * The index filename must be set before the handle is opened
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_set_delta_segment_filename(
+int libewf_handle_set_index_filename(
      libewf_handle_t *handle,
      const char *filename,
      size_t filename_length,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_delta_segment_filename";
+	static char *function                     = "libewf_handle_set_index_filename";
 
 	if( handle == NULL )
 	{
@@ -7815,60 +8689,101 @@ int libewf_handle_set_delta_segment_filename(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->write_io_handle == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: delta segment filename cannot be changed.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->delta_segment_table == NULL )
+	if( ( filename_length == 0 )
+	 || ( filename_length >= (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing delta segment table.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( libewf_segment_table_set_basename(
-	     internal_handle->delta_segment_table,
+	if( internal_handle->index_filename != NULL )
+	{
+		memory_free(
+		 internal_handle->index_filename );
+
+		internal_handle->index_filename      = NULL;
+		internal_handle->index_filename_size = 0;
+	}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	if( internal_handle->index_filename_wide != NULL )
+	{
+		memory_free(
+		 internal_handle->index_filename_wide );
+
+		internal_handle->index_filename_wide      = NULL;
+		internal_handle->index_filename_wide_size = 0;
+	}
+#endif
+	internal_handle->index_filename = libcstring_narrow_string_allocate(
+	                                   filename_length + 1 );
+
+	if( internal_handle->index_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcstring_narrow_string_copy(
+	     internal_handle->index_filename,
 	     filename,
-	     filename_length,
-	     error ) != 1 )
+	     filename_length ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set segment table basename.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy index filename.",
 		 function );
 
+		memory_free(
+		 internal_handle->index_filename );
+
+		internal_handle->index_filename = NULL;
+
 		return( -1 );
 	}
+	internal_handle->index_filename[ filename_length ] = 0;
+
+	internal_handle->index_filename_size = filename_length + 1;
+
 	return( 1 );
 }
 
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
-/* Retrieves the delta segment filename size
- * The filename size includes the end of string character
- * Returns 1 if successful, 0 if value not present or -1 on error
+/* Sets the index filename
+ * The index filename must be set before the handle is opened
+ * Returns 1 if successful or -1 on error
  */
-int libewf_handle_get_delta_segment_filename_size_wide(
+int libewf_handle_set_index_filename_wide(
      libewf_handle_t *handle,
-     size_t *filename_size,
+     const wchar_t *filename,
+     size_t filename_length,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_delta_segment_filename_size_wide";
-	int result                                = 0;
+	static char *function                     = "libewf_handle_set_index_filename_wide";
 
 	if( handle == NULL )
 	{
@@ -7883,49 +8798,96 @@ int libewf_handle_get_delta_segment_filename_size_wide(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->delta_segment_table == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing delta segment table.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	result = libewf_segment_table_get_basename_size_wide(
-	          internal_handle->delta_segment_table,
-	          filename_size,
-	          error );
+	if( ( filename_length == 0 )
+	 || ( filename_length >= (size_t) ( SSIZE_MAX / sizeof( wchar_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
 
-	if( result == -1 )
+		return( -1 );
+	}
+	if( internal_handle->index_filename != NULL )
+	{
+		memory_free(
+		 internal_handle->index_filename );
+
+		internal_handle->index_filename      = NULL;
+		internal_handle->index_filename_size = 0;
+	}
+	if( internal_handle->index_filename_wide != NULL )
+	{
+		memory_free(
+		 internal_handle->index_filename_wide );
+
+		internal_handle->index_filename_wide      = NULL;
+		internal_handle->index_filename_wide_size = 0;
+	}
+	internal_handle->index_filename_wide = libcstring_wide_string_allocate(
+	                                        filename_length + 1 );
+
+	if( internal_handle->index_filename_wide == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve segment table basename size.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index filename.",
 		 function );
 
 		return( -1 );
 	}
-	return( result );
+	if( libcstring_wide_string_copy(
+	     internal_handle->index_filename_wide,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy index filename.",
+		 function );
+
+		memory_free(
+		 internal_handle->index_filename_wide );
+
+		internal_handle->index_filename_wide = NULL;
+
+		return( -1 );
+	}
+	internal_handle->index_filename_wide[ filename_length ] = 0;
+
+	internal_handle->index_filename_wide_size = filename_length + 1;
+
+	return( 1 );
 }
 
-/* Retrieves the delta segment filename
- * The filename size should include the end of string character
- * Returns 1 if successful, 0 if value not present or -1 on error
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Determine if the segment files are corrupted
+ * Returns 1 if corrupted, 0 if not or -1 on error
  */
-int libewf_handle_get_delta_segment_filename_wide(
+int libewf_handle_segment_files_corrupted(
      libewf_handle_t *handle,
-     wchar_t *filename,
-     size_t filename_size,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_delta_segment_filename_wide";
-	int result                                = 0;
+	static char *function                     = "libewf_handle_segment_files_corrupted";
 
 	if( handle == NULL )
 	{
@@ -7940,48 +8902,36 @@ int libewf_handle_get_delta_segment_filename_wide(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->delta_segment_table == NULL )
+	if( internal_handle->segment_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing delta segment table.",
+		 "%s: invalid handle - missing segment table.",
 		 function );
 
 		return( -1 );
 	}
-	result = libewf_segment_table_get_basename_wide(
-	          internal_handle->delta_segment_table,
-	          filename,
-	          filename_size,
-	          error );
-
-	if( result == -1 )
+	if( ( internal_handle->segment_table->flags & LIBEWF_SEGMENT_TABLE_FLAG_CORRUPTED ) != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve segment table basename.",
-		 function );
-
-		return( -1 );
+		return( 1 );
 	}
-	return( result );
+	return( 0 );
 }
 
-/* Sets the delta segment file
- * Returns 1 if successful or -1 on error
+/* Retrieves the segment filename size
+ * The filename size should include the end of string character
+ * Returns 1 if successful, 0 if value not present or -1 on error
  */
-int libewf_handle_set_delta_segment_filename_wide(
+int libewf_handle_get_segment_filename_size(
      libewf_handle_t *handle,
-     const wchar_t *filename,
-     size_t filename_length,
+     size_t *filename_size,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_delta_segment_filename_wide";
+	static char *function                     = "libewf_handle_get_segment_filename_size";
+	int result                                = 0;
 
 	if( handle == NULL )
 	{
@@ -7996,58 +8946,49 @@ int libewf_handle_set_delta_segment_filename_wide(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->write_io_handle == NULL )
+	if( internal_handle->segment_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: delta segment filename cannot be changed.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing segment table.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->delta_segment_table == NULL )
+	result = libewf_segment_table_get_basename_size(
+	          internal_handle->segment_table,
+	          filename_size,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing delta segment table.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment table basename size.",
 		 function );
 
 		return( -1 );
 	}
-	if( libewf_segment_table_set_basename_wide(
-	     internal_handle->delta_segment_table,
-	     filename,
-	     filename_length,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set segment table basename.",
-		 function );
-
-		return( -1 );
-	}
-	return( 1 );
+	return( result );
 }
 
-#endif
-
-/* Retrieves the maximum delta segment file size
- * Returns 1 if successful or -1 on error
+/* Retrieves the segment filename
+ * The filename size should include the end of string character
+ * Returns 1 if successful, 0 if value not present or -1 on error
  */
-int libewf_handle_get_maximum_delta_segment_size(
+int libewf_handle_get_segment_filename(
      libewf_handle_t *handle,
-     size64_t *maximum_delta_segment_size,
+     char *filename,
+     size_t filename_size,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_maximum_delta_segment_size";
+	static char *function                     = "libewf_handle_get_segment_filename";
+	int result                                = 0;
 
 	if( handle == NULL )
 	{
@@ -8062,43 +9003,48 @@ int libewf_handle_get_maximum_delta_segment_size(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->delta_segment_table == NULL )
+	if( internal_handle->segment_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing delta segment table.",
+		 "%s: invalid handle - missing segment table.",
 		 function );
 
 		return( -1 );
 	}
-	if( maximum_delta_segment_size == NULL )
+	result = libewf_segment_table_get_basename(
+	          internal_handle->segment_table,
+	          filename,
+	          filename_size,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid maximum delta segment size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment table basename.",
 		 function );
 
 		return( -1 );
 	}
-	*maximum_delta_segment_size = internal_handle->delta_segment_table->maximum_segment_size;
-
-	return( 1 );
+	return( result );
 }
 
-/* Sets the maximum delta segment file size
+/* Sets the segment file
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_set_maximum_delta_segment_size(
+int libewf_handle_set_segment_filename(
      libewf_handle_t *handle,
-     size64_t maximum_delta_segment_size,
+     const char *filename,
+     size_t filename_length,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_maximum_delta_segment_size";
+	static char *function                     = "libewf_handle_set_segment_filename";
 
 	if( handle == NULL )
 	{
@@ -8113,68 +9059,60 @@ int libewf_handle_set_maximum_delta_segment_size(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->delta_segment_table == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing delta segment table.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( internal_handle->write_io_handle == NULL )
-	 || ( internal_handle->write_io_handle->values_initialized != 0 ) )
+	if( internal_handle->write_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: maximum delta segment size cannot be changed.",
+		 "%s: segment filename cannot be changed.",
 		 function );
 
 		return( -1 );
 	}
-	if( maximum_delta_segment_size > (size64_t) INT64_MAX )
+	if( internal_handle->segment_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid maximum delta segment size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing segment table.",
 		 function );
 
 		return( -1 );
 	}
-	if( maximum_delta_segment_size == 0 )
+	if( libewf_segment_table_set_basename(
+	     internal_handle->segment_table,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid maximum delta segment size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set segment table basename.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle->delta_segment_table->maximum_segment_size = maximum_delta_segment_size;
-
 	return( 1 );
 }
 
-/* Retrieves the filename size of the (delta) segment file of the current chunk
- * The filename size should include the end of string character
- * Returns 1 if successful, 0 if no such filename or -1 on error
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Retrieves the segment filename size
+ * The filename size includes the end of string character
+ * Returns 1 if successful, 0 if value not present or -1 on error
  */
-int libewf_handle_get_filename_size(
+int libewf_handle_get_segment_filename_size_wide(
      libewf_handle_t *handle,
      size_t *filename_size,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	static char *function            = "libewf_handle_get_filename_size";
-	int result                       = 0;
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_segment_filename_size_wide";
+	int result                                = 0;
 
 	if( handle == NULL )
 	{
@@ -8187,55 +9125,51 @@ int libewf_handle_get_filename_size(
 
 		return( -1 );
 	}
-	result = libewf_handle_get_file_io_handle(
-	          handle,
-	          &file_io_handle,
-	          error );
+	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( result == -1 )
+	if( internal_handle->segment_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file IO handle for current chunk.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing segment table.",
 		 function );
 
 		return( -1 );
 	}
-	else if( result != 0 )
+	result = libewf_segment_table_get_basename_size_wide(
+	          internal_handle->segment_table,
+	          filename_size,
+	          error );
+
+	if( result == -1 )
 	{
-		if( libbfio_file_get_name_size(
-		     file_io_handle,
-		     filename_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve filename size.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment table basename size.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
 	return( result );
 }
 
-/* Retrieves the filename of the (delta) segment file of the current chunk
+/* Retrieves the segment filename
  * The filename size should include the end of string character
- * Returns 1 if successful, 0 if no such filename or -1 on error
+ * Returns 1 if successful, 0 if value not present or -1 on error
  */
-int libewf_handle_get_filename(
+int libewf_handle_get_segment_filename_wide(
      libewf_handle_t *handle,
-     char *filename,
+     wchar_t *filename,
      size_t filename_size,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	static char *function            = "libewf_handle_get_filename";
-	int result                       = 0;
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_segment_filename_wide";
+	int result                                = 0;
 
 	if( handle == NULL )
 	{
@@ -8248,57 +9182,50 @@ int libewf_handle_get_filename(
 
 		return( -1 );
 	}
-	result = libewf_handle_get_file_io_handle(
-	          handle,
-	          &file_io_handle,
-	          error );
+	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( result == -1 )
+	if( internal_handle->segment_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file IO handle for current chunk.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing segment table.",
 		 function );
 
 		return( -1 );
 	}
-	else if( result != 0 )
+	result = libewf_segment_table_get_basename_wide(
+	          internal_handle->segment_table,
+	          filename,
+	          filename_size,
+	          error );
+
+	if( result == -1 )
 	{
-		if( libbfio_file_get_name(
-		     file_io_handle,
-		     filename,
-		     filename_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve filename.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment table basename.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
 	return( result );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Retrieves the filename size of the (delta) segment file of the current chunk
- * The filename size includes the end of string character
- * Returns 1 if successful, 0 if no such filename or -1 on error
+/* Sets the segment file
+ * Returns 1 if successful or -1 on error
  */
-int libewf_handle_get_filename_size_wide(
+int libewf_handle_set_segment_filename_wide(
      libewf_handle_t *handle,
-     size_t *filename_size,
+     const wchar_t *filename,
+     size_t filename_length,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	static char *function            = "libewf_handle_get_filename_size_wide";
-	int result                       = 0;
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_set_segment_filename_wide";
 
 	if( handle == NULL )
 	{
@@ -8311,55 +9238,60 @@ int libewf_handle_get_filename_size_wide(
 
 		return( -1 );
 	}
-	result = libewf_handle_get_file_io_handle(
-	          handle,
-	          &file_io_handle,
-	          error );
+	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( result == -1 )
+	if( internal_handle->write_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file IO handle for current chunk.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: segment filename cannot be changed.",
 		 function );
 
 		return( -1 );
 	}
-	else if( result != 0 )
+	if( internal_handle->segment_table == NULL )
 	{
-		if( libbfio_file_get_name_size_wide(
-		     file_io_handle,
-		     filename_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve filename size.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing segment table.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	return( result );
-}
-
-/* Retrieves the filename of the (delta) segment file of the current chunk
- * The filename size should include the end of string character
- * Returns 1 if successful, 0 if no such filename or -1 on error
+	if( libewf_segment_table_set_basename_wide(
+	     internal_handle->segment_table,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set segment table basename.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif
+
+/* Retrieves the maximum segment file size
+ * Returns 1 if successful or -1 on error
  */
-int libewf_handle_get_filename_wide(
+int libewf_handle_get_maximum_segment_size(
      libewf_handle_t *handle,
-     wchar_t *filename,
-     size_t filename_size,
+     size64_t *maximum_segment_size,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	static char *function            = "libewf_handle_get_filename_wide";
-	int result                       = 0;
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_maximum_segment_size";
 
 	if( handle == NULL )
 	{
@@ -8372,9 +9304,164 @@ int libewf_handle_get_filename_wide(
 
 		return( -1 );
 	}
-	result = libewf_handle_get_file_io_handle(
-	          handle,
-	          &file_io_handle,
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_segment_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum segment size.",
+		 function );
+
+		return( -1 );
+	}
+	*maximum_segment_size = internal_handle->segment_table->maximum_segment_size;
+
+	return( 1 );
+}
+
+/* Sets the maximum segment file size
+ * A maximum segment file size of 0 represents the maximum possible size for the format
+ * If the maximum segment file size is smaller than the size needed to store a single chunk
+ * the size off the latter is enforced and not the maximum segment file size
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_set_maximum_segment_size(
+     libewf_handle_t *handle,
+     size64_t maximum_segment_size,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_set_maximum_segment_size";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_handle->read_io_handle != NULL )
+	 || ( internal_handle->write_io_handle == NULL )
+	 || ( internal_handle->write_io_handle->values_initialized != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: maximum segment size cannot be changed.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_segment_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum segment size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_segment_size > internal_handle->write_io_handle->maximum_segment_file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment file size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->segment_table->maximum_segment_size = maximum_segment_size;
+
+	return( 1 );
+}
+
+/* Retrieves the delta segment filename size
+ * The filename size includes the end of string character
+ * Returns 1 if successful, 0 if value not present or -1 on error
+ */
+int libewf_handle_get_delta_segment_filename_size(
+     libewf_handle_t *handle,
+     size_t *filename_size,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_delta_segment_filename_size";
+	int result                                = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->delta_segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing delta segment table.",
+		 function );
+
+		return( -1 );
+	}
+	result = libewf_segment_table_get_basename_size(
+	          internal_handle->delta_segment_table,
+	          filename_size,
 	          error );
 
 	if( result == -1 )
@@ -8383,161 +9470,3277 @@ int libewf_handle_get_filename_wide(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file IO handle for current chunk.",
+		 "%s: unable to retrieve segment table basename size.",
 		 function );
 
 		return( -1 );
 	}
-	else if( result != 0 )
+	return( result );
+}
+
+/* Retrieves the delta segment filename
+ * The filename size should include the end of string character
+ * Returns 1 if successful, 0 if value not present or -1 on error
+ */
+int libewf_handle_get_delta_segment_filename(
+     libewf_handle_t *handle,
+     char *filename,
+     size_t filename_size,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_delta_segment_filename";
+	int result                                = 0;
+
+	if( handle == NULL )
 	{
-		if( libbfio_file_get_name_wide(
-		     file_io_handle,
-		     filename,
-		     filename_size,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->delta_segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing delta segment table.",
+		 function );
+
+		return( -1 );
+	}
+	result = libewf_segment_table_get_basename(
+	          internal_handle->delta_segment_table,
+	          filename,
+	          filename_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment table basename.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets the delta segment file
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_set_delta_segment_filename(
+     libewf_handle_t *handle,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_set_delta_segment_filename";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->write_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: delta segment filename cannot be changed.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->delta_segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing delta segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_segment_table_set_basename(
+	     internal_handle->delta_segment_table,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set segment table basename.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Retrieves the delta segment filename size
+ * The filename size includes the end of string character
+ * Returns 1 if successful, 0 if value not present or -1 on error
+ */
+int libewf_handle_get_delta_segment_filename_size_wide(
+     libewf_handle_t *handle,
+     size_t *filename_size,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_delta_segment_filename_size_wide";
+	int result                                = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->delta_segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing delta segment table.",
+		 function );
+
+		return( -1 );
+	}
+	result = libewf_segment_table_get_basename_size_wide(
+	          internal_handle->delta_segment_table,
+	          filename_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment table basename size.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the delta segment filename
+ * The filename size should include the end of string character
+ * Returns 1 if successful, 0 if value not present or -1 on error
+ */
+int libewf_handle_get_delta_segment_filename_wide(
+     libewf_handle_t *handle,
+     wchar_t *filename,
+     size_t filename_size,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_delta_segment_filename_wide";
+	int result                                = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->delta_segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing delta segment table.",
+		 function );
+
+		return( -1 );
+	}
+	result = libewf_segment_table_get_basename_wide(
+	          internal_handle->delta_segment_table,
+	          filename,
+	          filename_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment table basename.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets the delta segment file
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_set_delta_segment_filename_wide(
+     libewf_handle_t *handle,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_set_delta_segment_filename_wide";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->write_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: delta segment filename cannot be changed.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->delta_segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing delta segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_segment_table_set_basename_wide(
+	     internal_handle->delta_segment_table,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set segment table basename.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif
+
+/* Retrieves the maximum delta segment file size
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_get_maximum_delta_segment_size(
+     libewf_handle_t *handle,
+     size64_t *maximum_delta_segment_size,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_maximum_delta_segment_size";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->delta_segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing delta segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_delta_segment_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum delta segment size.",
+		 function );
+
+		return( -1 );
+	}
+	*maximum_delta_segment_size = internal_handle->delta_segment_table->maximum_segment_size;
+
+	return( 1 );
+}
+
+/* Sets the maximum delta segment file size
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_set_maximum_delta_segment_size(
+     libewf_handle_t *handle,
+     size64_t maximum_delta_segment_size,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_set_maximum_delta_segment_size";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->delta_segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing delta segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_handle->write_io_handle == NULL )
+	 || ( internal_handle->write_io_handle->values_initialized != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: maximum delta segment size cannot be changed.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_delta_segment_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum delta segment size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_delta_segment_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum delta segment size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->delta_segment_table->maximum_segment_size = maximum_delta_segment_size;
+
+	return( 1 );
+}
+
+/* Retrieves the filename size of the (delta) segment file of the current chunk
+ * The filename size should include the end of string character
+ * Returns 1 if successful, 0 if no such filename or -1 on error
+ */
+int libewf_handle_get_filename_size(
+     libewf_handle_t *handle,
+     size_t *filename_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libewf_handle_get_filename_size";
+	int result                       = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libewf_handle_get_file_io_handle(
+	          handle,
+	          &file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle for current chunk.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libbfio_file_get_name_size(
+		     file_io_handle,
+		     filename_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename size.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the filename of the (delta) segment file of the current chunk
+ * The filename size should include the end of string character
+ * Returns 1 if successful, 0 if no such filename or -1 on error
+ */
+int libewf_handle_get_filename(
+     libewf_handle_t *handle,
+     char *filename,
+     size_t filename_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libewf_handle_get_filename";
+	int result                       = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libewf_handle_get_file_io_handle(
+	          handle,
+	          &file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle for current chunk.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libbfio_file_get_name(
+		     file_io_handle,
+		     filename,
+		     filename_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Retrieves the filename size of the (delta) segment file of the current chunk
+ * The filename size includes the end of string character
+ * Returns 1 if successful, 0 if no such filename or -1 on error
+ */
+int libewf_handle_get_filename_size_wide(
+     libewf_handle_t *handle,
+     size_t *filename_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libewf_handle_get_filename_size_wide";
+	int result                       = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libewf_handle_get_file_io_handle(
+	          handle,
+	          &file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle for current chunk.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libbfio_file_get_name_size_wide(
+		     file_io_handle,
+		     filename_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename size.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the filename of the (delta) segment file of the current chunk
+ * The filename size should include the end of string character
+ * Returns 1 if successful, 0 if no such filename or -1 on error
+ */
+int libewf_handle_get_filename_wide(
+     libewf_handle_t *handle,
+     wchar_t *filename,
+     size_t filename_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libewf_handle_get_filename_wide";
+	int result                       = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libewf_handle_get_file_io_handle(
+	          handle,
+	          &file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle for current chunk.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libbfio_file_get_name_wide(
+		     file_io_handle,
+		     filename,
+		     filename_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+#endif
+
+/* Retrieves the file IO handle of the (delta) segment file of the current chunk
+ * Returns 1 if successful, 0 if no such file IO handle or -1 on error
+ */
+int libewf_handle_get_file_io_handle(
+     libewf_handle_t *handle,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_file_io_handle";
+	off64_t chunk_offset                      = 0;
+	size64_t chunk_size                       = 0;
+	uint64_t chunk_index                      = 0;
+	uint32_t chunk_flags                      = 0;
+	int file_io_pool_entry                    = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle->current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid internal handle - invalid IO handle - current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_values->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid media values - missing chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_index = internal_handle->io_handle->current_offset / internal_handle->media_values->chunk_size;
+
+	if( chunk_index >= (uint64_t) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk index value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmfdata_list_get_data_range_by_index(
+	     internal_handle->chunk_table_list,
+	     (int) chunk_index,
+	     &file_io_pool_entry,
+	     &chunk_offset,
+	     &chunk_size,
+	     &chunk_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data range of chunk: %" PRIu64 ".",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	if( file_io_pool_entry == -1 )
+	{
+		return( 0 );
+	}
+	if( libbfio_pool_get_handle(
+	     internal_handle->file_io_pool,
+	     file_io_pool_entry,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle: %d from pool (chunk: %" PRIu64 ").",
+		 function,
+		 file_io_pool_entry,
+		 chunk_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads (media) data at a specific offset into a buffer
+ * This function does not use or change the current offset
+ * When multi-threading support is enabled the chunk table and its cache
+ * are only locked to look up and store chunk data, uncached chunks are
+ * read and unpacked without holding the chunk table mutex
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libewf_internal_handle_read_buffer_at_offset(
+         libewf_internal_handle_t *internal_handle,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function      = "libewf_internal_handle_read_buffer_at_offset";
+	off64_t chunk_offset       = 0;
+	size_t buffer_offset       = 0;
+	ssize_t read_count         = 0;
+	ssize_t total_read_count   = 0;
+	uint64_t chunk_index       = 0;
+	uint64_t chunk_data_offset = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	size_t read_size           = 0;
+	int result                 = 0;
+#endif
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->chunk_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - chunk data set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_values->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid media values - missing chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= internal_handle->media_values->media_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) ( offset + buffer_size ) >= internal_handle->media_values->media_size )
+	{
+		buffer_size = (size_t) ( internal_handle->media_values->media_size - offset );
+	}
+	chunk_index = offset / internal_handle->media_values->chunk_size;
+
+	if( chunk_index >= (uint64_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk index value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_offset = chunk_index * internal_handle->media_values->chunk_size;
+
+	chunk_data_offset = offset - chunk_offset;
+
+	if( chunk_data_offset >= (uint64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk data offset value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( buffer_size > 0 )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libewf_internal_handle_read_ahead_update(
+		     internal_handle,
+		     chunk_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update read-ahead.",
+			 function );
+
+			goto on_error;
+		}
+		result = libewf_internal_handle_read_uncached_chunk_data_to_buffer(
+		          internal_handle,
+		          chunk_index,
+		          (size_t) chunk_data_offset,
+		          &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+		          buffer_size,
+		          &read_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read uncached chunk: %" PRIu64 " data.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			read_count = (ssize_t) read_size;
+		}
+		else
+		{
+			/* The chunk data is stored in the chunk table cache
+			 * hence it must be copied before the mutexes are released
+			 */
+			if( libewf_internal_handle_grab_chunk_table_mutexes(
+			     internal_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab chunk table mutexes.",
+				 function );
+
+				goto on_error;
+			}
+			read_count = libewf_internal_handle_read_chunk_data_to_buffer(
+			              internal_handle,
+			              chunk_index,
+			              chunk_offset,
+			              (size_t) chunk_data_offset,
+			              &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+			              buffer_size,
+			              error );
+
+			if( libewf_internal_handle_release_chunk_table_mutexes(
+			     internal_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release chunk table mutexes.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#else
+		read_count = libewf_internal_handle_read_chunk_data_to_buffer(
+		              internal_handle,
+		              chunk_index,
+		              chunk_offset,
+		              (size_t) chunk_data_offset,
+		              &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+		              buffer_size,
+		              error );
+#endif
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk: %" PRIu64 " data.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( read_count == 0 )
+		{
+			break;
+		}
+		buffer_offset    += (size_t) read_count;
+		buffer_size      -= (size_t) read_count;
+		total_read_count += read_count;
+		offset           += (off64_t) read_count;
+		chunk_index      += 1;
+		chunk_offset     += internal_handle->media_values->chunk_size;
+		chunk_data_offset = 0;
+
+		if( (size64_t) offset >= internal_handle->media_values->media_size )
+		{
+			break;
+		}
+		if( internal_handle->io_handle->abort != 0 )
+		{
+			break;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( total_read_count );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Reads the data of a specific chunk into a buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libewf_internal_handle_read_chunk_data_to_buffer(
+         libewf_internal_handle_t *internal_handle,
+         uint64_t chunk_index,
+         off64_t chunk_offset,
+         size_t chunk_data_offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libewf_chunk_data_t *chunk_data = NULL;
+	const uint8_t *data             = NULL;
+	static char *function           = "libewf_internal_handle_read_chunk_data_to_buffer";
+	size_t data_size                = 0;
+	size_t read_size                = 0;
+	int result                      = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* Uncompressed chunks are copied directly from the memory mapped segment file
+	 * instead of being read into the chunk table cache first
+	 */
+	result = libewf_internal_handle_get_memory_mapped_chunk_data(
+	          internal_handle,
+	          chunk_index,
+	          &data,
+	          &data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve memory mapped data of chunk: %" PRIu64 ".",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( libewf_read_io_handle_read_chunk_data(
+		     internal_handle->read_io_handle,
+		     internal_handle->io_handle->compression_context,
+		     internal_handle->file_io_pool,
+		     internal_handle->media_values,
+		     internal_handle->chunk_table_list,
+		     internal_handle->chunk_table_cache,
+		     (int) chunk_index,
+		     chunk_offset,
+		     &chunk_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk data: %" PRIu64 ".",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		if( chunk_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing chunk data: %" PRIu64 ".",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		data      = chunk_data->data;
+		data_size = chunk_data->data_size;
+	}
+	if( chunk_data_offset > data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: chunk offset exceeds chunk data size.",
+		 function );
+
+		return( -1 );
+	}
+	read_size = data_size - chunk_data_offset;
+
+	if( read_size > buffer_size )
+	{
+		read_size = buffer_size;
+	}
+	if( read_size == 0 )
+	{
+		return( 0 );
+	}
+	if( memory_copy(
+	     buffer,
+	     &( data[ chunk_data_offset ] ),
+	     read_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy chunk data to buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( (ssize_t) read_size );
+}
+
+/* Retrieves the memory mapped data of a specific chunk
+ * Only uncompressed chunks that are not flagged as corrupted, tainted or delta
+ * and have a matching checksum are used, other chunks are read as before
+ * Returns 1 if successful, 0 if the chunk data is not available or -1 on error
+ */
+int libewf_internal_handle_get_memory_mapped_chunk_data(
+     libewf_internal_handle_t *internal_handle,
+     uint64_t chunk_index,
+     const uint8_t **chunk_data,
+     size_t *chunk_data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *mapped_data   = NULL;
+	static char *function        = "libewf_internal_handle_get_memory_mapped_chunk_data";
+	off64_t chunk_offset         = 0;
+	size64_t chunk_size          = 0;
+	size_t data_size             = 0;
+	uint32_t calculated_checksum = 0;
+	uint32_t chunk_flags         = 0;
+	uint32_t stored_checksum     = 0;
+	int file_io_pool_entry       = 0;
+	int result                   = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Chunks of a handle that is opened for writing can be modified
+	 */
+	if( ( internal_handle->use_memory_map == 0 )
+	 || ( internal_handle->file_io_pool == NULL )
+	 || ( internal_handle->chunk_table_list == NULL )
+	 || ( ( internal_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_WRITE ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( chunk_index >= (uint64_t) internal_handle->media_values->number_of_chunks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* A chunk without a valid data range is handled by the regular read path
+	 * e.g. a chunk that is missing in a truncated segment file is zero filled
+	 */
+	if( libewf_chunk_table_get_chunk_range(
+	     internal_handle->chunk_table_list,
+	     internal_handle->file_io_pool,
+	     (int) chunk_index,
+	     &file_io_pool_entry,
+	     &chunk_offset,
+	     &chunk_size,
+	     &chunk_flags,
+	     error ) != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to retrieve data range of chunk: %" PRIu64 ".\n",
+			 function,
+			 chunk_index );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+
+		return( 0 );
+	}
+	if( ( file_io_pool_entry < 0 )
+	 || ( ( chunk_flags & ( LIBMFDATA_RANGE_FLAG_IS_COMPRESSED | LIBMFDATA_RANGE_FLAG_IS_SPARSE ) ) != 0 )
+	 || ( ( chunk_flags & ( LIBEWF_RANGE_FLAG_IS_DELTA | LIBEWF_RANGE_FLAG_IS_TAINTED | LIBEWF_RANGE_FLAG_IS_CORRUPTED ) ) != 0 )
+	 || ( chunk_size <= (size64_t) sizeof( uint32_t ) )
+	 || ( chunk_size > (size64_t) ( internal_handle->media_values->chunk_size + sizeof( uint32_t ) ) ) )
+	{
+		return( 0 );
+	}
+	result = libbfio_pool_get_memory_mapped_data(
+	          internal_handle->file_io_pool,
+	          file_io_pool_entry,
+	          chunk_offset,
+	          (size_t) chunk_size,
+	          &mapped_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve memory mapped data of chunk: %" PRIu64 " from file IO pool entry: %d.",
+		 function,
+		 chunk_index,
+		 file_io_pool_entry );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	data_size = (size_t) chunk_size - sizeof( uint32_t );
+
+	/* The checksum of the most recently used chunk is only calculated once
+	 * since a chunk is typically accessed by multiple consecutive reads
+	 */
+	if( ( mapped_data != internal_handle->memory_mapped_chunk_data )
+	 || ( chunk_index != internal_handle->memory_mapped_chunk_index ) )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( mapped_data[ data_size ] ),
+		 stored_checksum );
+
+		calculated_checksum = ewf_checksum_calculate(
+		                       mapped_data,
+		                       data_size,
+		                       1 );
+
+		if( stored_checksum != calculated_checksum )
+		{
+			return( 0 );
+		}
+		internal_handle->memory_mapped_chunk_data  = mapped_data;
+		internal_handle->memory_mapped_chunk_index = chunk_index;
+	}
+	*chunk_data      = mapped_data;
+	*chunk_data_size = data_size;
+
+	return( 1 );
+}
+
+/* Reads the data of a batch of consecutive chunks into the chunk table cache
+ * The chunks are stored packed, they are decompressed when the chunks are read
+ * Returns the number of chunks read if successful or -1 on error
+ */
+int libewf_internal_handle_read_chunks_batch(
+     libewf_internal_handle_t *internal_handle,
+     uint64_t chunk_index,
+     int number_of_chunks,
+     libcerror_error_t **error )
+{
+	static char *function       = "libewf_internal_handle_read_chunks_batch";
+	int number_of_cache_entries = 0;
+	int number_of_chunks_read   = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of chunks value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* Chunks are not batched while writing, the chunk table is still being filled
+	 */
+	if( ( internal_handle->write_io_handle != NULL )
+	 || ( chunk_index >= (uint64_t) internal_handle->media_values->number_of_chunks ) )
+	{
+		return( 0 );
+	}
+	if( (uint64_t) number_of_chunks > ( (uint64_t) internal_handle->media_values->number_of_chunks - chunk_index ) )
+	{
+		number_of_chunks = (int) ( internal_handle->media_values->number_of_chunks - chunk_index );
+	}
+	if( libfcache_cache_get_number_of_entries(
+	     internal_handle->chunk_table_cache,
+	     &number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunk table cache entries.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the chunks of the batch do not evict each other
+	 */
+	if( number_of_chunks > number_of_cache_entries )
+	{
+		number_of_chunks = number_of_cache_entries;
+	}
+	number_of_chunks_read = libewf_chunk_table_read_chunks(
+	                         internal_handle->chunk_table_list,
+	                         internal_handle->file_io_pool,
+	                         internal_handle->chunk_table_cache,
+	                         (int) chunk_index,
+	                         number_of_chunks,
+	                         error );
+
+	if( number_of_chunks_read == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunks.",
+		 function );
+
+		return( -1 );
+	}
+	return( number_of_chunks_read );
+}
+
+/* Resizes the chunk table cache to fit the maximum cache size
+ * The cache holds at least LIBEWF_MINIMUM_NUMBER_OF_CACHED_CHUNKS chunks
+ * in addition to the chunks that are read ahead
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_internal_handle_resize_chunk_table_cache(
+     libewf_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	static char *function       = "libewf_internal_handle_resize_chunk_table_cache";
+	size64_t number_of_chunks   = 0;
+	int number_of_cache_entries = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing media values.",
+		 function );
+
+		return( -1 );
+	}
+	/* The chunk size is not known until the media values have been read
+	 */
+	if( ( internal_handle->chunk_table_cache == NULL )
+	 || ( internal_handle->media_values->chunk_size == 0 ) )
+	{
+		return( 1 );
+	}
+	number_of_chunks = internal_handle->maximum_cache_size
+	                 / internal_handle->media_values->chunk_size;
+
+	if( number_of_chunks < (size64_t) LIBEWF_MINIMUM_NUMBER_OF_CACHED_CHUNKS )
+	{
+		number_of_chunks = (size64_t) LIBEWF_MINIMUM_NUMBER_OF_CACHED_CHUNKS;
+	}
+	/* Make sure the chunks that are read ahead do not evict
+	 * the chunks that are being read
+	 */
+	number_of_chunks += (size64_t) internal_handle->number_of_read_ahead_chunks;
+
+	if( number_of_chunks > (size64_t) ( INT_MAX / 2 ) )
+	{
+		number_of_chunks = (size64_t) ( INT_MAX / 2 );
+	}
+	if( libfcache_cache_get_number_of_entries(
+	     internal_handle->chunk_table_cache,
+	     &number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunk table cache entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_cache_entries == (int) number_of_chunks )
+	{
+		return( 1 );
+	}
+	if( libfcache_cache_resize(
+	     internal_handle->chunk_table_cache,
+	     (int) number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize chunk table cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Grabs the chunk table and file IO pool mutexes
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_internal_handle_grab_chunk_table_mutexes(
+     libewf_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_internal_handle_grab_chunk_table_mutexes";
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_handle->chunk_table_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab chunk table mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_handle->file_io_pool_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab file IO pool mutex.",
+		 function );
+
+		libcthreads_mutex_release(
+		 internal_handle->chunk_table_mutex,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Releases the file IO pool and chunk table mutexes
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_internal_handle_release_chunk_table_mutexes(
+     libewf_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_internal_handle_release_chunk_table_mutexes";
+	int result            = 1;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_release(
+	     internal_handle->file_io_pool_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO pool mutex.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     internal_handle->chunk_table_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release chunk table mutex.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Reads and unpacks the data of a specific chunk that is not cached
+ * Only the file IO pool mutex is held while the chunk data is read and
+ * no mutex is held while it is unpacked, the chunk data is not stored
+ * in the chunk table cache
+ * Returns 1 if successful, 0 if the chunk data should be read using
+ * the chunk table cache or -1 on error
+ */
+int libewf_internal_handle_read_uncached_chunk_data(
+     libewf_internal_handle_t *internal_handle,
+     uint64_t chunk_index,
+     libewf_chunk_data_t **chunk_data,
+     int *file_io_pool_entry,
+     off64_t *chunk_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_internal_handle_read_uncached_chunk_data";
+	size64_t chunk_size   = 0;
+	uint32_t chunk_flags  = 0;
+	int result            = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* Chunks of a handle that is opened for writing can be modified
+	 * and memory mapped chunks are not stored in the chunk table cache
+	 */
+	if( ( internal_handle->file_io_pool == NULL )
+	 || ( internal_handle->chunk_table_list == NULL )
+	 || ( internal_handle->use_memory_map != 0 )
+	 || ( ( internal_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_WRITE ) != 0 )
+	 || ( chunk_index >= (uint64_t) internal_handle->media_values->number_of_chunks ) )
+	{
+		return( 0 );
+	}
+	if( libewf_internal_handle_grab_chunk_table_mutexes(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab chunk table mutexes.",
+		 function );
+
+		return( -1 );
+	}
+	/* Retrieving the chunk range can require the chunk group to be read
+	 * hence the file IO pool mutex is held as well
+	 */
+	result = libewf_chunk_table_get_uncached_chunk_range(
+	          internal_handle->chunk_table_list,
+	          internal_handle->file_io_pool,
+	          internal_handle->chunk_table_cache,
+	          (int) chunk_index,
+	          file_io_pool_entry,
+	          chunk_offset,
+	          &chunk_size,
+	          &chunk_flags,
+	          error );
+
+	/* A chunk of which the table section has not been read yet
+	 * is handled by the chunk table cache
+	 */
+	if( result == -1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to retrieve uncached data range of chunk: %" PRIu64 ".\n",
+			 function,
+			 chunk_index );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+
+		result = 0;
+	}
+	if( libcthreads_mutex_release(
+	     internal_handle->chunk_table_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release chunk table mutex.",
+		 function );
+
+		libcthreads_mutex_release(
+		 internal_handle->file_io_pool_mutex,
+		 NULL );
+
+		return( -1 );
+	}
+	if( result != 0 )
+	{
+		result = libewf_chunk_table_read_chunk_data(
+		          internal_handle->file_io_pool,
+		          *file_io_pool_entry,
+		          *chunk_offset,
+		          chunk_size,
+		          chunk_flags,
+		          chunk_data,
+		          error );
+	}
+	if( libcthreads_mutex_release(
+	     internal_handle->file_io_pool_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO pool mutex.",
+		 function );
+
+		goto on_error;
+	}
+	/* A chunk that cannot be read is handled by the chunk table cache
+	 * e.g. it is zero filled if it is missing in a truncated segment file
+	 */
+	if( result == -1 )
+	{
+		libcerror_error_free(
+		 error );
+
+		return( 0 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libewf_chunk_data_unpack(
+	     *chunk_data,
+	     internal_handle->io_handle->compression_context,
+	     internal_handle->media_values->chunk_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to unpack chunk data: %" PRIu64 ".",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	/* A corrupted chunk is read again using the chunk table cache
+	 * which also keeps track of the checksum errors
+	 */
+	if( ( *chunk_data )->is_corrupt != 0 )
+	{
+		libewf_chunk_data_free(
+		 chunk_data,
+		 NULL );
+
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( *chunk_data != NULL )
+	{
+		libewf_chunk_data_free(
+		 chunk_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Stores the data of a specific chunk in the chunk table cache
+ * The chunk table mutex is held while the chunk data is stored and
+ * the cache takes over management of the chunk data
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_internal_handle_set_cached_chunk_data(
+     libewf_internal_handle_t *internal_handle,
+     int file_io_pool_entry,
+     off64_t chunk_offset,
+     libewf_chunk_data_t **chunk_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_internal_handle_set_cached_chunk_data";
+	int result            = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_handle->chunk_table_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab chunk table mutex.",
+		 function );
+
+		return( -1 );
+	}
+	/* Another thread could have stored the same chunk in the mean time
+	 * in which case the cached chunk data is replaced
+	 */
+	result = libewf_chunk_table_set_cached_chunk_data(
+	          internal_handle->chunk_table_cache,
+	          file_io_pool_entry,
+	          chunk_offset,
+	          *chunk_data,
+	          error );
+
+	if( result == 1 )
+	{
+		*chunk_data = NULL;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set chunk data in cache.",
+		 function );
+	}
+	if( libcthreads_mutex_release(
+	     internal_handle->chunk_table_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release chunk table mutex.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Reads the data of a specific chunk that is not cached into a buffer
+ * The chunk data is stored in the chunk table cache afterwards
+ * Returns 1 if successful, 0 if the chunk data should be read using
+ * the chunk table cache or -1 on error
+ */
+int libewf_internal_handle_read_uncached_chunk_data_to_buffer(
+     libewf_internal_handle_t *internal_handle,
+     uint64_t chunk_index,
+     size_t chunk_data_offset,
+     uint8_t *buffer,
+     size_t buffer_size,
+     size_t *read_size,
+     libcerror_error_t **error )
+{
+	libewf_chunk_data_t *chunk_data = NULL;
+	static char *function           = "libewf_internal_handle_read_uncached_chunk_data_to_buffer";
+	off64_t chunk_offset            = 0;
+	size_t data_size                = 0;
+	int file_io_pool_entry          = 0;
+	int result                      = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libewf_internal_handle_read_uncached_chunk_data(
+	          internal_handle,
+	          chunk_index,
+	          &chunk_data,
+	          &file_io_pool_entry,
+	          &chunk_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read uncached chunk: %" PRIu64 " data.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( chunk_data_offset > chunk_data->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: chunk offset exceeds chunk data size.",
+		 function );
+
+		goto on_error;
+	}
+	data_size = chunk_data->data_size - chunk_data_offset;
+
+	if( data_size > buffer_size )
+	{
+		data_size = buffer_size;
+	}
+	if( memory_copy(
+	     buffer,
+	     &( chunk_data->data[ chunk_data_offset ] ),
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy chunk data to buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_internal_handle_set_cached_chunk_data(
+	     internal_handle,
+	     file_io_pool_entry,
+	     chunk_offset,
+	     &chunk_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set chunk: %" PRIu64 " data in cache.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	*read_size = data_size;
+
+	return( 1 );
+
+on_error:
+	if( chunk_data != NULL )
+	{
+		libewf_chunk_data_free(
+		 &chunk_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Starts the read-ahead thread
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_internal_handle_read_ahead_start(
+     libewf_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_internal_handle_read_ahead_start";
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->read_ahead_thread != NULL )
+	{
+		return( 1 );
+	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_handle->read_ahead_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read-ahead mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( internal_handle->read_ahead_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read-ahead condition.",
+		 function );
+
+		goto on_error;
+	}
+	/* The first chunk is considered to be read sequentially
+	 */
+	internal_handle->read_ahead_last_chunk_index = (uint64_t) -1;
+	internal_handle->read_ahead_chunk_index      = 0;
+	internal_handle->read_ahead_end_chunk_index  = 0;
+	internal_handle->read_ahead_stop             = 0;
+
+	if( libcthreads_thread_create(
+	     &( internal_handle->read_ahead_thread ),
+	     &libewf_internal_handle_read_ahead_thread_function,
+	     (void *) internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read-ahead thread.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_handle->read_ahead_condition != NULL )
+	{
+		libcthreads_condition_free(
+		 &( internal_handle->read_ahead_condition ),
+		 NULL );
+	}
+	if( internal_handle->read_ahead_mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( internal_handle->read_ahead_mutex ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Stops the read-ahead thread
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_internal_handle_read_ahead_stop(
+     libewf_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_internal_handle_read_ahead_stop";
+	int result            = 1;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->read_ahead_thread == NULL )
+	{
+		return( 1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_handle->read_ahead_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read-ahead mutex.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->read_ahead_stop = 1;
+
+	if( libcthreads_condition_broadcast(
+	     internal_handle->read_ahead_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast read-ahead condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     internal_handle->read_ahead_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read-ahead mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	if( libcthreads_thread_join(
+	     &( internal_handle->read_ahead_thread ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join read-ahead thread.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_condition_free(
+	     &( internal_handle->read_ahead_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free read-ahead condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_free(
+	     &( internal_handle->read_ahead_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free read-ahead mutex.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Updates the read-ahead with the index of the chunk that is being read
+ * When the chunks are read sequentially the read-ahead thread is signalled
+ * to read the next chunks, otherwise pending read-ahead is cancelled
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_internal_handle_read_ahead_update(
+     libewf_internal_handle_t *internal_handle,
+     uint64_t chunk_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_internal_handle_read_ahead_update";
+	int result            = 1;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->read_ahead_thread == NULL )
+	{
+		return( 1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_handle->read_ahead_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read-ahead mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_index == internal_handle->read_ahead_last_chunk_index )
+	 || ( chunk_index == ( internal_handle->read_ahead_last_chunk_index + 1 ) ) )
+	{
+		internal_handle->read_ahead_end_chunk_index = chunk_index + 1
+		                                            + internal_handle->number_of_read_ahead_chunks;
+
+		if( internal_handle->read_ahead_chunk_index <= chunk_index )
+		{
+			internal_handle->read_ahead_chunk_index = chunk_index + 1;
+		}
+		if( libcthreads_condition_signal(
+		     internal_handle->read_ahead_condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal read-ahead condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	else
+	{
+		internal_handle->read_ahead_chunk_index     = chunk_index + 1;
+		internal_handle->read_ahead_end_chunk_index = chunk_index + 1;
+	}
+	internal_handle->read_ahead_last_chunk_index = chunk_index;
+
+	if( libcthreads_mutex_release(
+	     internal_handle->read_ahead_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read-ahead mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* The read-ahead thread function
+ * Reads and decompresses the chunks ahead of the caller into the chunk table cache
+ * Errors are not fatal here, they are reported when the caller reads the chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_internal_handle_read_ahead_thread_function(
+     void *arguments )
+{
+	libcerror_error_t *error                  = NULL;
+	libewf_chunk_data_t *chunk_data           = NULL;
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_internal_handle_read_ahead_thread_function";
+	off64_t chunk_offset                      = 0;
+	uint64_t chunk_index                      = 0;
+	int file_io_pool_entry                    = 0;
+	int result                                = 0;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) arguments;
+
+	while( 1 )
+	{
+		if( libcthreads_mutex_grab(
+		     internal_handle->read_ahead_mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read-ahead mutex.",
+			 function );
+
+			goto on_error;
+		}
+		while( ( internal_handle->read_ahead_stop == 0 )
+		    && ( internal_handle->read_ahead_chunk_index >= internal_handle->read_ahead_end_chunk_index ) )
+		{
+			if( libcthreads_condition_wait(
+			     internal_handle->read_ahead_condition,
+			     internal_handle->read_ahead_mutex,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for read-ahead condition.",
+				 function );
+
+				libcthreads_mutex_release(
+				 internal_handle->read_ahead_mutex,
+				 NULL );
+
+				goto on_error;
+			}
+		}
+		if( internal_handle->read_ahead_stop != 0 )
+		{
+			libcthreads_mutex_release(
+			 internal_handle->read_ahead_mutex,
+			 NULL );
+
+			break;
+		}
+		chunk_index = internal_handle->read_ahead_chunk_index;
+
+		internal_handle->read_ahead_chunk_index += 1;
+
+		if( libcthreads_mutex_release(
+		     internal_handle->read_ahead_mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read-ahead mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( chunk_index >= (uint64_t) internal_handle->media_values->number_of_chunks )
+		{
+			continue;
+		}
+		/* The read/write lock is grabbed for reading, like the read functions,
+		 * the chunk data is read and unpacked without holding the chunk table mutex
+		 */
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_handle->read_write_lock,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
+
+			goto on_error;
+		}
+		result = libewf_internal_handle_read_uncached_chunk_data(
+		          internal_handle,
+		          chunk_index,
+		          &chunk_data,
+		          &file_io_pool_entry,
+		          &chunk_offset,
+		          &error );
+
+		if( result == 1 )
+		{
+			result = libewf_internal_handle_set_cached_chunk_data(
+			          internal_handle,
+			          file_io_pool_entry,
+			          chunk_offset,
+			          &chunk_data,
+			          &error );
+		}
+		/* Chunks that are cached, are not part of a chunk group or cannot be read
+		 * are left to the read functions
+		 */
+		if( result == -1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to read ahead chunk: %" PRIu64 ".\n",
+				 function,
+				 chunk_index );
+
+				libcnotify_print_error_backtrace(
+				 error );
+			}
+#endif
+			libcerror_error_free(
+			 &error );
+		}
+		if( chunk_data != NULL )
+		{
+			libewf_chunk_data_free(
+			 &chunk_data,
+			 NULL );
+		}
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_handle->read_write_lock,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	return( -1 );
+}
+
+/* Scans the segment files concurrently
+ * The segment file header and the section starts of every segment file are read
+ * using a bounded number of threads, the sections themselves are read afterwards
+ * in segment file order
+ * Returns 1 if successful, 0 if the segment files were not scanned or -1 on error
+ */
+int libewf_internal_handle_scan_segment_files(
+     libewf_internal_handle_t *internal_handle,
+     libbfio_pool_t *file_io_pool,
+     int number_of_segment_files,
+     libcdata_array_t **segment_file_scans_array,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle                 = NULL;
+	libcthreads_thread_pool_t *scan_thread_pool      = NULL;
+	libewf_segment_file_scan_t *segment_file_scan    = NULL;
+	static char *function                            = "libewf_internal_handle_scan_segment_files";
+	int file_io_pool_entry                           = 0;
+	int number_of_threads                            = 0;
+	int segment_files_list_index                     = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_file_scans_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment file scans array.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segment_file_scans_array != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segment file scans array value already set.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_threads = number_of_segment_files;
+
+	if( number_of_threads > LIBEWF_MAXIMUM_NUMBER_OF_SCAN_THREADS )
+	{
+		number_of_threads = LIBEWF_MAXIMUM_NUMBER_OF_SCAN_THREADS;
+	}
+	/* Every scan thread keeps a single segment file open
+	 */
+	if( ( internal_handle->maximum_number_of_open_handles > 0 )
+	 && ( number_of_threads > internal_handle->maximum_number_of_open_handles ) )
+	{
+		number_of_threads = internal_handle->maximum_number_of_open_handles;
+	}
+	if( number_of_threads <= 1 )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_initialize(
+	     segment_file_scans_array,
+	     number_of_segment_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create segment file scans array.",
+		 function );
+
+		goto on_error;
+	}
+	for( segment_files_list_index = 0;
+	     segment_files_list_index < number_of_segment_files;
+	     segment_files_list_index++ )
+	{
+		if( libmfdata_file_list_get_file_by_index(
+		     internal_handle->segment_files_list,
+		     segment_files_list_index,
+		     &file_io_pool_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment file: %d from list.",
+			 function,
+			 segment_files_list_index + 1 );
+
+			goto on_error;
+		}
+		if( libbfio_pool_get_handle(
+		     file_io_pool,
+		     file_io_pool_entry,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file IO handle: %d from pool.",
+			 function,
+			 file_io_pool_entry );
+
+			goto on_error;
+		}
+		if( libewf_segment_file_scan_initialize(
+		     &segment_file_scan,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create segment file scan.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_array_set_entry_by_index(
+		     *segment_file_scans_array,
+		     segment_files_list_index,
+		     (intptr_t *) segment_file_scan,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set segment file scan: %d in array.",
+			 function,
+			 segment_files_list_index );
+
+			libewf_segment_file_scan_free(
+			 &segment_file_scan,
+			 NULL );
+
+			goto on_error;
+		}
+		segment_file_scan = NULL;
+	}
+	if( libcthreads_thread_pool_create(
+	     &scan_thread_pool,
+	     number_of_threads,
+	     number_of_segment_files,
+	     (int (*)(intptr_t *, void *)) &libewf_internal_handle_scan_segment_file_callback,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	for( segment_files_list_index = 0;
+	     segment_files_list_index < number_of_segment_files;
+	     segment_files_list_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     *segment_file_scans_array,
+		     segment_files_list_index,
+		     (intptr_t **) &segment_file_scan,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment file scan: %d from array.",
+			 function,
+			 segment_files_list_index );
+
+			goto on_error;
+		}
+		if( libcthreads_thread_pool_push(
+		     scan_thread_pool,
+		     (intptr_t *) segment_file_scan,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push segment file scan: %d onto thread pool.",
+			 function,
+			 segment_files_list_index );
+
+			goto on_error;
+		}
+	}
+	segment_file_scan = NULL;
+
+	if( libcthreads_thread_pool_join(
+	     &scan_thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join scan thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	/* The thread pool is joined before the segment file scans are freed
+	 */
+	if( scan_thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &scan_thread_pool,
+		 NULL );
+	}
+	if( *segment_file_scans_array != NULL )
+	{
+		libcdata_array_free(
+		 segment_file_scans_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libewf_segment_file_scan_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Callback function to scan a segment file
+ * A segment file that cannot be scanned is read without the scan,
+ * so that its errors are reported the same way as when scanning is not used
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_internal_handle_scan_segment_file_callback(
+     libewf_segment_file_scan_t *segment_file_scan,
+     void *arguments LIBEWF_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	static char *function    = "libewf_internal_handle_scan_segment_file_callback";
+#endif
+
+	LIBEWF_UNREFERENCED_PARAMETER( arguments )
+
+	if( segment_file_scan == NULL )
+	{
+		return( -1 );
+	}
+	segment_file_scan->result = libewf_segment_file_scan_read(
+	                             segment_file_scan,
+	                             &error );
+
+	if( segment_file_scan->result != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to scan segment file: %" PRIu16 ".\n",
+			 function,
+			 segment_file_scan->segment_number );
+
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Opens the index file
+ * Returns 1 if successful, 0 if no index filename was set or -1 on error
+ */
+int libewf_internal_handle_open_index_file(
+     libewf_internal_handle_t *internal_handle,
+     int access_flags,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_internal_handle_open_index_file";
+	int result            = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->index_filename != NULL )
+	{
+		if( libbfio_file_initialize(
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		result = libbfio_file_set_name(
+		          *file_io_handle,
+		          internal_handle->index_filename,
+		          internal_handle->index_filename_size - 1,
+		          error );
+	}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	else if( internal_handle->index_filename_wide != NULL )
+	{
+		if( libbfio_file_initialize(
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		result = libbfio_file_set_name_wide(
+		          *file_io_handle,
+		          internal_handle->index_filename_wide,
+		          internal_handle->index_filename_wide_size - 1,
+		          error );
+	}
+#endif
+	else
+	{
+		return( 0 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     *file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the index file and determines if it matches the segment files
+ * Returns 1 if successful, 0 if no usable index file is available or -1 on error
+ */
+int libewf_internal_handle_read_index_file(
+     libewf_internal_handle_t *internal_handle,
+     libbfio_pool_t *file_io_pool,
+     libewf_index_file_t *index_file,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libewf_internal_handle_read_index_file";
+	int result                       = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	result = libewf_internal_handle_open_index_file(
+	          internal_handle,
+	          LIBBFIO_OPEN_READ,
+	          &file_io_handle,
+	          error );
+
+	if( result == 1 )
+	{
+		result = libewf_index_file_read(
+		          index_file,
+		          file_io_handle,
+		          error );
+
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     NULL ) != 0 )
+		{
+			result = -1;
+		}
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( result == 1 )
+	{
+		result = libewf_index_file_validate(
+		          index_file,
+		          file_io_pool,
+		          internal_handle->segment_files_list,
+		          error );
+	}
+	if( result != 1 )
+	{
+		/* An index file that cannot be read or does not match the segment files is recreated
+		 */
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: index file not available or out of date.\n",
+			 function );
+		}
+#endif
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		if( libcdata_array_empty(
+		     index_file->segments_array,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_index_file_segment_free,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve filename.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty index file segments array.",
 			 function );
 
 			return( -1 );
 		}
+		return( 0 );
 	}
-	return( result );
+	return( 1 );
 }
 
-#endif
-
-/* Retrieves the file IO handle of the (delta) segment file of the current chunk
- * Returns 1 if successful, 0 if no such file IO handle or -1 on error
+/* Writes the index file
+ * Returns 1 if successful, 0 if no index filename was set or -1 on error
  */
-int libewf_handle_get_file_io_handle(
-     libewf_handle_t *handle,
-     libbfio_handle_t **file_io_handle,
+int libewf_internal_handle_write_index_file(
+     libewf_internal_handle_t *internal_handle,
+     libewf_index_file_t *index_file,
      libcerror_error_t **error )
 {
-	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_file_io_handle";
-	off64_t chunk_offset                      = 0;
-	size64_t chunk_size                       = 0;
-	uint64_t chunk_index                      = 0;
-	uint32_t chunk_flags                      = 0;
-	int file_io_pool_entry                    = 0;
-
-	if( handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
-		 function );
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libewf_internal_handle_write_index_file";
+	int result                       = 0;
 
-		return( -1 );
-	}
-	internal_handle = (libewf_internal_handle_t *) handle;
+	result = libewf_internal_handle_open_index_file(
+	          internal_handle,
+	          LIBBFIO_OPEN_WRITE_TRUNCATE,
+	          &file_io_handle,
+	          error );
 
-	if( internal_handle->io_handle == NULL )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index file.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle->current_offset < 0 )
+	else if( result == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid internal handle - invalid IO handle - current offset value out of bounds.",
-		 function );
-
-		return( -1 );
+		return( 0 );
 	}
-	if( internal_handle->media_values == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing media values.",
-		 function );
+	result = libewf_index_file_write(
+	          index_file,
+	          file_io_handle,
+	          error );
 
-		return( -1 );
-	}
-	if( internal_handle->media_values->chunk_size == 0 )
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - invalid media values - missing chunk size.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	chunk_index = internal_handle->io_handle->current_offset / internal_handle->media_values->chunk_size;
-
-	if( chunk_index >= (uint64_t) INT32_MAX )
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid chunk index value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close index file.",
 		 function );
 
-		return( -1 );
-	}
-	if( libmfdata_list_get_data_range_by_index(
-	     internal_handle->chunk_table_list,
-	     (int) chunk_index,
-	     &file_io_pool_entry,
-	     &chunk_offset,
-	     &chunk_size,
-	     &chunk_flags,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve data range of chunk: %" PRIu64 ".",
-		 function,
-		 chunk_index );
-
-		return( -1 );
-	}
-	if( file_io_pool_entry == -1 )
-	{
-		return( 0 );
+		result = -1;
 	}
-	if( libbfio_pool_get_handle(
-	     internal_handle->file_io_pool,
-	     file_io_pool_entry,
-	     file_io_handle,
+	if( libbfio_handle_free(
+	     &file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file IO handle: %d from pool (chunk: %" PRIu64 ").",
-		 function,
-		 file_io_pool_entry,
-		 chunk_index );
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Retrieves the maximum number of supported segment files to write
@@ -8675,14 +12878,14 @@ int libewf_internal_handle_get_media_values(
 		{
 			chunk_index = number_of_chunks - 1;
 
-			/* This function will expand element groups
+			/* This function will read chunk groups
 			 */
-			if( libmfdata_list_get_element_value_by_index(
+			if( libewf_chunk_table_get_chunk_data(
 			     internal_handle->chunk_table_list,
 			     internal_handle->file_io_pool,
 			     internal_handle->chunk_table_cache,
 			     chunk_index,
-			     (intptr_t **) &chunk_data,
+			     &chunk_data,
 			     0,
 			     error ) != 1 )
 			{
@@ -8717,6 +12920,7 @@ int libewf_internal_handle_get_media_values(
 			 */
 			if( libewf_chunk_data_unpack(
 			     chunk_data,
+			     internal_handle->io_handle->compression_context,
 			     internal_handle->media_values->chunk_size,
 			     error ) != 1 )
 			{
@@ -9028,6 +13232,142 @@ int libewf_internal_handle_set_format(
 	return( 1 );
 }
 
+/* Retrieves the single file entry tree index
+ * The index is created on first use
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_internal_handle_get_single_file_tree_index(
+     libewf_internal_handle_t *internal_handle,
+     libewf_single_file_tree_index_t **single_file_tree_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_internal_handle_get_single_file_tree_index";
+	int result            = 1;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->single_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing single files.",
+		 function );
+
+		return( -1 );
+	}
+	if( single_file_tree_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single file tree index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*single_file_tree_index = internal_handle->single_files->file_entry_tree_index;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( *single_file_tree_index != NULL )
+	 || ( internal_handle->single_files->root_file_entry_node == NULL ) )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Another thread could have created the index in the mean time
+	 */
+	if( internal_handle->single_files->file_entry_tree_index == NULL )
+	{
+		if( libewf_single_file_tree_index_initialize(
+		     &( internal_handle->single_files->file_entry_tree_index ),
+		     internal_handle->single_files->root_file_entry_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create single file entry tree index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	*single_file_tree_index = internal_handle->single_files->file_entry_tree_index;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
 /* Retrieves the root (single) file entry
  * Returns 1 if successful, 0 if no file entries are present or -1 on error
  */
@@ -9119,16 +13459,17 @@ int libewf_file_get_file_entry_by_utf8_path(
      libewf_file_entry_t **file_entry,
      libcerror_error_t **error )
 {
-	libewf_internal_handle_t *internal_handle         = NULL;
-	libewf_single_file_entry_t *single_file_entry     = NULL;
-	libewf_single_file_entry_t *sub_single_file_entry = NULL;
-	libcdata_tree_node_t *node                        = NULL;
-	libcdata_tree_node_t *sub_node                    = NULL;
-	uint8_t *utf8_string_segment                      = NULL;
-	static char *function                             = "libewf_file_get_file_entry_by_utf8_path";
-	size_t utf8_string_index                          = 0;
-	size_t utf8_string_segment_length                 = 0;
-	int result                                        = 0;
+	libewf_internal_handle_t *internal_handle               = NULL;
+	libewf_single_file_entry_t *single_file_entry           = NULL;
+	libewf_single_file_entry_t *sub_single_file_entry       = NULL;
+	libewf_single_file_tree_index_t *single_file_tree_index = NULL;
+	libcdata_tree_node_t *node                              = NULL;
+	libcdata_tree_node_t *sub_node                          = NULL;
+	uint8_t *utf8_string_segment                            = NULL;
+	static char *function                                   = "libewf_file_get_file_entry_by_utf8_path";
+	size_t utf8_string_index                                = 0;
+	size_t utf8_string_segment_length                       = 0;
+	int result                                              = 0;
 
 	if( handle == NULL )
 	{
@@ -9236,6 +13577,20 @@ int libewf_file_get_file_entry_by_utf8_path(
 			utf8_string_index++;
 		}
 	}
+	if( libewf_internal_handle_get_single_file_tree_index(
+	     internal_handle,
+	     &single_file_tree_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve single file tree index.",
+		 function );
+
+		return( -1 );
+	}
 	node = internal_handle->single_files->root_file_entry_node;
 
 	if( ( utf8_string_length == 0 )
@@ -9273,6 +13628,7 @@ int libewf_file_get_file_entry_by_utf8_path(
 			return( -1 );
 		}
 		result = libewf_single_file_tree_get_sub_node_by_utf8_name(
+			  single_file_tree_index,
 			  node,
 			  utf8_string_segment,
 			  utf8_string_segment_length,
@@ -9330,16 +13686,17 @@ int libewf_file_get_file_entry_by_utf16_path(
      libewf_file_entry_t **file_entry,
      libcerror_error_t **error )
 {
-	libewf_internal_handle_t *internal_handle         = NULL;
-	libewf_single_file_entry_t *single_file_entry     = NULL;
-	libewf_single_file_entry_t *sub_single_file_entry = NULL;
-	libcdata_tree_node_t *node                        = NULL;
-	libcdata_tree_node_t *sub_node                    = NULL;
-	uint16_t *utf16_string_segment                    = NULL;
-	static char *function                             = "libewf_file_get_file_entry_by_utf16_path";
-	size_t utf16_string_index                         = 0;
-	size_t utf16_string_segment_length                = 0;
-	int result                                        = 0;
+	libewf_internal_handle_t *internal_handle               = NULL;
+	libewf_single_file_entry_t *single_file_entry           = NULL;
+	libewf_single_file_entry_t *sub_single_file_entry       = NULL;
+	libewf_single_file_tree_index_t *single_file_tree_index = NULL;
+	libcdata_tree_node_t *node                              = NULL;
+	libcdata_tree_node_t *sub_node                          = NULL;
+	uint16_t *utf16_string_segment                          = NULL;
+	static char *function                                   = "libewf_file_get_file_entry_by_utf16_path";
+	size_t utf16_string_index                               = 0;
+	size_t utf16_string_segment_length                      = 0;
+	int result                                              = 0;
 
 	if( handle == NULL )
 	{
@@ -9447,6 +13804,20 @@ int libewf_file_get_file_entry_by_utf16_path(
 			utf16_string_index++;
 		}
 	}
+	if( libewf_internal_handle_get_single_file_tree_index(
+	     internal_handle,
+	     &single_file_tree_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve single file tree index.",
+		 function );
+
+		return( -1 );
+	}
 	node = internal_handle->single_files->root_file_entry_node;
 
 	if( ( utf16_string_length == 0 )
@@ -9484,6 +13855,7 @@ int libewf_file_get_file_entry_by_utf16_path(
 			return( -1 );
 		}
 		result = libewf_single_file_tree_get_sub_node_by_utf16_name(
+			  single_file_tree_index,
 			  node,
 			  utf16_string_segment,
 			  utf16_string_segment_length,
@@ -32,13 +32,16 @@
 #include "libewf_libbfio.h"
 #include "libewf_libcdata.h"
 #include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
 #include "libewf_libfvalue.h"
 #include "libewf_libfcache.h"
 #include "libewf_libmfdata.h"
 #include "libewf_header_sections.h"
+#include "libewf_index_file.h"
 #include "libewf_io_handle.h"
 #include "libewf_media_values.h"
 #include "libewf_read_io_handle.h"
+#include "libewf_segment_file.h"
 #include "libewf_segment_table.h"
 #include "libewf_single_files.h"
 #include "libewf_types.h"
@@ -104,6 +107,44 @@ struct libewf_internal_handle
 	 */
 	int maximum_number_of_open_handles;
 
+	/* The maximum size of the (decompressed) chunk data in the chunk table cache
+	 */
+	size64_t maximum_cache_size;
+
+	/* The number of chunks to read ahead
+	 */
+	int number_of_read_ahead_chunks;
+
+	/* Value to indicate the segment files should be memory mapped
+	 */
+	uint8_t use_memory_map;
+
+	/* The chunk data of the most recently verified memory mapped chunk
+	 */
+	const uint8_t *memory_mapped_chunk_data;
+
+	/* The chunk index of the most recently verified memory mapped chunk
+	 */
+	uint64_t memory_mapped_chunk_index;
+
+	/* The index filename
+	 */
+	char *index_filename;
+
+	/* The index filename size
+	 */
+	size_t index_filename_size;
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	/* The index filename
+	 */
+	wchar_t *index_filename_wide;
+
+	/* The index filename size
+	 */
+	size_t index_filename_wide_size;
+#endif
+
 	/* The segment files list
 	 */
 	libmfdata_file_list_t *segment_files_list;
@@ -163,6 +204,54 @@ struct libewf_internal_handle
 	/* The single files
 	 */
 	libewf_single_files_t *single_files;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 * is grabbed for reading while the media data is read and for writing
+	 * while the chunk table, the chunk table cache or the file IO pool are
+	 * used or changed outside the read functions
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The chunk table mutex
+	 * protects the chunk table and the chunk table cache while reading
+	 */
+	libcthreads_mutex_t *chunk_table_mutex;
+
+	/* The file IO pool mutex
+	 * protects the file IO pool while reading
+	 */
+	libcthreads_mutex_t *file_io_pool_mutex;
+
+	/* The read-ahead thread
+	 */
+	libcthreads_thread_t *read_ahead_thread;
+
+	/* The read-ahead mutex
+	 * protects the read-ahead values
+	 */
+	libcthreads_mutex_t *read_ahead_mutex;
+
+	/* The read-ahead condition
+	 */
+	libcthreads_condition_t *read_ahead_condition;
+
+	/* The index of the chunk that was last read
+	 */
+	uint64_t read_ahead_last_chunk_index;
+
+	/* The index of the next chunk to read ahead
+	 */
+	uint64_t read_ahead_chunk_index;
+
+	/* The index of the chunk up to which to read ahead
+	 */
+	uint64_t read_ahead_end_chunk_index;
+
+	/* Value to indicate the read-ahead thread should stop
+	 */
+	uint8_t read_ahead_stop;
+#endif
 };
 
 LIBEWF_EXTERN \
@@ -214,6 +303,7 @@ int libewf_handle_open_file_io_pool(
 int libewf_handle_open_read_segment_files(
      libewf_internal_handle_t *internal_handle,
      libbfio_pool_t *file_io_pool,
+     int access_flags,
      libewf_chunk_table_t *chunk_table,
      libcerror_error_t **error );
 
@@ -328,6 +418,76 @@ int libewf_handle_set_maximum_number_of_open_handles(
      int maximum_number_of_open_handles,
      libcerror_error_t **error );
 
+LIBEWF_EXTERN \
+int libewf_handle_get_segment_file_statistics(
+     libewf_handle_t *handle,
+     uint64_t *number_of_opens,
+     uint64_t *number_of_closes,
+     uint64_t *number_of_reopens,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_get_segment_file_access_count(
+     libewf_handle_t *handle,
+     uint32_t segment_number,
+     uint64_t *access_count,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_set_maximum_cache_size(
+     libewf_handle_t *handle,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_set_read_ahead(
+     libewf_handle_t *handle,
+     int number_of_chunks,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_set_use_memory_map(
+     libewf_handle_t *handle,
+     uint8_t use_memory_map,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_set_drop_cached_data(
+     libewf_handle_t *handle,
+     uint8_t drop_cached_data,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_get_memory_mapped_chunk_data(
+     libewf_handle_t *handle,
+     uint64_t chunk_index,
+     const uint8_t **chunk_data,
+     size_t *chunk_data_size,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_read_chunks_batch(
+     libewf_handle_t *handle,
+     uint64_t chunk_index,
+     int number_of_chunks,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_set_index_filename(
+     libewf_handle_t *handle,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+LIBEWF_EXTERN \
+int libewf_handle_set_index_filename_wide(
+     libewf_handle_t *handle,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+#endif
+
 LIBEWF_EXTERN \
 int libewf_handle_segment_files_corrupted(
      libewf_handle_t *handle,
@@ -475,6 +635,117 @@ int libewf_handle_get_file_io_handle(
      libbfio_handle_t **file_io_handle,
      libcerror_error_t **error );
 
+ssize_t libewf_internal_handle_read_buffer_at_offset(
+         libewf_internal_handle_t *internal_handle,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+ssize_t libewf_internal_handle_read_chunk_data_to_buffer(
+         libewf_internal_handle_t *internal_handle,
+         uint64_t chunk_index,
+         off64_t chunk_offset,
+         size_t chunk_data_offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+int libewf_internal_handle_get_memory_mapped_chunk_data(
+     libewf_internal_handle_t *internal_handle,
+     uint64_t chunk_index,
+     const uint8_t **chunk_data,
+     size_t *chunk_data_size,
+     libcerror_error_t **error );
+
+int libewf_internal_handle_read_chunks_batch(
+     libewf_internal_handle_t *internal_handle,
+     uint64_t chunk_index,
+     int number_of_chunks,
+     libcerror_error_t **error );
+
+int libewf_internal_handle_resize_chunk_table_cache(
+     libewf_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+int libewf_internal_handle_grab_chunk_table_mutexes(
+     libewf_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libewf_internal_handle_release_chunk_table_mutexes(
+     libewf_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libewf_internal_handle_read_uncached_chunk_data(
+     libewf_internal_handle_t *internal_handle,
+     uint64_t chunk_index,
+     libewf_chunk_data_t **chunk_data,
+     int *file_io_pool_entry,
+     off64_t *chunk_offset,
+     libcerror_error_t **error );
+
+int libewf_internal_handle_set_cached_chunk_data(
+     libewf_internal_handle_t *internal_handle,
+     int file_io_pool_entry,
+     off64_t chunk_offset,
+     libewf_chunk_data_t **chunk_data,
+     libcerror_error_t **error );
+
+int libewf_internal_handle_read_uncached_chunk_data_to_buffer(
+     libewf_internal_handle_t *internal_handle,
+     uint64_t chunk_index,
+     size_t chunk_data_offset,
+     uint8_t *buffer,
+     size_t buffer_size,
+     size_t *read_size,
+     libcerror_error_t **error );
+
+int libewf_internal_handle_read_ahead_start(
+     libewf_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libewf_internal_handle_read_ahead_stop(
+     libewf_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libewf_internal_handle_read_ahead_update(
+     libewf_internal_handle_t *internal_handle,
+     uint64_t chunk_index,
+     libcerror_error_t **error );
+
+int libewf_internal_handle_read_ahead_thread_function(
+     void *arguments );
+
+int libewf_internal_handle_scan_segment_files(
+     libewf_internal_handle_t *internal_handle,
+     libbfio_pool_t *file_io_pool,
+     int number_of_segment_files,
+     libcdata_array_t **segment_file_scans_array,
+     libcerror_error_t **error );
+
+int libewf_internal_handle_scan_segment_file_callback(
+     libewf_segment_file_scan_t *segment_file_scan,
+     void *arguments );
+#endif
+
+int libewf_internal_handle_open_index_file(
+     libewf_internal_handle_t *internal_handle,
+     int access_flags,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int libewf_internal_handle_read_index_file(
+     libewf_internal_handle_t *internal_handle,
+     libbfio_pool_t *file_io_pool,
+     libewf_index_file_t *index_file,
+     libcerror_error_t **error );
+
+int libewf_internal_handle_write_index_file(
+     libewf_internal_handle_t *internal_handle,
+     libewf_index_file_t *index_file,
+     libcerror_error_t **error );
+
 int libewf_internal_handle_get_write_maximum_number_of_segments(
      uint8_t ewf_format,
      uint16_t *maximum_number_of_segments,
@@ -497,6 +768,11 @@ int libewf_internal_handle_set_format(
      uint8_t format,
      libcerror_error_t **error );
 
+int libewf_internal_handle_get_single_file_tree_index(
+     libewf_internal_handle_t *internal_handle,
+     libewf_single_file_tree_index_t **single_file_tree_index,
+     libcerror_error_t **error );
+
 LIBEWF_EXTERN \
 int libewf_handle_get_root_file_entry(
      libewf_handle_t *handle,
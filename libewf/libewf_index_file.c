@@ -0,0 +1,1857 @@
+/*
+ * Index file functions
+ *
+ * Copyright (c) 2006-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#include "libewf_definitions.h"
+#include "libewf_index_file.h"
+#include "libewf_libbfio.h"
+#include "libewf_libcdata.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcnotify.h"
+#include "libewf_libcstring.h"
+#include "libewf_libmfdata.h"
+#include "libewf_section.h"
+#include "libewf_segment_file.h"
+#include "libewf_unused.h"
+
+#include "ewf_checksum.h"
+#include "ewf_index_file.h"
+
+const uint8_t ewf_index_file_signature[ 8 ] = { 'E', 'W', 'F', 'I', 'N', 'D', 'E', 'X' };
+
+/* Creates an index file
+ * Make sure the value index_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_index_file_initialize(
+     libewf_index_file_t **index_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_index_file_initialize";
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*index_file = memory_allocate_structure(
+	               libewf_index_file_t );
+
+	if( *index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *index_file,
+	     0,
+	     sizeof( libewf_index_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( ( *index_file )->segments_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create segments array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *index_file != NULL )
+	{
+		memory_free(
+		 *index_file );
+
+		*index_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an index file
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_index_file_free(
+     libewf_index_file_t **index_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_index_file_free";
+	int result            = 1;
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_file != NULL )
+	{
+		if( libcdata_array_free(
+		     &( ( *index_file )->segments_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_index_file_segment_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free segments array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *index_file );
+
+		*index_file = NULL;
+	}
+	return( result );
+}
+
+/* Frees an index file segment
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_index_file_segment_free(
+     libewf_index_file_segment_t **index_file_segment,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_index_file_segment_free";
+	int result            = 1;
+
+	if( index_file_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_file_segment != NULL )
+	{
+		if( libcdata_array_free(
+		     &( ( *index_file_segment )->sections_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_index_file_section_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sections array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *index_file_segment );
+
+		*index_file_segment = NULL;
+	}
+	return( result );
+}
+
+/* Frees an index file section
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_index_file_section_free(
+     libewf_index_file_section_t **index_file_section,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_index_file_section_free";
+
+	if( index_file_section == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file section.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_file_section != NULL )
+	{
+		memory_free(
+		 *index_file_section );
+
+		*index_file_section = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a segment to the index file
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_index_file_append_segment(
+     libewf_index_file_t *index_file,
+     libewf_segment_file_t *segment_file,
+     size64_t file_size,
+     int64_t modification_time,
+     libcerror_error_t **error )
+{
+	libewf_index_file_segment_t *index_file_segment = NULL;
+	static char *function                           = "libewf_index_file_append_segment";
+	int entry_index                                 = 0;
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment file.",
+		 function );
+
+		return( -1 );
+	}
+	index_file_segment = memory_allocate_structure(
+	                      libewf_index_file_segment_t );
+
+	if( index_file_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index file segment.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     index_file_segment,
+	     0,
+	     sizeof( libewf_index_file_segment_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index file segment.",
+		 function );
+
+		memory_free(
+		 index_file_segment );
+
+		index_file_segment = NULL;
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( index_file_segment->sections_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sections array.",
+		 function );
+
+		goto on_error;
+	}
+	index_file_segment->file_size           = file_size;
+	index_file_segment->modification_time   = modification_time;
+	index_file_segment->last_section_offset = segment_file->last_section_offset;
+	index_file_segment->number_of_chunks    = segment_file->number_of_chunks;
+	index_file_segment->segment_number      = segment_file->segment_number;
+	index_file_segment->type                = segment_file->type;
+
+	if( libcdata_array_append_entry(
+	     index_file->segments_array,
+	     &entry_index,
+	     (intptr_t *) index_file_segment,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append index file segment.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_file_segment != NULL )
+	{
+		libewf_index_file_segment_free(
+		 &index_file_segment,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the last segment of the index file
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_index_file_get_last_segment(
+     libewf_index_file_t *index_file,
+     libewf_index_file_segment_t **index_file_segment,
+     libcerror_error_t **error )
+{
+	static char *function  = "libewf_index_file_get_last_segment";
+	int number_of_segments = 0;
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     index_file->segments_array,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_index_file_get_segment(
+	     index_file,
+	     number_of_segments - 1,
+	     index_file_segment,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve last segment.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a section to the last segment of the index file
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_index_file_append_section(
+     libewf_index_file_t *index_file,
+     libewf_section_t *section,
+     uint32_t number_of_offsets,
+     libcerror_error_t **error )
+{
+	libewf_index_file_section_t *index_file_section = NULL;
+	libewf_index_file_segment_t *index_file_segment = NULL;
+	static char *function                           = "libewf_index_file_append_section";
+	int entry_index                                 = 0;
+
+	if( section == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_index_file_get_last_segment(
+	     index_file,
+	     &index_file_segment,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve last segment.",
+		 function );
+
+		goto on_error;
+	}
+	index_file_section = memory_allocate_structure(
+	                      libewf_index_file_section_t );
+
+	if( index_file_section == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index file section.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     index_file_section->type,
+	     section->type,
+	     17 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy section type.",
+		 function );
+
+		goto on_error;
+	}
+	index_file_section->start_offset      = section->start_offset;
+	index_file_section->end_offset        = section->end_offset;
+	index_file_section->size              = section->size;
+	index_file_section->number_of_offsets = number_of_offsets;
+
+	if( libcdata_array_append_entry(
+	     index_file_segment->sections_array,
+	     &entry_index,
+	     (intptr_t *) index_file_section,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append index file section.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_file_section != NULL )
+	{
+		memory_free(
+		 index_file_section );
+	}
+	return( -1 );
+}
+
+/* Sets the values of the last segment of the index file after its sections were read
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_index_file_set_segment_values(
+     libewf_index_file_t *index_file,
+     libewf_segment_file_t *segment_file,
+     libcerror_error_t **error )
+{
+	libewf_index_file_segment_t *index_file_segment = NULL;
+	static char *function                           = "libewf_index_file_set_segment_values";
+
+	if( segment_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_index_file_get_last_segment(
+	     index_file,
+	     &index_file_segment,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve last segment.",
+		 function );
+
+		return( -1 );
+	}
+	index_file_segment->last_section_offset = segment_file->last_section_offset;
+	index_file_segment->number_of_chunks    = segment_file->number_of_chunks;
+
+	return( 1 );
+}
+
+/* Retrieves a specific segment of the index file
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_index_file_get_segment(
+     libewf_index_file_t *index_file,
+     int segment_index,
+     libewf_index_file_segment_t **index_file_segment,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_index_file_get_segment";
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_file_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     index_file->segments_array,
+	     segment_index,
+	     (intptr_t **) index_file_segment,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment: %d.",
+		 function,
+		 segment_index );
+
+		return( -1 );
+	}
+	if( *index_file_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing segment: %d.",
+		 function,
+		 segment_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific section of an index file segment
+ * Sets the values of the section as if it were read from the segment file
+ * Returns 1 if successful, 0 if no such section or -1 on error
+ */
+int libewf_index_file_segment_get_section(
+     libewf_index_file_segment_t *index_file_segment,
+     int section_index,
+     libewf_section_t *section,
+     uint32_t *number_of_offsets,
+     libcerror_error_t **error )
+{
+	libewf_index_file_section_t *index_file_section = NULL;
+	static char *function                           = "libewf_index_file_segment_get_section";
+	int number_of_sections                          = 0;
+
+	if( index_file_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( section == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     index_file_segment->sections_array,
+	     &number_of_sections,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sections.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( section_index < 0 )
+	 || ( section_index >= number_of_sections ) )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     index_file_segment->sections_array,
+	     section_index,
+	     (intptr_t **) &index_file_section,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section: %d.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	if( index_file_section == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing section: %d.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     section->type,
+	     index_file_section->type,
+	     17 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy section type.",
+		 function );
+
+		return( -1 );
+	}
+	section->type_length = libcstring_narrow_string_length(
+	                        (char *) section->type );
+
+	section->start_offset = index_file_section->start_offset;
+	section->end_offset   = index_file_section->end_offset;
+	section->size         = index_file_section->size;
+
+	*number_of_offsets = index_file_section->number_of_offsets;
+
+	return( 1 );
+}
+
+/* Reads the index file
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_index_file_read(
+     libewf_index_file_t *index_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	ewf_index_file_header_t file_header;
+
+	libewf_index_file_section_t *index_file_section = NULL;
+	libewf_index_file_segment_t *index_file_segment = NULL;
+	uint8_t *data                                   = NULL;
+	uint8_t *data_end                               = NULL;
+	uint8_t *data_pointer                           = NULL;
+	static char *function                           = "libewf_index_file_read";
+	size64_t file_size                              = 0;
+	uint64_t data_size                              = 0;
+	ssize_t read_count                              = 0;
+	uint32_t calculated_checksum                    = 0;
+	uint32_t format_version                         = 0;
+	uint32_t number_of_sections                     = 0;
+	uint32_t number_of_segment_files                = 0;
+	uint32_t section_index                          = 0;
+	uint32_t segment_index                          = 0;
+	uint32_t stored_checksum                        = 0;
+	int entry_index                                 = 0;
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek index file header offset.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              (uint8_t *) &file_header,
+	              sizeof( ewf_index_file_header_t ),
+	              error );
+
+	if( read_count != (ssize_t) sizeof( ewf_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_compare(
+	     file_header.signature,
+	     ewf_index_file_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+		 "%s: unsupported index file signature.",
+		 function );
+
+		goto on_error;
+	}
+	calculated_checksum = ewf_checksum_calculate(
+	                       &file_header,
+	                       sizeof( ewf_index_file_header_t ) - 4,
+	                       1 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.checksum,
+	 stored_checksum );
+
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: checksum does not match (stored: 0x%08" PRIx32 " calculated: 0x%08" PRIx32 ").",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.number_of_segment_files,
+	 number_of_segment_files );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header.data_size,
+	 data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.data_checksum,
+	 stored_checksum );
+
+	if( format_version != LIBEWF_INDEX_FILE_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		goto on_error;
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (uint64_t) SSIZE_MAX )
+	 || ( ( (size64_t) sizeof( ewf_index_file_header_t ) + data_size ) != file_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * (size_t) data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              data,
+	              (size_t) data_size,
+	              error );
+
+	if( read_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index file data.",
+		 function );
+
+		goto on_error;
+	}
+	calculated_checksum = ewf_checksum_calculate(
+	                       data,
+	                       (size_t) data_size,
+	                       1 );
+
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: data checksum does not match (stored: 0x%08" PRIx32 " calculated: 0x%08" PRIx32 ").",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		goto on_error;
+	}
+	data_pointer = data;
+	data_end     = &( data[ data_size ] );
+
+	for( segment_index = 0;
+	     segment_index < number_of_segment_files;
+	     segment_index++ )
+	{
+		if( (size_t) ( data_end - data_pointer ) < sizeof( ewf_index_file_segment_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: segment: %" PRIu32 " exceeds data size.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		index_file_segment = memory_allocate_structure(
+		                      libewf_index_file_segment_t );
+
+		if( index_file_segment == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create index file segment.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     index_file_segment,
+		     0,
+		     sizeof( libewf_index_file_segment_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear index file segment.",
+			 function );
+
+			memory_free(
+			 index_file_segment );
+
+			index_file_segment = NULL;
+
+			goto on_error;
+		}
+		if( libcdata_array_initialize(
+		     &( index_file_segment->sections_array ),
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sections array.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (ewf_index_file_segment_t *) data_pointer )->file_size,
+		 index_file_segment->file_size );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (ewf_index_file_segment_t *) data_pointer )->modification_time,
+		 index_file_segment->modification_time );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (ewf_index_file_segment_t *) data_pointer )->last_section_offset,
+		 index_file_segment->last_section_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (ewf_index_file_segment_t *) data_pointer )->number_of_sections,
+		 number_of_sections );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (ewf_index_file_segment_t *) data_pointer )->number_of_chunks,
+		 index_file_segment->number_of_chunks );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (ewf_index_file_segment_t *) data_pointer )->segment_number,
+		 index_file_segment->segment_number );
+
+		index_file_segment->type = ( (ewf_index_file_segment_t *) data_pointer )->type;
+
+		data_pointer += sizeof( ewf_index_file_segment_t );
+
+		if( libcdata_array_append_entry(
+		     index_file->segments_array,
+		     &entry_index,
+		     (intptr_t *) index_file_segment,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append index file segment.",
+			 function );
+
+			goto on_error;
+		}
+		/* The index file segment is now managed by the segments array
+		 */
+		if( (size_t) ( data_end - data_pointer ) < ( (size_t) number_of_sections * sizeof( ewf_index_file_section_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: sections of segment: %" PRIu32 " exceed data size.",
+			 function,
+			 segment_index );
+
+			index_file_segment = NULL;
+
+			goto on_error;
+		}
+		for( section_index = 0;
+		     section_index < number_of_sections;
+		     section_index++ )
+		{
+			index_file_section = memory_allocate_structure(
+			                      libewf_index_file_section_t );
+
+			if( index_file_section == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create index file section.",
+				 function );
+
+				index_file_segment = NULL;
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     index_file_section->type,
+			     ( (ewf_index_file_section_t *) data_pointer )->type,
+			     16 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy section type.",
+				 function );
+
+				index_file_segment = NULL;
+
+				goto on_error;
+			}
+			index_file_section->type[ 16 ] = 0;
+
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (ewf_index_file_section_t *) data_pointer )->start_offset,
+			 index_file_section->start_offset );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (ewf_index_file_section_t *) data_pointer )->end_offset,
+			 index_file_section->end_offset );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (ewf_index_file_section_t *) data_pointer )->size,
+			 index_file_section->size );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (ewf_index_file_section_t *) data_pointer )->number_of_offsets,
+			 index_file_section->number_of_offsets );
+
+			data_pointer += sizeof( ewf_index_file_section_t );
+
+			if( ( index_file_section->start_offset < 0 )
+			 || ( index_file_section->end_offset < index_file_section->start_offset )
+			 || ( (size64_t) index_file_section->end_offset > index_file_segment->file_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid section: %" PRIu32 " offsets value out of bounds.",
+				 function,
+				 section_index );
+
+				index_file_segment = NULL;
+
+				goto on_error;
+			}
+			if( libcdata_array_append_entry(
+			     index_file_segment->sections_array,
+			     &entry_index,
+			     (intptr_t *) index_file_section,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append index file section.",
+				 function );
+
+				index_file_segment = NULL;
+
+				goto on_error;
+			}
+			index_file_section = NULL;
+		}
+		index_file_segment = NULL;
+	}
+	if( data_pointer != data_end )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: trailing data in index file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( index_file_section != NULL )
+	{
+		memory_free(
+		 index_file_section );
+	}
+	if( index_file_segment != NULL )
+	{
+		libewf_index_file_segment_free(
+		 &index_file_segment,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	libcdata_array_empty(
+	 index_file->segments_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libewf_index_file_segment_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Writes the index file
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_index_file_write(
+     libewf_index_file_t *index_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	ewf_index_file_header_t file_header;
+
+	libewf_index_file_section_t *index_file_section = NULL;
+	libewf_index_file_segment_t *index_file_segment = NULL;
+	uint8_t *data                                   = NULL;
+	uint8_t *data_pointer                           = NULL;
+	static char *function                           = "libewf_index_file_write";
+	size_t data_size                                = 0;
+	ssize_t write_count                             = 0;
+	uint32_t calculated_checksum                    = 0;
+	int number_of_sections                          = 0;
+	int number_of_segments                          = 0;
+	int section_index                               = 0;
+	int segment_index                               = 0;
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     index_file->segments_array,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segments.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_segments <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: number of segments value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		if( libewf_index_file_get_segment(
+		     index_file,
+		     segment_index,
+		     &index_file_segment,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		if( libcdata_array_get_number_of_entries(
+		     index_file_segment->sections_array,
+		     &number_of_sections,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of sections of segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		data_size += sizeof( ewf_index_file_segment_t )
+		           + ( (size_t) number_of_sections * sizeof( ewf_index_file_section_t ) );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		goto on_error;
+	}
+	data_pointer = data;
+
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		if( libewf_index_file_get_segment(
+		     index_file,
+		     segment_index,
+		     &index_file_segment,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		if( libcdata_array_get_number_of_entries(
+		     index_file_segment->sections_array,
+		     &number_of_sections,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of sections of segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (ewf_index_file_segment_t *) data_pointer )->file_size,
+		 index_file_segment->file_size );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (ewf_index_file_segment_t *) data_pointer )->modification_time,
+		 index_file_segment->modification_time );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (ewf_index_file_segment_t *) data_pointer )->last_section_offset,
+		 index_file_segment->last_section_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (ewf_index_file_segment_t *) data_pointer )->number_of_sections,
+		 number_of_sections );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (ewf_index_file_segment_t *) data_pointer )->number_of_chunks,
+		 index_file_segment->number_of_chunks );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 ( (ewf_index_file_segment_t *) data_pointer )->segment_number,
+		 index_file_segment->segment_number );
+
+		( (ewf_index_file_segment_t *) data_pointer )->type = index_file_segment->type;
+
+		data_pointer += sizeof( ewf_index_file_segment_t );
+
+		for( section_index = 0;
+		     section_index < number_of_sections;
+		     section_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     index_file_segment->sections_array,
+			     section_index,
+			     (intptr_t **) &index_file_section,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve section: %d of segment: %d.",
+				 function,
+				 section_index,
+				 segment_index );
+
+				goto on_error;
+			}
+			if( index_file_section == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing section: %d of segment: %d.",
+				 function,
+				 section_index,
+				 segment_index );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     ( (ewf_index_file_section_t *) data_pointer )->type,
+			     index_file_section->type,
+			     16 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy section type.",
+				 function );
+
+				goto on_error;
+			}
+			byte_stream_copy_from_uint64_little_endian(
+			 ( (ewf_index_file_section_t *) data_pointer )->start_offset,
+			 index_file_section->start_offset );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 ( (ewf_index_file_section_t *) data_pointer )->end_offset,
+			 index_file_section->end_offset );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 ( (ewf_index_file_section_t *) data_pointer )->size,
+			 index_file_section->size );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (ewf_index_file_section_t *) data_pointer )->number_of_offsets,
+			 index_file_section->number_of_offsets );
+
+			data_pointer += sizeof( ewf_index_file_section_t );
+		}
+	}
+	if( memory_set(
+	     &file_header,
+	     0,
+	     sizeof( ewf_index_file_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     file_header.signature,
+	     ewf_index_file_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.format_version,
+	 LIBEWF_INDEX_FILE_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.number_of_segment_files,
+	 number_of_segments );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header.data_size,
+	 data_size );
+
+	calculated_checksum = ewf_checksum_calculate(
+	                       data,
+	                       data_size,
+	                       1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.data_checksum,
+	 calculated_checksum );
+
+	calculated_checksum = ewf_checksum_calculate(
+	                       &file_header,
+	                       sizeof( ewf_index_file_header_t ) - 4,
+	                       1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.checksum,
+	 calculated_checksum );
+
+	write_count = libbfio_handle_write_buffer(
+	               file_io_handle,
+	               (uint8_t *) &file_header,
+	               sizeof( ewf_index_file_header_t ),
+	               error );
+
+	if( write_count != (ssize_t) sizeof( ewf_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file header.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = libbfio_handle_write_buffer(
+	               file_io_handle,
+	               data,
+	               data_size,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Determines if the index file matches the segment files
+ * Returns 1 if the index file matches, 0 if not or -1 on error
+ */
+int libewf_index_file_validate(
+     libewf_index_file_t *index_file,
+     libbfio_pool_t *file_io_pool,
+     libmfdata_file_list_t *segment_files_list,
+     libcerror_error_t **error )
+{
+	libewf_index_file_segment_t *index_file_segment = NULL;
+	static char *function                           = "libewf_index_file_validate";
+	size64_t segment_file_size                      = 0;
+	int64_t modification_time                       = 0;
+	int file_io_pool_entry                          = 0;
+	int number_of_segment_files                     = 0;
+	int number_of_segments                          = 0;
+	int segment_files_list_index                    = 0;
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     index_file->segments_array,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmfdata_file_list_get_number_of_files(
+	     segment_files_list,
+	     &number_of_segment_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segment files in list.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_segments == 0 )
+	 || ( number_of_segments != number_of_segment_files ) )
+	{
+		return( 0 );
+	}
+	for( segment_files_list_index = 0;
+	     segment_files_list_index < number_of_segment_files;
+	     segment_files_list_index++ )
+	{
+		if( libewf_index_file_get_segment(
+		     index_file,
+		     segment_files_list_index,
+		     &index_file_segment,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment: %d.",
+			 function,
+			 segment_files_list_index );
+
+			return( -1 );
+		}
+		if( ( (int) index_file_segment->segment_number != ( segment_files_list_index + 1 ) )
+		 || ( ( index_file_segment->type != LIBEWF_SEGMENT_FILE_TYPE_EWF )
+		  &&  ( index_file_segment->type != LIBEWF_SEGMENT_FILE_TYPE_LWF ) ) )
+		{
+			return( 0 );
+		}
+		if( libmfdata_file_list_get_file_by_index(
+		     segment_files_list,
+		     segment_files_list_index,
+		     &file_io_pool_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment file: %d from list.",
+			 function,
+			 segment_files_list_index + 1 );
+
+			return( -1 );
+		}
+		if( libbfio_pool_get_size(
+		     file_io_pool,
+		     file_io_pool_entry,
+		     &segment_file_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of file IO pool entry: %d.",
+			 function,
+			 file_io_pool_entry );
+
+			return( -1 );
+		}
+		if( segment_file_size != index_file_segment->file_size )
+		{
+			return( 0 );
+		}
+		if( libewf_index_file_get_modification_time(
+		     file_io_pool,
+		     file_io_pool_entry,
+		     &modification_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve modification time of file IO pool entry: %d.",
+			 function,
+			 file_io_pool_entry );
+
+			return( -1 );
+		}
+		if( modification_time != index_file_segment->modification_time )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the modification time of a file in the pool
+ * The file IO pool must only contain file IO handles, i.e. be created by the library
+ * The modification time is 0 if not available
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_index_file_get_modification_time(
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     int64_t *modification_time,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_SYS_STAT_H ) && defined( HAVE_STAT ) && !defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	struct stat file_statistics;
+
+	libbfio_handle_t *file_io_handle = NULL;
+	char *name                       = NULL;
+	size_t name_size                 = 0;
+#endif
+	static char *function            = "libewf_index_file_get_modification_time";
+
+	if( modification_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid modification time.",
+		 function );
+
+		return( -1 );
+	}
+	*modification_time = 0;
+
+#if defined( HAVE_SYS_STAT_H ) && defined( HAVE_STAT ) && !defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_pool_get_handle(
+	     file_io_pool,
+	     file_io_pool_entry,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle: %d from pool.",
+		 function,
+		 file_io_pool_entry );
+
+		return( -1 );
+	}
+	if( libbfio_file_get_name_size(
+	     file_io_handle,
+	     &name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_size == 0 )
+	 || ( name_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	name = libcstring_narrow_string_allocate(
+	        name_size );
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_get_name(
+	     file_io_handle,
+	     name,
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name.",
+		 function );
+
+		memory_free(
+		 name );
+
+		return( -1 );
+	}
+	if( stat(
+	     name,
+	     &file_statistics ) == 0 )
+	{
+		*modification_time = (int64_t) file_statistics.st_mtime;
+	}
+	memory_free(
+	 name );
+
+#else
+	LIBEWF_UNREFERENCED_PARAMETER( file_io_pool )
+	LIBEWF_UNREFERENCED_PARAMETER( file_io_pool_entry )
+
+#endif /* defined( HAVE_SYS_STAT_H ) && defined( HAVE_STAT ) && !defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	return( 1 );
+}
+
@@ -0,0 +1,187 @@
+/*
+ * Index file functions
+ *
+ * Copyright (c) 2006-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_INDEX_FILE_H )
+#define _LIBEWF_INDEX_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_libbfio.h"
+#include "libewf_libcdata.h"
+#include "libewf_libcerror.h"
+#include "libewf_libmfdata.h"
+#include "libewf_section.h"
+#include "libewf_segment_file.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define LIBEWF_INDEX_FILE_FORMAT_VERSION	1
+
+typedef struct libewf_index_file_section libewf_index_file_section_t;
+
+struct libewf_index_file_section
+{
+	/* The section type string
+	 */
+	uint8_t type[ 17 ];
+
+	/* The start offset of the section
+	 */
+	off64_t start_offset;
+
+	/* The end offset of the section
+	 */
+	off64_t end_offset;
+
+	/* The size the section
+	 */
+	size64_t size;
+
+	/* The number of offsets of a table or table2 section
+	 */
+	uint32_t number_of_offsets;
+};
+
+typedef struct libewf_index_file_segment libewf_index_file_segment_t;
+
+struct libewf_index_file_segment
+{
+	/* The size of the segment file
+	 */
+	size64_t file_size;
+
+	/* The modification time of the segment file
+	 */
+	int64_t modification_time;
+
+	/* The offset of the last section
+	 */
+	off64_t last_section_offset;
+
+	/* The number of chunks
+	 */
+	uint32_t number_of_chunks;
+
+	/* The segment number
+	 */
+	uint16_t segment_number;
+
+	/* The segment file type
+	 */
+	uint8_t type;
+
+	/* The sections array
+	 */
+	libcdata_array_t *sections_array;
+};
+
+typedef struct libewf_index_file libewf_index_file_t;
+
+struct libewf_index_file
+{
+	/* The segments array
+	 */
+	libcdata_array_t *segments_array;
+};
+
+int libewf_index_file_initialize(
+     libewf_index_file_t **index_file,
+     libcerror_error_t **error );
+
+int libewf_index_file_free(
+     libewf_index_file_t **index_file,
+     libcerror_error_t **error );
+
+int libewf_index_file_segment_free(
+     libewf_index_file_segment_t **index_file_segment,
+     libcerror_error_t **error );
+
+int libewf_index_file_section_free(
+     libewf_index_file_section_t **index_file_section,
+     libcerror_error_t **error );
+
+int libewf_index_file_append_segment(
+     libewf_index_file_t *index_file,
+     libewf_segment_file_t *segment_file,
+     size64_t file_size,
+     int64_t modification_time,
+     libcerror_error_t **error );
+
+int libewf_index_file_get_last_segment(
+     libewf_index_file_t *index_file,
+     libewf_index_file_segment_t **index_file_segment,
+     libcerror_error_t **error );
+
+int libewf_index_file_append_section(
+     libewf_index_file_t *index_file,
+     libewf_section_t *section,
+     uint32_t number_of_offsets,
+     libcerror_error_t **error );
+
+int libewf_index_file_set_segment_values(
+     libewf_index_file_t *index_file,
+     libewf_segment_file_t *segment_file,
+     libcerror_error_t **error );
+
+int libewf_index_file_get_segment(
+     libewf_index_file_t *index_file,
+     int segment_index,
+     libewf_index_file_segment_t **index_file_segment,
+     libcerror_error_t **error );
+
+int libewf_index_file_segment_get_section(
+     libewf_index_file_segment_t *index_file_segment,
+     int section_index,
+     libewf_section_t *section,
+     uint32_t *number_of_offsets,
+     libcerror_error_t **error );
+
+int libewf_index_file_read(
+     libewf_index_file_t *index_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libewf_index_file_write(
+     libewf_index_file_t *index_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libewf_index_file_validate(
+     libewf_index_file_t *index_file,
+     libbfio_pool_t *file_io_pool,
+     libmfdata_file_list_t *segment_files_list,
+     libcerror_error_t **error );
+
+int libewf_index_file_get_modification_time(
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     int64_t *modification_time,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
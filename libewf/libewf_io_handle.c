@@ -90,6 +90,20 @@ int libewf_io_handle_initialize(
 
 		goto on_error;
 	}
+	if( libewf_compression_context_initialize(
+	     &( ( *io_handle )->compression_context ),
+	     LIBEWF_COMPRESSION_BACKEND_DEFAULT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compression context.",
+		 function );
+
+		goto on_error;
+	}
 	( *io_handle )->format            = LIBEWF_FORMAT_ENCASE5;
 	( *io_handle )->ewf_format        = EWF_FORMAT_E01;
 	( *io_handle )->compression_level = EWF_COMPRESSION_NONE;
@@ -116,6 +130,7 @@ int libewf_io_handle_free(
      libcerror_error_t **error )
 {
 	static char *function = "libewf_io_handle_free";
+	int result            = 1;
 
 	if( io_handle == NULL )
 	{
@@ -130,12 +145,25 @@ int libewf_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		if( libewf_compression_context_free(
+		     &( ( *io_handle )->compression_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compression context.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *io_handle );
 
 		*io_handle = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Clones the IO handle
@@ -202,7 +230,33 @@ int libewf_io_handle_clone(
 		 "%s: unable to copy source to destination IO handle.",
 		 function );
 
-		goto on_error;
+		memory_free(
+		 *destination_io_handle );
+
+		*destination_io_handle = NULL;
+
+		return( -1 );
+	}
+	/* The compressors are not shared with the destination
+	 */
+	( *destination_io_handle )->compression_context = NULL;
+
+	if( source_io_handle->compression_context != NULL )
+	{
+		if( libewf_compression_context_initialize(
+		     &( ( *destination_io_handle )->compression_context ),
+		     source_io_handle->compression_context->compression_backend,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create destination compression context.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	return( 1 );
 
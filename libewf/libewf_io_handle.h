@@ -27,6 +27,7 @@
 
 #include "libewf_libcerror.h"
 
+#include "libewf_compression.h"
 #include "libewf_libbfio.h"
 
 #if defined( __cplusplus )
@@ -62,10 +63,20 @@ struct libewf_io_handle
 	 */
 	uint8_t compression_flags;
 
+	/* The compression context
+	 * contains the compression backend and the compressors for reuse
+	 */
+	libewf_compression_context_t *compression_context;
+
 	/* The header codepage
 	 */
 	int header_codepage;
 
+	/* Value to indicate the segment file data should be dropped
+	 * from the system page cache
+	 */
+	uint8_t drop_cached_data;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -668,6 +668,148 @@ int libewf_handle_set_compression_values(
 	return( 1 );
 }
 
+/* Retrieves the compression backend
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_get_compression_backend(
+     libewf_handle_t *handle,
+     int *compression_backend,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_compression_backend";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle->compression_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid IO handle - missing compression context.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compression backend.",
+		 function );
+
+		return( -1 );
+	}
+	*compression_backend = internal_handle->io_handle->compression_context->compression_backend;
+
+	return( 1 );
+}
+
+/* Sets the compression backend
+ * The compression backend cannot be changed after the handle was opened
+ * since the chunks can be compressed and decompressed by multiple threads
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_set_compression_backend(
+     libewf_handle_t *handle,
+     int compression_backend,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_set_compression_backend";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle->compression_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid IO handle - missing compression context.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->file_io_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: compression backend cannot be changed.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compression_backend != LIBEWF_COMPRESSION_BACKEND_DEFAULT )
+	 && ( compression_backend != LIBEWF_COMPRESSION_BACKEND_ZLIB )
+#if defined( HAVE_LIBDEFLATE )
+	 && ( compression_backend != LIBEWF_COMPRESSION_BACKEND_LIBDEFLATE )
+#endif
+	 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression backend.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->io_handle->compression_context->compression_backend = compression_backend;
+
+	return( 1 );
+}
+
 /* Retrieves the size of the contained media data
  * Returns 1 if successful or -1 on error
  */
@@ -1841,6 +1983,84 @@ int libewf_handle_get_number_of_chunks_written(
 	return( 1 );
 }
 
+/* Retrieves the zero run statistics
+ * A zero run consists of consecutive chunks that were written as empty blocks of zero bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_get_zero_run_statistics(
+     libewf_handle_t *handle,
+     size64_t *zero_data_size,
+     uint64_t *number_of_zero_runs,
+     size64_t *largest_zero_run_size,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_zero_run_statistics";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->write_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing subhandle write.",
+		 function );
+
+		return( -1 );
+	}
+	if( zero_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid zero data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_zero_runs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of zero runs.",
+		 function );
+
+		return( -1 );
+	}
+	if( largest_zero_run_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid largest zero run size.",
+		 function );
+
+		return( -1 );
+	}
+	*zero_data_size        = internal_handle->write_io_handle->zero_data_size;
+	*number_of_zero_runs   = internal_handle->write_io_handle->number_of_zero_runs;
+	*largest_zero_run_size = internal_handle->write_io_handle->largest_zero_run_size;
+
+	return( 1 );
+}
+
 /* Sets the read zero chunk on error
  * The chunk is not zeroed if read raw is used
  * Returns 1 if successful or -1 on error
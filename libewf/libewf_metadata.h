@@ -96,6 +96,18 @@ int libewf_handle_set_compression_values(
      uint8_t compression_flags,
      libcerror_error_t **error );
 
+LIBEWF_EXTERN \
+int libewf_handle_get_compression_backend(
+     libewf_handle_t *handle,
+     int *compression_backend,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_set_compression_backend(
+     libewf_handle_t *handle,
+     int compression_backend,
+     libcerror_error_t **error );
+
 LIBEWF_EXTERN \
 int libewf_handle_get_media_size(
      libewf_handle_t *handle,
@@ -192,6 +204,14 @@ int libewf_handle_get_number_of_chunks_written(
      uint32_t *number_of_chunks,
      libcerror_error_t **error );
 
+LIBEWF_EXTERN \
+int libewf_handle_get_zero_run_statistics(
+     libewf_handle_t *handle,
+     size64_t *zero_data_size,
+     uint64_t *number_of_zero_runs,
+     size64_t *largest_zero_run_size,
+     libcerror_error_t **error );
+
 LIBEWF_EXTERN \
 int libewf_handle_set_read_zero_chunk_on_error(
      libewf_handle_t *handle,
@@ -23,6 +23,7 @@
 #include <types.h>
 
 #include "libewf_chunk_data.h"
+#include "libewf_chunk_table.h"
 #include "libewf_definitions.h"
 #include "libewf_libbfio.h"
 #include "libewf_libcdata.h"
@@ -265,6 +266,7 @@ on_error:
  */
 int libewf_read_io_handle_read_chunk_data(
      libewf_read_io_handle_t *read_io_handle,
+     libewf_compression_context_t *compression_context,
      libbfio_pool_t *file_io_pool,
      libewf_media_values_t *media_values,
      libmfdata_list_t *chunk_table_list,
@@ -313,14 +315,14 @@ int libewf_read_io_handle_read_chunk_data(
 
 		return( -1 );
 	}
-	/* This function will expand element groups
+	/* This function will read chunk groups
 	 */
-	result = libmfdata_list_get_element_value_by_index(
+	result = libewf_chunk_table_get_chunk_data(
 	          chunk_table_list,
 	          file_io_pool,
 	          chunk_table_cache,
 	          chunk_index,
-	          (intptr_t **) chunk_data,
+	          chunk_data,
 	          0,
 	          error );
 
@@ -464,6 +466,7 @@ int libewf_read_io_handle_read_chunk_data(
 		}
 		if( libewf_chunk_data_unpack(
 		     *chunk_data,
+		     compression_context,
 		     media_values->chunk_size,
 		     error ) != 1 )
 		{
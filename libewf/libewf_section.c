@@ -378,6 +378,7 @@ int libewf_section_set_values(
 }
 
 /* Reads a section start
+ * The section start is read at the file offset, the current offset is not changed
  * Returns the number of bytes read or -1 on error
  */
 ssize_t libewf_section_start_read(
@@ -415,29 +416,12 @@ ssize_t libewf_section_start_read(
 		 file_offset );
 	}
 #endif
-	if( libbfio_pool_seek_offset(
-	     file_io_pool,
-	     file_io_pool_entry,
-	     file_offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek section start offset: %" PRIi64 " in file IO pool entry: %d.",
-		 function,
-		 file_offset,
-		 file_io_pool_entry );
-
-		return( -1 );
-	}
-	read_count = libbfio_pool_read_buffer(
+	read_count = libbfio_pool_read_buffer_at_offset(
 	              file_io_pool,
 	              file_io_pool_entry,
 	              (uint8_t *) &section_start,
 	              sizeof( ewf_section_start_t ),
+	              file_offset,
 	              error );
 
 	if( read_count != (ssize_t) sizeof( ewf_section_start_t ) )
@@ -446,9 +430,10 @@ ssize_t libewf_section_start_read(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read section start from file IO pool entry: %d.",
+		 "%s: unable to read section start from file IO pool entry: %d at offset: %" PRIi64 ".",
 		 function,
-		 file_io_pool_entry );
+		 file_io_pool_entry,
+		 file_offset );
 
 		return( -1 );
 	}
@@ -887,6 +872,7 @@ ssize_t libewf_section_debug_read(
 		goto on_error;
 	}
 	result = libewf_decompress(
+	          NULL,
 	          uncompressed_data,
 	          &uncompressed_size,
 	          data,
@@ -1142,7 +1128,10 @@ ssize_t libewf_section_compressed_string_read(
 
 		goto on_error;
 	}
+	/* The section strings are decompressed with zlib
+	 */
 	result = libewf_decompress(
+	          NULL,
 	          *uncompressed_string,
 	          uncompressed_string_size,
 	          compressed_string,
@@ -1173,6 +1162,7 @@ ssize_t libewf_section_compressed_string_read(
 		*uncompressed_string = (uint8_t *) reallocation;
 
 		result = libewf_decompress(
+		          NULL,
 		          *uncompressed_string,
 		          uncompressed_string_size,
 		          compressed_string,
@@ -1296,7 +1286,10 @@ ssize_t libewf_section_write_compressed_string(
 
 		goto on_error;
 	}
+	/* The section strings are compressed with zlib
+	 */
 	result = libewf_compress(
+	          NULL,
 	          compressed_string,
 	          &compressed_string_size,
 	          uncompressed_string,
@@ -1328,6 +1321,7 @@ ssize_t libewf_section_write_compressed_string(
 		compressed_string = (uint8_t *) reallocation;
 
 		result = libewf_compress(
+		          NULL,
 		          compressed_string,
 		          &compressed_string_size,
 		          uncompressed_string,
@@ -5409,6 +5403,7 @@ on_error:
 }
 
 /* Reads a table section header
+ * The table header is read directly after the section start, the current offset is not changed
  * Returns the number of bytes read or -1 on error
  */
 ssize_t libewf_section_table_header_read(
@@ -5476,11 +5471,12 @@ ssize_t libewf_section_table_header_read(
 
 		return( -1 );
 	}
-	read_count = libbfio_pool_read_buffer(
+	read_count = libbfio_pool_read_buffer_at_offset(
 	              file_io_pool,
 	              file_io_pool_entry,
 	              (uint8_t *) &table_header,
 	              sizeof( ewf_table_header_t ),
+	              section->start_offset + sizeof( ewf_section_start_t ),
 	              error );
 	
 	if( read_count != (ssize_t) sizeof( ewf_table_header_t ) )
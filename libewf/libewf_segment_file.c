@@ -279,6 +279,547 @@ on_error:
 	return( -1 );
 }
 
+/* Creates a segment file scan
+ * Make sure the value segment_file_scan is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_file_scan_initialize(
+     libewf_segment_file_scan_t **segment_file_scan,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_segment_file_scan_initialize";
+
+	if( segment_file_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment file scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segment_file_scan != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segment file scan value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*segment_file_scan = memory_allocate_structure(
+	                      libewf_segment_file_scan_t );
+
+	if( *segment_file_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment file scan.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *segment_file_scan,
+	     0,
+	     sizeof( libewf_segment_file_scan_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear segment file scan.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( ( *segment_file_scan )->sections_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sections array.",
+		 function );
+
+		goto on_error;
+	}
+	( *segment_file_scan )->file_io_handle = file_io_handle;
+	( *segment_file_scan )->result         = -1;
+
+	return( 1 );
+
+on_error:
+	if( *segment_file_scan != NULL )
+	{
+		memory_free(
+		 *segment_file_scan );
+
+		*segment_file_scan = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a segment file scan
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_file_scan_free(
+     libewf_segment_file_scan_t **segment_file_scan,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_segment_file_scan_free";
+	int result            = 1;
+
+	if( segment_file_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment file scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segment_file_scan != NULL )
+	{
+		/* The file IO handle is not managed by the segment file scan
+		 */
+		if( libcdata_array_free(
+		     &( ( *segment_file_scan )->sections_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_section_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sections array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *segment_file_scan );
+
+		*segment_file_scan = NULL;
+	}
+	return( result );
+}
+
+/* Reads the segment file header and the section starts of a segment file
+ * The segment file is read using a clone of the file IO handle so that
+ * multiple segment files can be scanned concurrently
+ * A section start that cannot be read marks the segment file scan as corrupted
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_file_scan_read(
+     libewf_segment_file_scan_t *segment_file_scan,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle    = NULL;
+	libbfio_pool_t *file_io_pool        = NULL;
+	libewf_section_t *section           = NULL;
+	libewf_segment_file_t *segment_file = NULL;
+	static char *function               = "libewf_segment_file_scan_read";
+	off64_t section_offset              = 0;
+	size64_t segment_file_size          = 0;
+	ssize_t read_count                  = 0;
+	int entry_index                     = 0;
+	int file_io_pool_entry              = 0;
+	int last_section                    = 0;
+
+	if( segment_file_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment file scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_clone(
+	     &file_io_handle,
+	     segment_file_scan->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_pool_initialize(
+	     &file_io_pool,
+	     0,
+	     LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_pool_append_handle(
+	     file_io_pool,
+	     &file_io_pool_entry,
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file IO handle to pool.",
+		 function );
+
+		goto on_error;
+	}
+	/* The file IO handle is now managed by the file IO pool
+	 */
+	file_io_handle = NULL;
+
+	if( libbfio_pool_get_size(
+	     file_io_pool,
+	     file_io_pool_entry,
+	     &segment_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of file IO pool entry: %d.",
+		 function,
+		 file_io_pool_entry );
+
+		goto on_error;
+	}
+	if( libewf_segment_file_initialize(
+	     &segment_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create segment file.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libewf_segment_file_read_file_header(
+		      segment_file,
+		      file_io_pool,
+		      file_io_pool_entry,
+		      error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read segment file header.",
+		 function );
+
+		goto on_error;
+	}
+	segment_file_scan->type           = segment_file->type;
+	segment_file_scan->segment_number = segment_file->segment_number;
+
+	if( libewf_segment_file_free(
+	     &segment_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free segment file.",
+		 function );
+
+		goto on_error;
+	}
+	section_offset = (off64_t) read_count;
+
+	while( (size64_t) section_offset < segment_file_size )
+	{
+		if( libewf_section_initialize(
+		     &section,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create section.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libewf_section_start_read(
+		              section,
+		              file_io_pool,
+		              file_io_pool_entry,
+		              section_offset,
+		              error );
+
+		if( read_count == -1 )
+		{
+			/* The error is reported when the sections are read
+			 */
+			libcerror_error_free(
+			 error );
+
+			libewf_section_free(
+			 &section,
+			 NULL );
+
+			segment_file_scan->is_corrupted = 1;
+
+			break;
+		}
+		if( section->type_length == 4 )
+		{
+			if( ( memory_compare(
+			       (void *) section->type,
+			       (void *) "done",
+			       4 ) == 0 )
+			 || ( memory_compare(
+			       (void *) section->type,
+			       (void *) "next",
+			       4 ) == 0 ) )
+			{
+				last_section = 1;
+			}
+		}
+		section_offset += section->size;
+
+		if( ( last_section != 0 )
+		 && ( section->size == 0 ) )
+		{
+			section_offset += sizeof( ewf_section_start_t );
+		}
+		if( libcdata_array_append_entry(
+		     segment_file_scan->sections_array,
+		     &entry_index,
+		     (intptr_t *) section,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append section to array.",
+			 function );
+
+			goto on_error;
+		}
+		section = NULL;
+
+		if( last_section != 0 )
+		{
+			break;
+		}
+	}
+	if( libbfio_pool_close_all(
+	     file_io_pool,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_pool_free(
+	     &file_io_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( section != NULL )
+	{
+		libewf_section_free(
+		 &section,
+		 NULL );
+	}
+	if( segment_file != NULL )
+	{
+		libewf_segment_file_free(
+		 &segment_file,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_close_all(
+		 file_io_pool,
+		 NULL );
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	libcdata_array_empty(
+	 segment_file_scan->sections_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libewf_section_free,
+	 NULL );
+
+	segment_file_scan->is_corrupted = 0;
+
+	return( -1 );
+}
+
+/* Retrieves a specific section of the segment file scan
+ * Sets the values of the section as if it were read from the segment file
+ * Returns 1 if successful, 0 if no such section or -1 on error
+ */
+int libewf_segment_file_scan_get_section(
+     libewf_segment_file_scan_t *segment_file_scan,
+     int section_index,
+     libewf_section_t *section,
+     libcerror_error_t **error )
+{
+	libewf_section_t *scanned_section = NULL;
+	static char *function             = "libewf_segment_file_scan_get_section";
+	int number_of_sections            = 0;
+
+	if( segment_file_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment file scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( section == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     segment_file_scan->sections_array,
+	     &number_of_sections,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sections.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( section_index < 0 )
+	 || ( section_index >= number_of_sections ) )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     segment_file_scan->sections_array,
+	     section_index,
+	     (intptr_t **) &scanned_section,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section: %d.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	if( scanned_section == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing section: %d.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     section,
+	     scanned_section,
+	     sizeof( libewf_section_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy section.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Reads the segment file header
  * Returns the number of bytes read if successful, or -1 on error
  */
@@ -312,27 +853,12 @@ ssize_t libewf_segment_file_read_file_header(
 		 function );
 	}
 #endif
-	if( libbfio_pool_seek_offset(
-	     file_io_pool,
-	     file_io_pool_entry,
-	     0,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek file header offset: 0.",
-		 function );
-
-		return( -1 );
-	}
-	read_count = libbfio_pool_read_buffer(
+	read_count = libbfio_pool_read_buffer_at_offset(
 	              file_io_pool,
 	              file_io_pool_entry,
 	              (uint8_t *) &file_header,
 	              sizeof( ewf_file_header_t ),
+	              0,
 	              error );
 
 	if( read_count != (ssize_t) sizeof( ewf_file_header_t ) )
@@ -776,8 +1302,6 @@ ssize_t libewf_segment_file_read_table_section(
 
 		return( -1 );
 	}
-	chunk_table->previous_last_chunk_filled = chunk_table->last_chunk_filled;
-
 	read_count = libewf_section_table_header_read(
 	              section,
 	              file_io_pool,
@@ -798,6 +1322,89 @@ ssize_t libewf_segment_file_read_table_section(
 
 		return( -1 );
 	}
+	if( libewf_segment_file_append_chunk_group(
+	     segment_file,
+	     section,
+	     file_io_pool_entry,
+	     media_values,
+	     chunk_table,
+	     chunk_table_list,
+	     number_of_offsets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append chunk group.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Appends or sets the chunk group of a table section
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_file_append_chunk_group(
+     libewf_segment_file_t *segment_file,
+     libewf_section_t *section,
+     int file_io_pool_entry,
+     libewf_media_values_t *media_values,
+     libewf_chunk_table_t *chunk_table,
+     libmfdata_list_t *chunk_table_list,
+     uint32_t number_of_offsets,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_segment_file_append_chunk_group";
+
+	if( segment_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment file.",
+		 function );
+
+		return( -1 );
+	}
+	if( section == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk table.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media values.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_table->previous_last_chunk_filled = chunk_table->last_chunk_filled;
+
 	if( number_of_offsets > 0 )
 	{
 		/* The EWF-L01 does not define the number of chunks in the volume
@@ -868,15 +1475,10 @@ ssize_t libewf_segment_file_read_table2_section(
          libmfdata_list_t *chunk_table_list,
          libcerror_error_t **error )
 {
-	static char *function        = "libewf_segment_file_read_table2_section";
-	off64_t group_offset         = 0;
-	size64_t group_size          = 0;
-	ssize_t read_count           = 0;
-	uint64_t base_offset         = 0;
-	uint32_t group_flags         = 0;
-	uint32_t number_of_offsets   = 0;
-	int group_number_of_offsets  = 0;
-	int group_file_io_pool_entry = 0;
+	static char *function      = "libewf_segment_file_read_table2_section";
+	ssize_t read_count         = 0;
+	uint64_t base_offset       = 0;
+	uint32_t number_of_offsets = 0;
 
 	if( segment_file == NULL )
 	{
@@ -942,6 +1544,66 @@ ssize_t libewf_segment_file_read_table2_section(
 
 		return( -1 );
 	}
+	if( libewf_segment_file_set_backup_chunk_group(
+	     section,
+	     file_io_pool_entry,
+	     chunk_table,
+	     chunk_table_list,
+	     number_of_offsets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set backup chunk group.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Sets the backup data range of the chunk group of a table2 section
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_file_set_backup_chunk_group(
+     libewf_section_t *section,
+     int file_io_pool_entry,
+     libewf_chunk_table_t *chunk_table,
+     libmfdata_list_t *chunk_table_list,
+     uint32_t number_of_offsets,
+     libcerror_error_t **error )
+{
+	static char *function        = "libewf_segment_file_set_backup_chunk_group";
+	off64_t group_offset         = 0;
+	size64_t group_size          = 0;
+	uint32_t group_flags         = 0;
+	int group_number_of_offsets  = 0;
+	int group_file_io_pool_entry = 0;
+
+	if( section == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk table.",
+		 function );
+
+		return( -1 );
+	}
 	if( number_of_offsets > 0 )
 	{
 		if( libmfdata_list_get_group_by_index(
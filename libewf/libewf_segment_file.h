@@ -79,6 +79,35 @@ struct libewf_segment_file
 	uint8_t flags;
 };
 
+typedef struct libewf_segment_file_scan libewf_segment_file_scan_t;
+
+struct libewf_segment_file_scan
+{
+	/* The file IO handle of the segment file
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The segment file type
+	 */
+	uint8_t type;
+
+	/* The segment number
+	 */
+	uint16_t segment_number;
+
+	/* The sections array
+	 */
+	libcdata_array_t *sections_array;
+
+	/* Value to indicate the section starts could not be read up to the last section
+	 */
+	uint8_t is_corrupted;
+
+	/* The result of the scan
+	 */
+	int result;
+};
+
 int libewf_segment_file_initialize(
      libewf_segment_file_t **segment_file,
      libcerror_error_t **error );
@@ -92,6 +121,25 @@ int libewf_segment_file_clone(
      libewf_segment_file_t *source_segment_file,
      libcerror_error_t **error );
 
+int libewf_segment_file_scan_initialize(
+     libewf_segment_file_scan_t **segment_file_scan,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libewf_segment_file_scan_free(
+     libewf_segment_file_scan_t **segment_file_scan,
+     libcerror_error_t **error );
+
+int libewf_segment_file_scan_read(
+     libewf_segment_file_scan_t *segment_file_scan,
+     libcerror_error_t **error );
+
+int libewf_segment_file_scan_get_section(
+     libewf_segment_file_scan_t *segment_file_scan,
+     int section_index,
+     libewf_section_t *section,
+     libcerror_error_t **error );
+
 ssize_t libewf_segment_file_read_file_header(
          libewf_segment_file_t *segment_file,
          libbfio_pool_t *file_io_pool,
@@ -124,6 +172,16 @@ ssize_t libewf_segment_file_read_table_section(
          libmfdata_list_t *chunk_table_list,
          libcerror_error_t **error );
 
+int libewf_segment_file_append_chunk_group(
+     libewf_segment_file_t *segment_file,
+     libewf_section_t *section,
+     int file_io_pool_entry,
+     libewf_media_values_t *media_values,
+     libewf_chunk_table_t *chunk_table,
+     libmfdata_list_t *chunk_table_list,
+     uint32_t number_of_offsets,
+     libcerror_error_t **error );
+
 ssize_t libewf_segment_file_read_table2_section(
          libewf_segment_file_t *segment_file,
          libewf_section_t *section,
@@ -134,6 +192,14 @@ ssize_t libewf_segment_file_read_table2_section(
          libmfdata_list_t *chunk_table_list,
          libcerror_error_t **error );
 
+int libewf_segment_file_set_backup_chunk_group(
+     libewf_section_t *section,
+     int file_io_pool_entry,
+     libewf_chunk_table_t *chunk_table,
+     libmfdata_list_t *chunk_table_list,
+     uint32_t number_of_offsets,
+     libcerror_error_t **error );
+
 ssize_t libewf_segment_file_read_volume_section(
          libewf_segment_file_t *segment_file,
          libewf_section_t *section,
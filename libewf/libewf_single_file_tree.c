@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <memory.h>
 #include <types.h>
 
 #include "libewf_libcdata.h"
@@ -28,10 +29,1066 @@
 #include "libewf_single_file_entry.h"
 #include "libewf_single_file_tree.h"
 
+/* Creates a single file tree index
+ * The index maps the parent node and name of every node in the tree to the node
+ * Make sure the value index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_file_tree_index_initialize(
+     libewf_single_file_tree_index_t **index,
+     libcdata_tree_node_t *root_node,
+     libcerror_error_t **error )
+{
+	static char *function    = "libewf_single_file_tree_index_initialize";
+	size_t entries_size      = 0;
+	size_t number_of_entries = 16;
+	size_t number_of_nodes   = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( root_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid root node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_single_file_tree_get_number_of_nodes(
+	     root_node,
+	     &number_of_nodes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of nodes.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the load factor of the index at or below 2/3
+	 */
+	while( number_of_entries < ( number_of_nodes + ( number_of_nodes / 2 ) + 1 ) )
+	{
+		if( number_of_entries > ( (size_t) SSIZE_MAX / ( 2 * sizeof( libewf_single_file_tree_index_entry_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of nodes value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_entries *= 2;
+	}
+	entries_size = number_of_entries * sizeof( libewf_single_file_tree_index_entry_t );
+
+	*index = memory_allocate_structure(
+	          libewf_single_file_tree_index_t );
+
+	if( *index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *index,
+	     0,
+	     sizeof( libewf_single_file_tree_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index.",
+		 function );
+
+		memory_free(
+		 *index );
+
+		*index = NULL;
+
+		return( -1 );
+	}
+	( *index )->entries = (libewf_single_file_tree_index_entry_t *) memory_allocate(
+	                                                                 entries_size );
+
+	if( ( *index )->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *index )->entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		goto on_error;
+	}
+	( *index )->number_of_entries = number_of_entries;
+
+	if( libewf_single_file_tree_index_insert_sub_nodes(
+	     *index,
+	     root_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert sub nodes of root node.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *index != NULL )
+	{
+		if( ( *index )->entries != NULL )
+		{
+			memory_free(
+			 ( *index )->entries );
+		}
+		memory_free(
+		 *index );
+
+		*index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a single file tree index
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_file_tree_index_free(
+     libewf_single_file_tree_index_t **index,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_single_file_tree_index_free";
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index != NULL )
+	{
+		/* The nodes are referenced and freed elsewhere
+		 */
+		if( ( *index )->entries != NULL )
+		{
+			memory_free(
+			 ( *index )->entries );
+		}
+		memory_free(
+		 *index );
+
+		*index = NULL;
+	}
+	return( 1 );
+}
+
+/* Inserts the sub nodes of a node and their sub nodes into the index
+ * Sub nodes without a name or with a name that is not valid UTF-8 are not inserted
+ * since they cannot be retrieved by name, the name comparison of the sub nodes
+ * one by one requires the name to be valid UTF-8 as well
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_file_tree_index_insert_sub_nodes(
+     libewf_single_file_tree_index_t *index,
+     libcdata_tree_node_t *node,
+     libcerror_error_t **error )
+{
+	libewf_single_file_entry_t *sub_single_file_entry = NULL;
+	libcdata_tree_node_t *sub_node                    = NULL;
+	static char *function                             = "libewf_single_file_tree_index_insert_sub_nodes";
+	size_t entry_index                                = 0;
+	uint32_t hash                                     = 0;
+	int number_of_sub_nodes                           = 0;
+	int result                                        = 0;
+	int sub_node_index                                = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_number_of_sub_nodes(
+	     node,
+	     &number_of_sub_nodes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_nodes == 0 )
+	{
+		return( 1 );
+	}
+	if( libcdata_tree_node_get_sub_node_by_index(
+	     node,
+	     0,
+	     &sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first sub node.",
+		 function );
+
+		return( -1 );
+	}
+	for( sub_node_index = 0;
+	     sub_node_index < number_of_sub_nodes;
+	     sub_node_index++ )
+	{
+		if( libcdata_tree_node_get_value(
+		     sub_node,
+		     (intptr_t **) &sub_single_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			return( -1 );
+		}
+		if( sub_single_file_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing sub single file entry: %d.",
+			 function,
+			 sub_node_index );
+
+			return( -1 );
+		}
+		if( sub_single_file_entry->name != NULL )
+		{
+			result = libewf_single_file_tree_get_utf8_stream_name_hash(
+			          node,
+			          sub_single_file_entry->name,
+			          sub_single_file_entry->name_size,
+			          &hash );
+
+			if( result != 0 )
+			{
+				/* Nodes are inserted in tree order using linear probing
+				 * so that a lookup finds the first of identically named sub nodes
+				 */
+				entry_index = (size_t) hash & ( index->number_of_entries - 1 );
+
+				while( index->entries[ entry_index ].sub_node != NULL )
+				{
+					entry_index = ( entry_index + 1 ) & ( index->number_of_entries - 1 );
+				}
+				index->entries[ entry_index ].sub_node = sub_node;
+				index->entries[ entry_index ].hash     = hash;
+			}
+		}
+		if( libewf_single_file_tree_index_insert_sub_nodes(
+		     index,
+		     sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert sub nodes of sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			return( -1 );
+		}
+		if( libcdata_tree_node_get_next_node(
+		     sub_node,
+		     &sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next node from sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of nodes in the tree below a node
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_file_tree_get_number_of_nodes(
+     libcdata_tree_node_t *node,
+     size_t *number_of_nodes,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *sub_node = NULL;
+	static char *function          = "libewf_single_file_tree_get_number_of_nodes";
+	int number_of_sub_nodes        = 0;
+	int sub_node_index             = 0;
+
+	if( number_of_nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_number_of_sub_nodes(
+	     node,
+	     &number_of_sub_nodes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_nodes == 0 )
+	{
+		return( 1 );
+	}
+	*number_of_nodes += (size_t) number_of_sub_nodes;
+
+	if( libcdata_tree_node_get_sub_node_by_index(
+	     node,
+	     0,
+	     &sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first sub node.",
+		 function );
+
+		return( -1 );
+	}
+	for( sub_node_index = 0;
+	     sub_node_index < number_of_sub_nodes;
+	     sub_node_index++ )
+	{
+		if( libewf_single_file_tree_get_number_of_nodes(
+		     sub_node,
+		     number_of_nodes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of nodes of sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			return( -1 );
+		}
+		if( libcdata_tree_node_get_next_node(
+		     sub_node,
+		     &sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next node from sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Calculates the initial hash value for names of the sub nodes of a parent node
+ * The hash is a 32-bit FNV-1a over the bytes of the parent node reference
+ * followed by the 3 least significant bytes of every Unicode character of the name
+ * Returns the hash value
+ */
+uint32_t libewf_single_file_tree_get_parent_node_hash(
+          libcdata_tree_node_t *parent_node )
+{
+	uint64_t parent_node_value = (uint64_t) (intptr_t) parent_node;
+	uint32_t hash              = 0x811c9dc5UL;
+	uint8_t byte_index         = 0;
+
+	for( byte_index = 0;
+	     byte_index < 8;
+	     byte_index++ )
+	{
+		hash ^= (uint32_t) ( parent_node_value & 0xff );
+		hash *= 0x01000193UL;
+
+		parent_node_value >>= 8;
+	}
+	return( hash );
+}
+
+/* Updates the hash value of a name with an Unicode character
+ * Returns the updated hash value
+ */
+uint32_t libewf_single_file_tree_update_name_hash(
+          uint32_t hash,
+          libuna_unicode_character_t unicode_character )
+{
+	uint8_t byte_index = 0;
+
+	for( byte_index = 0;
+	     byte_index < 3;
+	     byte_index++ )
+	{
+		hash ^= (uint32_t) ( unicode_character & 0xff );
+		hash *= 0x01000193UL;
+
+		unicode_character >>= 8;
+	}
+	return( hash );
+}
+
+/* Calculates the hash of an UTF-8 formatted name of a sub node of a parent node
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_file_tree_get_utf8_name_hash(
+     libcdata_tree_node_t *parent_node,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *hash,
+     libcerror_error_t **error )
+{
+	libuna_unicode_character_t unicode_character = 0;
+	static char *function                        = "libewf_single_file_tree_get_utf8_name_hash";
+	size_t utf8_string_index                     = 0;
+	uint32_t safe_hash                           = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	/* The name comparison ignores a terminating end-of-string character
+	 */
+	if( ( utf8_string_length > 0 )
+	 && ( utf8_string[ utf8_string_length - 1 ] == 0 ) )
+	{
+		utf8_string_length -= 1;
+	}
+	safe_hash = libewf_single_file_tree_get_parent_node_hash(
+	             parent_node );
+
+	while( utf8_string_index < utf8_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     utf8_string,
+		     utf8_string_length,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		safe_hash = libewf_single_file_tree_update_name_hash(
+		             safe_hash,
+		             unicode_character );
+	}
+	*hash = safe_hash;
+
+	return( 1 );
+}
+
+/* Calculates the hash of an UTF-16 formatted name of a sub node of a parent node
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_file_tree_get_utf16_name_hash(
+     libcdata_tree_node_t *parent_node,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *hash,
+     libcerror_error_t **error )
+{
+	libuna_unicode_character_t unicode_character = 0;
+	static char *function                        = "libewf_single_file_tree_get_utf16_name_hash";
+	size_t utf16_string_index                    = 0;
+	uint32_t safe_hash                           = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	/* The name comparison ignores a terminating end-of-string character
+	 */
+	if( ( utf16_string_length > 0 )
+	 && ( utf16_string[ utf16_string_length - 1 ] == 0 ) )
+	{
+		utf16_string_length -= 1;
+	}
+	safe_hash = libewf_single_file_tree_get_parent_node_hash(
+	             parent_node );
+
+	while( utf16_string_index < utf16_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf16(
+		     &unicode_character,
+		     utf16_string,
+		     utf16_string_length,
+		     &utf16_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+		safe_hash = libewf_single_file_tree_update_name_hash(
+		             safe_hash,
+		             unicode_character );
+	}
+	*hash = safe_hash;
+
+	return( 1 );
+}
+
+/* Calculates the hash of the UTF-8 stream formatted name of a single file entry
+ * of a sub node of a parent node
+ * Returns 1 if successful or 0 if the name is not valid UTF-8
+ */
+int libewf_single_file_tree_get_utf8_stream_name_hash(
+     libcdata_tree_node_t *parent_node,
+     const uint8_t *utf8_stream,
+     size_t utf8_stream_size,
+     uint32_t *hash )
+{
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf8_stream_index                     = 0;
+	uint32_t safe_hash                           = 0;
+
+	if( ( utf8_stream == NULL )
+	 || ( utf8_stream_size == 0 )
+	 || ( hash == NULL ) )
+	{
+		return( 0 );
+	}
+	/* The name comparison ignores a byte order mark (BOM)
+	 * and a terminating end-of-string character
+	 */
+	if( utf8_stream_size >= 3 )
+	{
+		if( ( utf8_stream[ 0 ] == 0xef )
+		 && ( utf8_stream[ 1 ] == 0xbb )
+		 && ( utf8_stream[ 2 ] == 0xbf ) )
+		{
+			utf8_stream_index += 3;
+		}
+	}
+	if( utf8_stream[ utf8_stream_size - 1 ] == 0 )
+	{
+		utf8_stream_size -= 1;
+	}
+	safe_hash = libewf_single_file_tree_get_parent_node_hash(
+	             parent_node );
+
+	while( utf8_stream_index < utf8_stream_size )
+	{
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     utf8_stream,
+		     utf8_stream_size,
+		     &utf8_stream_index,
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+		safe_hash = libewf_single_file_tree_update_name_hash(
+		             safe_hash,
+		             unicode_character );
+	}
+	*hash = safe_hash;
+
+	return( 1 );
+}
+
+/* Retrieves the single file entry sub node for the specific UTF-8 formatted name from the index
+ * Returns 1 if successful, 0 if no such sub single file entry or -1 on error
+ */
+int libewf_single_file_tree_index_get_sub_node_by_utf8_name(
+     libewf_single_file_tree_index_t *index,
+     libcdata_tree_node_t *node,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcdata_tree_node_t **sub_node,
+     libewf_single_file_entry_t **sub_single_file_entry,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *parent_node = NULL;
+	static char *function             = "libewf_single_file_tree_index_get_sub_node_by_utf8_name";
+	size_t entry_index                = 0;
+	uint32_t hash                     = 0;
+	int result                        = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( index->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub node.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_single_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub single file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_single_file_tree_get_utf8_name_hash(
+	     node,
+	     utf8_string,
+	     utf8_string_length,
+	     &hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 name hash.",
+		 function );
+
+		goto on_error;
+	}
+	entry_index = (size_t) hash & ( index->number_of_entries - 1 );
+
+	while( index->entries[ entry_index ].sub_node != NULL )
+	{
+		if( index->entries[ entry_index ].hash == hash )
+		{
+			*sub_node = index->entries[ entry_index ].sub_node;
+
+			if( libcdata_tree_node_get_parent_node(
+			     *sub_node,
+			     &parent_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve parent node of index entry: %" PRIzd ".",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			if( parent_node == node )
+			{
+				if( libcdata_tree_node_get_value(
+				     *sub_node,
+				     (intptr_t **) sub_single_file_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve value from sub node of index entry: %" PRIzd ".",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				if( ( *sub_single_file_entry == NULL )
+				 || ( ( *sub_single_file_entry )->name == NULL ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing sub single file entry name of index entry: %" PRIzd ".",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				result = libuna_utf8_string_compare_with_utf8_stream(
+					  utf8_string,
+					  utf8_string_length,
+					  ( *sub_single_file_entry )->name,
+					  (size_t) ( *sub_single_file_entry )->name_size,
+					  error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to compare UTF-8 string.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+					return( 1 );
+				}
+			}
+		}
+		entry_index = ( entry_index + 1 ) & ( index->number_of_entries - 1 );
+	}
+	*sub_node              = NULL;
+	*sub_single_file_entry = NULL;
+
+	return( 0 );
+
+on_error:
+	*sub_node              = NULL;
+	*sub_single_file_entry = NULL;
+
+	return( -1 );
+}
+
+/* Retrieves the single file entry sub node for the specific UTF-16 formatted name from the index
+ * Returns 1 if successful, 0 if no such sub single file entry or -1 on error
+ */
+int libewf_single_file_tree_index_get_sub_node_by_utf16_name(
+     libewf_single_file_tree_index_t *index,
+     libcdata_tree_node_t *node,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcdata_tree_node_t **sub_node,
+     libewf_single_file_entry_t **sub_single_file_entry,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *parent_node = NULL;
+	static char *function             = "libewf_single_file_tree_index_get_sub_node_by_utf16_name";
+	size_t entry_index                = 0;
+	uint32_t hash                     = 0;
+	int result                        = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( index->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub node.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_single_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub single file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_single_file_tree_get_utf16_name_hash(
+	     node,
+	     utf16_string,
+	     utf16_string_length,
+	     &hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 name hash.",
+		 function );
+
+		goto on_error;
+	}
+	entry_index = (size_t) hash & ( index->number_of_entries - 1 );
+
+	while( index->entries[ entry_index ].sub_node != NULL )
+	{
+		if( index->entries[ entry_index ].hash == hash )
+		{
+			*sub_node = index->entries[ entry_index ].sub_node;
+
+			if( libcdata_tree_node_get_parent_node(
+			     *sub_node,
+			     &parent_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve parent node of index entry: %" PRIzd ".",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			if( parent_node == node )
+			{
+				if( libcdata_tree_node_get_value(
+				     *sub_node,
+				     (intptr_t **) sub_single_file_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve value from sub node of index entry: %" PRIzd ".",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				if( ( *sub_single_file_entry == NULL )
+				 || ( ( *sub_single_file_entry )->name == NULL ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing sub single file entry name of index entry: %" PRIzd ".",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				result = libuna_utf16_string_compare_with_utf8_stream(
+					  utf16_string,
+					  utf16_string_length,
+					  ( *sub_single_file_entry )->name,
+					  (size_t) ( *sub_single_file_entry )->name_size,
+					  error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to compare UTF-16 string.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+					return( 1 );
+				}
+			}
+		}
+		entry_index = ( entry_index + 1 ) & ( index->number_of_entries - 1 );
+	}
+	*sub_node              = NULL;
+	*sub_single_file_entry = NULL;
+
+	return( 0 );
+
+on_error:
+	*sub_node              = NULL;
+	*sub_single_file_entry = NULL;
+
+	return( -1 );
+}
+
 /* Retrieves the single file entry sub node for the specific UTF-8 formatted name
+ * The index is used if provided otherwise the sub nodes are compared one by one
+ * The index does not fall back to comparing the sub nodes one by one, since
+ * the sub nodes that are not in the index cannot be retrieved by name
  * Returns 1 if successful, 0 if no such sub single file entry or -1 on error
  */
 int libewf_single_file_tree_get_sub_node_by_utf8_name(
+     libewf_single_file_tree_index_t *index,
      libcdata_tree_node_t *node,
      const uint8_t *utf8_string,
      size_t utf8_string_length,
@@ -77,6 +1134,28 @@ int libewf_single_file_tree_get_sub_node_by_utf8_name(
 
 		return( -1 );
 	}
+	if( index != NULL )
+	{
+		result = libewf_single_file_tree_index_get_sub_node_by_utf8_name(
+		          index,
+		          node,
+		          utf8_string,
+		          utf8_string_length,
+		          sub_node,
+		          sub_single_file_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node from index.",
+			 function );
+		}
+		return( result );
+	}
 	if( libcdata_tree_node_get_number_of_sub_nodes(
 	     node,
 	     &number_of_sub_nodes,
@@ -194,9 +1273,13 @@ on_error:
 }
 
 /* Retrieves the single file entry sub node for the specific UTF-16 formatted name
+ * The index is used if provided otherwise the sub nodes are compared one by one
+ * The index does not fall back to comparing the sub nodes one by one, since
+ * the sub nodes that are not in the index cannot be retrieved by name
  * Returns 1 if successful, 0 if no such sub single file entry or -1 on error
  */
 int libewf_single_file_tree_get_sub_node_by_utf16_name(
+     libewf_single_file_tree_index_t *index,
      libcdata_tree_node_t *node,
      const uint16_t *utf16_string,
      size_t utf16_string_length,
@@ -242,6 +1325,28 @@ int libewf_single_file_tree_get_sub_node_by_utf16_name(
 
 		return( -1 );
 	}
+	if( index != NULL )
+	{
+		result = libewf_single_file_tree_index_get_sub_node_by_utf16_name(
+		          index,
+		          node,
+		          utf16_string,
+		          utf16_string_length,
+		          sub_node,
+		          sub_single_file_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node from index.",
+			 function );
+		}
+		return( result );
+	}
 	if( libcdata_tree_node_get_number_of_sub_nodes(
 	     node,
 	     &number_of_sub_nodes,
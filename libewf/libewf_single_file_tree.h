@@ -27,13 +27,105 @@
 
 #include "libewf_libcdata.h"
 #include "libewf_libcerror.h"
+#include "libewf_libuna.h"
 #include "libewf_single_file_entry.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+typedef struct libewf_single_file_tree_index_entry libewf_single_file_tree_index_entry_t;
+
+struct libewf_single_file_tree_index_entry
+{
+	/* The sub node
+	 */
+	libcdata_tree_node_t *sub_node;
+
+	/* The hash of the parent node and the name of the sub node
+	 */
+	uint32_t hash;
+};
+
+typedef struct libewf_single_file_tree_index libewf_single_file_tree_index_t;
+
+struct libewf_single_file_tree_index
+{
+	/* The entries
+	 */
+	libewf_single_file_tree_index_entry_t *entries;
+
+	/* The number of entries, which is a power of 2
+	 */
+	size_t number_of_entries;
+};
+
+int libewf_single_file_tree_index_initialize(
+     libewf_single_file_tree_index_t **index,
+     libcdata_tree_node_t *root_node,
+     libcerror_error_t **error );
+
+int libewf_single_file_tree_index_free(
+     libewf_single_file_tree_index_t **index,
+     libcerror_error_t **error );
+
+int libewf_single_file_tree_index_insert_sub_nodes(
+     libewf_single_file_tree_index_t *index,
+     libcdata_tree_node_t *node,
+     libcerror_error_t **error );
+
+int libewf_single_file_tree_get_number_of_nodes(
+     libcdata_tree_node_t *node,
+     size_t *number_of_nodes,
+     libcerror_error_t **error );
+
+uint32_t libewf_single_file_tree_get_parent_node_hash(
+          libcdata_tree_node_t *parent_node );
+
+uint32_t libewf_single_file_tree_update_name_hash(
+          uint32_t hash,
+          libuna_unicode_character_t unicode_character );
+
+int libewf_single_file_tree_get_utf8_name_hash(
+     libcdata_tree_node_t *parent_node,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *hash,
+     libcerror_error_t **error );
+
+int libewf_single_file_tree_get_utf16_name_hash(
+     libcdata_tree_node_t *parent_node,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *hash,
+     libcerror_error_t **error );
+
+int libewf_single_file_tree_get_utf8_stream_name_hash(
+     libcdata_tree_node_t *parent_node,
+     const uint8_t *utf8_stream,
+     size_t utf8_stream_size,
+     uint32_t *hash );
+
+int libewf_single_file_tree_index_get_sub_node_by_utf8_name(
+     libewf_single_file_tree_index_t *index,
+     libcdata_tree_node_t *single_file_tree_node,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcdata_tree_node_t **single_file_tree_sub_node,
+     libewf_single_file_entry_t **sub_single_file_entry,
+     libcerror_error_t **error );
+
+int libewf_single_file_tree_index_get_sub_node_by_utf16_name(
+     libewf_single_file_tree_index_t *index,
+     libcdata_tree_node_t *single_file_tree_node,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcdata_tree_node_t **single_file_tree_sub_node,
+     libewf_single_file_entry_t **sub_single_file_entry,
+     libcerror_error_t **error );
+
 int libewf_single_file_tree_get_sub_node_by_utf8_name(
+     libewf_single_file_tree_index_t *index,
      libcdata_tree_node_t *single_file_tree_node,
      const uint8_t *utf8_string,
      size_t utf8_string_length,
@@ -42,6 +134,7 @@ int libewf_single_file_tree_get_sub_node_by_utf8_name(
      libcerror_error_t **error );
 
 int libewf_single_file_tree_get_sub_node_by_utf16_name(
+     libewf_single_file_tree_index_t *index,
      libcdata_tree_node_t *single_file_tree_node,
      const uint16_t *utf16_string,
      size_t utf16_string_length,
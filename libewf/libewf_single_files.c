@@ -27,10 +27,9 @@
 #include "libewf_libcdata.h"
 #include "libewf_libcerror.h"
 #include "libewf_libcnotify.h"
-#include "libewf_libcstring.h"
-#include "libewf_libfvalue.h"
 #include "libewf_libuna.h"
 #include "libewf_single_file_entry.h"
+#include "libewf_single_file_tree.h"
 #include "libewf_single_files.h"
 
 /* Initialize the single files
@@ -133,6 +132,27 @@ int libewf_single_files_free(
 			memory_free(
 			 ( *single_files )->section_data );
 		}
+		if( ( *single_files )->ltree_data != NULL )
+		{
+			memory_free(
+			 ( *single_files )->ltree_data );
+		}
+		if( ( *single_files )->file_entry_tree_index != NULL )
+		{
+			if( libewf_single_file_tree_index_free(
+			     &( ( *single_files )->file_entry_tree_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free single file entry tree index.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *single_files )->root_file_entry_node != NULL )
 		{
 			if( libcdata_tree_node_free(
@@ -158,6 +178,7 @@ int libewf_single_files_free(
 	return( result );
 }
 
+
 /* Parse an EWF ltree for the values
  * Returns 1 if successful or -1 on error
  */
@@ -167,9 +188,7 @@ int libewf_single_files_parse(
      uint8_t *format,
      libcerror_error_t **error )
 {
-	uint8_t *file_entries_string    = NULL;
-	static char *function           = "libewf_single_files_parse";
-	size_t file_entries_string_size = 0;
+	static char *function = "libewf_single_files_parse";
 
 	if( single_files == NULL )
 	{
@@ -193,58 +212,14 @@ int libewf_single_files_parse(
 
 		return( -1 );
 	}
-	if( libuna_utf8_string_size_from_utf16_stream(
-	     single_files->ltree_data,
-	     single_files->ltree_data_size,
-	     LIBUNA_ENDIAN_LITTLE,
-	     &file_entries_string_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine file entries string size.",
-		 function );
-
-		return( -1 );
-	}
-	file_entries_string = (uint8_t *) memory_allocate(
-	                                   sizeof( uint8_t ) * (size_t) file_entries_string_size );
-
-	if( file_entries_string == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create file entries string.",
-		 function );
-
-		goto on_error;
-	}
-	if( libuna_utf8_string_copy_from_utf16_stream(
-	     file_entries_string,
-	     file_entries_string_size,
-	     single_files->ltree_data,
-	     single_files->ltree_data_size,
-	     LIBUNA_ENDIAN_LITTLE,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set file entries string.",
-		 function );
-
-		goto on_error;
-	}
+	/* The file entries are parsed directly from the UTF-16 little-endian
+	 * ltree data, only the names are converted into UTF-8
+	 */
 	if( libewf_single_files_parse_file_entries(
 	     single_files,
 	     media_size,
-	     file_entries_string,
-	     file_entries_string_size,
+	     single_files->ltree_data,
+	     single_files->ltree_data_size,
 	     format,
 	     error ) != 1 )
 	{
@@ -252,43 +227,46 @@ int libewf_single_files_parse(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
 		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to parse file entries string.",
+		 "%s: unable to parse file entries.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
+	/* The ltree data is no longer needed once the file entries are parsed
+	 */
 	memory_free(
-	 file_entries_string );
+	 single_files->ltree_data );
 
-	return( 1 );
+	single_files->ltree_data      = NULL;
+	single_files->ltree_data_size = 0;
 
-on_error:
-	if( file_entries_string != NULL )
-	{
-		memory_free(
-		 file_entries_string );
-	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Parse a single file entries string for the values
+/* Parse the UTF-16 little-endian ltree data for the file entries
  * Returns 1 if successful or -1 on error
  */
 int libewf_single_files_parse_file_entries(
      libewf_single_files_t *single_files,
      size64_t *media_size,
-     const uint8_t *entries_string,
-     size_t entries_string_size,
+     const uint8_t *ltree_data,
+     size_t ltree_data_size,
      uint8_t *format,
      libcerror_error_t **error )
 {
-	libfvalue_split_utf8_string_t *lines = NULL;
-	libfvalue_split_utf8_string_t *types = NULL;
-	uint8_t *line_string                 = NULL;
-	static char *function                = "libewf_single_files_parse_file_entries";
-	size_t line_string_size              = 0;
-	int line_index                       = 0;
-	int number_of_lines                  = 0;
+	const uint8_t *line_data        = NULL;
+	uint8_t *value_types            = NULL;
+	static char *function           = "libewf_single_files_parse_file_entries";
+	size_t entry_data_offset        = 0;
+	size_t line_data_size           = 0;
+	size_t ltree_data_offset        = 0;
+	size_t record_data_offset       = 0;
+	size_t start_data_offset        = 0;
+	int entry_line_index            = -1;
+	int line_index                  = 0;
+	int number_of_lines             = 0;
+	int number_of_value_types       = 0;
+	int record_line_index           = -1;
 
 	if( single_files == NULL )
 	{
@@ -301,387 +279,410 @@ int libewf_single_files_parse_file_entries(
 
 		return( -1 );
 	}
-	if( entries_string == NULL )
+	if( single_files->root_file_entry_node != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid single files - root file entry node value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ltree_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid entries string.",
+		 "%s: invalid ltree data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ltree_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid ltree data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfvalue_utf8_string_split(
-	     entries_string,
-	     entries_string_size - 1,
-	     (uint8_t) '\n',
-	     &lines,
+	/* Skip the byte order mark if present
+	 */
+	if( ( ltree_data_size >= 2 )
+	 && ( ltree_data[ 0 ] == 0xff )
+	 && ( ltree_data[ 1 ] == 0xfe ) )
+	{
+		start_data_offset = 2;
+	}
+	/* Determine the number of lines, the string is terminated by the first 0-character
+	 */
+	number_of_lines = 1;
+
+	for( ltree_data_offset = start_data_offset;
+	     ( ltree_data_offset + 1 ) < ltree_data_size;
+	     ltree_data_offset += 2 )
+	{
+		if( ltree_data[ ltree_data_offset + 1 ] != 0 )
+		{
+			continue;
+		}
+		if( ltree_data[ ltree_data_offset ] == 0 )
+		{
+			break;
+		}
+		else if( ltree_data[ ltree_data_offset ] == (uint8_t) '\n' )
+		{
+			if( number_of_lines == INT_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of lines value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			number_of_lines++;
+		}
+	}
+	ltree_data_size = ltree_data_offset;
+
+	if( ltree_data_size == start_data_offset )
+	{
+		return( 1 );
+	}
+	ltree_data_offset = start_data_offset;
+
+	if( libewf_single_files_read_line(
+	     ltree_data,
+	     ltree_data_size,
+	     &ltree_data_offset,
+	     &line_data,
+	     &line_data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to split entries string into lines.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve line: 0.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfvalue_split_utf8_string_get_number_of_segments(
-	     lines,
-	     &number_of_lines,
-	     error ) != 1 )
+	if( line_data_size == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of lines",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing line: 0.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( line_data_size != 2 )
+	 || ( line_data[ 0 ] < (uint8_t) '0' )
+	 || ( line_data[ 0 ] > (uint8_t) '9' )
+	 || ( line_data[ 1 ] != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported single file entries string.",
 		 function );
 
 		goto on_error;
 	}
-	if( number_of_lines > 0 )
+	/* Find the lines containing: "rec" and "entry"
+	 */
+	ltree_data_offset = start_data_offset;
+
+	for( line_index = 0;
+	     line_index < number_of_lines;
+	     line_index++ )
 	{
-		if( libfvalue_split_utf8_string_get_segment_by_index(
-		     lines,
-		     0,
-		     &line_string,
-		     &line_string_size,
+		if( libewf_single_files_read_line(
+		     ltree_data,
+		     ltree_data_size,
+		     &ltree_data_offset,
+		     &line_data,
+		     &line_data_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve line string: 0.",
-			 function );
+			 "%s: unable to retrieve line: %d.",
+			 function,
+			 line_index );
 
 			goto on_error;
 		}
-		if( ( line_string == NULL )
-		 || ( line_string_size < 2 )
-		 || ( line_string[ 0 ] == 0 ) )
+		if( ( record_line_index == -1 )
+		 && ( libewf_single_files_compare_value(
+		       line_data,
+		       line_data_size,
+		       "rec",
+		       3 ) == 1 ) )
+		{
+			record_line_index  = line_index + 1;
+			record_data_offset = ltree_data_offset;
+		}
+		else if( ( entry_line_index == -1 )
+		      && ( libewf_single_files_compare_value(
+		            line_data,
+		            line_data_size,
+		            "entry",
+		            5 ) == 1 ) )
+		{
+			entry_line_index  = line_index + 1;
+			entry_data_offset = ltree_data_offset;
+		}
+		if( ( record_line_index != -1 )
+		 && ( entry_line_index != -1 ) )
+		{
+			break;
+		}
+	}
+	if( record_line_index == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing record line.",
+		 function );
+
+		goto on_error;
+	}
+	line_index        = record_line_index;
+	ltree_data_offset = record_data_offset;
+
+	if( libewf_single_files_parse_record_values(
+	     media_size,
+	     ltree_data,
+	     ltree_data_size,
+	     &ltree_data_offset,
+	     &line_index,
+	     number_of_lines,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to parse record values.",
+		 function );
+
+		goto on_error;
+	}
+	/* The "entry" line is followed by the number of entries
+	 * and the types line
+	 */
+	if( ( entry_line_index != -1 )
+	 && ( ( entry_line_index + 1 ) < number_of_lines ) )
+	{
+		line_index        = entry_line_index;
+		ltree_data_offset = entry_data_offset;
+
+		if( libewf_single_files_read_line(
+		     ltree_data,
+		     ltree_data_size,
+		     &ltree_data_offset,
+		     &line_data,
+		     &line_data_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing line string: 0.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve line: %d.",
+			 function,
+			 line_index );
 
 			goto on_error;
 		}
-		/* Remove trailing carriage return
-		 */
-		else if( line_string[ line_string_size - 2 ] == (uint8_t) '\r' )
+		line_index += 1;
+
+		if( libewf_single_files_read_line(
+		     ltree_data,
+		     ltree_data_size,
+		     &ltree_data_offset,
+		     &line_data,
+		     &line_data_size,
+		     error ) != 1 )
 		{
-			line_string[ line_string_size - 2 ] = 0;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve line: %d.",
+			 function,
+			 line_index );
 
-			line_string_size -= 1;
+			goto on_error;
 		}
-		if( line_string_size != 2 )
+		line_index += 1;
+
+		if( libewf_single_files_parse_value_types(
+		     line_data,
+		     line_data_size,
+		     &value_types,
+		     &number_of_value_types,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported single file entries string.",
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to parse value types.",
 			 function );
 
 			goto on_error;
 		}
-		if( ( line_string[ 0 ] < (uint8_t) '0' )
-		 || ( line_string[ 0 ] > (uint8_t) '9' ) )
+		if( libcdata_tree_node_initialize(
+		     &( single_files->root_file_entry_node ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported single file entries string.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create root single file entry node.",
 			 function );
 
 			goto on_error;
 		}
-		/* Find the line containing: "rec"
-		 */
-		for( line_index = 0;
-		     line_index < number_of_lines;
-		     line_index++ )
-		{
-			if( libfvalue_split_utf8_string_get_segment_by_index(
-			     lines,
-			     line_index,
-			     &line_string,
-			     &line_string_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve line string: %d.",
-				 function,
-				 line_index );
-
-				goto on_error;
-			}
-			if( line_string_size == 4 )
-			{
-				if( line_string == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing line string: %d.",
-					 function,
-					 line_index );
-
-					goto on_error;
-				}
-				if( ( line_string[ 0 ] == (uint8_t) 'r' )
-				 && ( line_string[ 1 ] == (uint8_t) 'e' )
-				 && ( line_string[ 2 ] == (uint8_t) 'c' ) )
-				{
-					line_index += 1;
-
-					break;
-				}
-			}
-		}
-		if( libewf_single_files_parse_record_values(
-		     media_size,
-		     lines,
+		if( libewf_single_files_parse_file_entry(
+		     single_files->root_file_entry_node,
+		     ltree_data,
+		     ltree_data_size,
+		     &ltree_data_offset,
 		     &line_index,
+		     number_of_lines,
+		     value_types,
+		     number_of_value_types,
+		     format,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
 			 LIBCERROR_CONVERSION_ERROR_GENERIC,
-			 "%s: unable to parse record values.",
+			 "%s: unable to parse file entry.",
 			 function );
 
 			goto on_error;
 		}
-		/* Find the line containing: "entry"
+		/* The single files entries should be followed by an emtpy line
 		 */
-		for( line_index = 0;
-		     line_index < number_of_lines;
-		     line_index++ )
+		if( line_index >= number_of_lines )
 		{
-			if( libfvalue_split_utf8_string_get_segment_by_index(
-			     lines,
-			     line_index,
-			     &line_string,
-			     &line_string_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve line string: %d.",
-				 function,
-				 line_index );
-
-				goto on_error;
-			}
-			if( line_string_size == 6 )
-			{
-				if( line_string == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing line string: %d.",
-					 function,
-					 line_index );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing empty line: %d.",
+			 function,
+			 line_index );
 
-					goto on_error;
-				}
-				if( ( line_string[ 0 ] == (uint8_t) 'e' )
-				 && ( line_string[ 1 ] == (uint8_t) 'n' )
-				 && ( line_string[ 2 ] == (uint8_t) 't' )
-				 && ( line_string[ 3 ] == (uint8_t) 'r' )
-				 && ( line_string[ 4 ] == (uint8_t) 'y' ) )
-				{
-					line_index += 2;
+			goto on_error;
+		}
+		if( libewf_single_files_read_line(
+		     ltree_data,
+		     ltree_data_size,
+		     &ltree_data_offset,
+		     &line_data,
+		     &line_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve line: %d.",
+			 function,
+			 line_index );
 
-					break;
-				}
-			}
+			goto on_error;
 		}
-		if( line_index < number_of_lines )
+		if( line_data_size != 0 )
 		{
-			if( libfvalue_split_utf8_string_get_segment_by_index(
-			     lines,
-			     line_index,
-			     &line_string,
-			     &line_string_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve line string: %d.",
-				 function,
-				 line_index );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported empty line: %d - not empty.",
+			 function,
+			 line_index );
 
-				goto on_error;
-			}
-			line_index += 1;
+			goto on_error;
+		}
+		memory_free(
+		 value_types );
 
-			if( libfvalue_utf8_string_split(
-			     line_string,
-			     line_string_size,
-			     (uint8_t) '\t',
-			     &types,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to split entries string into types.",
-				 function );
-
-				goto on_error;
-			}
-			if( libcdata_tree_node_initialize(
-			     &( single_files->root_file_entry_node ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create root single file entry node.",
-				 function );
-
-				goto on_error;
-			}
-			if( libewf_single_files_parse_file_entry(
-			     single_files->root_file_entry_node,
-			     lines,
-			     &line_index,
-			     types,
-			     format,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-				 LIBCERROR_CONVERSION_ERROR_GENERIC,
-				 "%s: unable to parse file entry.",
-				 function );
-
-				goto on_error;
-			}
-			/* The single files entries should be followed by an emtpy line
-			 */
-			if( libfvalue_split_utf8_string_get_segment_by_index(
-			     lines,
-			     line_index,
-			     &line_string,
-			     &line_string_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve line string: %d.",
-				 function,
-				 line_index );
-
-				goto on_error;
-			}
-			if( ( line_string_size != 1 )
-			 || ( line_string[ 0 ] != 0 ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported empty line string: %d - not empty.",
-				 function,
-				 line_index );
-
-				goto on_error;
-			}
-		}
-		if( libfvalue_split_utf8_string_free(
-		     &types,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free split types.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	if( libfvalue_split_utf8_string_free(
-	     &lines,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free split lines.",
-		 function );
-
-		goto on_error;
+		value_types = NULL;
 	}
 	return( 1 );
 
 on_error:
-	if( types != NULL )
+	if( single_files->root_file_entry_node != NULL )
 	{
-		libfvalue_split_utf8_string_free(
-		 &types,
+		libcdata_tree_node_free(
+		 &( single_files->root_file_entry_node ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libewf_single_file_entry_free,
 		 NULL );
 	}
-	if( lines != NULL )
+	if( value_types != NULL )
 	{
-		libfvalue_split_utf8_string_free(
-		 &lines,
-		 NULL );
+		memory_free(
+		 value_types );
 	}
 	return( -1 );
 }
 
-/* Parse a record string for the values
+/* Parse the record types and values lines for the values
  * Returns 1 if successful or -1 on error
  */
 int libewf_single_files_parse_record_values(
      size64_t *media_size,
-     libfvalue_split_utf8_string_t *lines,
+     const uint8_t *ltree_data,
+     size_t ltree_data_size,
+     size_t *ltree_data_offset,
      int *line_index,
+     int number_of_lines,
      libcerror_error_t **error )
 {
-	libfvalue_split_utf8_string_t *types  = NULL;
-	libfvalue_split_utf8_string_t *values = NULL;
-	uint8_t *line_string                  = NULL;
-	uint8_t *type_string                  = NULL;
-	uint8_t *value_string                 = NULL;
-	static char *function                 = "libewf_single_files_parse_record_values";
-	size_t line_string_size               = 0;
-	size_t type_string_size               = 0;
-	size_t value_string_size              = 0;
-	uint64_t value_64bit                  = 0;
-	int number_of_types                   = 0;
-	int number_of_values                  = 0;
-	int value_index                       = 0;
+	const uint8_t *type_data   = NULL;
+	const uint8_t *types_data  = NULL;
+	const uint8_t *value_data  = NULL;
+	const uint8_t *values_data = NULL;
+	static char *function      = "libewf_single_files_parse_record_values";
+	size_t type_data_size      = 0;
+	size_t types_data_offset   = 0;
+	size_t types_data_size     = 0;
+	size_t value_data_size     = 0;
+	size_t values_data_offset  = 0;
+	size_t values_data_size    = 0;
+	uint64_t value_64bit       = 0;
+	int result                 = 0;
+	int value_index            = 0;
+
+#if defined( HAVE_VERBOSE_OUTPUT )
+	int number_of_types        = 0;
+	int number_of_values       = 0;
+#endif
 
 	if( media_size == NULL )
 	{
@@ -705,108 +706,70 @@ int libewf_single_files_parse_record_values(
 
 		return( -1 );
 	}
-	if( libfvalue_split_utf8_string_get_segment_by_index(
-	     lines,
-	     *line_index,
-	     &line_string,
-	     &line_string_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve line string: %d.",
-		 function,
-		 *line_index );
-
-		goto on_error;
-	}
-	*line_index += 1;
-
-	if( libfvalue_utf8_string_split(
-	     line_string,
-	     line_string_size,
-	     (uint8_t) '\t',
-	     &types,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to split entries string into types.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfvalue_split_utf8_string_get_number_of_segments(
-	     types,
-	     &number_of_types,
-	     error ) != 1 )
+	if( ( *line_index + 1 ) >= number_of_lines )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of types",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid line index value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfvalue_split_utf8_string_get_segment_by_index(
-	     lines,
-	     *line_index,
-	     &line_string,
-	     &line_string_size,
+	if( libewf_single_files_read_line(
+	     ltree_data,
+	     ltree_data_size,
+	     ltree_data_offset,
+	     &types_data,
+	     &types_data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve line string: %d.",
+		 "%s: unable to retrieve line: %d.",
 		 function,
 		 *line_index );
 
-		goto on_error;
+		return( -1 );
 	}
 	*line_index += 1;
 
-	if( libfvalue_utf8_string_split(
-	     line_string,
-	     line_string_size,
-	     (uint8_t) '\t',
-	     &values,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to split entries string into values.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfvalue_split_utf8_string_get_number_of_segments(
-	     values,
-	     &number_of_values,
+	if( libewf_single_files_read_line(
+	     ltree_data,
+	     ltree_data_size,
+	     ltree_data_offset,
+	     &values_data,
+	     &values_data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of values",
-		 function );
+		 "%s: unable to retrieve line: %d.",
+		 function,
+		 *line_index );
 
-		goto on_error;
+		return( -1 );
 	}
+	*line_index += 1;
+
 #if defined( HAVE_VERBOSE_OUTPUT )
-	if( number_of_types != number_of_values )
+	if( libcnotify_verbose != 0 )
 	{
-		if( libcnotify_verbose != 0 )
+		number_of_types  = libewf_single_files_get_number_of_values(
+		                    types_data,
+		                    types_data_size,
+		                    (uint8_t) '\t' );
+		number_of_values = libewf_single_files_get_number_of_values(
+		                    values_data,
+		                    values_data_size,
+		                    (uint8_t) '\t' );
+
+		if( number_of_types != number_of_values )
 		{
 			libcnotify_printf(
 			"%s: mismatch in number of types and values.\n",
@@ -814,608 +777,650 @@ int libewf_single_files_parse_record_values(
 		}
 	}
 #endif
-	for( value_index = 0;
-	     value_index < number_of_types;
-	     value_index++ )
-	{
-		if( libfvalue_split_utf8_string_get_segment_by_index(
-		     types,
-		     value_index,
-		     &type_string,
-		     &type_string_size,
+	/* The types and values lines are walked side by side
+	 */
+	while( types_data_offset <= types_data_size )
+	{
+		if( libewf_single_files_read_value(
+		     types_data,
+		     types_data_size,
+		     &types_data_offset,
+		     (uint8_t) '\t',
+		     &type_data,
+		     &type_data_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve type string: %d.",
+			 "%s: unable to retrieve type: %d.",
 			 function,
 			 value_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( ( type_string == NULL )
-		 || ( type_string_size < 2 )
-		 || ( type_string[ 0 ] == 0 ) )
+		if( type_data_size == 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing type string: %d.",
+			 "%s: missing type: %d.",
 			 function,
 			 value_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		/* Remove trailing carriage return
-		 */
-		else if( type_string[ type_string_size - 2 ] == (uint8_t) '\r' )
-		{
-			type_string[ type_string_size - 2 ] = 0;
+		value_data      = NULL;
+		value_data_size = 0;
 
-			type_string_size -= 1;
-		}
-		if( value_index < number_of_values )
+		if( values_data_offset <= values_data_size )
 		{
-			if( libfvalue_split_utf8_string_get_segment_by_index(
-			     values,
-			     value_index,
-			     &value_string,
-			     &value_string_size,
+			if( libewf_single_files_read_value(
+			     values_data,
+			     values_data_size,
+			     &values_data_offset,
+			     (uint8_t) '\t',
+			     &value_data,
+			     &value_data_size,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve value string: %d.",
+				 "%s: unable to retrieve value: %d.",
 				 function,
 				 value_index );
 
-				goto on_error;
-			}
-			if( ( value_string == NULL )
-			 || ( value_string_size < 2 )
-			 || ( value_string[ 0 ] == 0 ) )
-			{
-				value_string      = NULL;
-				value_string_size = 0;
-			}
-			/* Remove trailing carriage return
-			 */
-			else if( value_string[ value_string_size - 2 ] == (uint8_t) '\r' )
-			{
-				value_string[ value_string_size - 2 ] = 0;
-
-				value_string_size -= 1;
+				return( -1 );
 			}
 		}
-		else
-		{
-			value_string      = NULL;
-			value_string_size = 0;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: type: %s with value: %s.\n",
-			 function,
-			 (char *) type_string,
-			 (char *) value_string );
-		}
-#endif
 		/* Ignore empty values
 		 */
-		if( value_string == NULL )
-		{
-			continue;
-		}
-		if( type_string_size == 3 )
+		if( value_data_size != 0 )
 		{
-			if( ( type_string[ 0 ] == (uint8_t) 'c' )
-			 && ( type_string[ 1 ] == (uint8_t) 'l' ) )
-			{
-			}
-			else if( ( type_string[ 0 ] == (uint8_t) 't' )
-			      && ( type_string[ 1 ] == (uint8_t) 'b' ) )
+			result = libewf_single_files_compare_value(
+			          type_data,
+			          type_data_size,
+			          "tb",
+			          2 );
+
+			if( result == 1 )
 			{
-				if( libfvalue_utf8_string_copy_to_integer(
-				     value_string,
-				     value_string_size,
+				if( libewf_single_files_copy_value_to_integer(
+				     value_data,
+				     value_data_size,
 				     &value_64bit,
 				     64,
-				     LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_UNSIGNED,
+				     10,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
 					 "%s: unable to set media size.",
 					 function );
 
-					goto on_error;
+					return( -1 );
 				}
 				*media_size = (size64_t) value_64bit;
 			}
 		}
-	}
-	if( libfvalue_split_utf8_string_free(
-	     &values,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free split values.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfvalue_split_utf8_string_free(
-	     &types,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free split types.",
-		 function );
-
-		goto on_error;
+		value_index++;
 	}
 	return( 1 );
-
-on_error:
-	if( values != NULL )
-	{
-		libfvalue_split_utf8_string_free(
-		 &values,
-		 NULL );
-	}
-	if( types != NULL )
-	{
-		libfvalue_split_utf8_string_free(
-		 &types,
-		 NULL );
-	}
-	return( -1 );
 }
 
-/* Parse a single file entry string for the values
+/* Parse a single file entry types line into value types
  * Returns 1 if successful or -1 on error
  */
-int libewf_single_files_parse_file_entry(
-     libcdata_tree_node_t *parent_file_entry_node,
-     libfvalue_split_utf8_string_t *lines,
-     int *line_index,
-     libfvalue_split_utf8_string_t *types,
-     uint8_t *format,
+int libewf_single_files_parse_value_types(
+     const uint8_t *types_data,
+     size_t types_data_size,
+     uint8_t **value_types,
+     int *number_of_value_types,
      libcerror_error_t **error )
 {
-	libewf_single_file_entry_t *single_file_entry = NULL;
-	libfvalue_split_utf8_string_t *values         = NULL;
-	libcdata_tree_node_t *file_entry_node         = NULL;
-	uint8_t *line_string                          = NULL;
-	uint8_t *type_string                          = NULL;
-	uint8_t *value_string                         = NULL;
-	static char *function                         = "libewf_single_files_parse_file_entry";
-	size_t line_string_size                       = 0;
-	size_t type_string_size                       = 0;
-	size_t value_string_size                      = 0;
-	size_t value_string_index                     = 0;
-	uint64_t number_of_sub_entries                = 0;
-	uint64_t value_64bit                          = 0;
-	int number_of_lines                           = 0;
-	int number_of_types                           = 0;
-	int number_of_values                          = 0;
-	int value_index                               = 0;
-	int zero_values_only                          = 0;
-
-	if( parent_file_entry_node == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid parent file entry node.",
-		 function );
+	const uint8_t *type_data = NULL;
+	static char *function    = "libewf_single_files_parse_value_types";
+	size_t type_data_size    = 0;
+	size_t types_data_offset = 0;
+	int value_index          = 0;
 
-		return( -1 );
-	}
-	if( line_index == NULL )
+	if( types_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid line index.",
+		 "%s: invalid types data.",
 		 function );
 
 		return( -1 );
 	}
-	if( format == NULL )
+	if( value_types == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid format.",
+		 "%s: invalid value types.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfvalue_split_utf8_string_get_number_of_segments(
-	     types,
-	     &number_of_types,
-	     error ) != 1 )
+	if( *value_types != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of types",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid value types value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libewf_single_files_parse_file_entry_number_of_sub_entries(
-	     lines,
-	     line_index,
-	     &number_of_sub_entries,
-	     error ) != 1 )
+	if( number_of_value_types == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to parse file entry number of sub entries.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of value types.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfvalue_split_utf8_string_get_segment_by_index(
-	     lines,
-	     *line_index,
-	     &line_string,
-	     &line_string_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve line string: %d.",
-		 function,
-		 *line_index );
+	*number_of_value_types = libewf_single_files_get_number_of_values(
+	                          types_data,
+	                          types_data_size,
+	                          (uint8_t) '\t' );
 
-		goto on_error;
-	}
-	*line_index += 1;
+	*value_types = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * *number_of_value_types );
 
-	if( libfvalue_utf8_string_split(
-	     line_string,
-	     line_string_size,
-	     (uint8_t) '\t',
-	     &values,
-	     error ) != 1 )
+	if( *value_types == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to split entries string into values.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create value types.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfvalue_split_utf8_string_get_number_of_segments(
-	     values,
-	     &number_of_values,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of values",
-		 function );
+	types_data_offset = 0;
 
-		goto on_error;
-	}
-#if defined( HAVE_VERBOSE_OUTPUT )
-	if( number_of_types != number_of_values )
+	for( value_index = 0;
+	     value_index < *number_of_value_types;
+	     value_index++ )
 	{
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			"%s: mismatch in number of types and values.\n",
-			 function );
-		}
-	}
-#endif
-	if( libewf_single_file_entry_initialize(
-	     &single_file_entry,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create single file entry.",
-		 function );
-
-		goto on_error;
-	}
-	for( value_index = 0;
-	     value_index < number_of_types;
-	     value_index++ )
-	{
-		if( libfvalue_split_utf8_string_get_segment_by_index(
-		     types,
-		     value_index,
-		     &type_string,
-		     &type_string_size,
-		     error ) != 1 )
+		if( libewf_single_files_read_value(
+		     types_data,
+		     types_data_size,
+		     &types_data_offset,
+		     (uint8_t) '\t',
+		     &type_data,
+		     &type_data_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve type string: %d.",
+			 "%s: unable to retrieve type: %d.",
 			 function,
 			 value_index );
 
 			goto on_error;
 		}
-		if( ( type_string == NULL )
-		 || ( type_string_size < 2 )
-		 || ( type_string[ 0 ] == 0 ) )
+		if( type_data_size == 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing type string: %d.",
+			 "%s: missing type: %d.",
 			 function,
 			 value_index );
 
 			goto on_error;
 		}
-		/* Remove trailing carriage return
+		( *value_types )[ value_index ] = LIBEWF_SINGLE_FILES_VALUE_TYPE_UNDEFINED;
+
+		/* Types without a corresponding single file entry value
+		 * like "cid", "src", "sub", "aq", "dl", "id", "jq", "lo", "pm" and "po"
+		 * are ignored
 		 */
-		else if( type_string[ type_string_size - 2 ] == (uint8_t) '\r' )
+		if( type_data_size == 6 )
 		{
-			type_string[ type_string_size - 2 ] = 0;
-
-			type_string_size -= 1;
+			if( libewf_single_files_compare_value(
+			     type_data,
+			     type_data_size,
+			     "opr",
+			     3 ) == 1 )
+			{
+				( *value_types )[ value_index ] = LIBEWF_SINGLE_FILES_VALUE_TYPE_FLAGS;
+			}
+			else if( libewf_single_files_compare_value(
+			          type_data,
+			          type_data_size,
+			          "sha",
+			          3 ) == 1 )
+			{
+				( *value_types )[ value_index ] = LIBEWF_SINGLE_FILES_VALUE_TYPE_SHA1_HASH;
+			}
 		}
-		if( value_index < number_of_values )
+		else if( type_data_size == 4 )
 		{
-			if( libfvalue_split_utf8_string_get_segment_by_index(
-			     values,
-			     value_index,
-			     &value_string,
-			     &value_string_size,
-			     error ) != 1 )
+			if( libewf_single_files_compare_value(
+			     type_data,
+			     type_data_size,
+			     "ac",
+			     2 ) == 1 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve value string: %d.",
-				 function,
-				 value_index );
-
-				goto on_error;
+				( *value_types )[ value_index ] = LIBEWF_SINGLE_FILES_VALUE_TYPE_ACCESS_TIME;
 			}
-			if( ( value_string == NULL )
-			 || ( value_string_size < 2 )
-			 || ( value_string[ 0 ] == 0 ) )
+			/* Data offset
+			 * consist of: unknown, offset and size
+			 */
+			else if( libewf_single_files_compare_value(
+			          type_data,
+			          type_data_size,
+			          "be",
+			          2 ) == 1 )
+			{
+				( *value_types )[ value_index ] = LIBEWF_SINGLE_FILES_VALUE_TYPE_DATA_OFFSET;
+			}
+			else if( libewf_single_files_compare_value(
+			          type_data,
+			          type_data_size,
+			          "cr",
+			          2 ) == 1 )
+			{
+				( *value_types )[ value_index ] = LIBEWF_SINGLE_FILES_VALUE_TYPE_CREATION_TIME;
+			}
+			else if( libewf_single_files_compare_value(
+			          type_data,
+			          type_data_size,
+			          "du",
+			          2 ) == 1 )
+			{
+				( *value_types )[ value_index ] = LIBEWF_SINGLE_FILES_VALUE_TYPE_DUPLICATE_DATA_OFFSET;
+			}
+			/* MD5 digest hash
+			 */
+			else if( libewf_single_files_compare_value(
+			          type_data,
+			          type_data_size,
+			          "ha",
+			          2 ) == 1 )
 			{
-				value_string      = NULL;
-				value_string_size = 0;
+				( *value_types )[ value_index ] = LIBEWF_SINGLE_FILES_VALUE_TYPE_MD5_HASH;
 			}
-			/* Remove trailing carriage return
+			/* Size
 			 */
-			else if( value_string[ value_string_size - 2 ] == (uint8_t) '\r' )
+			else if( libewf_single_files_compare_value(
+			          type_data,
+			          type_data_size,
+			          "ls",
+			          2 ) == 1 )
 			{
-				value_string[ value_string_size - 2 ] = 0;
-
-				value_string_size -= 1;
+				( *value_types )[ value_index ] = LIBEWF_SINGLE_FILES_VALUE_TYPE_SIZE;
+			}
+			else if( libewf_single_files_compare_value(
+			          type_data,
+			          type_data_size,
+			          "mo",
+			          2 ) == 1 )
+			{
+				( *value_types )[ value_index ] = LIBEWF_SINGLE_FILES_VALUE_TYPE_ENTRY_MODIFICATION_TIME;
+			}
+			/* Modification time
+			 */
+			else if( libewf_single_files_compare_value(
+			          type_data,
+			          type_data_size,
+			          "wr",
+			          2 ) == 1 )
+			{
+				( *value_types )[ value_index ] = LIBEWF_SINGLE_FILES_VALUE_TYPE_MODIFICATION_TIME;
 			}
 		}
-		else
+		else if( type_data_size == 2 )
 		{
-			value_string      = NULL;
-			value_string_size = 0;
+			/* Name
+			 */
+			if( libewf_single_files_compare_value(
+			     type_data,
+			     type_data_size,
+			     "n",
+			     1 ) == 1 )
+			{
+				( *value_types )[ value_index ] = LIBEWF_SINGLE_FILES_VALUE_TYPE_NAME;
+			}
+			/* p = 1 if directory
+			 * p = emtpy if file
+			 */
+			else if( libewf_single_files_compare_value(
+			          type_data,
+			          type_data_size,
+			          "p",
+			          1 ) == 1 )
+			{
+				( *value_types )[ value_index ] = LIBEWF_SINGLE_FILES_VALUE_TYPE_TYPE;
+			}
 		}
+	}
+	return( 1 );
+
+on_error:
+	if( *value_types != NULL )
+	{
+		memory_free(
+		 *value_types );
+
+		*value_types = NULL;
+	}
+	*number_of_value_types = 0;
+
+	return( -1 );
+}
+
+/* Parse a single file entry for the values
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_files_parse_file_entry(
+     libcdata_tree_node_t *parent_file_entry_node,
+     const uint8_t *ltree_data,
+     size_t ltree_data_size,
+     size_t *ltree_data_offset,
+     int *line_index,
+     int number_of_lines,
+     const uint8_t *value_types,
+     int number_of_value_types,
+     uint8_t *format,
+     libcerror_error_t **error )
+{
+	libewf_single_file_entry_t *single_file_entry = NULL;
+	libcdata_tree_node_t *file_entry_node         = NULL;
+	const uint8_t *value_data                     = NULL;
+	const uint8_t *values_data                    = NULL;
+	static char *function                         = "libewf_single_files_parse_file_entry";
+	size_t value_data_size                        = 0;
+	size_t values_data_offset                     = 0;
+	size_t values_data_size                       = 0;
+	uint64_t number_of_sub_entries                = 0;
+	uint64_t value_64bit                          = 0;
+	int result                                    = 0;
+	int value_index                               = 0;
+
+	if( parent_file_entry_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent file entry node.",
+		 function );
+
+		return( -1 );
+	}
+	if( line_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line index.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value types.",
+		 function );
+
+		return( -1 );
+	}
+	if( format == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_single_files_parse_file_entry_number_of_sub_entries(
+	     ltree_data,
+	     ltree_data_size,
+	     ltree_data_offset,
+	     line_index,
+	     number_of_lines,
+	     &number_of_sub_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to parse file entry number of sub entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( *line_index >= number_of_lines )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid line index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_single_files_read_line(
+	     ltree_data,
+	     ltree_data_size,
+	     ltree_data_offset,
+	     &values_data,
+	     &values_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve line: %d.",
+		 function,
+		 *line_index );
+
+		goto on_error;
+	}
+	*line_index += 1;
+
 #if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: values:\n",
+		 function );
+		libcnotify_print_data(
+		 values_data,
+		 values_data_size,
+		 0 );
+	}
+#endif
+#if defined( HAVE_VERBOSE_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( libewf_single_files_get_number_of_values(
+		     values_data,
+		     values_data_size,
+		     (uint8_t) '\t' ) != number_of_value_types )
 		{
 			libcnotify_printf(
-			 "%s: type: %s with value: %s.\n",
-			 function,
-			 (char *) type_string,
-			 (char *) value_string );
+			"%s: mismatch in number of types and values.\n",
+			 function );
 		}
+	}
 #endif
-		if( value_string == NULL )
+	if( libewf_single_file_entry_initialize(
+	     &single_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create single file entry.",
+		 function );
+
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < number_of_value_types;
+	     value_index++ )
+	{
+		value_data      = NULL;
+		value_data_size = 0;
+
+		if( values_data_offset <= values_data_size )
 		{
-			/* Ignore empty values
-			 */
+			if( libewf_single_files_read_value(
+			     values_data,
+			     values_data_size,
+			     &values_data_offset,
+			     (uint8_t) '\t',
+			     &value_data,
+			     &value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value: %d.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
 		}
-		else if( type_string_size == 4 )
+		if( value_types[ value_index ] == LIBEWF_SINGLE_FILES_VALUE_TYPE_TYPE )
 		{
-			if( ( type_string[ 0 ] == (uint8_t) 'c' )
-			 && ( type_string[ 1 ] == (uint8_t) 'i' )
-			 && ( type_string[ 2 ] == (uint8_t) 'd' ) )
+			/* p = 1 if directory
+			 * p = emtpy if file
+			 */
+			if( value_data_size == 0 )
 			{
+				single_file_entry->type = LIBEWF_FILE_ENTRY_TYPE_FILE;
 			}
-			else if( ( type_string[ 0 ] == (uint8_t) 'o' )
-			      && ( type_string[ 1 ] == (uint8_t) 'p' )
-			      && ( type_string[ 2 ] == (uint8_t) 'r' ) )
+			else if( libewf_single_files_compare_value(
+			          value_data,
+			          value_data_size,
+			          "1",
+			          1 ) == 1 )
 			{
-				if( libfvalue_utf8_string_copy_to_integer(
-				     value_string,
-				     value_string_size,
-				     &value_64bit,
-				     64,
-				     LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_UNSIGNED,
-				     error ) != 1 )
+				single_file_entry->type = LIBEWF_FILE_ENTRY_TYPE_DIRECTORY;
+			}
+			continue;
+		}
+		/* Ignore empty values
+		 */
+		if( value_data_size == 0 )
+		{
+			continue;
+		}
+		switch( value_types[ value_index ] )
+		{
+			case LIBEWF_SINGLE_FILES_VALUE_TYPE_ACCESS_TIME:
+				result = libewf_single_files_copy_value_to_integer(
+				          value_data,
+				          value_data_size,
+				          &value_64bit,
+				          32,
+				          10,
+				          error );
+
+				if( result == -1 )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-					 "%s: unable to set entry flags.",
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set access time.",
 					 function );
 
 					goto on_error;
 				}
-				if( value_64bit > (uint64_t) UINT32_MAX )
+				else if( result != 0 )
+				{
+					single_file_entry->access_time = (uint32_t) value_64bit;
+				}
+
+				break;
+
+			case LIBEWF_SINGLE_FILES_VALUE_TYPE_CREATION_TIME:
+				result = libewf_single_files_copy_value_to_integer(
+				          value_data,
+				          value_data_size,
+				          &value_64bit,
+				          32,
+				          10,
+				          error );
+
+				if( result == -1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-					 "%s: invalid entry flags value exceeds maximum.",
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set creation time.",
 					 function );
 
 					goto on_error;
 				}
-				single_file_entry->flags = (uint32_t) value_64bit;
-			}
-			else if( ( type_string[ 0 ] == (uint8_t) 's' )
-			      && ( type_string[ 1 ] == (uint8_t) 'r' )
-			      && ( type_string[ 2 ] == (uint8_t) 'c' ) )
-			{
-			}
-			else if( ( type_string[ 0 ] == (uint8_t) 's' )
-			      && ( type_string[ 1 ] == (uint8_t) 'u' )
-			      && ( type_string[ 2 ] == (uint8_t) 'b' ) )
-			{
-			}
-			else if( ( type_string[ 0 ] == (uint8_t) 's' )
-			      && ( type_string[ 1 ] == (uint8_t) 'h' )
-			      && ( type_string[ 2 ] == (uint8_t) 'a' ) )
-			{
-				single_file_entry->sha1_hash = (uint8_t *) memory_allocate(
-				                                            sizeof( uint8_t ) * value_string_size );
+				else if( result != 0 )
+				{
+					single_file_entry->creation_time = (uint32_t) value_64bit;
+				}
 
-				if( single_file_entry->sha1_hash == NULL )
+				break;
+
+			case LIBEWF_SINGLE_FILES_VALUE_TYPE_DATA_OFFSET:
+				if( libewf_single_files_parse_file_entry_offset_values(
+				     single_file_entry,
+				     value_data,
+				     value_data_size,
+				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-					 "%s: unable to create MD5 hash.",
+					 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+					 LIBCERROR_CONVERSION_ERROR_GENERIC,
+					 "%s: unable to parse offset values.",
 					 function );
 
 					goto on_error;
 				}
-				zero_values_only = 1;
-
-				for( value_string_index = 0;
-				     value_string_index < value_string_size - 1;
-				     value_string_index++ )
-				{
-					if( ( value_string[ value_string_index ] >= (uint8_t) '0' )
-					 && ( value_string[ value_string_index ] <= (uint8_t) '9' ) )
-					{
-						single_file_entry->sha1_hash[ value_string_index ] = value_string[ value_string_index ];
-					}
-					else if( ( value_string[ value_string_index ] >= (uint8_t) 'A' )
-					      && ( value_string[ value_string_index ] <= (uint8_t) 'F' ) )
-					{
-						single_file_entry->sha1_hash[ value_string_index ] = (uint8_t) ( 'a' - 'A' ) + value_string[ value_string_index ];
-					}
-					else if( ( value_string[ value_string_index ] >= (uint8_t) 'a' )
-					      && ( value_string[ value_string_index ] <= (uint8_t) 'f' ) )
-					{
-						single_file_entry->sha1_hash[ value_string_index ] = value_string[ value_string_index ];
-					}
-					else
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-						 "%s: unsupported character in MD5 hash.",
-						 function );
-
-						goto on_error;
-					}
-					if( value_string[ value_string_index ] != (uint8_t) '0' )
-					{
-						zero_values_only = 0;
-					}
-				}
-				single_file_entry->sha1_hash[ value_string_size - 1 ] = 0;
-
-				if( zero_values_only == 0 )
-				{
-					single_file_entry->sha1_hash_size = value_string_size;
-				}
-			}
-		}
-		else if( type_string_size == 3 )
-		{
-			/* Access time
-			 */
-			if( ( type_string[ 0 ] == (uint8_t) 'a' )
-			 && ( type_string[ 1 ] == (uint8_t) 'c' ) )
-			{
-				if( libfvalue_utf8_string_copy_to_integer(
-				     value_string,
-				     value_string_size,
-				     &value_64bit,
-				     32,
-				     LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_UNSIGNED,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-					 "%s: unable to set access time.",
-					 function );
-
-					goto on_error;
-				}
-				single_file_entry->access_time = (uint32_t) value_64bit;
-			}
-			else if( ( type_string[ 0 ] == (uint8_t) 'a' )
-			      && ( type_string[ 1 ] == (uint8_t) 'q' ) )
-			{
-			}
-			/* Data offset
-			 * consist of: unknown, offset and size
-			 */
-			else if( ( type_string[ 0 ] == (uint8_t) 'b' )
-			      && ( type_string[ 1 ] == (uint8_t) 'e' ) )
-			{
-				if( libewf_single_files_parse_file_entry_offset_values(
-				     single_file_entry,
-				     value_string,
-				     value_string_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-					 LIBCERROR_CONVERSION_ERROR_GENERIC,
-					 "%s: unable to parse offset values string.",
-					 function );
-
-					goto on_error;
-				}
-				if( value_index == 19 )
+				/* The position of the data offset value
+				 * indicates the format
+				 */
+				if( value_index == 19 )
 				{
 					*format = LIBEWF_FORMAT_LOGICAL_ENCASE5;
 				}
@@ -1428,219 +1433,176 @@ int libewf_single_files_parse_file_entry(
 				{
 					*format = LIBEWF_FORMAT_LOGICAL_ENCASE7;
 				}
-			}
-			/* Creation time
-			 */
-			else if( ( type_string[ 0 ] == (uint8_t) 'c' )
-			      && ( type_string[ 1 ] == (uint8_t) 'r' ) )
-			{
-				if( libfvalue_utf8_string_copy_to_integer(
-				     value_string,
-				     value_string_size,
-				     &value_64bit,
-				     32,
-				     LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_UNSIGNED,
-				     error ) != 1 )
+				break;
+
+			case LIBEWF_SINGLE_FILES_VALUE_TYPE_DUPLICATE_DATA_OFFSET:
+				result = libewf_single_files_copy_value_to_integer(
+				          value_data,
+				          value_data_size,
+				          &value_64bit,
+				          64,
+				          10,
+				          error );
+
+				if( result == -1 )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-					 "%s: unable to set creation time.",
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set duplicate data offset.",
 					 function );
 
 					goto on_error;
 				}
-				single_file_entry->creation_time = (uint32_t) value_64bit;
-			}
-			else if( ( type_string[ 0 ] == (uint8_t) 'd' )
-			      && ( type_string[ 1 ] == (uint8_t) 'l' ) )
-			{
-			}
-			else if( ( type_string[ 0 ] == (uint8_t) 'd' )
-			      && ( type_string[ 1 ] == (uint8_t) 'u' ) )
-			{
-				if( libfvalue_utf8_string_copy_to_integer(
-				     value_string,
-				     value_string_size,
-				     &value_64bit,
-				     64,
-				     LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_UNSIGNED,
-				     error ) != 1 )
+				else if( result != 0 )
+				{
+					single_file_entry->duplicate_data_offset = (off64_t) value_64bit;
+				}
+
+				break;
+
+			case LIBEWF_SINGLE_FILES_VALUE_TYPE_ENTRY_MODIFICATION_TIME:
+				result = libewf_single_files_copy_value_to_integer(
+				          value_data,
+				          value_data_size,
+				          &value_64bit,
+				          32,
+				          10,
+				          error );
+
+				if( result == -1 )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-					 "%s: unable to set duplicate data offset.",
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set entry modification time.",
 					 function );
 
 					goto on_error;
 				}
-				single_file_entry->duplicate_data_offset = (off64_t) value_64bit;
-			}
-			/* MD5 digest hash
-			 */
-			else if( ( type_string[ 0 ] == (uint8_t) 'h' )
-			      && ( type_string[ 1 ] == (uint8_t) 'a' ) )
-			{
-				single_file_entry->md5_hash = (uint8_t *) memory_allocate(
-				                                           sizeof( uint8_t ) * value_string_size );
+				else if( result != 0 )
+				{
+					single_file_entry->entry_modification_time = (uint32_t) value_64bit;
+				}
+
+				break;
 
-				if( single_file_entry->md5_hash == NULL )
+			case LIBEWF_SINGLE_FILES_VALUE_TYPE_FLAGS:
+				result = libewf_single_files_copy_value_to_integer(
+				          value_data,
+				          value_data_size,
+				          &value_64bit,
+				          64,
+				          10,
+				          error );
+
+				if( result == -1 )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-					 "%s: unable to create MD5 hash.",
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set entry flags.",
 					 function );
 
 					goto on_error;
 				}
-				zero_values_only = 1;
-
-				for( value_string_index = 0;
-				     value_string_index < value_string_size - 1;
-				     value_string_index++ )
+				else if( result != 0 )
 				{
-					if( ( value_string[ value_string_index ] >= (uint8_t) '0' )
-					 && ( value_string[ value_string_index ] <= (uint8_t) '9' ) )
-					{
-						single_file_entry->md5_hash[ value_string_index ] = value_string[ value_string_index ];
-					}
-					else if( ( value_string[ value_string_index ] >= (uint8_t) 'A' )
-					      && ( value_string[ value_string_index ] <= (uint8_t) 'F' ) )
-					{
-						single_file_entry->md5_hash[ value_string_index ] = (uint8_t) ( 'a' - 'A' ) + value_string[ value_string_index ];
-					}
-					else if( ( value_string[ value_string_index ] >= (uint8_t) 'a' )
-					      && ( value_string[ value_string_index ] <= (uint8_t) 'f' ) )
-					{
-						single_file_entry->md5_hash[ value_string_index ] = value_string[ value_string_index ];
-					}
-					else
+					if( value_64bit > (uint64_t) UINT32_MAX )
 					{
 						libcerror_error_set(
 						 error,
 						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-						 "%s: unsupported character in MD5 hash.",
+						 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+						 "%s: invalid entry flags value exceeds maximum.",
 						 function );
 
 						goto on_error;
 					}
-					if( value_string[ value_string_index ] != (uint8_t) '0' )
-					{
-						zero_values_only = 0;
-					}
+					single_file_entry->flags = (uint32_t) value_64bit;
 				}
-				single_file_entry->md5_hash[ value_string_size - 1 ] = 0;
 
-				if( zero_values_only == 0 )
+				break;
+
+			case LIBEWF_SINGLE_FILES_VALUE_TYPE_MD5_HASH:
+				if( libewf_single_files_copy_value_to_hash(
+				     value_data,
+				     value_data_size,
+				     &( single_file_entry->md5_hash ),
+				     &( single_file_entry->md5_hash_size ),
+				     error ) != 1 )
 				{
-					single_file_entry->md5_hash_size = value_string_size;
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set MD5 hash.",
+					 function );
+
+					goto on_error;
 				}
-			}
-			else if( ( type_string[ 0 ] == (uint8_t) 'i' )
-			      && ( type_string[ 1 ] == (uint8_t) 'd' ) )
-			{
-			}
-			else if( ( type_string[ 0 ] == (uint8_t) 'j' )
-			      && ( type_string[ 1 ] == (uint8_t) 'q' ) )
-			{
-			}
-			else if( ( type_string[ 0 ] == (uint8_t) 'l' )
-			      && ( type_string[ 1 ] == (uint8_t) 'o' ) )
-			{
-			}
-			/* Size
-			 */
-			else if( ( type_string[ 0 ] == (uint8_t) 'l' )
-			      && ( type_string[ 1 ] == (uint8_t) 's' ) )
-			{
-				if( libfvalue_utf8_string_copy_to_integer(
-				     value_string,
-				     value_string_size,
-				     &value_64bit,
-				     64,
-				     LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_UNSIGNED,
-				     error ) != 1 )
+				break;
+
+			case LIBEWF_SINGLE_FILES_VALUE_TYPE_MODIFICATION_TIME:
+				result = libewf_single_files_copy_value_to_integer(
+				          value_data,
+				          value_data_size,
+				          &value_64bit,
+				          32,
+				          10,
+				          error );
+
+				if( result == -1 )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-					 "%s: unable to set size.",
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set modification time.",
 					 function );
 
 					goto on_error;
 				}
-				single_file_entry->size = (size64_t) value_64bit;
-			}
-			else if( ( type_string[ 0 ] == (uint8_t) 'm' )
-			      && ( type_string[ 1 ] == (uint8_t) 'o' ) )
-			{
-				if( libfvalue_utf8_string_copy_to_integer(
-				     value_string,
-				     value_string_size,
-				     &value_64bit,
-				     32,
-				     LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_UNSIGNED,
-				     error ) != 1 )
+				else if( result != 0 )
+				{
+					single_file_entry->modification_time = (uint32_t) value_64bit;
+				}
+
+				break;
+
+			case LIBEWF_SINGLE_FILES_VALUE_TYPE_NAME:
+				if( single_file_entry->name != NULL )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-					 "%s: unable to set entry modification time.",
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+					 "%s: invalid single file entry - name value already set.",
 					 function );
 
 					goto on_error;
 				}
-				single_file_entry->entry_modification_time = (uint32_t) value_64bit;
-			}
-			else if( ( type_string[ 0 ] == (uint8_t) 'p' )
-			      && ( type_string[ 1 ] == (uint8_t) 'm' ) )
-			{
-			}
-			else if( ( type_string[ 0 ] == (uint8_t) 'p' )
-			      && ( type_string[ 1 ] == (uint8_t) 'o' ) )
-			{
-			}
-			/* Modification time
-			 */
-			else if( ( type_string[ 0 ] == (uint8_t) 'w' )
-			      && ( type_string[ 1 ] == (uint8_t) 'r' ) )
-			{
-				if( libfvalue_utf8_string_copy_to_integer(
-				     value_string,
-				     value_string_size,
-				     &value_64bit,
-				     32,
-				     LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_UNSIGNED,
+				if( libuna_utf8_string_size_from_utf16_stream(
+				     value_data,
+				     value_data_size,
+				     LIBUNA_ENDIAN_LITTLE,
+				     &( single_file_entry->name_size ),
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-					 "%s: unable to set modification time.",
+					 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+					 LIBCERROR_CONVERSION_ERROR_GENERIC,
+					 "%s: unable to determine name size.",
 					 function );
 
 					goto on_error;
 				}
-				single_file_entry->modification_time = (uint32_t) value_64bit;
-			}
-		}
-		else if( type_string_size == 2 )
-		{
-			/* Name
-			 */
-			if( type_string[ 0 ] == (uint8_t) 'n' )
-			{
 				single_file_entry->name = (uint8_t *) memory_allocate(
-								       sizeof( uint8_t ) * value_string_size );
+								       sizeof( uint8_t ) * single_file_entry->name_size );
 
 				if( single_file_entry->name == NULL )
 				{
@@ -1653,63 +1615,74 @@ int libewf_single_files_parse_file_entry(
 
 					goto on_error;
 				}
-				if( libcstring_narrow_string_copy(
+				if( libuna_utf8_string_copy_from_utf16_stream(
 				     single_file_entry->name,
-				     value_string,
-				     value_string_size - 1 ) == NULL )
+				     single_file_entry->name_size,
+				     value_data,
+				     value_data_size,
+				     LIBUNA_ENDIAN_LITTLE,
+				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+					 LIBCERROR_CONVERSION_ERROR_GENERIC,
 					 "%s: unable to set name.",
 					 function );
 
 					goto on_error;
 				}
-				single_file_entry->name[ value_string_size - 1 ] = 0;
+				break;
+
+			case LIBEWF_SINGLE_FILES_VALUE_TYPE_SHA1_HASH:
+				if( libewf_single_files_copy_value_to_hash(
+				     value_data,
+				     value_data_size,
+				     &( single_file_entry->sha1_hash ),
+				     &( single_file_entry->sha1_hash_size ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set SHA1 hash.",
+					 function );
 
-				single_file_entry->name_size = value_string_size;
-			}
-		}
-		if( type_string_size == 2 )
-		{
-			if( type_string[ 0 ] == (uint8_t) 'p' )
-			{
-				/* p = 1 if directory
-				 * p = emtpy if file
-				 */
-				if( value_string == NULL )
+					goto on_error;
+				}
+				break;
+
+			case LIBEWF_SINGLE_FILES_VALUE_TYPE_SIZE:
+				result = libewf_single_files_copy_value_to_integer(
+				          value_data,
+				          value_data_size,
+				          &value_64bit,
+				          64,
+				          10,
+				          error );
+
+				if( result == -1 )
 				{
-					single_file_entry->type = LIBEWF_FILE_ENTRY_TYPE_FILE;
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set size.",
+					 function );
+
+					goto on_error;
 				}
-				else if( ( value_string_size == 2 )
-				      && ( value_string[ 0 ] == (uint8_t) '1' ) )
+				else if( result != 0 )
 				{
-					single_file_entry->type = LIBEWF_FILE_ENTRY_TYPE_DIRECTORY;
+					single_file_entry->size = (size64_t) value_64bit;
 				}
-			}
-		}
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "\n" );
-	}
-#endif
-	if( libfvalue_split_utf8_string_free(
-	     &values,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free split values.",
-		 function );
 
-		goto on_error;
+				break;
+
+			default:
+				break;
+		}
 	}
 	if( libcdata_tree_node_set_value(
 	     parent_file_entry_node,
@@ -1727,21 +1700,7 @@ int libewf_single_files_parse_file_entry(
 	}
 	single_file_entry = NULL;
 
-	if( libfvalue_split_utf8_string_get_number_of_segments(
-	     lines,
-	     &number_of_lines,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of lines",
-		 function );
-
-		goto on_error;
-	}
-	if( ( *line_index + number_of_sub_entries ) > (uint64_t) number_of_lines )
+	if( ( (uint64_t) *line_index + number_of_sub_entries ) > (uint64_t) number_of_lines )
 	{
 		libcerror_error_set(
 		 error,
@@ -1769,9 +1728,13 @@ int libewf_single_files_parse_file_entry(
 		}
 		if( libewf_single_files_parse_file_entry(
 		     file_entry_node,
-		     lines,
+		     ltree_data,
+		     ltree_data_size,
+		     ltree_data_offset,
 		     line_index,
-		     types,
+		     number_of_lines,
+		     value_types,
+		     number_of_value_types,
 		     format,
 		     error ) != 1 )
 		{
@@ -1800,400 +1763,870 @@ int libewf_single_files_parse_file_entry(
 		}
 		file_entry_node = NULL;
 
-		number_of_sub_entries--;
+		number_of_sub_entries--;
+	}
+	return( 1 );
+
+on_error:
+	if( file_entry_node != NULL )
+	{
+		libcdata_tree_node_free(
+		 &file_entry_node,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libewf_single_file_entry_free,
+		 NULL );
+	}
+	if( single_file_entry != NULL )
+	{
+		libewf_single_file_entry_free(
+		 &single_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Parse a single file entry line for the number of sub entries
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_files_parse_file_entry_number_of_sub_entries(
+     const uint8_t *ltree_data,
+     size_t ltree_data_size,
+     size_t *ltree_data_offset,
+     int *line_index,
+     int number_of_lines,
+     uint64_t *number_of_sub_entries,
+     libcerror_error_t **error )
+{
+	const uint8_t *line_data  = NULL;
+	const uint8_t *value_data = NULL;
+	static char *function     = "libewf_single_files_parse_file_entry_number_of_sub_entries";
+	size_t line_data_offset   = 0;
+	size_t line_data_size     = 0;
+	size_t value_data_size    = 0;
+
+	if( line_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *line_index >= number_of_lines )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid line index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_single_files_read_line(
+	     ltree_data,
+	     ltree_data_size,
+	     ltree_data_offset,
+	     &line_data,
+	     &line_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve line: %d.",
+		 function,
+		 *line_index );
+
+		return( -1 );
+	}
+	*line_index += 1;
+
+	/* The line consists of 2 values
+	 */
+	if( libewf_single_files_read_value(
+	     line_data,
+	     line_data_size,
+	     &line_data_offset,
+	     (uint8_t) '\t',
+	     &value_data,
+	     &value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: 0.",
+		 function );
+
+		return( -1 );
+	}
+	if( line_data_offset > line_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( libewf_single_files_compare_value(
+	       value_data,
+	       value_data_size,
+	       "0",
+	       1 ) != 1 )
+	 && ( libewf_single_files_compare_value(
+	       value_data,
+	       value_data_size,
+	       "26",
+	       2 ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported first value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_single_files_read_value(
+	     line_data,
+	     line_data_size,
+	     &line_data_offset,
+	     (uint8_t) '\t',
+	     &value_data,
+	     &value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: 1.",
+		 function );
+
+		return( -1 );
+	}
+	if( line_data_offset <= line_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_single_files_copy_value_to_integer(
+	     value_data,
+	     value_data_size,
+	     number_of_sub_entries,
+	     64,
+	     10,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of sub entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Parse a single file entry offset values for the values
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_files_parse_file_entry_offset_values(
+     libewf_single_file_entry_t *single_file_entry,
+     const uint8_t *offset_values_data,
+     size_t offset_values_data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *offset_value_data = NULL;
+	static char *function            = "libewf_single_files_parse_file_entry_offset_values";
+	size_t offset_value_data_size    = 0;
+	size_t offset_values_data_offset = 0;
+	uint64_t value_64bit             = 0;
+	int value_index                  = 0;
+
+	if( single_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single file entry.",
+		 function );
+
+		return( -1 );
+	}
+	/* The offset values consist of 1 or 3 values
+	 */
+	while( offset_values_data_offset <= offset_values_data_size )
+	{
+		if( value_index >= 3 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported number of offset values.",
+			 function );
+
+			return( -1 );
+		}
+		if( libewf_single_files_read_value(
+		     offset_values_data,
+		     offset_values_data_size,
+		     &offset_values_data_offset,
+		     (uint8_t) ' ',
+		     &offset_value_data,
+		     &offset_value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve offset value: %d.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		if( value_index == 1 )
+		{
+			if( libewf_single_files_copy_value_to_integer(
+			     offset_value_data,
+			     offset_value_data_size,
+			     &value_64bit,
+			     64,
+			     16,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set data offset.",
+				 function );
+
+				return( -1 );
+			}
+			single_file_entry->data_offset = (off64_t) value_64bit;
+		}
+		else if( value_index == 2 )
+		{
+			if( libewf_single_files_copy_value_to_integer(
+			     offset_value_data,
+			     offset_value_data_size,
+			     &value_64bit,
+			     64,
+			     16,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set data size.",
+				 function );
+
+				return( -1 );
+			}
+			single_file_entry->data_size = (size64_t) value_64bit;
+		}
+		value_index++;
+	}
+	if( value_index == 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of offset values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a line from the UTF-16 little-endian ltree data
+ * The line data references the ltree data and excludes the end of line characters
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_files_read_line(
+     const uint8_t *ltree_data,
+     size_t ltree_data_size,
+     size_t *ltree_data_offset,
+     const uint8_t **line_data,
+     size_t *line_data_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libewf_single_files_read_line";
+	size_t line_end_offset = 0;
+
+	if( ltree_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ltree data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ltree_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ltree data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( *ltree_data_offset > ltree_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid ltree data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( line_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line data.",
+		 function );
+
+		return( -1 );
+	}
+	if( line_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line data size.",
+		 function );
+
+		return( -1 );
 	}
-	return( 1 );
+	for( line_end_offset = *ltree_data_offset;
+	     ( line_end_offset + 1 ) < ltree_data_size;
+	     line_end_offset += 2 )
+	{
+		if( ( ltree_data[ line_end_offset ] == (uint8_t) '\n' )
+		 && ( ltree_data[ line_end_offset + 1 ] == 0 ) )
+		{
+			break;
+		}
+	}
+	if( ( line_end_offset + 1 ) >= ltree_data_size )
+	{
+		line_end_offset = ltree_data_size;
+	}
+	*line_data      = &( ltree_data[ *ltree_data_offset ] );
+	*line_data_size = line_end_offset - *ltree_data_offset;
 
-on_error:
-	if( file_entry_node != NULL )
+	if( line_end_offset < ltree_data_size )
 	{
-		libcdata_tree_node_free(
-		 &file_entry_node,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libewf_single_file_entry_free,
-		 NULL );
+		*ltree_data_offset = line_end_offset + 2;
 	}
-	if( single_file_entry != NULL )
+	else
 	{
-		libewf_single_file_entry_free(
-		 &single_file_entry,
-		 NULL );
+		*ltree_data_offset = ltree_data_size;
 	}
-	if( values != NULL )
+	/* Remove trailing carriage return
+	 */
+	if( ( *line_data_size >= 2 )
+	 && ( ( *line_data )[ *line_data_size - 2 ] == (uint8_t) '\r' )
+	 && ( ( *line_data )[ *line_data_size - 1 ] == 0 ) )
 	{
-		libfvalue_split_utf8_string_free(
-		 &values,
-		 NULL );
+		*line_data_size -= 2;
 	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Parse a single file entry string for the number of sub entries
+/* Reads a value from UTF-16 little-endian line data
+ * The value data references the line data and excludes the separator character
+ * The line data offset is set beyond the line data size after the last value
  * Returns 1 if successful or -1 on error
  */
-int libewf_single_files_parse_file_entry_number_of_sub_entries(
-     libfvalue_split_utf8_string_t *lines,
-     int *line_index,
-     uint64_t *number_of_sub_entries,
+int libewf_single_files_read_value(
+     const uint8_t *line_data,
+     size_t line_data_size,
+     size_t *line_data_offset,
+     uint8_t separator,
+     const uint8_t **value_data,
+     size_t *value_data_size,
      libcerror_error_t **error )
 {
-	libfvalue_split_utf8_string_t *values = NULL;
-	uint8_t *line_string                  = NULL;
-	uint8_t *value_string                 = NULL;
-	static char *function                 = "libewf_single_files_parse_file_entry_number_of_sub_entries";
-	size_t line_string_size               = 0;
-	size_t value_string_size              = 0;
-	int number_of_values                  = 0;
+	static char *function   = "libewf_single_files_read_value";
+	size_t value_end_offset = 0;
 
-	if( line_index == NULL )
+	if( line_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid line index.",
+		 "%s: invalid line data.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfvalue_split_utf8_string_get_segment_by_index(
-	     lines,
-	     *line_index,
-	     &line_string,
-	     &line_string_size,
-	     error ) != 1 )
+	if( line_data_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve line string: %d.",
-		 function,
-		 *line_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line data offset.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	*line_index += 1;
-
-	if( libfvalue_utf8_string_split(
-	     line_string,
-	     line_string_size,
-	     (uint8_t) '\t',
-	     &values,
-	     error ) != 1 )
+	if( *line_data_offset > line_data_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to split entries string into values.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid line data offset value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfvalue_split_utf8_string_get_number_of_segments(
-	     values,
-	     &number_of_values,
-	     error ) != 1 )
+	if( value_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of values",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( number_of_values != 2 )
+	if( value_data_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported number of values.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfvalue_split_utf8_string_get_segment_by_index(
-	     values,
-	     0,
-	     &value_string,
-	     &value_string_size,
-	     error ) != 1 )
+	for( value_end_offset = *line_data_offset;
+	     ( value_end_offset + 1 ) < line_data_size;
+	     value_end_offset += 2 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value string: 0.",
-		 function );
+		if( ( line_data[ value_end_offset ] == separator )
+		 && ( line_data[ value_end_offset + 1 ] == 0 ) )
+		{
+			break;
+		}
+	}
+	if( ( value_end_offset + 1 ) >= line_data_size )
+	{
+		value_end_offset = line_data_size;
+	}
+	*value_data      = &( line_data[ *line_data_offset ] );
+	*value_data_size = value_end_offset - *line_data_offset;
 
-		goto on_error;
+	if( value_end_offset < line_data_size )
+	{
+		*line_data_offset = value_end_offset + 2;
 	}
-	if( value_string_size == 2 )
+	else
 	{
-		if( value_string[ 0 ] != (uint8_t) '0' )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported first value: %c.",
-			 function,
-			 value_string[ 0 ] );
+		*line_data_offset = line_data_size + 1;
+	}
+	/* Remove trailing carriage return
+	 */
+	if( ( *value_data_size >= 2 )
+	 && ( ( *value_data )[ *value_data_size - 2 ] == (uint8_t) '\r' )
+	 && ( ( *value_data )[ *value_data_size - 1 ] == 0 ) )
+	{
+		*value_data_size -= 2;
+	}
+	return( 1 );
+}
 
-			goto on_error;
-		}
+/* Determines the number of values in UTF-16 little-endian line data
+ * Returns the number of values
+ */
+int libewf_single_files_get_number_of_values(
+     const uint8_t *line_data,
+     size_t line_data_size,
+     uint8_t separator )
+{
+	size_t line_data_offset = 0;
+	int number_of_values    = 1;
+
+	if( line_data == NULL )
+	{
+		return( 0 );
 	}
-	else if( value_string_size == 3 )
+	for( line_data_offset = 0;
+	     ( line_data_offset + 1 ) < line_data_size;
+	     line_data_offset += 2 )
 	{
-		if( ( value_string[ 0 ] != (uint8_t) '2' )
-		 || ( value_string[ 1 ] != (uint8_t) '6' ) )
+		if( ( line_data[ line_data_offset ] == separator )
+		 && ( line_data[ line_data_offset + 1 ] == 0 ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported first value: %c%c.",
-			 function,
-			 value_string[ 0 ],
-			 value_string[ 1 ] );
+			number_of_values++;
+		}
+	}
+	return( number_of_values );
+}
 
-			goto on_error;
+/* Compares UTF-16 little-endian value data with an ASCII string
+ * Returns 1 if equal, 0 if not
+ */
+int libewf_single_files_compare_value(
+     const uint8_t *value_data,
+     size_t value_data_size,
+     const char *string,
+     size_t string_length )
+{
+	size_t string_index = 0;
+
+	if( ( value_data == NULL )
+	 || ( string == NULL ) )
+	{
+		return( 0 );
+	}
+	if( value_data_size != ( string_length * 2 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( value_data[ string_index * 2 ] != (uint8_t) string[ string_index ] )
+		 || ( value_data[ ( string_index * 2 ) + 1 ] != 0 ) )
+		{
+			return( 0 );
 		}
 	}
-	else
+	return( 1 );
+}
+
+/* Copies UTF-16 little-endian value data of a decimal or hexadecimal number to an integer value
+ * The integer value size is in bits
+ * Returns 1 if successful, 0 if the value is not a supported number or -1 on error
+ */
+int libewf_single_files_copy_value_to_integer(
+     const uint8_t *value_data,
+     size_t value_data_size,
+     uint64_t *integer_value,
+     size_t integer_value_size,
+     uint8_t base,
+     libcerror_error_t **error )
+{
+	static char *function     = "libewf_single_files_copy_value_to_integer";
+	size_t maximum_value_size = 0;
+	size_t value_data_offset  = 0;
+	uint64_t maximum_value    = 0;
+	uint8_t character_value   = 0;
+
+	if( value_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported first value.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfvalue_split_utf8_string_get_segment_by_index(
-	     values,
-	     1,
-	     &value_string,
-	     &value_string_size,
-	     error ) != 1 )
+	if( integer_value == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value string: 1.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integer value.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfvalue_utf8_string_copy_to_integer(
-	     value_string,
-	     value_string_size,
-	     number_of_sub_entries,
-	     64,
-	     LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_UNSIGNED,
-	     error ) != 1 )
+	if( ( integer_value_size != 32 )
+	 && ( integer_value_size != 64 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to set number fo sub entries.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported integer value size.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfvalue_split_utf8_string_free(
-	     &values,
-	     error ) != 1 )
+	/* The maximum number of characters in the value
+	 */
+	if( base == 10 )
+	{
+		maximum_value_size = ( integer_value_size == 32 ) ? 10 : 20;
+	}
+	else if( base == 16 )
+	{
+		maximum_value_size = integer_value_size / 4;
+	}
+	else
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free split values.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported base.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	return( 1 );
+	if( integer_value_size == 32 )
+	{
+		maximum_value = (uint64_t) UINT32_MAX;
+	}
+	else
+	{
+		maximum_value = (uint64_t) UINT64_MAX;
+	}
+	if( value_data_size > ( maximum_value_size * 2 ) )
+	{
+		return( 0 );
+	}
+	*integer_value = 0;
 
-on_error:
-	if( values != NULL )
+	for( value_data_offset = 0;
+	     ( value_data_offset + 1 ) < value_data_size;
+	     value_data_offset += 2 )
 	{
-		libfvalue_split_utf8_string_free(
-		 &values,
-		 NULL );
+		character_value = value_data[ value_data_offset ];
+
+		if( value_data[ value_data_offset + 1 ] != 0 )
+		{
+			character_value = 0xff;
+		}
+		else if( ( character_value >= (uint8_t) '0' )
+		      && ( character_value <= (uint8_t) '9' ) )
+		{
+			character_value -= (uint8_t) '0';
+		}
+		else if( ( character_value >= (uint8_t) 'A' )
+		      && ( character_value <= (uint8_t) 'F' ) )
+		{
+			character_value -= (uint8_t) 'A' - 10;
+		}
+		else if( ( character_value >= (uint8_t) 'a' )
+		      && ( character_value <= (uint8_t) 'f' ) )
+		{
+			character_value -= (uint8_t) 'a' - 10;
+		}
+		else
+		{
+			character_value = 0xff;
+		}
+		if( character_value >= base )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unsupported character value: 0x%02" PRIx8 "%02" PRIx8 " at offset: %" PRIzd ".\n",
+				 function,
+				 value_data[ value_data_offset + 1 ],
+				 value_data[ value_data_offset ],
+				 value_data_offset );
+			}
+#endif
+			return( 0 );
+		}
+		/* A decimal value with the maximum number of characters can exceed the maximum value
+		 */
+		if( *integer_value > ( ( maximum_value - character_value ) / base ) )
+		{
+			return( 0 );
+		}
+		*integer_value *= base;
+		*integer_value += character_value;
 	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Parse a single file entry offset values string for the values
+/* Copies UTF-16 little-endian value data of a hexadecimal digest hash to a lower case string
+ * The hash size is left 0 if the digest hash consists of 0-characters only
  * Returns 1 if successful or -1 on error
  */
-int libewf_single_files_parse_file_entry_offset_values(
-     libewf_single_file_entry_t *single_file_entry,
-     const uint8_t *offset_values_string,
-     size_t offset_values_string_size,
+int libewf_single_files_copy_value_to_hash(
+     const uint8_t *value_data,
+     size_t value_data_size,
+     uint8_t **hash,
+     size_t *hash_size,
      libcerror_error_t **error )
 {
-	libfvalue_split_utf8_string_t *offset_values  = NULL;
-	uint8_t *offset_value_string                  = NULL;
-	static char *function                         = "libewf_single_files_parse_file_entry_offset_values";
-	size_t offset_value_string_size               = 0;
-	uint64_t value_64bit                          = 0;
-	int number_of_offset_values                   = 0;
+	static char *function    = "libewf_single_files_copy_value_to_hash";
+	size_t hash_index        = 0;
+	size_t string_size       = 0;
+	uint8_t character_value  = 0;
+	uint8_t zero_values_only = 1;
 
-	if( single_file_entry == NULL )
+	if( value_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid single file entry.",
+		 "%s: invalid value data.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfvalue_utf8_string_split(
-	     offset_values_string,
-	     offset_values_string_size,
-	     (uint8_t) ' ',
-	     &offset_values,
-	     error ) != 1 )
+	if( ( value_data_size % 2 ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to split string into offset values.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value data size.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfvalue_split_utf8_string_get_number_of_segments(
-	     offset_values,
-	     &number_of_offset_values,
-	     error ) != 1 )
+	if( hash == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of offset values",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( ( number_of_offset_values != 1 )
-	 && ( number_of_offset_values != 3 ) )
+	if( *hash != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported number of offset values.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash size.",
+		 function );
+
+		return( -1 );
+	}
+	string_size = ( value_data_size / 2 ) + 1;
+
+	*hash = (uint8_t *) memory_allocate(
+	                     sizeof( uint8_t ) * string_size );
+
+	if( *hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash.",
 		 function );
 
 		goto on_error;
 	}
-	if( number_of_offset_values == 3 )
+	for( hash_index = 0;
+	     hash_index < ( string_size - 1 );
+	     hash_index++ )
 	{
-		if( libfvalue_split_utf8_string_get_segment_by_index(
-		     offset_values,
-		     1,
-		     &offset_value_string,
-		     &offset_value_string_size,
-		     error ) != 1 )
+		character_value = value_data[ hash_index * 2 ];
+
+		if( value_data[ ( hash_index * 2 ) + 1 ] != 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve offset value string: 1.",
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character in hash.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfvalue_utf8_string_copy_to_integer(
-		     offset_value_string,
-		     offset_value_string_size,
-		     &value_64bit,
-		     64,
-		     LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL | LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR,
-		     error ) != 1 )
+		if( ( character_value >= (uint8_t) 'A' )
+		 && ( character_value <= (uint8_t) 'F' ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to set data offset.",
-			 function );
-
-			goto on_error;
+			character_value += (uint8_t) ( 'a' - 'A' );
 		}
-		single_file_entry->data_offset = (off64_t) value_64bit;
-
-		if( libfvalue_split_utf8_string_get_segment_by_index(
-		     offset_values,
-		     2,
-		     &offset_value_string,
-		     &offset_value_string_size,
-		     error ) != 1 )
+		else if( ( ( character_value < (uint8_t) '0' )
+		        || ( character_value > (uint8_t) '9' ) )
+		      && ( ( character_value < (uint8_t) 'a' )
+		        || ( character_value > (uint8_t) 'f' ) ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve offset value string: 2.",
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character in hash.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfvalue_utf8_string_copy_to_integer(
-		     offset_value_string,
-		     offset_value_string_size,
-		     &value_64bit,
-		     64,
-		     LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL | LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR,
-		     error ) != 1 )
+		if( character_value != (uint8_t) '0' )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to set data size.",
-			 function );
-
-			goto on_error;
+			zero_values_only = 0;
 		}
-		single_file_entry->data_size = (size64_t) value_64bit;
+		( *hash )[ hash_index ] = character_value;
 	}
-	if( libfvalue_split_utf8_string_free(
-	     &offset_values,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free split offset values.",
-		 function );
+	( *hash )[ hash_index ] = 0;
 
-		goto on_error;
+	if( zero_values_only == 0 )
+	{
+		*hash_size = string_size;
 	}
 	return( 1 );
 
 on_error:
-	if( offset_values != NULL )
+	if( *hash != NULL )
 	{
-		libfvalue_split_utf8_string_free(
-		 &offset_values,
-		 NULL );
+		memory_free(
+		 *hash );
+
+		*hash = NULL;
 	}
 	return( -1 );
 }
@@ -28,14 +28,31 @@
 #include "libewf_extern.h"
 #include "libewf_libcdata.h"
 #include "libewf_libcerror.h"
-#include "libewf_libfvalue.h"
 #include "libewf_single_file_entry.h"
+#include "libewf_single_file_tree.h"
 #include "libewf_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+enum LIBEWF_SINGLE_FILES_VALUE_TYPES
+{
+	LIBEWF_SINGLE_FILES_VALUE_TYPE_UNDEFINED		= 0,
+	LIBEWF_SINGLE_FILES_VALUE_TYPE_ACCESS_TIME		= 1,
+	LIBEWF_SINGLE_FILES_VALUE_TYPE_CREATION_TIME		= 2,
+	LIBEWF_SINGLE_FILES_VALUE_TYPE_DATA_OFFSET		= 3,
+	LIBEWF_SINGLE_FILES_VALUE_TYPE_DUPLICATE_DATA_OFFSET	= 4,
+	LIBEWF_SINGLE_FILES_VALUE_TYPE_ENTRY_MODIFICATION_TIME	= 5,
+	LIBEWF_SINGLE_FILES_VALUE_TYPE_FLAGS			= 6,
+	LIBEWF_SINGLE_FILES_VALUE_TYPE_MD5_HASH			= 7,
+	LIBEWF_SINGLE_FILES_VALUE_TYPE_MODIFICATION_TIME	= 8,
+	LIBEWF_SINGLE_FILES_VALUE_TYPE_NAME			= 9,
+	LIBEWF_SINGLE_FILES_VALUE_TYPE_SHA1_HASH		= 10,
+	LIBEWF_SINGLE_FILES_VALUE_TYPE_SIZE			= 11,
+	LIBEWF_SINGLE_FILES_VALUE_TYPE_TYPE			= 12
+};
+
 typedef struct libewf_single_files libewf_single_files_t;
 
 struct libewf_single_files
@@ -59,6 +76,11 @@ struct libewf_single_files
 	/* The single file entry tree
 	 */
 	libcdata_tree_node_t *root_file_entry_node;
+
+	/* The single file entry tree index
+	 * which is created on the first lookup by name
+	 */
+	libewf_single_file_tree_index_t *file_entry_tree_index;
 };
 
 int libewf_single_files_initialize(
@@ -78,35 +100,95 @@ int libewf_single_files_parse(
 int libewf_single_files_parse_file_entries(
      libewf_single_files_t *single_files,
      size64_t *media_size,
-     const uint8_t *file_entries_string,
-     size_t file_entries_string_size,
+     const uint8_t *ltree_data,
+     size_t ltree_data_size,
      uint8_t *format,
      libcerror_error_t **error );
 
 int libewf_single_files_parse_record_values(
      size64_t *media_size,
-     libfvalue_split_utf8_string_t *lines,
-     int *line_iterator,
+     const uint8_t *ltree_data,
+     size_t ltree_data_size,
+     size_t *ltree_data_offset,
+     int *line_index,
+     int number_of_lines,
+     libcerror_error_t **error );
+
+int libewf_single_files_parse_value_types(
+     const uint8_t *types_data,
+     size_t types_data_size,
+     uint8_t **value_types,
+     int *number_of_value_types,
      libcerror_error_t **error );
 
 int libewf_single_files_parse_file_entry(
      libcdata_tree_node_t *parent_file_entry_node,
-     libfvalue_split_utf8_string_t *lines,
-     int *line_iterator,
-     libfvalue_split_utf8_string_t *types,
+     const uint8_t *ltree_data,
+     size_t ltree_data_size,
+     size_t *ltree_data_offset,
+     int *line_index,
+     int number_of_lines,
+     const uint8_t *value_types,
+     int number_of_value_types,
      uint8_t *format,
      libcerror_error_t **error );
 
 int libewf_single_files_parse_file_entry_number_of_sub_entries(
-     libfvalue_split_utf8_string_t *lines,
+     const uint8_t *ltree_data,
+     size_t ltree_data_size,
+     size_t *ltree_data_offset,
      int *line_index,
+     int number_of_lines,
      uint64_t *number_of_sub_entries,
      libcerror_error_t **error );
 
 int libewf_single_files_parse_file_entry_offset_values(
      libewf_single_file_entry_t *single_file_entry,
-     const uint8_t *offset_values_string,
-     size_t offset_values_string_size,
+     const uint8_t *offset_values_data,
+     size_t offset_values_data_size,
+     libcerror_error_t **error );
+
+int libewf_single_files_read_line(
+     const uint8_t *ltree_data,
+     size_t ltree_data_size,
+     size_t *ltree_data_offset,
+     const uint8_t **line_data,
+     size_t *line_data_size,
+     libcerror_error_t **error );
+
+int libewf_single_files_read_value(
+     const uint8_t *line_data,
+     size_t line_data_size,
+     size_t *line_data_offset,
+     uint8_t separator,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
+int libewf_single_files_get_number_of_values(
+     const uint8_t *line_data,
+     size_t line_data_size,
+     uint8_t separator );
+
+int libewf_single_files_compare_value(
+     const uint8_t *value_data,
+     size_t value_data_size,
+     const char *string,
+     size_t string_length );
+
+int libewf_single_files_copy_value_to_integer(
+     const uint8_t *value_data,
+     size_t value_data_size,
+     uint64_t *integer_value,
+     size_t integer_value_size,
+     uint8_t base,
+     libcerror_error_t **error );
+
+int libewf_single_files_copy_value_to_hash(
+     const uint8_t *value_data,
+     size_t value_data_size,
+     uint8_t **hash,
+     size_t *hash_size,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
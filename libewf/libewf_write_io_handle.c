@@ -361,6 +361,7 @@ int libewf_write_io_handle_initialize_values(
 	static char *function                     = "libewf_write_io_handle_initialize_values";
 	void *reallocation                        = NULL;
 	int64_t required_number_of_segments       = 0;
+	int8_t compression_level                  = 0;
 	int result                                = 0;
 
 	if( write_io_handle == NULL )
@@ -523,6 +524,16 @@ int libewf_write_io_handle_initialize_values(
 
 			goto on_error;
 		}
+		/* Empty blocks are compressed with the default compression level
+		 * when no compression level was set, which is what the empty block
+		 * compression does for the other chunks
+		 */
+		compression_level = io_handle->compression_level;
+
+		if( compression_level == EWF_COMPRESSION_NONE )
+		{
+			compression_level = EWF_COMPRESSION_DEFAULT;
+		}
 		write_io_handle->compressed_zero_byte_empty_block_size = 512;
 
 		compressed_zero_byte_empty_block = (uint8_t *) memory_allocate(
@@ -540,11 +551,12 @@ int libewf_write_io_handle_initialize_values(
 			goto on_error;
 		}
 		result = libewf_compress(
+			  io_handle->compression_context,
 			  compressed_zero_byte_empty_block,
 			  &( write_io_handle->compressed_zero_byte_empty_block_size ),
 			  zero_byte_empty_block,
 			  (size_t) media_values->chunk_size,
-			  io_handle->compression_level,
+			  compression_level,
 			  error );
 
 		/* Check if the compressed buffer was too small
@@ -582,11 +594,12 @@ int libewf_write_io_handle_initialize_values(
 			compressed_zero_byte_empty_block = (uint8_t *) reallocation;
 
 			result = libewf_compress(
+			          io_handle->compression_context,
 			          compressed_zero_byte_empty_block,
 			          &( write_io_handle->compressed_zero_byte_empty_block_size ),
 			          zero_byte_empty_block,
 			          (size_t) media_values->chunk_size,
-			          io_handle->compression_level,
+			          compression_level,
 			          error );
 		}
 		if( result != 1 )
@@ -2073,6 +2086,37 @@ int libewf_write_io_handle_create_segment_file(
 
 	filename = NULL;
 
+	if( io_handle->drop_cached_data != 0 )
+	{
+		if( libbfio_file_set_drop_cached_data(
+		     file_io_handle,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set drop cached data in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libbfio_file_set_write_buffer_size(
+	     file_io_handle,
+	     LIBEWF_SEGMENT_FILE_WRITE_BUFFER_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set write buffer size in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
 	if( segment_file_type == LIBEWF_SEGMENT_FILE_TYPE_DWF )
 	{
 		bfio_access_flags = LIBBFIO_OPEN_READ_WRITE_TRUNCATE;
@@ -2888,6 +2932,35 @@ ssize_t libewf_write_io_handle_write_new_chunk(
 		write_io_handle->number_of_chunks_written_to_section += 1;
 		write_io_handle->number_of_chunks_written            += 1;
 
+		/* A chunk that was stored as the compressed zero byte empty block
+		 * is part of a zero run
+		 */
+		if( ( is_compressed != 0 )
+		 && ( chunk_data_size == (size_t) media_values->chunk_size )
+		 && ( write_io_handle->compressed_zero_byte_empty_block != NULL )
+		 && ( chunk_buffer_size == write_io_handle->compressed_zero_byte_empty_block_size )
+		 && ( memory_compare(
+		       chunk_buffer,
+		       write_io_handle->compressed_zero_byte_empty_block,
+		       chunk_buffer_size ) == 0 ) )
+		{
+			if( write_io_handle->zero_run_size == 0 )
+			{
+				write_io_handle->number_of_zero_runs += 1;
+			}
+			write_io_handle->zero_data_size += chunk_data_size;
+			write_io_handle->zero_run_size  += chunk_data_size;
+
+			if( write_io_handle->zero_run_size > write_io_handle->largest_zero_run_size )
+			{
+				write_io_handle->largest_zero_run_size = write_io_handle->zero_run_size;
+			}
+		}
+		else
+		{
+			write_io_handle->zero_run_size = 0;
+		}
+
 		if( ( io_handle->ewf_format == EWF_FORMAT_S01 )
 		 || ( io_handle->format == LIBEWF_FORMAT_ENCASE1 ) )
 		{
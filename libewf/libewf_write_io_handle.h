@@ -137,6 +137,22 @@ struct libewf_write_io_handle
 	/* The size of the compressed zero byte empty block
 	 */
 	size_t compressed_zero_byte_empty_block_size;
+
+	/* The number of bytes of the input written as empty blocks of zero bytes
+	 */
+	size64_t zero_data_size;
+
+	/* The number of runs of consecutive empty blocks of zero bytes
+	 */
+	uint64_t number_of_zero_runs;
+
+	/* The size of the current run of empty blocks of zero bytes
+	 */
+	size64_t zero_run_size;
+
+	/* The size of the largest run of empty blocks of zero bytes
+	 */
+	size64_t largest_zero_run_size;
 };
 
 int libewf_write_io_handle_initialize(
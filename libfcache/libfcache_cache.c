@@ -31,6 +31,9 @@
 #include "libfcache_libcerror.h"
 #include "libfcache_types.h"
 
+#define libfcache_cache_calculate_hash_table_index( file_index, offset, hash_table_size ) \
+	(int) ( ( (uint32_t) ( ( (uint32_t) ( offset ) ^ (uint32_t) ( (uint64_t) ( offset ) >> 32 ) ^ (uint32_t) ( file_index ) ) * 0x9e3779b1UL ) ) % (uint32_t) ( hash_table_size ) )
+
 /* Initializes the cache
  * Returns 1 if successful or -1 on error
  */
@@ -117,6 +120,20 @@ int libfcache_cache_initialize(
 
 		goto on_error;
 	}
+	if( libfcache_cache_initialize_hash_table(
+	     internal_cache,
+	     maximum_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
 	*cache = (libfcache_cache_t *) internal_cache;
 
 	return( 1 );
@@ -124,12 +141,119 @@ int libfcache_cache_initialize(
 on_error:
 	if( internal_cache != NULL )
 	{
+		if( internal_cache->entries != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_cache->entries ),
+			 NULL,
+			 NULL );
+		}
 		memory_free(
 		 internal_cache );
 	}
 	return( -1 );
 }
 
+/* Initializes the hash table of the cache
+ * The hash table is (re)allocated to fit the maximum number of cache entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_initialize_hash_table(
+     libfcache_internal_cache_t *internal_cache,
+     int maximum_cache_entries,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_value_t **hash_table = NULL;
+	static char *function                         = "libfcache_cache_initialize_hash_table";
+	size_t hash_table_size                        = 0;
+	int number_of_buckets                         = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_cache_entries <= 0 )
+	 || ( maximum_cache_entries > ( INT_MAX / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum cache entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use an odd number of buckets of about twice the number of entries
+	 * to keep the hash chains short
+	 */
+	number_of_buckets = ( maximum_cache_entries * 2 ) - 1;
+
+	hash_table_size = sizeof( libfcache_internal_cache_value_t * ) * number_of_buckets;
+
+	if( hash_table_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid hash table size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table = (libfcache_internal_cache_value_t **) memory_allocate(
+	                                                    hash_table_size );
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     hash_table,
+	     0,
+	     hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		memory_free(
+		 hash_table );
+
+		return( -1 );
+	}
+	if( internal_cache->hash_table != NULL )
+	{
+		memory_free(
+		 internal_cache->hash_table );
+	}
+	internal_cache->hash_table                = hash_table;
+	internal_cache->hash_table_size           = number_of_buckets;
+	internal_cache->most_recently_used_value  = NULL;
+	internal_cache->least_recently_used_value = NULL;
+	internal_cache->unused_entry_index        = 0;
+
+	return( 1 );
+}
+
 /* Frees the cache
  * Returns 1 if successful or -1 on error
  */
@@ -171,6 +295,11 @@ int libfcache_cache_free(
 
 			result = -1;
 		}
+		if( internal_cache->hash_table != NULL )
+		{
+			memory_free(
+			 internal_cache->hash_table );
+		}
 		memory_free(
 		 internal_cache );
 	}
@@ -368,7 +497,255 @@ int libfcache_cache_clear(
 
 		return( -1 );
 	}
-	internal_cache->number_of_cache_values = 0;
+	if( memory_set(
+	     internal_cache->hash_table,
+	     0,
+	     sizeof( libfcache_internal_cache_value_t * ) * internal_cache->hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache->number_of_cache_values    = 0;
+	internal_cache->most_recently_used_value  = NULL;
+	internal_cache->least_recently_used_value = NULL;
+	internal_cache->unused_entry_index        = 0;
+
+	return( 1 );
+}
+
+/* Resizes the cache
+ * The values currently stored in the cache are freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_resize(
+     libfcache_cache_t *cache,
+     int maximum_cache_entries,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                     = "libfcache_cache_resize";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+	if( maximum_cache_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum cache entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_clear(
+	     cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_resize(
+	     internal_cache->entries,
+	     maximum_cache_entries,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfcache_cache_value_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize entries array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_initialize_hash_table(
+	     internal_cache,
+	     maximum_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create hash table.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Links a cache value into the hash table as the most recently used value
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_link_value(
+     libfcache_internal_cache_t *internal_cache,
+     libfcache_internal_cache_value_t *internal_cache_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcache_cache_link_value";
+	int hash_table_index  = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cache_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache value.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cache_value->is_linked != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cache value - already linked.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table_index = libfcache_cache_calculate_hash_table_index(
+	                    internal_cache_value->file_index,
+	                    internal_cache_value->offset,
+	                    internal_cache->hash_table_size );
+
+	internal_cache_value->next_hash_value = internal_cache->hash_table[ hash_table_index ];
+
+	internal_cache->hash_table[ hash_table_index ] = internal_cache_value;
+
+	internal_cache_value->previous_used_value = NULL;
+	internal_cache_value->next_used_value     = internal_cache->most_recently_used_value;
+
+	if( internal_cache->most_recently_used_value != NULL )
+	{
+		internal_cache->most_recently_used_value->previous_used_value = internal_cache_value;
+	}
+	internal_cache->most_recently_used_value = internal_cache_value;
+
+	if( internal_cache->least_recently_used_value == NULL )
+	{
+		internal_cache->least_recently_used_value = internal_cache_value;
+	}
+	internal_cache_value->is_linked = 1;
+
+	return( 1 );
+}
+
+/* Unlinks a cache value from the hash table
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_unlink_value(
+     libfcache_internal_cache_t *internal_cache,
+     libfcache_internal_cache_value_t *internal_cache_value,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_value_t **hash_value = NULL;
+	static char *function                         = "libfcache_cache_unlink_value";
+	int hash_table_index                          = 0;
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cache_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache value.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cache_value->is_linked == 0 )
+	{
+		return( 1 );
+	}
+	hash_table_index = libfcache_cache_calculate_hash_table_index(
+	                    internal_cache_value->file_index,
+	                    internal_cache_value->offset,
+	                    internal_cache->hash_table_size );
+
+	hash_value = &( internal_cache->hash_table[ hash_table_index ] );
+
+	while( *hash_value != NULL )
+	{
+		if( *hash_value == internal_cache_value )
+		{
+			*hash_value = internal_cache_value->next_hash_value;
+
+			break;
+		}
+		hash_value = &( ( *hash_value )->next_hash_value );
+	}
+	if( internal_cache_value->previous_used_value != NULL )
+	{
+		internal_cache_value->previous_used_value->next_used_value = internal_cache_value->next_used_value;
+	}
+	else
+	{
+		internal_cache->most_recently_used_value = internal_cache_value->next_used_value;
+	}
+	if( internal_cache_value->next_used_value != NULL )
+	{
+		internal_cache_value->next_used_value->previous_used_value = internal_cache_value->previous_used_value;
+	}
+	else
+	{
+		internal_cache->least_recently_used_value = internal_cache_value->previous_used_value;
+	}
+	internal_cache_value->next_hash_value     = NULL;
+	internal_cache_value->previous_used_value = NULL;
+	internal_cache_value->next_used_value     = NULL;
+	internal_cache_value->is_linked           = 0;
 
 	return( 1 );
 }
@@ -503,6 +880,21 @@ int libfcache_cache_set_value_by_index(
 		}
 		internal_cache->number_of_cache_values++;
 	}
+	else if( libfcache_cache_unlink_value(
+	          internal_cache,
+	          (libfcache_internal_cache_value_t *) cache_value,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to unlink cache value: %d.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
 	if( libfcache_cache_value_set_value(
 	     cache_value,
 	     value,
@@ -535,6 +927,322 @@ int libfcache_cache_set_value_by_index(
 
 		return( -1 );
 	}
+	if( libfcache_cache_link_value(
+	     internal_cache,
+	     (libfcache_internal_cache_value_t *) cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to link cache value: %d.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the cache value for the specific identifier
+ * A cache value is looked up by its file index and offset, the timestamp
+ * is used to determine if the cache value is still up to date
+ * The cache value that was found becomes the most recently used
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libfcache_cache_get_value_by_identifier(
+     libfcache_cache_t *cache,
+     int file_index,
+     off64_t offset,
+     time_t timestamp,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache             = NULL;
+	libfcache_internal_cache_value_t *internal_cache_value = NULL;
+	static char *function                                  = "libfcache_cache_get_value_by_identifier";
+	int hash_table_index                                   = 0;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+	if( cache_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache value.",
+		 function );
+
+		return( -1 );
+	}
+	*cache_value = NULL;
+
+	hash_table_index = libfcache_cache_calculate_hash_table_index(
+	                    file_index,
+	                    offset,
+	                    internal_cache->hash_table_size );
+
+	internal_cache_value = internal_cache->hash_table[ hash_table_index ];
+
+	while( internal_cache_value != NULL )
+	{
+		if( ( internal_cache_value->file_index == file_index )
+		 && ( internal_cache_value->offset == offset ) )
+		{
+			break;
+		}
+		internal_cache_value = internal_cache_value->next_hash_value;
+	}
+	if( internal_cache_value == NULL )
+	{
+		return( 0 );
+	}
+	if( internal_cache_value->timestamp != timestamp )
+	{
+		return( 0 );
+	}
+	if( internal_cache->most_recently_used_value != internal_cache_value )
+	{
+		if( libfcache_cache_unlink_value(
+		     internal_cache,
+		     internal_cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to unlink cache value.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfcache_cache_link_value(
+		     internal_cache,
+		     internal_cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to link cache value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*cache_value = (libfcache_cache_value_t *) internal_cache_value;
+
+	return( 1 );
+}
+
+/* Sets the cache value for the specific identifier
+ * If a cache value with the same file index and offset exists it is reused,
+ * otherwise an unused cache entry is used or, when the cache is full,
+ * the least recently used cache value is replaced
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_set_value_by_identifier(
+     libfcache_cache_t *cache,
+     int file_index,
+     off64_t offset,
+     time_t timestamp,
+     intptr_t *value,
+     int (*free_value)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value                   = NULL;
+	libfcache_internal_cache_t *internal_cache             = NULL;
+	libfcache_internal_cache_value_t *internal_cache_value = NULL;
+	static char *function                                  = "libfcache_cache_set_value_by_identifier";
+	int cache_entry_index                                  = 0;
+	int hash_table_index                                   = 0;
+	int number_of_cache_entries                            = 0;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+	hash_table_index = libfcache_cache_calculate_hash_table_index(
+	                    file_index,
+	                    offset,
+	                    internal_cache->hash_table_size );
+
+	internal_cache_value = internal_cache->hash_table[ hash_table_index ];
+
+	while( internal_cache_value != NULL )
+	{
+		if( ( internal_cache_value->file_index == file_index )
+		 && ( internal_cache_value->offset == offset ) )
+		{
+			break;
+		}
+		internal_cache_value = internal_cache_value->next_hash_value;
+	}
+	if( internal_cache_value == NULL )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     internal_cache->entries,
+		     &number_of_cache_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries from entries array.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_cache->number_of_cache_values < number_of_cache_entries )
+		{
+			/* Look for an unused cache entry
+			 */
+			cache_entry_index = internal_cache->unused_entry_index;
+
+			do
+			{
+				if( cache_entry_index >= number_of_cache_entries )
+				{
+					cache_entry_index = 0;
+				}
+				if( libcdata_array_get_entry_by_index(
+				     internal_cache->entries,
+				     cache_entry_index,
+				     (intptr_t **) &cache_value,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve cache value: %d from entries array.",
+					 function,
+					 cache_entry_index );
+
+					return( -1 );
+				}
+				if( cache_value == NULL )
+				{
+					break;
+				}
+				cache_entry_index++;
+			}
+			while( cache_entry_index != internal_cache->unused_entry_index );
+
+			if( cache_value != NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: unable to find unused cache entry.",
+				 function );
+
+				return( -1 );
+			}
+			internal_cache->unused_entry_index = cache_entry_index + 1;
+
+			return( libfcache_cache_set_value_by_index(
+			         cache,
+			         cache_entry_index,
+			         file_index,
+			         offset,
+			         timestamp,
+			         value,
+			         free_value,
+			         flags,
+			         error ) );
+		}
+		internal_cache_value = internal_cache->least_recently_used_value;
+
+		if( internal_cache_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid cache - missing least recently used value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfcache_cache_unlink_value(
+	     internal_cache,
+	     internal_cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to unlink cache value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_value_set_value(
+	     (libfcache_cache_value_t *) internal_cache_value,
+	     value,
+	     free_value,
+	     flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value in cache value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_value->file_index = file_index;
+	internal_cache_value->offset     = offset;
+	internal_cache_value->timestamp  = timestamp;
+
+	if( libfcache_cache_link_value(
+	     internal_cache,
+	     internal_cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to link cache value.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
@@ -47,6 +47,26 @@ struct libfcache_internal_cache
 	/* The number of cache values
 	 */
 	int number_of_cache_values;
+
+	/* The hash table, used to look up cache values by identifier
+	 */
+	libfcache_internal_cache_value_t **hash_table;
+
+	/* The number of hash table buckets
+	 */
+	int hash_table_size;
+
+	/* The most recently used cache value
+	 */
+	libfcache_internal_cache_value_t *most_recently_used_value;
+
+	/* The least recently used cache value
+	 */
+	libfcache_internal_cache_value_t *least_recently_used_value;
+
+	/* The index of the first entry to check for an unused entry
+	 */
+	int unused_entry_index;
 };
 
 LIBFCACHE_EXTERN \
@@ -71,6 +91,27 @@ int libfcache_cache_clear(
      libfcache_cache_t *cache,
      libcerror_error_t **error );
 
+LIBFCACHE_EXTERN \
+int libfcache_cache_resize(
+     libfcache_cache_t *cache,
+     int maximum_cache_entries,
+     libcerror_error_t **error );
+
+int libfcache_cache_initialize_hash_table(
+     libfcache_internal_cache_t *internal_cache,
+     int maximum_cache_entries,
+     libcerror_error_t **error );
+
+int libfcache_cache_link_value(
+     libfcache_internal_cache_t *internal_cache,
+     libfcache_internal_cache_value_t *internal_cache_value,
+     libcerror_error_t **error );
+
+int libfcache_cache_unlink_value(
+     libfcache_internal_cache_t *internal_cache,
+     libfcache_internal_cache_value_t *internal_cache_value,
+     libcerror_error_t **error );
+
 LIBFCACHE_EXTERN \
 int libfcache_cache_get_number_of_entries(
      libfcache_cache_t *cache,
@@ -106,6 +147,28 @@ int libfcache_cache_set_value_by_index(
      uint8_t flags,
      libcerror_error_t **error );
 
+LIBFCACHE_EXTERN \
+int libfcache_cache_get_value_by_identifier(
+     libfcache_cache_t *cache,
+     int file_index,
+     off64_t offset,
+     time_t timestamp,
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error );
+
+LIBFCACHE_EXTERN \
+int libfcache_cache_set_value_by_identifier(
+     libfcache_cache_t *cache,
+     int file_index,
+     off64_t offset,
+     time_t timestamp,
+     intptr_t *value,
+     int (*free_value)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     uint8_t flags,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -63,6 +63,22 @@ struct libfcache_internal_cache_value
 	/* The flags
 	 */
 	uint8_t flags;
+
+	/* The previous (more recently used) cache value
+	 */
+	libfcache_internal_cache_value_t *previous_used_value;
+
+	/* The next (less recently used) cache value
+	 */
+	libfcache_internal_cache_value_t *next_used_value;
+
+	/* The next cache value in the same hash table bucket
+	 */
+	libfcache_internal_cache_value_t *next_hash_value;
+
+	/* Value to indicate the cache value is linked in the hash table
+	 */
+	uint8_t is_linked;
 };
 
 int libfcache_cache_value_initialize(
@@ -35,9 +35,6 @@
 #include "libmfdata_range.h"
 #include "libmfdata_types.h"
 
-#define libmfdata_list_calculate_cache_entry_index( element_index, number_of_cache_entries ) \
-	element_index % number_of_cache_entries
-
 /* Initializes the list
  *
  * If the flag LIBMFDATA_FLAG_IO_HANDLE_MANAGED is set the list
@@ -651,6 +648,46 @@ int libmfdata_list_resize(
 	return( 1 );
 }
 
+/* Retrieves the IO handle of the list
+ * Returns 1 if successful or -1 on error
+ */
+int libmfdata_list_get_io_handle(
+     libmfdata_list_t *list,
+     intptr_t **io_handle,
+     libcerror_error_t **error )
+{
+	libmfdata_internal_list_t *internal_list = NULL;
+	static char *function                    = "libmfdata_list_get_io_handle";
+
+	if( list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_list = (libmfdata_internal_list_t *) list;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*io_handle = internal_list->io_handle;
+
+	return( 1 );
+}
+
 /* Retrieves the number of elements of the list
  * Returns 1 if successful or -1 on error
  */
@@ -3079,17 +3116,12 @@ int libmfdata_list_get_element_value(
 	libfcache_cache_value_t *cache_value    = NULL;
 	libmfdata_internal_list_t *internal_list = NULL;
 	static char *function                    = "libmfdata_list_get_element_value";
-        off64_t cache_value_offset               = (off64_t) -1;
 	off64_t element_data_offset              = 0;
 	size64_t element_data_size               = 0;
-	time_t cache_value_timestamp             = 0;
 	time_t element_timestamp                 = 0;
 	uint32_t element_data_flags              = 0;
-	int cache_entry_index                    = -1;
-	int cache_value_file_io_pool_entry       = -1;
 	int element_file_io_pool_entry           = 0;
 	int element_index                        = -1;
-	int number_of_cache_entries              = 0;
 	int result                               = 0;
 
 	if( list == NULL )
@@ -3136,91 +3168,41 @@ int libmfdata_list_get_element_value(
 
 		return( -1 );
 	}
-	if( libfcache_cache_get_number_of_entries(
-	     cache,
-	     &number_of_cache_entries,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of cache entries.",
-		 function );
-
-		return( -1 );
-	}
-	if( number_of_cache_entries <= 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid number of cache entries value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
 	if( ( read_flags & LIBMFDATA_READ_FLAG_IGNORE_CACHE ) == 0 )
 	{
-		cache_entry_index = libmfdata_list_calculate_cache_entry_index(
-		                     element_index,
-		                     number_of_cache_entries );
-
-		if( libfcache_cache_get_value_by_index(
-		     cache,
-		     cache_entry_index,
-		     &cache_value,
+		if( libmfdata_list_element_get_timestamp(
+		     element,
+		     &element_timestamp,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache entry: %d from cache.",
-			 function,
-			 cache_entry_index );
+			 "%s: unable to retrieve time stamp from list element.",
+			 function );
 
 			return( -1 );
 		}
-		if( cache_value != NULL )
-		{
-			if( libmfdata_list_element_get_timestamp(
-			     element,
-			     &element_timestamp,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve time stamp from list element.",
-				 function );
-
-				return( -1 );
-			}
-			if( libfcache_cache_value_get_identifier(
-			     cache_value,
-			     &cache_value_file_io_pool_entry,
-			     &cache_value_offset,
-			     &cache_value_timestamp,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve cache value identifier.",
-				 function );
+		result = libfcache_cache_get_value_by_identifier(
+		          cache,
+		          element_file_io_pool_entry,
+		          element_data_offset,
+		          element_timestamp,
+		          &cache_value,
+		          error );
 
-				return( -1 );
-			}
-		}
-		if( ( element_file_io_pool_entry == cache_value_file_io_pool_entry )
-		 && ( element_data_offset == cache_value_offset )
-		 && ( element_timestamp == cache_value_timestamp ) )
+		if( result == -1 )
 		{
-			result = 1;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value of element: %d from cache.",
+			 function,
+			 element_index );
+
+			return( -1 );
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -3228,20 +3210,18 @@ int libmfdata_list_get_element_value(
 			if( result == 0 )
 			{
 				libcnotify_printf(
-				 "%s: cache: 0x%08" PRIjx " miss (%d out of %d)\n",
+				 "%s: cache: 0x%08" PRIjx " miss (element: %d)\n",
 				 function,
 				 (intptr_t) cache,
-				 cache_entry_index,
-				 number_of_cache_entries );
+				 element_index );
 			}
 			else
 			{
 				libcnotify_printf(
-				 "%s: cache: 0x%08" PRIjx " hit (%d out of %d)\n",
+				 "%s: cache: 0x%08" PRIjx " hit (element: %d)\n",
 				 function,
 				 (intptr_t) cache,
-				 cache_entry_index,
-				 number_of_cache_entries );
+				 element_index );
 			}
 		}
 #endif
@@ -3285,62 +3265,60 @@ int libmfdata_list_get_element_value(
 
 			return( -1 );
 		}
-		cache_entry_index = libmfdata_list_calculate_cache_entry_index(
-		                     element_index,
-		                     number_of_cache_entries );
-
-		if( libfcache_cache_get_value_by_index(
-		     cache,
-		     cache_entry_index,
-		     &cache_value,
+		/* The read element data function can change the element
+		 */
+		if( libmfdata_list_element_get_data_range(
+		     element,
+		     &element_file_io_pool_entry,
+		     &element_data_offset,
+		     &element_data_size,
+		     &element_data_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache entry: %d from cache.",
-			 function,
-			 cache_entry_index );
+			 "%s: unable to retrieve data range from list element.",
+			 function );
 
 			return( -1 );
 		}
-		if( cache_value != NULL )
+		if( libmfdata_list_element_get_timestamp(
+		     element,
+		     &element_timestamp,
+		     error ) != 1 )
 		{
-			if( libmfdata_list_element_get_timestamp(
-			     element,
-			     &element_timestamp,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve time stamp from list element.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve time stamp from list element.",
+			 function );
 
-				return( -1 );
-			}
-			if( libfcache_cache_value_get_identifier(
-			     cache_value,
-			     &cache_value_file_io_pool_entry,
-			     &cache_value_offset,
-			     &cache_value_timestamp,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve cache value identifier.",
-				 function );
+			return( -1 );
+		}
+		result = libfcache_cache_get_value_by_identifier(
+		          cache,
+		          element_file_io_pool_entry,
+		          element_data_offset,
+		          element_timestamp,
+		          &cache_value,
+		          error );
 
-				return( -1 );
-			}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value of element: %d from cache.",
+			 function,
+			 element_index );
+
+			return( -1 );
 		}
-		if( ( element_file_io_pool_entry != cache_value_file_io_pool_entry )
-		 || ( element_data_offset != cache_value_offset )
-		 || ( element_timestamp != cache_value_timestamp ) )
+		else if( result == 0 )
 		{
 			libcerror_error_set(
 			 error,
@@ -3599,10 +3577,8 @@ int libmfdata_list_set_element_value(
 	size64_t element_data_size     = 0;
 	time_t element_timestamp       = 0;
 	uint32_t element_data_flags    = 0;
-	int cache_entry_index          = -1;
 	int element_index              = -1;
 	int element_file_io_pool_entry = 0;
-	int number_of_cache_entries    = 0;
 
 	if( list == NULL )
 	{
@@ -3646,20 +3622,6 @@ int libmfdata_list_set_element_value(
 
 		return( -1 );
 	}
-	if( libfcache_cache_get_number_of_entries(
-	     cache,
-	     &number_of_cache_entries,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of cache entries.",
-		 function );
-
-		return( -1 );
-	}
 	if( libmfdata_list_element_get_element_index(
 	     element,
 	     &element_index,
@@ -3674,24 +3636,8 @@ int libmfdata_list_set_element_value(
 
 		return( -1 );
 	}
-	if( number_of_cache_entries <= 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid number of cache entries value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
-	cache_entry_index = libmfdata_list_calculate_cache_entry_index(
-	                     element_index,
-	                     number_of_cache_entries );
-
-	if( libfcache_cache_set_value_by_index(
+	if( libfcache_cache_set_value_by_identifier(
 	     cache,
-	     cache_entry_index,
 	     element_file_io_pool_entry,
 	     element_data_offset,
 	     element_timestamp,
@@ -3704,9 +3650,9 @@ int libmfdata_list_set_element_value(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set value in cache entry: %d.",
+		 "%s: unable to set value of element: %d in cache.",
 		 function,
-		 cache_entry_index );
+		 element_index );
 
 		return( -1 );
 	}
@@ -160,6 +160,12 @@ int libmfdata_list_resize(
      int number_of_elements,
      libcerror_error_t **error );
 
+LIBMFDATA_EXTERN \
+int libmfdata_list_get_io_handle(
+     libmfdata_list_t *list,
+     intptr_t **io_handle,
+     libcerror_error_t **error );
+
 LIBMFDATA_EXTERN \
 int libmfdata_list_get_number_of_elements(
      libmfdata_list_t *list,
@@ -606,6 +606,23 @@ int libsmdev_handle_open(
 
 		goto on_error;
 	}
+	if( internal_handle->drop_cached_data != 0 )
+	{
+		if( libcfile_file_set_drop_cached_data(
+		     internal_handle->device_file,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set drop cached data.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( libsmdev_handle_get_media_size(
 	     handle,
 	     &media_size,
@@ -809,6 +826,23 @@ int libsmdev_handle_open_wide(
 
 		goto on_error;
 	}
+	if( internal_handle->drop_cached_data != 0 )
+	{
+		if( libcfile_file_set_drop_cached_data(
+		     internal_handle->device_file,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set drop cached data.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( libsmdev_handle_get_media_size(
 	     handle,
 	     &media_size,
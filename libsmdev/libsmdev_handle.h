@@ -136,6 +136,10 @@ struct libsmdev_internal_handle
 	 */
 	libcdata_range_list_t *errors_range_list;
 
+	/* Value to indicate the data read should be dropped from the system page cache
+	 */
+	uint8_t drop_cached_data;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
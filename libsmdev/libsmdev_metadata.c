@@ -1234,6 +1234,54 @@ int libsmdev_handle_set_error_flags(
 	return( 1 );
 }
 
+/* Sets the value to indicate the data read should be dropped from the system page cache
+ * Use this when the storage media device is read once, to keep its data from filling the cache
+ * The value must be set before the handle is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_set_drop_cached_data(
+     libsmdev_handle_t *handle,
+     uint8_t drop_cached_data,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_set_drop_cached_data";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->device_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - device file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( drop_cached_data != 0 )
+	{
+		internal_handle->drop_cached_data = 1;
+	}
+	else
+	{
+		internal_handle->drop_cached_data = 0;
+	}
+	return( 1 );
+}
+
 /* Retrieves the number of read/write errors
  * Returns 1 if successful or -1 on error
  */
@@ -140,6 +140,12 @@ int libsmdev_handle_set_error_flags(
      uint8_t error_flags,
      libcerror_error_t **error );
 
+LIBSMDEV_EXTERN \
+int libsmdev_handle_set_drop_cached_data(
+     libsmdev_handle_t *handle,
+     uint8_t drop_cached_data,
+     libcerror_error_t **error );
+
 LIBSMDEV_EXTERN \
 int libsmdev_handle_get_number_of_errors(
      libsmdev_handle_t *handle,
@@ -295,6 +295,17 @@ AC_DEFUN([AX_LIBCFILE_CHECK_LOCAL],
  dnl File input/output functions used in libcfile/libcfile_file.c
  AC_CHECK_FUNCS([close fstat ftruncate ioctl lseek open read write])
 
+ dnl Memory map functions used in libcfile/libcfile_file.c
+ AC_CHECK_HEADERS([sys/mman.h])
+ AC_CHECK_FUNCS([mmap munmap])
+
+ dnl Positional and vectored input/output functions used in libcfile/libcfile_file.c
+ AC_CHECK_HEADERS([sys/uio.h])
+ AC_CHECK_FUNCS([pread preadv])
+
+ dnl Function to flush written data used in libcfile/libcfile_file.c
+ AC_CHECK_FUNCS([sync_file_range])
+
  AS_IF(
   [test "x$ac_cv_func_close" != xyes],
   [AC_MSG_FAILURE(
@@ -0,0 +1,214 @@
+dnl Functions for libcthreads
+dnl
+dnl Version: 20130509
+
+dnl Function to detect if pthread is available
+AC_DEFUN([AX_PTHREAD_CHECK_LIB],
+ [AS_IF(
+  [test "x$ac_cv_enable_winapi" = xyes],
+  [ac_cv_pthread=no],
+  [dnl Check for headers
+  AC_CHECK_HEADERS([pthread.h])
+
+  AS_IF(
+   [test "x$ac_cv_header_pthread_h" = xno],
+   [ac_cv_pthread=no],
+   [dnl Check for the individual functions
+   ac_cv_pthread=pthread
+
+   AC_CHECK_LIB(
+    pthread,
+    pthread_create,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_exit,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_join,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_cond_init,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_cond_destroy,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_cond_broadcast,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_cond_signal,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_cond_wait,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_mutex_init,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_mutex_destroy,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_mutex_lock,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_mutex_trylock,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_mutex_unlock,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_rwlock_init,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_rwlock_destroy,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_rwlock_rdlock,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_rwlock_wrlock,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+   AC_CHECK_LIB(
+    pthread,
+    pthread_rwlock_unlock,
+    [ac_pthread_dummy=yes],
+    [ac_cv_pthread=no])
+
+   ac_cv_pthread_LIBADD="-lpthread";
+   ])
+  ])
+
+ AS_IF(
+  [test "x$ac_cv_pthread" = xpthread],
+  [AC_DEFINE(
+   [HAVE_PTHREAD],
+   [1],
+   [Define to 1 if you have the `pthread' library (-lpthread).])
+  ])
+
+ AS_IF(
+  [test "x$ac_cv_pthread" != xno],
+  [AC_SUBST(
+   [HAVE_PTHREAD],
+   [1]) ],
+  [AC_SUBST(
+   [HAVE_PTHREAD],
+   [0])
+  ])
+
+ AS_IF(
+  [test "x$ac_cv_pthread_LIBADD" != "x"],
+  [AC_SUBST(
+   [PTHREAD_LIBADD],
+   [$ac_cv_pthread_LIBADD])
+  ])
+ ])
+
+dnl Function to detect if libcthreads dependencies are available
+AC_DEFUN([AX_LIBCTHREADS_CHECK_LOCAL],
+ [AX_PTHREAD_CHECK_LIB
+
+ AS_IF(
+  [test "x$ac_cv_enable_winapi" = xno && test "x$ac_cv_pthread" = xno],
+  [ac_cv_enable_multi_threading_support=no])
+ ])
+
+dnl Function to detect how to enable libcthreads
+dnl Only the local version of libcthreads is used, the ewftools and library
+dnl depend on its thread pool interface which differs from that of the
+dnl stand-alone libcthreads
+AC_DEFUN([AX_LIBCTHREADS_CHECK_ENABLE],
+ [AX_COMMON_ARG_ENABLE(
+  [multi-threading-support],
+  [multi_threading_support],
+  [enable multi-threading support],
+  [yes])
+
+ AS_IF(
+  [test "x$ac_cv_enable_multi_threading_support" = xno],
+  [ac_cv_libcthreads="no"],
+  [dnl Check if the dependencies for the local library version
+  AX_LIBCTHREADS_CHECK_LOCAL
+
+  AS_IF(
+   [test "x$ac_cv_enable_multi_threading_support" = xno],
+   [ac_cv_libcthreads="no"],
+   [AC_DEFINE(
+    [HAVE_LOCAL_LIBCTHREADS],
+    [1],
+    [Define to 1 if the local version of libcthreads is used.])
+   AC_SUBST(
+    [HAVE_LOCAL_LIBCTHREADS],
+    [1])
+
+   ac_cv_libcthreads_CPPFLAGS="-I../libcthreads";
+   ac_cv_libcthreads_LIBADD="../libcthreads/libcthreads.la";
+
+   ac_cv_libcthreads=local
+   ])
+  ])
+
+ AS_IF(
+  [test "x$ac_cv_libcthreads" != xno],
+  [AC_DEFINE(
+   [HAVE_MULTI_THREAD_SUPPORT],
+   [1],
+   [Define to 1 if multi thread support should be used.])
+  AC_SUBST(
+   [HAVE_MULTI_THREAD_SUPPORT],
+   [1]) ],
+  [AC_SUBST(
+   [HAVE_MULTI_THREAD_SUPPORT],
+   [0])
+  ])
+
+ AM_CONDITIONAL(
+  [HAVE_LOCAL_LIBCTHREADS],
+  [test "x$ac_cv_libcthreads" = xlocal])
+ AS_IF(
+  [test "x$ac_cv_libcthreads_CPPFLAGS" != "x"],
+  [AC_SUBST(
+   [LIBCTHREADS_CPPFLAGS],
+   [$ac_cv_libcthreads_CPPFLAGS])
+  ])
+ AS_IF(
+  [test "x$ac_cv_libcthreads_LIBADD" != "x"],
+  [AC_SUBST(
+   [LIBCTHREADS_LIBADD],
+   [$ac_cv_libcthreads_LIBADD])
+  ])
+ ])
+
@@ -96,7 +96,7 @@ AC_DEFUN([AX_ZLIB_CHECK_LIB],
  AS_IF(
   [test "x$ac_cv_lib_z_adler32" = xyes],
   [AS_IF(
-   [test "x$ac_cv_with_adler32" != xzlib && test "x$ac_cv_with_adler32" != xauto-detect],
+   [test "x$ac_cv_with_adler32" != xzlib],
    [ac_cv_adler32=local],
    [AC_DEFINE(
     [HAVE_ADLER32],
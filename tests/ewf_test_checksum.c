@@ -0,0 +1,229 @@
+/*
+ * Expert Witness Compression Format (EWF) library checksum testing program
+ *
+ * Copyright (c) 2006-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+/* The checksum functions are internal to the library and can only be tested
+ * when the library exports its internal symbols
+ */
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+#include "../libewf/libewf_checksum.h"
+
+#define EWF_TEST_CHECKSUM_BUFFER_SIZE	( 64 * 1024 )
+
+/* Tests an Adler-32 implementation against the generic implementation
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_checksum_adler32(
+     const char *name,
+     uint32_t (*calculate_adler32)(
+               const uint8_t *buffer,
+               size_t size,
+               uint32_t initial_value ),
+     const uint8_t *buffer )
+{
+	uint32_t initial_values[ 3 ] = { 1, 0xfff0fff0UL, 0x12345678UL };
+	uint32_t expected_value      = 0;
+	uint32_t value               = 0;
+	size_t buffer_offset         = 0;
+	size_t size                  = 0;
+	int initial_value_index      = 0;
+
+	for( size = 0;
+	     size <= ( EWF_TEST_CHECKSUM_BUFFER_SIZE - 64 );
+	     size += ( size < 1024 ) ? 1 : 4093 )
+	{
+		for( buffer_offset = 0;
+		     buffer_offset < 64;
+		     buffer_offset += 7 )
+		{
+			for( initial_value_index = 0;
+			     initial_value_index < 3;
+			     initial_value_index++ )
+			{
+				expected_value = libewf_checksum_calculate_adler32_generic(
+				                  &( buffer[ buffer_offset ] ),
+				                  size,
+				                  initial_values[ initial_value_index ] );
+
+				value = calculate_adler32(
+				         &( buffer[ buffer_offset ] ),
+				         size,
+				         initial_values[ initial_value_index ] );
+
+				if( value != expected_value )
+				{
+					fprintf(
+					 stderr,
+					 "%s: mismatch for size: %" PRIzd " at offset: %" PRIzd ": 0x%08" PRIx32 " expected: 0x%08" PRIx32 ".\n",
+					 name,
+					 size,
+					 buffer_offset,
+					 value,
+					 expected_value );
+
+					return( 0 );
+				}
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Tests the Adler-32 implementations on a specific buffer
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_checksum_buffer(
+     const uint8_t *buffer )
+{
+	if( ewf_test_checksum_adler32(
+	     "libewf_checksum_calculate_adler32",
+	     &libewf_checksum_calculate_adler32,
+	     buffer ) != 1 )
+	{
+		return( 0 );
+	}
+#if defined( LIBEWF_CHECKSUM_HAVE_SSE2 )
+	if( ewf_test_checksum_adler32(
+	     "libewf_checksum_calculate_adler32_sse2",
+	     &libewf_checksum_calculate_adler32_sse2,
+	     buffer ) != 1 )
+	{
+		return( 0 );
+	}
+#endif
+#if defined( LIBEWF_CHECKSUM_HAVE_AVX2 )
+	if( libewf_checksum_cpu_supports_avx2() != 0 )
+	{
+		if( ewf_test_checksum_adler32(
+		     "libewf_checksum_calculate_adler32_avx2",
+		     &libewf_checksum_calculate_adler32_avx2,
+		     buffer ) != 1 )
+		{
+			return( 0 );
+		}
+	}
+#endif
+#if defined( LIBEWF_CHECKSUM_HAVE_NEON )
+	if( ewf_test_checksum_adler32(
+	     "libewf_checksum_calculate_adler32_neon",
+	     &libewf_checksum_calculate_adler32_neon,
+	     buffer ) != 1 )
+	{
+		return( 0 );
+	}
+#endif
+	return( 1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+/* The main program
+ */
+int main( void )
+{
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+	uint8_t *buffer     = NULL;
+	uint32_t seed       = 0x5eed5eedUL;
+	uint32_t value      = 0;
+	size_t buffer_index = 0;
+
+	/* The Adler-32 of "Wikipedia"
+	 */
+	value = libewf_checksum_calculate_adler32(
+	         (uint8_t *) "Wikipedia",
+	         9,
+	         1 );
+
+	if( value != 0x11e60398UL )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid Adler-32 of test string: 0x%08" PRIx32 ".\n",
+		 value );
+
+		return( EXIT_FAILURE );
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * EWF_TEST_CHECKSUM_BUFFER_SIZE );
+
+	if( buffer == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create buffer.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	for( buffer_index = 0;
+	     buffer_index < EWF_TEST_CHECKSUM_BUFFER_SIZE;
+	     buffer_index++ )
+	{
+		seed = ( seed * 1103515245UL ) + 12345;
+
+		buffer[ buffer_index ] = (uint8_t) ( seed >> 16 );
+	}
+	if( ewf_test_checksum_buffer(
+	     buffer ) != 1 )
+	{
+		goto on_error;
+	}
+	/* A buffer of 0xff bytes causes the largest intermediate sums
+	 */
+	if( memory_set(
+	     buffer,
+	     0xff,
+	     sizeof( uint8_t ) * EWF_TEST_CHECKSUM_BUFFER_SIZE ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set buffer.\n" );
+
+		goto on_error;
+	}
+	if( ewf_test_checksum_buffer(
+	     buffer ) != 1 )
+	{
+		goto on_error;
+	}
+	memory_free(
+	 buffer );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	memory_free(
+	 buffer );
+
+	return( EXIT_FAILURE );
+#else
+	return( EXIT_SUCCESS );
+#endif
+}
+
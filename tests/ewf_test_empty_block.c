@@ -0,0 +1,289 @@
+/*
+ * Expert Witness Compression Format (EWF) library empty block testing program
+ *
+ * Copyright (c) 2006-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+/* The empty block functions are internal to the library and can only be tested
+ * when the library exports its internal symbols
+ */
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+#include "../libewf/libewf_empty_block.h"
+
+#define EWF_TEST_EMPTY_BLOCK_BUFFER_SIZE	( 4 * 1024 )
+
+/* Tests an empty block implementation
+ * Every size is tested with a buffer that only contains the byte value
+ * and with buffers in which a single byte differs
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_empty_block_test(
+     const char *name,
+     int (*test_empty_block)(
+          const uint8_t *block_buffer,
+          size_t block_size,
+          uint8_t byte_value ),
+     uint8_t *buffer,
+     uint8_t byte_value )
+{
+	size_t buffer_offset = 0;
+	size_t byte_index    = 0;
+	size_t size          = 0;
+	int result           = 0;
+
+	for( size = 0;
+	     size <= ( EWF_TEST_EMPTY_BLOCK_BUFFER_SIZE - 64 );
+	     size += ( size < 512 ) ? 1 : 509 )
+	{
+		for( buffer_offset = 0;
+		     buffer_offset < 64;
+		     buffer_offset += 7 )
+		{
+			result = test_empty_block(
+			          &( buffer[ buffer_offset ] ),
+			          size,
+			          byte_value );
+
+			if( result != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "%s: empty block of size: %" PRIzd " at offset: %" PRIzd " not detected.\n",
+				 name,
+				 size,
+				 buffer_offset );
+
+				return( 0 );
+			}
+			for( byte_index = 0;
+			     byte_index < size;
+			     byte_index += ( size < 256 ) ? 1 : 31 )
+			{
+				buffer[ buffer_offset + byte_index ] ^= 0x01;
+
+				result = test_empty_block(
+				          &( buffer[ buffer_offset ] ),
+				          size,
+				          byte_value );
+
+				buffer[ buffer_offset + byte_index ] ^= 0x01;
+
+				if( result != 0 )
+				{
+					fprintf(
+					 stderr,
+					 "%s: differing byte: %" PRIzd " in block of size: %" PRIzd " at offset: %" PRIzd " not detected.\n",
+					 name,
+					 byte_index,
+					 size,
+					 buffer_offset );
+
+					return( 0 );
+				}
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Tests the empty block implementations on a buffer filled with a specific byte value
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_empty_block_byte_value(
+     uint8_t *buffer,
+     uint8_t byte_value )
+{
+	if( memory_set(
+	     buffer,
+	     byte_value,
+	     sizeof( uint8_t ) * EWF_TEST_EMPTY_BLOCK_BUFFER_SIZE ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set buffer.\n" );
+
+		return( 0 );
+	}
+	if( ewf_test_empty_block_test(
+	     "libewf_empty_block_test_generic",
+	     &libewf_empty_block_test_generic,
+	     buffer,
+	     byte_value ) != 1 )
+	{
+		return( 0 );
+	}
+#if defined( LIBEWF_EMPTY_BLOCK_HAVE_SSE2 )
+	if( ewf_test_empty_block_test(
+	     "libewf_empty_block_test_sse2",
+	     &libewf_empty_block_test_sse2,
+	     buffer,
+	     byte_value ) != 1 )
+	{
+		return( 0 );
+	}
+#endif
+#if defined( LIBEWF_EMPTY_BLOCK_HAVE_AVX2 )
+	if( libewf_empty_block_cpu_supports_avx2() != 0 )
+	{
+		if( ewf_test_empty_block_test(
+		     "libewf_empty_block_test_avx2",
+		     &libewf_empty_block_test_avx2,
+		     buffer,
+		     byte_value ) != 1 )
+		{
+			return( 0 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Tests libewf_empty_block_test on a buffer filled with a specific byte value
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_empty_block(
+     uint8_t *buffer,
+     uint8_t byte_value )
+{
+	size_t byte_index = 0;
+	size_t size       = 0;
+	int result        = 0;
+
+	if( memory_set(
+	     buffer,
+	     byte_value,
+	     sizeof( uint8_t ) * EWF_TEST_EMPTY_BLOCK_BUFFER_SIZE ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set buffer.\n" );
+
+		return( 0 );
+	}
+	for( size = 0;
+	     size <= EWF_TEST_EMPTY_BLOCK_BUFFER_SIZE;
+	     size += ( size < 512 ) ? 1 : 511 )
+	{
+		result = libewf_empty_block_test(
+		          buffer,
+		          size,
+		          NULL );
+
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "libewf_empty_block_test: empty block of size: %" PRIzd " not detected.\n",
+			 size );
+
+			return( 0 );
+		}
+		/* The first byte determines the byte value of the block
+		 */
+		for( byte_index = 1;
+		     byte_index < size;
+		     byte_index++ )
+		{
+			buffer[ byte_index ] ^= 0x80;
+
+			result = libewf_empty_block_test(
+			          buffer,
+			          size,
+			          NULL );
+
+			buffer[ byte_index ] ^= 0x80;
+
+			if( result != 0 )
+			{
+				fprintf(
+				 stderr,
+				 "libewf_empty_block_test: differing byte: %" PRIzd " in block of size: %" PRIzd " not detected.\n",
+				 byte_index,
+				 size );
+
+				return( 0 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+/* The main program
+ */
+int main( void )
+{
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+	uint8_t byte_values[ 3 ] = { 0x00, 0x5a, 0xff };
+	uint8_t *buffer          = NULL;
+	int byte_value_index     = 0;
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * EWF_TEST_EMPTY_BLOCK_BUFFER_SIZE );
+
+	if( buffer == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create buffer.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	for( byte_value_index = 0;
+	     byte_value_index < 3;
+	     byte_value_index++ )
+	{
+		if( ewf_test_empty_block_byte_value(
+		     buffer,
+		     byte_values[ byte_value_index ] ) != 1 )
+		{
+			goto on_error;
+		}
+		if( ewf_test_empty_block(
+		     buffer,
+		     byte_values[ byte_value_index ] ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	memory_free(
+	 buffer );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	memory_free(
+	 buffer );
+
+	return( EXIT_FAILURE );
+#else
+	return( EXIT_SUCCESS );
+#endif
+}
+
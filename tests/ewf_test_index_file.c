@@ -0,0 +1,493 @@
+/*
+ * Expert Witness Compression Format (EWF) library index file testing program
+ *
+ * Copyright (c) 2006-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "ewf_test_definitions.h"
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libcstring.h"
+#include "ewf_test_libcsystem.h"
+#include "ewf_test_libewf.h"
+
+/* Define to make ewf_test_index_file generate verbose output
+#define EWF_TEST_INDEX_FILE_VERBOSE
+ */
+
+/* Opens a handle
+ * The index filename is only set if not NULL
+ * Return 1 if successful or -1 on error
+ */
+int ewf_test_index_file_open_handle(
+     libewf_handle_t **handle,
+     char * const filenames[],
+     int number_of_filenames,
+     const libcstring_system_character_t *index_filename,
+     libcerror_error_t **error )
+{
+	static char *function        = "ewf_test_index_file_open_handle";
+	size_t index_filename_length = 0;
+
+	if( libewf_handle_initialize(
+	     handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( index_filename != NULL )
+	{
+		index_filename_length = libcstring_system_string_length(
+		                         index_filename );
+
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libewf_handle_set_index_filename_wide(
+		     *handle,
+		     index_filename,
+		     index_filename_length,
+		     error ) != 1 )
+#else
+		if( libewf_handle_set_index_filename(
+		     *handle,
+		     index_filename,
+		     index_filename_length,
+		     error ) != 1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set index filename.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libewf_handle_open_wide(
+	     *handle,
+	     filenames,
+	     number_of_filenames,
+	     LIBEWF_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libewf_handle_open(
+	     *handle,
+	     filenames,
+	     number_of_filenames,
+	     LIBEWF_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *handle != NULL )
+	{
+		libewf_handle_free(
+		 handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests opening with an index file
+ * Compares the media data read using the index file with the media data
+ * read without using the index file
+ * Return 1 if successful, 0 if not or -1 on error
+ */
+int ewf_test_index_file(
+     char * const filenames[],
+     int number_of_filenames,
+     const libcstring_system_character_t *index_filename,
+     libcerror_error_t **error )
+{
+	libewf_handle_t *handle           = NULL;
+	libewf_handle_t *reference_handle = NULL;
+	uint8_t *buffer                   = NULL;
+	uint8_t *reference_buffer         = NULL;
+	static char *function             = "ewf_test_index_file";
+	size64_t media_size               = 0;
+	size64_t reference_media_size     = 0;
+	size_t read_size                  = 0;
+	ssize_t read_count                = 0;
+	int result                        = 1;
+
+	if( ewf_test_index_file_open_handle(
+	     &handle,
+	     filenames,
+	     number_of_filenames,
+	     index_filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open handle with index file.",
+		 function );
+
+		goto on_error;
+	}
+	if( ewf_test_index_file_open_handle(
+	     &reference_handle,
+	     filenames,
+	     number_of_filenames,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open reference handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_get_media_size(
+	     handle,
+	     &media_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_get_media_size(
+	     reference_handle,
+	     &reference_media_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve reference media size.",
+		 function );
+
+		goto on_error;
+	}
+	if( media_size != reference_media_size )
+	{
+		result = 0;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      EWF_TEST_BUFFER_SIZE );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	reference_buffer = (uint8_t *) memory_allocate(
+	                                EWF_TEST_BUFFER_SIZE );
+
+	if( reference_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create reference buffer.",
+		 function );
+
+		goto on_error;
+	}
+	while( ( result == 1 )
+	    && ( media_size > 0 ) )
+	{
+		if( media_size > (size64_t) EWF_TEST_BUFFER_SIZE )
+		{
+			read_size = EWF_TEST_BUFFER_SIZE;
+		}
+		else
+		{
+			read_size = (size_t) media_size;
+		}
+		read_count = libewf_handle_read_buffer(
+			      handle,
+			      buffer,
+			      read_size,
+			      error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable read buffer of size: %" PRIzd ".",
+			 function,
+			 read_size );
+
+			goto on_error;
+		}
+		read_count = libewf_handle_read_buffer(
+			      reference_handle,
+			      reference_buffer,
+			      read_size,
+			      error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable read reference buffer of size: %" PRIzd ".",
+			 function,
+			 read_size );
+
+			goto on_error;
+		}
+		if( memory_compare(
+		     buffer,
+		     reference_buffer,
+		     read_size ) != 0 )
+		{
+			result = 0;
+		}
+		media_size -= read_size;
+	}
+	memory_free(
+	 reference_buffer );
+
+	reference_buffer = NULL;
+
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	if( libewf_handle_close(
+	     reference_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close reference handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_free(
+	     &reference_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free reference handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_close(
+	     handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_free(
+	     &handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( reference_buffer != NULL )
+	{
+		memory_free(
+		 reference_buffer );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( reference_handle != NULL )
+	{
+		libewf_handle_close(
+		 reference_handle,
+		 NULL );
+		libewf_handle_free(
+		 &reference_handle,
+		 NULL );
+	}
+	if( handle != NULL )
+	{
+		libewf_handle_close(
+		 handle,
+		 NULL );
+		libewf_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcstring_system_character_t *index_filename = NULL;
+	libcerror_error_t *error                      = NULL;
+	libcstring_system_integer_t option            = 0;
+	int result                                    = 0;
+
+	while( ( option = libcsystem_getopt(
+	                   argc,
+	                   argv,
+	                   _LIBCSTRING_SYSTEM_STRING( "i:" ) ) ) != (libcstring_system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (libcstring_system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_LIBCSTRING_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+
+			case (libcstring_system_integer_t) 'i':
+				index_filename = optarg;
+
+				break;
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing EWF image filename(s).\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( index_filename == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Missing index filename.\n" );
+
+		return( EXIT_FAILURE );
+	}
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( EWF_TEST_INDEX_FILE_VERBOSE )
+	libewf_notify_set_verbose(
+	 1 );
+	libewf_notify_set_stream(
+	 stderr,
+	 NULL );
+#endif
+	result = ewf_test_index_file(
+	          &( argv[ optind ] ),
+	          argc - optind,
+	          index_filename,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to test index file.\n" );
+
+		goto on_error;
+	}
+	if( result != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Media data read using the index file differs.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libewf_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libewf_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+}
+
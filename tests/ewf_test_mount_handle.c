@@ -0,0 +1,806 @@
+/*
+ * Expert Witness Compression Format (EWF) mount handle testing program
+ *
+ * Copyright (c) 2006-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libcstring.h"
+#include "ewf_test_libewf.h"
+
+#include "../ewftools/mount_handle.h"
+
+#define EWF_TEST_MOUNT_HANDLE_MEDIA_SIZE	( 1024 * 1024 )
+#define EWF_TEST_MOUNT_HANDLE_READ_SIZE		4096
+#define EWF_TEST_MOUNT_HANDLE_WRITE_SIZE	( 32 * 1024 )
+
+/* The number of reader threads, which exceeds the number of input handles
+ * so that readers have to wait for an input handle to become available
+ */
+#define EWF_TEST_MOUNT_HANDLE_NUMBER_OF_READERS	8
+
+/* Define to make ewf_test_mount_handle generate verbose output
+#define EWF_TEST_MOUNT_HANDLE_VERBOSE
+ */
+
+typedef struct ewf_test_mount_handle_reader ewf_test_mount_handle_reader_t;
+
+struct ewf_test_mount_handle_reader
+{
+	/* The mount handle
+	 */
+	mount_handle_t *mount_handle;
+
+	/* The offset of the first read
+	 */
+	off64_t offset;
+
+	/* The result of the reads
+	 */
+	int result;
+};
+
+/* Retrieves the value of the test data at a specific offset
+ * The modulus is a prime so that the data of every chunk differs
+ */
+uint8_t ewf_test_mount_handle_get_value(
+         off64_t offset )
+{
+	return( (uint8_t) ( offset % 251 ) );
+}
+
+/* Writes the test data to EWF file(s)
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_mount_handle_write(
+     const libcstring_system_character_t *filename,
+     libcerror_error_t **error )
+{
+	libewf_handle_t *handle = NULL;
+	uint8_t *buffer         = NULL;
+	static char *function   = "ewf_test_mount_handle_write";
+	size_t buffer_index     = 0;
+	ssize_t write_count     = 0;
+	off64_t offset          = 0;
+
+	if( libewf_handle_initialize(
+	     &handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libewf_handle_open_wide(
+	     handle,
+	     (wchar_t * const *) &filename,
+	     1,
+	     LIBEWF_OPEN_WRITE,
+	     error ) != 1 )
+#else
+	if( libewf_handle_open(
+	     handle,
+	     (char * const *) &filename,
+	     1,
+	     LIBEWF_OPEN_WRITE,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_set_media_size(
+	     handle,
+	     EWF_TEST_MOUNT_HANDLE_MEDIA_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable set media size.",
+		 function );
+
+		goto on_error;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * EWF_TEST_MOUNT_HANDLE_WRITE_SIZE );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable created buffer.",
+		 function );
+
+		goto on_error;
+	}
+	while( offset < EWF_TEST_MOUNT_HANDLE_MEDIA_SIZE )
+	{
+		for( buffer_index = 0;
+		     buffer_index < EWF_TEST_MOUNT_HANDLE_WRITE_SIZE;
+		     buffer_index++ )
+		{
+			buffer[ buffer_index ] = ewf_test_mount_handle_get_value(
+			                          offset + (off64_t) buffer_index );
+		}
+		write_count = libewf_handle_write_buffer(
+			       handle,
+			       buffer,
+			       EWF_TEST_MOUNT_HANDLE_WRITE_SIZE,
+			       error );
+
+		if( write_count != (ssize_t) EWF_TEST_MOUNT_HANDLE_WRITE_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable write buffer at offset: %" PRIi64 ".",
+			 function,
+			 offset );
+
+			goto on_error;
+		}
+		offset += write_count;
+	}
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	if( libewf_handle_close(
+	     handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_free(
+	     &handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( handle != NULL )
+	{
+		libewf_handle_close(
+		 handle,
+		 NULL );
+		libewf_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests reading the test data at a specific offset
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int ewf_test_mount_handle_read(
+     mount_handle_t *mount_handle,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	uint8_t buffer[ EWF_TEST_MOUNT_HANDLE_READ_SIZE ];
+
+	static char *function = "ewf_test_mount_handle_read";
+	size_t buffer_index   = 0;
+	size_t read_size      = EWF_TEST_MOUNT_HANDLE_READ_SIZE;
+	ssize_t read_count    = 0;
+
+	if( offset >= EWF_TEST_MOUNT_HANDLE_MEDIA_SIZE )
+	{
+		read_size = 0;
+	}
+	else if( (size64_t) read_size > (size64_t) ( EWF_TEST_MOUNT_HANDLE_MEDIA_SIZE - offset ) )
+	{
+		read_size = (size_t) ( EWF_TEST_MOUNT_HANDLE_MEDIA_SIZE - offset );
+	}
+	read_count = mount_handle_read_buffer_at_offset(
+	              mount_handle,
+	              buffer,
+	              EWF_TEST_MOUNT_HANDLE_READ_SIZE,
+	              offset,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 ".",
+		 function,
+		 offset );
+
+		return( -1 );
+	}
+	if( read_count != (ssize_t) read_size )
+	{
+		return( 0 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < read_size;
+	     buffer_index++ )
+	{
+		if( buffer[ buffer_index ] != ewf_test_mount_handle_get_value(
+		                               offset + (off64_t) buffer_index ) )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Tests grabbing and releasing the input handles
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int ewf_test_mount_handle_grab_and_release(
+     mount_handle_t *mount_handle,
+     libcerror_error_t **error )
+{
+	int input_handle_indexes[ MOUNT_HANDLE_MAXIMUM_NUMBER_OF_THREADS ];
+
+	static char *function   = "ewf_test_mount_handle_grab_and_release";
+	int input_handle_index  = 0;
+	int number_of_grabs     = 0;
+	int other_index         = 0;
+	int result              = 1;
+
+	/* All input handles can be grabbed at the same time
+	 */
+	for( number_of_grabs = 0;
+	     number_of_grabs < mount_handle->number_of_input_handles;
+	     number_of_grabs++ )
+	{
+		if( mount_handle_grab_input_handle(
+		     mount_handle,
+		     0,
+		     &( input_handle_indexes[ number_of_grabs ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to grab input handle: %d.",
+			 function,
+			 number_of_grabs );
+
+			goto on_error;
+		}
+		/* An input handle is never handed out twice
+		 */
+		for( other_index = 0;
+		     other_index < number_of_grabs;
+		     other_index++ )
+		{
+			if( input_handle_indexes[ other_index ] == input_handle_indexes[ number_of_grabs ] )
+			{
+				result = 0;
+			}
+		}
+	}
+	/* The input handle of which the last read ended at the offset is preferred
+	 */
+	for( input_handle_index = 0;
+	     input_handle_index < number_of_grabs;
+	     input_handle_index++ )
+	{
+		if( mount_handle_release_input_handle(
+		     mount_handle,
+		     input_handle_indexes[ input_handle_index ],
+		     (off64_t) ( input_handle_index + 1 ) * EWF_TEST_MOUNT_HANDLE_READ_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release input handle: %d.",
+			 function,
+			 input_handle_indexes[ input_handle_index ] );
+
+			goto on_error;
+		}
+	}
+	number_of_grabs = 0;
+
+	for( input_handle_index = mount_handle->number_of_input_handles - 1;
+	     input_handle_index >= 0;
+	     input_handle_index-- )
+	{
+		if( mount_handle_grab_input_handle(
+		     mount_handle,
+		     (off64_t) ( input_handle_index + 1 ) * EWF_TEST_MOUNT_HANDLE_READ_SIZE,
+		     &other_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to grab input handle.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_grabs++;
+
+		if( other_index != input_handle_indexes[ input_handle_index ] )
+		{
+			result = 0;
+		}
+	}
+	for( input_handle_index = 0;
+	     input_handle_index < number_of_grabs;
+	     input_handle_index++ )
+	{
+		if( mount_handle_release_input_handle(
+		     mount_handle,
+		     input_handle_indexes[ input_handle_index ],
+		     -1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release input handle: %d.",
+			 function,
+			 input_handle_indexes[ input_handle_index ] );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	for( input_handle_index = 0;
+	     input_handle_index < number_of_grabs;
+	     input_handle_index++ )
+	{
+		mount_handle_release_input_handle(
+		 mount_handle,
+		 input_handle_indexes[ input_handle_index ],
+		 -1,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Reads the test data sequentially from a reader thread
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_mount_handle_reader_callback(
+     ewf_test_mount_handle_reader_t *reader )
+{
+	libcerror_error_t *error = NULL;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	if( reader == NULL )
+	{
+		return( -1 );
+	}
+	reader->result = 1;
+
+	for( offset = reader->offset;
+	     offset < EWF_TEST_MOUNT_HANDLE_MEDIA_SIZE;
+	     offset += EWF_TEST_MOUNT_HANDLE_READ_SIZE )
+	{
+		result = ewf_test_mount_handle_read(
+		          reader->mount_handle,
+		          offset,
+		          &error );
+
+		if( result != 1 )
+		{
+			reader->result = result;
+
+			break;
+		}
+	}
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+}
+
+/* Tests reading the test data concurrently
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int ewf_test_mount_handle_read_concurrently(
+     mount_handle_t *mount_handle,
+     libcerror_error_t **error )
+{
+	ewf_test_mount_handle_reader_t readers[ EWF_TEST_MOUNT_HANDLE_NUMBER_OF_READERS ];
+	libcthreads_thread_t *threads[ EWF_TEST_MOUNT_HANDLE_NUMBER_OF_READERS ];
+
+	static char *function = "ewf_test_mount_handle_read_concurrently";
+	int reader_index      = 0;
+	int result            = 1;
+
+	for( reader_index = 0;
+	     reader_index < EWF_TEST_MOUNT_HANDLE_NUMBER_OF_READERS;
+	     reader_index++ )
+	{
+		threads[ reader_index ] = NULL;
+
+		readers[ reader_index ].mount_handle = mount_handle;
+		readers[ reader_index ].offset       = (off64_t) reader_index * ( EWF_TEST_MOUNT_HANDLE_MEDIA_SIZE / EWF_TEST_MOUNT_HANDLE_NUMBER_OF_READERS );
+		readers[ reader_index ].result       = 0;
+	}
+	for( reader_index = 0;
+	     reader_index < EWF_TEST_MOUNT_HANDLE_NUMBER_OF_READERS;
+	     reader_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( threads[ reader_index ] ),
+		     (int (*)(void *)) &ewf_test_mount_handle_reader_callback,
+		     (void *) &( readers[ reader_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
+			 function,
+			 reader_index );
+
+			result = -1;
+
+			break;
+		}
+	}
+	for( reader_index = 0;
+	     reader_index < EWF_TEST_MOUNT_HANDLE_NUMBER_OF_READERS;
+	     reader_index++ )
+	{
+		if( threads[ reader_index ] == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_join(
+		     &( threads[ reader_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread: %d.",
+			 function,
+			 reader_index );
+
+			result = -1;
+		}
+		else if( ( result == 1 )
+		      && ( readers[ reader_index ].result != 1 ) )
+		{
+			result = readers[ reader_index ].result;
+		}
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Tests the input handles of a mount handle
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int ewf_test_mount_handle(
+     libcstring_system_character_t *filename,
+     const libcstring_system_character_t *number_of_threads,
+     libcerror_error_t **error )
+{
+	mount_handle_t *mount_handle = NULL;
+	static char *function        = "ewf_test_mount_handle";
+	off64_t offset               = 0;
+	int result                   = 0;
+
+	fprintf(
+	 stdout,
+	 "Testing mount handle with number of threads: %" PRIs_LIBCSTRING_SYSTEM "\t",
+	 number_of_threads );
+
+	if( mount_handle_initialize(
+	     &mount_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mount handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( mount_handle_set_number_of_threads(
+	     mount_handle,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( mount_handle_open_input(
+	     mount_handle,
+	     &filename,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open mount handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* Without a pool of input handles the reads are issued on the input handle
+	 */
+	result = 1;
+
+	if( mount_handle->input_handles != NULL )
+	{
+		result = ewf_test_mount_handle_grab_and_release(
+		          mount_handle,
+		          error );
+	}
+	for( offset = 0;
+	     ( result == 1 ) && ( offset <= EWF_TEST_MOUNT_HANDLE_MEDIA_SIZE );
+	     offset += 65535 )
+	{
+		result = ewf_test_mount_handle_read(
+		          mount_handle,
+		          offset,
+		          error );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( result == 1 )
+	{
+		result = ewf_test_mount_handle_read_concurrently(
+		          mount_handle,
+		          error );
+	}
+#endif
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	if( mount_handle_close(
+	     mount_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close mount handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( mount_handle_free(
+	     &mount_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free mount handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( result != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "(PASS)" );
+	}
+	else
+	{
+		fprintf(
+		 stdout,
+		 "(FAIL)" );
+	}
+	fprintf(
+	 stdout,
+	 "\n" );
+
+	return( result );
+
+on_error:
+	fprintf(
+	 stdout,
+	 "(FAIL)\n" );
+
+	if( mount_handle != NULL )
+	{
+		mount_handle_close(
+		 mount_handle,
+		 NULL );
+		mount_handle_free(
+		 &mount_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcstring_system_character_t filename[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	size_t filename_length   = 0;
+	int result               = 0;
+
+	if( argc < 2 )
+	{
+		fprintf(
+		 stderr,
+		 "Missing filename.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( ewf_test_mount_handle_write(
+	     argv[ 1 ],
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write test data.\n" );
+
+		goto on_error;
+	}
+	/* The first segment file has the .E01 extension
+	 */
+	filename_length = libcstring_system_string_length(
+	                   argv[ 1 ] );
+
+	if( filename_length > ( 256 - 5 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Filename too long.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( memory_copy(
+	     filename,
+	     argv[ 1 ],
+	     sizeof( libcstring_system_character_t ) * filename_length ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set filename.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	filename[ filename_length++ ] = (libcstring_system_character_t) '.';
+	filename[ filename_length++ ] = (libcstring_system_character_t) 'E';
+	filename[ filename_length++ ] = (libcstring_system_character_t) '0';
+	filename[ filename_length++ ] = (libcstring_system_character_t) '1';
+	filename[ filename_length ]   = 0;
+	result = ewf_test_mount_handle(
+	          filename,
+	          _LIBCSTRING_SYSTEM_STRING( "1" ),
+	          &error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( result == 1 )
+	{
+		result = ewf_test_mount_handle(
+		          filename,
+		          _LIBCSTRING_SYSTEM_STRING( "4" ),
+		          &error );
+	}
+#endif
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	if( result != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+}
+
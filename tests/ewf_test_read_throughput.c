@@ -0,0 +1,309 @@
+/*
+ * Expert Witness Compression Format (EWF) library read throughput program
+ *
+ * Copyright (c) 2006-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+#include <time.h>
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libcstring.h"
+#include "ewf_test_libewf.h"
+
+/* The size of the buffer used to read the media data
+ */
+#define EWF_TEST_READ_THROUGHPUT_BUFFER_SIZE	( 1024 * 1024 )
+
+/* The number of chunks read in a single batch
+ */
+#define EWF_TEST_READ_THROUGHPUT_BATCH_SIZE	64
+
+/* Retrieves the current time of the monotonic clock in seconds
+ * Returns the time in seconds
+ */
+double ewf_test_read_throughput_get_time(
+        void )
+{
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0.0 );
+	}
+	return( (double) time_value.tv_sec + ( (double) time_value.tv_nsec / 1000000000.0 ) );
+}
+
+/* The main program
+ * Reads the media data sequentially and reports the throughput
+ * Usage: ewf_test_read_throughput [ -b ] source(s)
+ * where -b reads the chunks in batches before they are read
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error     = NULL;
+	libewf_handle_t *handle      = NULL;
+	uint8_t *buffer              = NULL;
+	size64_t media_size          = 0;
+	size64_t total_read_count    = 0;
+	uint64_t chunk_index         = 0;
+	uint64_t next_batch_index    = 0;
+	size32_t chunk_size          = 0;
+	ssize_t read_count           = 0;
+	double start_time            = 0.0;
+	double elapsed_time          = 0.0;
+	int argument_index           = 1;
+	int use_batches              = 0;
+
+	if( ( argc > 1 )
+	 && ( argv[ 1 ][ 0 ] == (libcstring_system_character_t) '-' )
+	 && ( argv[ 1 ][ 1 ] == (libcstring_system_character_t) 'b' )
+	 && ( argv[ 1 ][ 2 ] == 0 ) )
+	{
+		use_batches    = 1;
+		argument_index = 2;
+	}
+	if( argc <= argument_index )
+	{
+		fprintf(
+		 stderr,
+		 "Missing filename(s).\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( libewf_handle_initialize(
+	     &handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create handle.\n" );
+
+		goto on_error;
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libewf_handle_open_wide(
+	     handle,
+	     &( argv[ argument_index ] ),
+	     argc - argument_index,
+	     LIBEWF_OPEN_READ,
+	     &error ) != 1 )
+#else
+	if( libewf_handle_open(
+	     handle,
+	     &( argv[ argument_index ] ),
+	     argc - argument_index,
+	     LIBEWF_OPEN_READ,
+	     &error ) != 1 )
+#endif
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open file(s).\n" );
+
+		goto on_error;
+	}
+	if( libewf_handle_get_media_size(
+	     handle,
+	     &media_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to retrieve media size.\n" );
+
+		goto on_error;
+	}
+	if( libewf_handle_get_chunk_size(
+	     handle,
+	     &chunk_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to retrieve chunk size.\n" );
+
+		goto on_error;
+	}
+	if( chunk_size == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid chunk size.\n" );
+
+		goto on_error;
+	}
+	if( use_batches != 0 )
+	{
+		/* Make sure the cache can hold a full batch
+		 */
+		if( libewf_handle_set_maximum_cache_size(
+		     handle,
+		     (size64_t) chunk_size * EWF_TEST_READ_THROUGHPUT_BATCH_SIZE,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set maximum cache size.\n" );
+
+			goto on_error;
+		}
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * EWF_TEST_READ_THROUGHPUT_BUFFER_SIZE );
+
+	if( buffer == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create buffer.\n" );
+
+		goto on_error;
+	}
+	start_time = ewf_test_read_throughput_get_time();
+
+	while( total_read_count < media_size )
+	{
+		if( use_batches != 0 )
+		{
+			chunk_index = total_read_count / chunk_size;
+
+			if( chunk_index >= next_batch_index )
+			{
+				if( libewf_handle_read_chunks_batch(
+				     handle,
+				     chunk_index,
+				     EWF_TEST_READ_THROUGHPUT_BATCH_SIZE,
+				     &error ) == -1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to read batch of chunks.\n" );
+
+					goto on_error;
+				}
+				next_batch_index = chunk_index + EWF_TEST_READ_THROUGHPUT_BATCH_SIZE;
+			}
+		}
+		read_count = libewf_handle_read_buffer(
+		              handle,
+		              buffer,
+		              EWF_TEST_READ_THROUGHPUT_BUFFER_SIZE,
+		              &error );
+
+		if( read_count < 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read buffer.\n" );
+
+			goto on_error;
+		}
+		else if( read_count == 0 )
+		{
+			break;
+		}
+		total_read_count += (size64_t) read_count;
+	}
+	elapsed_time = ewf_test_read_throughput_get_time() - start_time;
+
+	fprintf(
+	 stdout,
+	 "Read: %" PRIu64 " of %" PRIu64 " bytes in %.3f second(s)",
+	 total_read_count,
+	 media_size,
+	 elapsed_time );
+
+	if( elapsed_time > 0.0 )
+	{
+		fprintf(
+		 stdout,
+		 " (%.2f MiB/s)",
+		 (double) total_read_count / ( elapsed_time * 1024.0 * 1024.0 ) );
+	}
+	fprintf(
+	 stdout,
+	 "%s\n",
+	 ( use_batches != 0 ) ? " using batched reads" : "" );
+
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	if( libewf_handle_close(
+	     handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close handle.\n" );
+
+		goto on_error;
+	}
+	if( libewf_handle_free(
+	     &handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free handle.\n" );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libewf_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libewf_error_free(
+		 &error );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( handle != NULL )
+	{
+		libewf_handle_close(
+		 handle,
+		 NULL );
+		libewf_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,949 @@
+/*
+ * Expert Witness Compression Format (EWF) library single files testing program
+ *
+ * Copyright (c) 2006-2013, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libcstring.h"
+
+/* The single files functions are internal to the library and can only be tested
+ * when the library exports its internal symbols
+ */
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+#include "../libewf/libewf_single_file_entry.h"
+#include "../libewf/libewf_single_file_tree.h"
+#include "../libewf/libewf_single_files.h"
+
+/* The ltree string of a directory that contains a single file
+ * The values of the file are: size (ls), creation time (cr) and duplicate data offset (du)
+ */
+#define EWF_TEST_SINGLE_FILES_LTREE_FORMAT \
+	"5\n" \
+	"rec\n" \
+	"tb\n" \
+	"%s\n" \
+	"entry\n" \
+	"1\n" \
+	"p\tn\tls\tcr\tdu\n" \
+	"26\t1\n" \
+	"1\t\t\t\t\n" \
+	"0\t0\n" \
+	"\tfile.txt\t%s\t%s\t%s\n" \
+	"\n"
+
+#define EWF_TEST_SINGLE_FILES_LTREE_STRING_SIZE	512
+
+/* The ltree string of a tree with several directories
+ * The size (ls) of a file is used to identify the file
+ * dir1 contains 2 files named file.txt of which the first has size 1
+ * and \xe9 is stored as the Unicode character U+00e9
+ */
+#define EWF_TEST_SINGLE_FILES_LTREE_TREE_STRING \
+	"5\n" \
+	"rec\n" \
+	"tb\n" \
+	"2000\n" \
+	"entry\n" \
+	"1\n" \
+	"p\tn\tls\tcr\tdu\n" \
+	"26\t3\n" \
+	"1\t\t\t\t\n" \
+	"26\t3\n" \
+	"1\tdir1\t\t\t\n" \
+	"0\t0\n" \
+	"\tfile.txt\t1\t\t\n" \
+	"0\t0\n" \
+	"\tfile.txt\t2\t\t\n" \
+	"0\t0\n" \
+	"\ta.txt\t5\t\t\n" \
+	"26\t2\n" \
+	"1\tdir2\t\t\t\n" \
+	"0\t0\n" \
+	"\tfile.txt\t3\t\t\n" \
+	"0\t0\n" \
+	"\t\xe9t\xe9.txt\t6\t\t\n" \
+	"0\t0\n" \
+	"\tfile.txt\t4\t\t\n" \
+	"\n"
+
+/* Define to make ewf_test_single_files generate verbose output
+#define EWF_TEST_SINGLE_FILES_VERBOSE
+ */
+
+/* Creates UTF-16 little-endian ltree data from an ASCII string
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_single_files_create_ltree_data(
+     const char *string,
+     uint8_t add_byte_order_mark,
+     uint8_t use_carriage_return,
+     uint8_t **ltree_data,
+     size_t *ltree_data_size )
+{
+	size_t ltree_data_offset = 0;
+	size_t string_index      = 0;
+	size_t string_length     = 0;
+
+	string_length = libcstring_narrow_string_length(
+	                 string );
+
+	/* Each character can require a carriage return, and the byte order mark
+	 * and the end-of-string character are added
+	 */
+	*ltree_data_size = ( ( 2 * string_length ) + 2 ) * 2;
+
+	*ltree_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * *ltree_data_size );
+
+	if( *ltree_data == NULL )
+	{
+		return( -1 );
+	}
+	if( add_byte_order_mark != 0 )
+	{
+		( *ltree_data )[ ltree_data_offset++ ] = 0xff;
+		( *ltree_data )[ ltree_data_offset++ ] = 0xfe;
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( use_carriage_return != 0 )
+		 && ( string[ string_index ] == '\n' ) )
+		{
+			( *ltree_data )[ ltree_data_offset++ ] = (uint8_t) '\r';
+			( *ltree_data )[ ltree_data_offset++ ] = 0;
+		}
+		( *ltree_data )[ ltree_data_offset++ ] = (uint8_t) string[ string_index ];
+		( *ltree_data )[ ltree_data_offset++ ] = 0;
+	}
+	( *ltree_data )[ ltree_data_offset++ ] = 0;
+	( *ltree_data )[ ltree_data_offset++ ] = 0;
+
+	*ltree_data_size = ltree_data_offset;
+
+	return( 1 );
+}
+
+/* Tests parsing the ltree data of a single file
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_single_files_parse(
+     const char *media_size_string,
+     const char *size_string,
+     const char *creation_time_string,
+     const char *duplicate_data_offset_string,
+     uint8_t add_byte_order_mark,
+     uint8_t use_carriage_return,
+     int expected_result,
+     size64_t expected_size,
+     uint32_t expected_creation_time,
+     off64_t expected_duplicate_data_offset )
+{
+	char ltree_string[ EWF_TEST_SINGLE_FILES_LTREE_STRING_SIZE ];
+
+	libcdata_tree_node_t *sub_node                = NULL;
+	libcerror_error_t *error                      = NULL;
+	libewf_single_file_entry_t *single_file_entry = NULL;
+	libewf_single_files_t *single_files           = NULL;
+	uint8_t *ltree_data                           = NULL;
+	size64_t media_size                           = 0;
+	size_t ltree_data_size                        = 0;
+	uint8_t format                                = 0;
+	int print_count                               = 0;
+	int result                                    = 0;
+	int test_result                               = 0;
+
+	print_count = libcstring_narrow_string_snprintf(
+	               ltree_string,
+	               EWF_TEST_SINGLE_FILES_LTREE_STRING_SIZE,
+	               EWF_TEST_SINGLE_FILES_LTREE_FORMAT,
+	               media_size_string,
+	               size_string,
+	               creation_time_string,
+	               duplicate_data_offset_string );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= EWF_TEST_SINGLE_FILES_LTREE_STRING_SIZE ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create ltree data.\n" );
+
+		return( 0 );
+	}
+	if( ewf_test_single_files_create_ltree_data(
+	     ltree_string,
+	     add_byte_order_mark,
+	     use_carriage_return,
+	     &ltree_data,
+	     &ltree_data_size ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create ltree data.\n" );
+
+		return( 0 );
+	}
+	if( libewf_single_files_initialize(
+	     &single_files,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	result = libewf_single_files_parse_file_entries(
+	          single_files,
+	          &media_size,
+	          ltree_data,
+	          ltree_data_size,
+	          &format,
+	          &error );
+
+	if( result == expected_result )
+	{
+		test_result = 1;
+	}
+	if( ( test_result == 1 )
+	 && ( result == 1 ) )
+	{
+		if( libewf_single_file_tree_get_sub_node_by_utf8_name(
+		     NULL,
+		     single_files->root_file_entry_node,
+		     (uint8_t *) "file.txt",
+		     8,
+		     &sub_node,
+		     &single_file_entry,
+		     &error ) != 1 )
+		{
+			test_result = 0;
+		}
+		else if( ( media_size != 2000 )
+		      || ( single_file_entry->size != expected_size )
+		      || ( single_file_entry->creation_time != expected_creation_time )
+		      || ( single_file_entry->duplicate_data_offset != expected_duplicate_data_offset ) )
+		{
+			test_result = 0;
+		}
+	}
+	if( test_result == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid result parsing ltree with size: \"%s\", creation time: \"%s\" and duplicate data offset: \"%s\"%s%s.\n",
+		 size_string,
+		 creation_time_string,
+		 duplicate_data_offset_string,
+		 ( add_byte_order_mark != 0 ) ? ", byte order mark" : "",
+		 ( use_carriage_return != 0 ) ? ", CRLF" : "" );
+	}
+	if( error != NULL )
+	{
+#if defined( EWF_TEST_SINGLE_FILES_VERBOSE )
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	if( libewf_single_files_free(
+	     &single_files,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	memory_free(
+	 ltree_data );
+
+	return( test_result );
+
+on_error:
+	fprintf(
+	 stderr,
+	 "Unable to parse ltree data.\n" );
+
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( single_files != NULL )
+	{
+		libewf_single_files_free(
+		 &single_files,
+		 NULL );
+	}
+	memory_free(
+	 ltree_data );
+
+	return( 0 );
+}
+
+/* Tests parsing the ltree data of a single file with and without byte order mark
+ * and with LF and CRLF line endings
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_single_files_parse_variants(
+     const char *media_size_string,
+     const char *size_string,
+     const char *creation_time_string,
+     const char *duplicate_data_offset_string,
+     int expected_result,
+     size64_t expected_size,
+     uint32_t expected_creation_time,
+     off64_t expected_duplicate_data_offset )
+{
+	uint8_t add_byte_order_mark = 0;
+	uint8_t use_carriage_return = 0;
+
+	for( add_byte_order_mark = 0;
+	     add_byte_order_mark <= 1;
+	     add_byte_order_mark++ )
+	{
+		for( use_carriage_return = 0;
+		     use_carriage_return <= 1;
+		     use_carriage_return++ )
+		{
+			if( ewf_test_single_files_parse(
+			     media_size_string,
+			     size_string,
+			     creation_time_string,
+			     duplicate_data_offset_string,
+			     add_byte_order_mark,
+			     use_carriage_return,
+			     expected_result,
+			     expected_size,
+			     expected_creation_time,
+			     expected_duplicate_data_offset ) != 1 )
+			{
+				return( 0 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Tests retrieving a sub node by its UTF-8 and UTF-16 name
+ * with and without the index
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_single_files_get_sub_node_by_name(
+     libewf_single_file_tree_index_t *index,
+     libcdata_tree_node_t *node,
+     const uint8_t *utf8_name,
+     const uint16_t *utf16_name,
+     int expected_result,
+     size64_t expected_size,
+     libcdata_tree_node_t **sub_node )
+{
+	libcdata_tree_node_t *utf16_sub_node                = NULL;
+	libcdata_tree_node_t *utf8_sub_node                 = NULL;
+	libcerror_error_t *error                            = NULL;
+	libewf_single_file_entry_t *utf16_single_file_entry = NULL;
+	libewf_single_file_entry_t *utf8_single_file_entry  = NULL;
+	size_t utf16_name_length                            = 0;
+	size_t utf8_name_length                             = 0;
+	int test_result                                     = 1;
+	int utf16_result                                    = 0;
+	int utf8_result                                     = 0;
+
+	utf8_name_length = libcstring_narrow_string_length(
+	                    (char *) utf8_name );
+
+	while( utf16_name[ utf16_name_length ] != 0 )
+	{
+		utf16_name_length++;
+	}
+	utf8_result = libewf_single_file_tree_get_sub_node_by_utf8_name(
+	               index,
+	               node,
+	               utf8_name,
+	               utf8_name_length,
+	               &utf8_sub_node,
+	               &utf8_single_file_entry,
+	               &error );
+
+	utf16_result = libewf_single_file_tree_get_sub_node_by_utf16_name(
+	                index,
+	                node,
+	                utf16_name,
+	                utf16_name_length,
+	                &utf16_sub_node,
+	                &utf16_single_file_entry,
+	                &error );
+
+	if( ( utf8_result != expected_result )
+	 || ( utf16_result != expected_result )
+	 || ( utf8_sub_node != utf16_sub_node ) )
+	{
+		test_result = 0;
+	}
+	else if( ( expected_result == 1 )
+	      && ( utf8_single_file_entry->size != expected_size ) )
+	{
+		test_result = 0;
+	}
+	if( test_result == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid result retrieving sub node by name: \"%s\"%s.\n",
+		 (char *) utf8_name,
+		 ( index != NULL ) ? " with index" : "" );
+	}
+	if( error != NULL )
+	{
+#if defined( EWF_TEST_SINGLE_FILES_VERBOSE )
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	if( sub_node != NULL )
+	{
+		*sub_node = utf8_sub_node;
+	}
+	return( test_result );
+}
+
+/* Tests retrieving sub nodes by name from a tree with several directories
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_single_files_tree_index(
+     uint8_t use_index )
+{
+	uint16_t utf16_a_name[ 6 ]        = { 'a', '.', 't', 'x', 't', 0 };
+	uint16_t utf16_dir1_name[ 5 ]     = { 'd', 'i', 'r', '1', 0 };
+	uint16_t utf16_dir2_name[ 5 ]     = { 'd', 'i', 'r', '2', 0 };
+	uint16_t utf16_file_name[ 9 ]     = { 'f', 'i', 'l', 'e', '.', 't', 'x', 't', 0 };
+	uint16_t utf16_missing_name[ 12 ] = { 'm', 'i', 's', 's', 'i', 'n', 'g', '.', 't', 'x', 't', 0 };
+	uint16_t utf16_unicode_name[ 8 ]  = { 0x00e9, 't', 0x00e9, '.', 't', 'x', 't', 0 };
+
+	libcdata_tree_node_t *dir1_node        = NULL;
+	libcdata_tree_node_t *dir2_node        = NULL;
+	libcdata_tree_node_t *root_node        = NULL;
+	libcerror_error_t *error               = NULL;
+	libewf_single_file_tree_index_t *index = NULL;
+	libewf_single_files_t *single_files    = NULL;
+	uint8_t *ltree_data                    = NULL;
+	size64_t media_size                    = 0;
+	size_t ltree_data_size                 = 0;
+	uint8_t format                         = 0;
+	int test_result                        = 0;
+
+	if( ewf_test_single_files_create_ltree_data(
+	     EWF_TEST_SINGLE_FILES_LTREE_TREE_STRING,
+	     0,
+	     0,
+	     &ltree_data,
+	     &ltree_data_size ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create ltree data.\n" );
+
+		return( 0 );
+	}
+	if( libewf_single_files_initialize(
+	     &single_files,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libewf_single_files_parse_file_entries(
+	     single_files,
+	     &media_size,
+	     ltree_data,
+	     ltree_data_size,
+	     &format,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	root_node = single_files->root_file_entry_node;
+
+	if( use_index != 0 )
+	{
+		if( libewf_single_file_tree_index_initialize(
+		     &index,
+		     root_node,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	test_result = 1;
+
+	if( ( ewf_test_single_files_get_sub_node_by_name(
+	       index,
+	       root_node,
+	       (uint8_t *) "dir1",
+	       utf16_dir1_name,
+	       1,
+	       0,
+	       &dir1_node ) != 1 )
+	 || ( ewf_test_single_files_get_sub_node_by_name(
+	       index,
+	       root_node,
+	       (uint8_t *) "dir2",
+	       utf16_dir2_name,
+	       1,
+	       0,
+	       &dir2_node ) != 1 ) )
+	{
+		test_result = 0;
+	}
+	/* Identically named sub nodes of different directories are distinguished
+	 * and of identically named sub nodes of the same directory the first is retrieved
+	 */
+	else if( ( ewf_test_single_files_get_sub_node_by_name(
+	            index,
+	            root_node,
+	            (uint8_t *) "file.txt",
+	            utf16_file_name,
+	            1,
+	            4,
+	            NULL ) != 1 )
+	      || ( ewf_test_single_files_get_sub_node_by_name(
+	            index,
+	            dir1_node,
+	            (uint8_t *) "file.txt",
+	            utf16_file_name,
+	            1,
+	            1,
+	            NULL ) != 1 )
+	      || ( ewf_test_single_files_get_sub_node_by_name(
+	            index,
+	            dir2_node,
+	            (uint8_t *) "file.txt",
+	            utf16_file_name,
+	            1,
+	            3,
+	            NULL ) != 1 ) )
+	{
+		test_result = 0;
+	}
+	else if( ( ewf_test_single_files_get_sub_node_by_name(
+	            index,
+	            dir1_node,
+	            (uint8_t *) "a.txt",
+	            utf16_a_name,
+	            1,
+	            5,
+	            NULL ) != 1 )
+	      || ( ewf_test_single_files_get_sub_node_by_name(
+	            index,
+	            dir2_node,
+	            (uint8_t *) "\xc3\xa9t\xc3\xa9.txt",
+	            utf16_unicode_name,
+	            1,
+	            6,
+	            NULL ) != 1 ) )
+	{
+		test_result = 0;
+	}
+	/* Names that are not in the directory are not found
+	 */
+	else if( ( ewf_test_single_files_get_sub_node_by_name(
+	            index,
+	            root_node,
+	            (uint8_t *) "missing.txt",
+	            utf16_missing_name,
+	            0,
+	            0,
+	            NULL ) != 1 )
+	      || ( ewf_test_single_files_get_sub_node_by_name(
+	            index,
+	            dir2_node,
+	            (uint8_t *) "a.txt",
+	            utf16_a_name,
+	            0,
+	            0,
+	            NULL ) != 1 )
+	      || ( ewf_test_single_files_get_sub_node_by_name(
+	            index,
+	            root_node,
+	            (uint8_t *) "\xc3\xa9t\xc3\xa9.txt",
+	            utf16_unicode_name,
+	            0,
+	            0,
+	            NULL ) != 1 ) )
+	{
+		test_result = 0;
+	}
+	if( test_result == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid result retrieving sub nodes by name%s.\n",
+		 ( use_index != 0 ) ? " with index" : "" );
+	}
+	if( index != NULL )
+	{
+		if( libewf_single_file_tree_index_free(
+		     &index,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( libewf_single_files_free(
+	     &single_files,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	memory_free(
+	 ltree_data );
+
+	return( test_result );
+
+on_error:
+	fprintf(
+	 stderr,
+	 "Unable to test sub nodes by name.\n" );
+
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( index != NULL )
+	{
+		libewf_single_file_tree_index_free(
+		 &index,
+		 NULL );
+	}
+	if( single_files != NULL )
+	{
+		libewf_single_files_free(
+		 &single_files,
+		 NULL );
+	}
+	memory_free(
+	 ltree_data );
+
+	return( 0 );
+}
+
+/* Tests retrieving sub nodes by name from the index when a sub node has a name
+ * that is not valid UTF-8
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_single_files_tree_index_invalid_name(
+     void )
+{
+	uint16_t utf16_a_name[ 6 ]    = { 'a', '.', 't', 'x', 't', 0 };
+	uint16_t utf16_dir1_name[ 5 ] = { 'd', 'i', 'r', '1', 0 };
+	uint16_t utf16_file_name[ 9 ] = { 'f', 'i', 'l', 'e', '.', 't', 'x', 't', 0 };
+
+	libcdata_tree_node_t *dir1_node               = NULL;
+	libcdata_tree_node_t *sub_node                = NULL;
+	libcerror_error_t *error                      = NULL;
+	libewf_single_file_entry_t *single_file_entry = NULL;
+	libewf_single_file_tree_index_t *index        = NULL;
+	libewf_single_files_t *single_files           = NULL;
+	uint8_t *ltree_data                           = NULL;
+	size64_t media_size                           = 0;
+	size_t ltree_data_size                        = 0;
+	uint8_t format                                = 0;
+	int test_result                               = 1;
+
+	if( ewf_test_single_files_create_ltree_data(
+	     EWF_TEST_SINGLE_FILES_LTREE_TREE_STRING,
+	     0,
+	     0,
+	     &ltree_data,
+	     &ltree_data_size ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create ltree data.\n" );
+
+		return( 0 );
+	}
+	if( libewf_single_files_initialize(
+	     &single_files,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libewf_single_files_parse_file_entries(
+	     single_files,
+	     &media_size,
+	     ltree_data,
+	     ltree_data_size,
+	     &format,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libewf_single_file_tree_get_sub_node_by_utf8_name(
+	     NULL,
+	     single_files->root_file_entry_node,
+	     (uint8_t *) "dir1",
+	     4,
+	     &dir1_node,
+	     &single_file_entry,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libewf_single_file_tree_get_sub_node_by_utf8_name(
+	     NULL,
+	     dir1_node,
+	     (uint8_t *) "a.txt",
+	     5,
+	     &sub_node,
+	     &single_file_entry,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* Change the name a.txt into a.tx followed by a byte that is not valid UTF-8
+	 */
+	single_file_entry->name[ 4 ] = 0xff;
+
+	if( libewf_single_file_tree_index_initialize(
+	     &index,
+	     single_files->root_file_entry_node,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The sub node with the name that is not valid UTF-8 is not in the index
+	 * and cannot be retrieved by name, the other sub nodes can
+	 */
+	if( ( ewf_test_single_files_get_sub_node_by_name(
+	       index,
+	       dir1_node,
+	       (uint8_t *) "a.txt",
+	       utf16_a_name,
+	       0,
+	       0,
+	       NULL ) != 1 )
+	 || ( ewf_test_single_files_get_sub_node_by_name(
+	       index,
+	       dir1_node,
+	       (uint8_t *) "file.txt",
+	       utf16_file_name,
+	       1,
+	       1,
+	       NULL ) != 1 )
+	 || ( ewf_test_single_files_get_sub_node_by_name(
+	       index,
+	       single_files->root_file_entry_node,
+	       (uint8_t *) "dir1",
+	       utf16_dir1_name,
+	       1,
+	       0,
+	       NULL ) != 1 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid result retrieving sub nodes by name with a name that is not valid UTF-8.\n" );
+
+		test_result = 0;
+	}
+	if( libewf_single_file_tree_index_free(
+	     &index,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libewf_single_files_free(
+	     &single_files,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	memory_free(
+	 ltree_data );
+
+	return( test_result );
+
+on_error:
+	fprintf(
+	 stderr,
+	 "Unable to test sub nodes by name.\n" );
+
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( index != NULL )
+	{
+		libewf_single_file_tree_index_free(
+		 &index,
+		 NULL );
+	}
+	if( single_files != NULL )
+	{
+		libewf_single_files_free(
+		 &single_files,
+		 NULL );
+	}
+	memory_free(
+	 ltree_data );
+
+	return( 0 );
+}
+
+#endif
+
+/* The main program
+ */
+int main( void )
+{
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+	if( ewf_test_single_files_parse_variants(
+	     "2000",
+	     "1024",
+	     "1357000000",
+	     "4096",
+	     1,
+	     1024,
+	     1357000000UL,
+	     4096 ) != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+	/* Values that are not a supported number are ignored for the optional values
+	 * and the duplicate data offset remains -1
+	 */
+	if( ewf_test_single_files_parse_variants(
+	     "2000",
+	     " 1",
+	     "-1",
+	     "1 5 6",
+	     1,
+	     0,
+	     0,
+	     -1 ) != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+	/* The largest values that fit in the integer values
+	 */
+	if( ewf_test_single_files_parse_variants(
+	     "2000",
+	     "18446744073709551615",
+	     "4294967295",
+	     "9223372036854775807",
+	     1,
+	     (size64_t) UINT64_MAX,
+	     (uint32_t) UINT32_MAX,
+	     (off64_t) INT64_MAX ) != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+	/* Values that exceed the integer values are ignored for the optional values
+	 */
+	if( ewf_test_single_files_parse_variants(
+	     "2000",
+	     "18446744073709551616",
+	     "4294967296",
+	     "99999999999999999999",
+	     1,
+	     0,
+	     0,
+	     -1 ) != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+	if( ewf_test_single_files_parse_variants(
+	     "2000",
+	     "184467440737095516150",
+	     "42949672950",
+	     "",
+	     1,
+	     0,
+	     0,
+	     -1 ) != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+	/* Values that are not a supported number are an error for the media size
+	 */
+	if( ewf_test_single_files_parse_variants(
+	     "2x00",
+	     "1024",
+	     "1357000000",
+	     "4096",
+	     -1,
+	     0,
+	     0,
+	     0 ) != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+	if( ewf_test_single_files_parse_variants(
+	     "18446744073709551616",
+	     "1024",
+	     "1357000000",
+	     "4096",
+	     -1,
+	     0,
+	     0,
+	     0 ) != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+	/* Retrieving sub nodes by name without and with the index
+	 */
+	if( ewf_test_single_files_tree_index(
+	     0 ) != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+	if( ewf_test_single_files_tree_index(
+	     1 ) != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+	if( ewf_test_single_files_tree_index_invalid_name() != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+#endif
+	return( EXIT_SUCCESS );
+}
+
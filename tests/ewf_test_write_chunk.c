@@ -199,6 +199,11 @@ int ewf_test_write_chunk(
 
 			goto on_error;
 		}
+		/* The compressed chunk buffer size is updated to the size of the compressed data
+		 * and must contain the size of the buffer on entry
+		 */
+		compressed_chunk_buffer_size = chunk_buffer_size * 2;
+
 		process_count = libewf_handle_prepare_write_chunk(
 				 handle,
 				 chunk_buffer,
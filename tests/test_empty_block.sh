@@ -0,0 +1,63 @@
+#!/bin/bash
+#
+# Expert Witness Compression Format (EWF) library empty block testing script
+#
+# Copyright (c) 2006-2013, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This software is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This software is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this software.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+EXIT_SUCCESS=0;
+EXIT_FAILURE=1;
+EXIT_IGNORE=77;
+
+test_empty_block()
+{ 
+	echo -n "Testing empty block functions";
+
+	./${EWF_TEST_EMPTY_BLOCK};
+
+	RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		echo " (FAIL)";
+	else
+		echo " (PASS)";
+	fi
+	return ${RESULT};
+}
+
+EWF_TEST_EMPTY_BLOCK="ewf_test_empty_block";
+
+if ! test -x ${EWF_TEST_EMPTY_BLOCK};
+then
+	EWF_TEST_EMPTY_BLOCK="ewf_test_empty_block.exe";
+fi
+
+if ! test -x ${EWF_TEST_EMPTY_BLOCK};
+then
+	echo "Missing executable: ${EWF_TEST_EMPTY_BLOCK}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+if ! test_empty_block;
+then
+	exit ${EXIT_FAILURE};
+fi
+
+exit ${EXIT_SUCCESS};
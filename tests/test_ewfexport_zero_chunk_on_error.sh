@@ -0,0 +1,196 @@
+#!/bin/bash
+#
+# ewfexport zero chunk on error testing script
+#
+# Copyright (c) 2006-2013, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This software is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This software is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this software.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+EXIT_SUCCESS=0;
+EXIT_FAILURE=1;
+EXIT_IGNORE=77;
+
+TMP="tmp";
+
+CMP="cmp";
+CUT="cut";
+DD="dd";
+GREP="grep";
+HEAD="head";
+
+CHUNK_SIZE=32768;
+NUMBER_OF_CHUNKS=16;
+CORRUPTED_CHUNK=5;
+MARKER="EWFTESTCORRUPTEDCHUNKMARKER";
+
+# Creates an image with a corrupted chunk and the raw data that
+# is expected to be exported from it when the chunk is zeroed
+create_corrupted_image()
+{
+	COMPRESSION_LEVEL=$1;
+
+	${DD} if=/dev/zero of=${TMP}/input.raw bs=${CHUNK_SIZE} count=${NUMBER_OF_CHUNKS} 2> /dev/null;
+
+	# The random data is not compressible hence the chunk is stored uncompressed
+	# which allows to corrupt it by the marker
+	(echo -n ${MARKER}; ${HEAD} -c $(( ${CHUNK_SIZE} - ${#MARKER} )) /dev/urandom) | \
+	${DD} of=${TMP}/input.raw bs=${CHUNK_SIZE} seek=${CORRUPTED_CHUNK} conv=notrunc 2> /dev/null;
+
+	${EWFACQUIRE} -q -u -c deflate:${COMPRESSION_LEVEL} -f encase6 -t ${TMP}/corrupted ${TMP}/input.raw > /dev/null;
+
+	if test $? -ne ${EXIT_SUCCESS};
+	then
+		return ${EXIT_FAILURE};
+	fi
+	MARKER_OFFSET=`${GREP} -obUa ${MARKER} ${TMP}/corrupted.E01 | ${CUT} -d ':' -f 1`;
+
+	if test -z "${MARKER_OFFSET}";
+	then
+		return ${EXIT_FAILURE};
+	fi
+	echo -n "X" | ${DD} of=${TMP}/corrupted.E01 bs=1 seek=$(( ${MARKER_OFFSET} + 128 )) conv=notrunc 2> /dev/null;
+
+	cp ${TMP}/input.raw ${TMP}/expected.raw;
+
+	${DD} if=/dev/zero of=${TMP}/expected.raw bs=${CHUNK_SIZE} seek=${CORRUPTED_CHUNK} count=1 conv=notrunc 2> /dev/null;
+
+	return ${EXIT_SUCCESS};
+}
+
+test_export_raw_zero_chunk_on_error()
+{
+	NUMBER_OF_THREADS=$1;
+
+	mkdir ${TMP};
+
+	create_corrupted_image best;
+
+	RESULT=$?;
+
+	if test ${RESULT} -eq ${EXIT_SUCCESS};
+	then
+		${EWFEXPORT} -q -u -w -j ${NUMBER_OF_THREADS} -f raw -t ${TMP}/export ${TMP}/corrupted.E01 > /dev/null;
+
+		RESULT=$?;
+	fi
+	if test ${RESULT} -eq ${EXIT_SUCCESS};
+	then
+		${CMP} -s ${TMP}/export.raw ${TMP}/expected.raw;
+
+		RESULT=$?;
+	fi
+
+	rm -rf ${TMP};
+
+	echo -n "Testing ewfexport to raw with zero chunk on error and number of threads: ${NUMBER_OF_THREADS} ";
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		echo " (FAIL)";
+	else
+		echo " (PASS)";
+	fi
+	return ${RESULT};
+}
+
+# The input and output use the same format, chunk size and compression
+# hence the chunks are passed through
+test_export_ewf_zero_chunk_on_error()
+{
+	NUMBER_OF_THREADS=$1;
+
+	mkdir ${TMP};
+
+	create_corrupted_image best;
+
+	RESULT=$?;
+
+	if test ${RESULT} -eq ${EXIT_SUCCESS};
+	then
+		${EWFEXPORT} -q -u -w -j ${NUMBER_OF_THREADS} -c deflate:best -f encase6 -t ${TMP}/export ${TMP}/corrupted.E01 > /dev/null;
+
+		RESULT=$?;
+	fi
+	if test ${RESULT} -eq ${EXIT_SUCCESS};
+	then
+		${EWFEXPORT} -q -u -f raw -t ${TMP}/export ${TMP}/export.E01 > /dev/null;
+
+		RESULT=$?;
+	fi
+	if test ${RESULT} -eq ${EXIT_SUCCESS};
+	then
+		${CMP} -s ${TMP}/export.raw ${TMP}/expected.raw;
+
+		RESULT=$?;
+	fi
+
+	rm -rf ${TMP};
+
+	echo -n "Testing ewfexport to ewf format: encase6 with zero chunk on error and number of threads: ${NUMBER_OF_THREADS} ";
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		echo " (FAIL)";
+	else
+		echo " (PASS)";
+	fi
+	return ${RESULT};
+}
+
+EWFACQUIRE="../ewftools/ewfacquire";
+
+if ! test -x ${EWFACQUIRE};
+then
+	EWFACQUIRE="../ewftools/ewfacquire.exe"
+fi
+
+if ! test -x ${EWFACQUIRE};
+then
+	echo "Missing executable: ${EWFACQUIRE}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+EWFEXPORT="../ewftools/ewfexport";
+
+if ! test -x ${EWFEXPORT};
+then
+	EWFEXPORT="../ewftools/ewfexport.exe"
+fi
+
+if ! test -x ${EWFEXPORT};
+then
+	echo "Missing executable: ${EWFEXPORT}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+for NUMBER_OF_THREADS in 0 3;
+do
+	if ! test_export_raw_zero_chunk_on_error ${NUMBER_OF_THREADS};
+	then
+		exit ${EXIT_FAILURE};
+	fi
+
+	if ! test_export_ewf_zero_chunk_on_error ${NUMBER_OF_THREADS};
+	then
+		exit ${EXIT_FAILURE};
+	fi
+done
+
+exit ${EXIT_SUCCESS};
+
@@ -0,0 +1,226 @@
+#!/bin/bash
+#
+# Expert Witness Compression Format (EWF) library index file testing script
+#
+# Copyright (c) 2006-2012, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This software is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This software is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this software.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+EXIT_SUCCESS=0;
+EXIT_FAILURE=1;
+EXIT_IGNORE=77;
+
+TMP="tmp";
+
+CMP="cmp";
+DD="dd";
+FIND="find";
+LS="ls";
+SEQ="seq";
+TOUCH="touch";
+TR="tr";
+
+write_image()
+{
+	NUMBER_OF_LINES=$1;
+
+	rm -f ${TMP}/input.raw ${TMP}/write.E*;
+
+	${SEQ} 1 ${NUMBER_OF_LINES} > ${TMP}/input.raw;
+
+	${EWFACQUIRE} -q -u -c none -S 1MiB -t ${TMP}/write ${TMP}/input.raw > /dev/null;
+
+	return $?;
+}
+
+test_index_file()
+{
+	DESCRIPTION=$1;
+
+	FILENAMES=`${LS} ${TMP}/write.E* | ${TR} '\n' ' '`;
+
+	./${EWF_TEST_INDEX_FILE} -i ${TMP}/write.idx ${FILENAMES};
+
+	RESULT=$?;
+
+	if [ ${RESULT} -eq ${EXIT_SUCCESS} ] && [ ! -f ${TMP}/write.idx ];
+	then
+		RESULT=${EXIT_FAILURE};
+	fi
+
+	echo -n "Testing index file: ${DESCRIPTION} ";
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		echo " (FAIL)";
+	else
+		echo " (PASS)";
+	fi
+	return ${RESULT};
+}
+
+test_index_file_compare()
+{
+	DESCRIPTION=$1;
+	EXPECTED=$2;
+
+	${CMP} -s ${TMP}/write.idx ${TMP}/write.idx.orig;
+
+	CMP_RESULT=$?;
+
+	if [ ${EXPECTED} = "same" ];
+	then
+		EXPECTED=${EXIT_SUCCESS};
+	else
+		EXPECTED=${EXIT_FAILURE};
+	fi
+
+	echo -n "Testing index file: ${DESCRIPTION} ";
+
+	if test ${CMP_RESULT} -ne ${EXPECTED};
+	then
+		echo " (FAIL)";
+
+		return ${EXIT_FAILURE};
+	fi
+	echo " (PASS)";
+
+	return ${EXIT_SUCCESS};
+}
+
+EWFACQUIRE="../ewftools/ewfacquire";
+
+if ! test -x ${EWFACQUIRE};
+then
+	EWFACQUIRE="../ewftools/ewfacquire.exe"
+fi
+
+if ! test -x ${EWFACQUIRE};
+then
+	echo "Missing executable: ${EWFACQUIRE}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+EWF_TEST_INDEX_FILE="ewf_test_index_file";
+
+if ! test -x ${EWF_TEST_INDEX_FILE};
+then
+	EWF_TEST_INDEX_FILE="ewf_test_index_file.exe";
+fi
+
+if ! test -x ${EWF_TEST_INDEX_FILE};
+then
+	echo "Missing executable: ${EWF_TEST_INDEX_FILE}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+rm -rf ${TMP};
+mkdir ${TMP};
+
+RESULT=${EXIT_SUCCESS};
+
+if ! write_image 400000;
+then
+	RESULT=${EXIT_FAILURE};
+fi
+
+# Create the index file and read it back
+if [ ${RESULT} -eq ${EXIT_SUCCESS} ];
+then
+	if ! test_index_file "create";
+	then
+		RESULT=${EXIT_FAILURE};
+	fi
+	cp ${TMP}/write.idx ${TMP}/write.idx.orig;
+fi
+
+# A valid index file is used and not recreated
+if [ ${RESULT} -eq ${EXIT_SUCCESS} ];
+then
+	${TOUCH} -t 200001010000 ${TMP}/write.idx;
+
+	if ! test_index_file "read";
+	then
+		RESULT=${EXIT_FAILURE};
+	elif ! test_index_file_compare "read unchanged" same;
+	then
+		RESULT=${EXIT_FAILURE};
+	else
+		echo -n "Testing index file: read not recreated ";
+
+		if test -n "`${FIND} ${TMP} -name write.idx -newer ${TMP}/input.raw`";
+		then
+			echo " (FAIL)";
+
+			RESULT=${EXIT_FAILURE};
+		else
+			echo " (PASS)";
+		fi
+	fi
+fi
+
+# A corrupt index file is recreated
+if [ ${RESULT} -eq ${EXIT_SUCCESS} ];
+then
+	echo "corrupt" | ${DD} of=${TMP}/write.idx bs=1 seek=64 conv=notrunc 2> /dev/null;
+
+	if ! test_index_file "corrupt";
+	then
+		RESULT=${EXIT_FAILURE};
+	elif ! test_index_file_compare "corrupt recreated" same;
+	then
+		RESULT=${EXIT_FAILURE};
+	fi
+fi
+
+# A truncated index file is recreated
+if [ ${RESULT} -eq ${EXIT_SUCCESS} ];
+then
+	${DD} if=${TMP}/write.idx.orig of=${TMP}/write.idx bs=1 count=48 2> /dev/null;
+
+	if ! test_index_file "truncated";
+	then
+		RESULT=${EXIT_FAILURE};
+	elif ! test_index_file_compare "truncated recreated" same;
+	then
+		RESULT=${EXIT_FAILURE};
+	fi
+fi
+
+# A stale index file of different segment files is not used and recreated
+if [ ${RESULT} -eq ${EXIT_SUCCESS} ];
+then
+	if ! write_image 300000;
+	then
+		RESULT=${EXIT_FAILURE};
+
+	elif ! test_index_file "stale";
+	then
+		RESULT=${EXIT_FAILURE};
+
+	elif ! test_index_file_compare "stale recreated" different;
+	then
+		RESULT=${EXIT_FAILURE};
+	fi
+fi
+
+rm -rf ${TMP};
+
+exit ${RESULT};
+